@@ -1,6 +1,8 @@
 #include <iostream>
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
+#include <commons/ShaderVariants.h>
+#include <commons/StatsOverlay.h>
 #include <cmath>
 #include <vector>
 
@@ -35,6 +37,8 @@ bool initGLAD() {
         std::cerr << "Erro ao inicializar o GLAD" << std::endl;
         return false;
     }
+    // Contadores do HUD (F3)
+    GlIntercept::install();
     return true;
 }
 
@@ -145,6 +149,12 @@ std::vector<float> createCircleVerticesToStar() {
 
 // Função para criar um programa de shader
 GLuint createShaderProgram(const char* vertexShaderSource, const char* fragmentShaderSource) {
+    // Reaproveita o binário de uma execução anterior, se o driver aceitar
+    GLuint cachedProgram = ShaderCache::load(vertexShaderSource, fragmentShaderSource);
+    if (cachedProgram != 0) {
+        return cachedProgram;
+    }
+
     GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
     glShaderSource(vertexShader, 1, &vertexShaderSource, nullptr);
     glCompileShader(vertexShader);
@@ -156,11 +166,14 @@ GLuint createShaderProgram(const char* vertexShaderSource, const char* fragmentS
     GLuint shaderProgram = glCreateProgram();
     glAttachShader(shaderProgram, vertexShader);
     glAttachShader(shaderProgram, fragmentShader);
+    ShaderCache::prepare(shaderProgram);
     glLinkProgram(shaderProgram);
 
     glDeleteShader(vertexShader);
     glDeleteShader(fragmentShader);
 
+    ShaderCache::save(shaderProgram, vertexShaderSource, fragmentShaderSource);
+
     return shaderProgram;
 }
 
@@ -308,24 +321,18 @@ int main() {
     glViewport(0, 0, WINDOW_WIDTH, WINDOW_HEIGHT);
     glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
 
-    const char* vertexShaderSource = R"(
-        #version 330 core
-        layout (location = 0) in vec2 aPos;
-        void main() {
-            gl_Position = vec4(aPos.x, aPos.y, 0.0, 1.0);
-        }
-    )";
-
-    const char* fragmentShaderSource = R"(
-        #version 330 core
-        out vec4 FragColor;
-        uniform vec3 shapeColor;
-        void main() {
-            FragColor = vec4(shapeColor, 1.0);
-        }
-    )";
+    // Variante do uber-shader de arkanoide/shaders: só cor uniforme, sem transformação
+    std::string vertexShaderSource = shaderVariantSource(UBER_VERTEX_SHADER, ShaderFeature::None);
+    std::string fragmentShaderSource = shaderVariantSource(UBER_FRAGMENT_SHADER, ShaderFeature::None);
+
+    GLuint shaderProgram = createShaderProgram(vertexShaderSource.c_str(), fragmentShaderSource.c_str());
 
-    GLuint shaderProgram = createShaderProgram(vertexShaderSource, fragmentShaderSource);
+    // HUD de estatísticas, alternado com F3
+    std::string overlayVertexSource = shaderVariantSource(UBER_VERTEX_SHADER, ShaderFeature::Instanced);
+    std::string overlayFragmentSource = shaderVariantSource(UBER_FRAGMENT_SHADER, ShaderFeature::Instanced);
+    GLuint overlayProgram = createShaderProgram(overlayVertexSource.c_str(), overlayFragmentSource.c_str());
+    StatsOverlay overlay;
+    overlay.create();
     
 
     while (!glfwWindowShouldClose(window)) {
@@ -338,11 +345,16 @@ int main() {
         exE(shaderProgram);
 
 
+        overlay.handleKeys(window);
+        overlay.draw(overlayProgram, WINDOW_WIDTH, WINDOW_HEIGHT);
+
         glfwSwapBuffers(window);
         glfwPollEvents();
     }
 
     glDeleteProgram(shaderProgram);
+    overlay.destroy();
+    glDeleteProgram(overlayProgram);
     glfwTerminate();
     return 0;
 }
\ No newline at end of file
@@ -1,6 +1,8 @@
 #include <iostream>
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
+#include <commons/ShaderVariants.h>
+#include <commons/StatsOverlay.h>
 #include <vector>
 
 const int WINDOW_WIDTH = 800;
@@ -34,11 +36,19 @@ bool initGLAD() {
         std::cerr << "Erro ao inicializar o GLAD" << std::endl;
         return false;
     }
+    // Contadores do HUD (F3)
+    GlIntercept::install();
     return true;
 }
 
 
 GLuint createShaderProgram(const char* vertexShaderSource, const char* fragmentShaderSource) {
+    // Reaproveita o binário de uma execução anterior, se o driver aceitar
+    GLuint cachedProgram = ShaderCache::load(vertexShaderSource, fragmentShaderSource);
+    if (cachedProgram != 0) {
+        return cachedProgram;
+    }
+
     GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
     glShaderSource(vertexShader, 1, &vertexShaderSource, nullptr);
     glCompileShader(vertexShader);
@@ -50,15 +60,18 @@ GLuint createShaderProgram(const char* vertexShaderSource, const char* fragmentS
     GLuint shaderProgram = glCreateProgram();
     glAttachShader(shaderProgram, vertexShader);
     glAttachShader(shaderProgram, fragmentShader);
+    ShaderCache::prepare(shaderProgram);
     glLinkProgram(shaderProgram);
 
     glDeleteShader(vertexShader);
     glDeleteShader(fragmentShader);
 
+    ShaderCache::save(shaderProgram, vertexShaderSource, fragmentShaderSource);
+
     return shaderProgram;
 }
 
-void renderShape(GLuint shaderProgram, std::vector<float> vertices, GLenum primitiveType, std::vector<GLuint> indices) {
+void renderShape(GLuint shaderProgram, const std::vector<float>& vertices, GLenum primitiveType, const std::vector<GLuint>& indices) {
 
     
     GLuint VAO, VBO, EBO; 
@@ -107,32 +120,18 @@ int main() {
     glViewport(0, 0, WINDOW_WIDTH, WINDOW_HEIGHT);
     glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
 
-    const char* vertexShaderSource = R"(
-        #version 330 core
-
-        in vec3 inPosition;  // Atributo de posição
-        in vec3 inColor;     // Atributo de cor
-
-        out vec3 fragColor;  // Saída para o fragment shader
+    // Variante do uber-shader de arkanoide/shaders: cor por vértice
+    std::string vertexShaderSource = shaderVariantSource(UBER_VERTEX_SHADER, ShaderFeature::VertexColor);
+    std::string fragmentShaderSource = shaderVariantSource(UBER_FRAGMENT_SHADER, ShaderFeature::VertexColor);
 
-        void main() {
-            gl_Position = vec4(inPosition, 1.0);
-            fragColor = inColor;
-        }
-    )";
+    GLuint shaderProgram = createShaderProgram(vertexShaderSource.c_str(), fragmentShaderSource.c_str());
 
-    const char* fragmentShaderSource = R"(
-        #version 330 core
-
-        in vec3 fragColor;  // Entrada do vertex shader
-        out vec4 outColor;  // Saída para a tela
-
-        void main() {
-            outColor = vec4(fragColor, 1.0);
-        }
-    )";
-
-    GLuint shaderProgram = createShaderProgram(vertexShaderSource, fragmentShaderSource);
+    // HUD de estatísticas, alternado com F3
+    std::string overlayVertexSource = shaderVariantSource(UBER_VERTEX_SHADER, ShaderFeature::Instanced);
+    std::string overlayFragmentSource = shaderVariantSource(UBER_FRAGMENT_SHADER, ShaderFeature::Instanced);
+    GLuint overlayProgram = createShaderProgram(overlayVertexSource.c_str(), overlayFragmentSource.c_str());
+    StatsOverlay overlay;
+    overlay.create();
     
     // Vetores de vértices para o triângulo e pontos
     std::vector<float> triangleVertices = {
@@ -159,11 +158,16 @@ int main() {
         renderShape(shaderProgram, pointVertices, GL_POINTS, pointIndices);
         renderShape(shaderProgram, triangleVertices, GL_LINE_LOOP, triangleIndices);
 
+        overlay.handleKeys(window);
+        overlay.draw(overlayProgram, WINDOW_WIDTH, WINDOW_HEIGHT);
+
         glfwSwapBuffers(window);
         glfwPollEvents();
     }
 
     glDeleteProgram(shaderProgram);
+    overlay.destroy();
+    glDeleteProgram(overlayProgram);
     glfwTerminate();
     return 0;
 }
\ No newline at end of file
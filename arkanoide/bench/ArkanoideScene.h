@@ -0,0 +1,148 @@
+// Cena do jogo: o mesmo pipeline de main.cpp (simulação a 1 kHz, blocos numa camada
+// persistente que só reenvia o que mudou, submissão ao Renderer na sua própria thread),
+// com tabuleiro e número de bolas parametrizados, sem entrada do teclado e sem partículas.
+
+#pragma once
+
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <commons/CommandBuffer.h>
+#include <commons/FrameArena.h>
+#include <commons/InstanceLayer.h>
+#include <commons/JobSystem.h>
+#include <commons/RenderBackend.h>
+#include "Ball.h"
+#include "BallPool.h"
+#include "Block.h"
+#include "Board.h"
+#include "Paddle.h"
+
+#include "Scene.h"
+
+class ArkanoideScene : public Scene {
+public:
+    static const int TICKS_PER_FRAME = 16; // ticks de 1 ms por quadro a 60 Hz
+
+    ArkanoideScene(int numRows, int numCols, int numBalls)
+        : numRows(numRows), numCols(numCols), numBalls(numBalls), paddle(0.2f, 0.02f, 0.0f), balls(numBalls) {
+    }
+
+    void setup(SceneContext& context) override {
+        srand(1);
+        jobs = context.jobs;
+        board.reset(new Board(numRows, numCols));
+        disabledBlocks.clear();
+        disabledBlocks.reserve(board->size());
+        bricks = InstanceLayer();
+        board->fillLayer(disabledBlocks, bricks);
+        layerBroken = 0;
+        collision.assign(board->getActiveBlocks(disabledBlocks));
+
+        // Bolas espalhadas abaixo do tabuleiro; sementes fixas para que duas execuções
+        // simulem exatamente o mesmo jogo
+        balls.clear();
+        for (int i = 0; i < numBalls; ++i) {
+            balls.spawn(spawnBall(i));
+        }
+
+        renderer = startRenderer(context);
+    }
+
+    void frame() override {
+        for (int tick = 0; tick < TICKS_PER_FRAME; ++tick) {
+            simulate(0.001f);
+        }
+        record();
+        renderer->submit(recordedFrame);
+    }
+
+    void teardown(SceneContext& context) override {
+        stopRenderer(context, renderer);
+    }
+
+    const char* unit() const override {
+        return "objects";
+    }
+
+    // Blocos e bolas que a simulação percorre a cada quadro
+    uint64_t workPerFrame() const override {
+        return static_cast<uint64_t>(numRows) * numCols + numBalls;
+    }
+
+    bool drawsOnBenchThread() const override {
+        return false;
+    }
+
+private:
+    Ball spawnBall(int index) const {
+        // Hash inteiro simples: determinístico e sem estado compartilhado
+        uint32_t hash = static_cast<uint32_t>(index) * 2654435761u;
+        float u = static_cast<float>(hash & 0xFFFF) / 65535.0f;
+        float v = static_cast<float>(hash >> 16) / 65535.0f;
+        glm::vec2 position(-0.75f + 1.4f * u, -0.85f + 0.5f * v);
+        glm::vec2 velocity((hash & 1) ? 0.8f : -0.8f, 0.8f);
+        return Ball(0.02f, position, velocity);
+    }
+
+    // Um tick de Simulation::tick sem o teclado, com as bolas no BallPool: movimento, paredes e
+    // paddle de todas de uma vez em SIMD, a fase larga contra os blocos em paralelo no
+    // JobSystem, depois os blocos bola a bola, contra as caixas que ficam de um tick para o
+    // outro (CollisionBlocks) e com os candidatos na arena. Bolas que caem voltam ao ponto de
+    // partida e o tabuleiro é recomposto quando esvazia, para a carga não mudar ao longo da
+    // medição.
+    void simulate(float deltaTime) {
+        arena.reset();
+        if (static_cast<int>(disabledBlocks.size()) == board->size()) {
+            disabledBlocks.clear();
+            collision.assign(board->getActiveBlocks(disabledBlocks));
+            board->fillLayer(disabledBlocks, bricks);
+            layerBroken = 0;
+        }
+        collision.beginTick();
+        std::pmr::vector<int> candidates(&arena);
+
+        integrateBalls(balls, deltaTime, paddle);
+        findCollisionCandidates(*jobs, collision.bounds, balls, 0.0f, candidates);
+        for (int i = 0; i < numBalls; ++i) {
+            Ball ball = (balls.y[i] < -1.0f) ? spawnBall(i) : balls.get(i);
+            verifyCollisionBlocks(collision.blocks, collision.bounds, ball, disabledBlocks, candidates[i]);
+            balls.set(i, ball);
+        }
+    }
+
+    // Como recordFrame em main.cpp, com as bolas no segundo buffer
+    void record() {
+        for (; layerBroken < disabledBlocks.size(); ++layerBroken) {
+            bricks.remove(board->getBlockKey(disabledBlocks[layerBroken]));
+        }
+
+        recordedFrame.buffers.resize(2);
+        recordedFrame.clear();
+
+        bricks.flush(recordedFrame.bricks);
+        recordedFrame.background.push(Program::Flat, Mesh::Contour, glm::vec2(0.0f, 0.0f), glm::vec2(1.0f, 1.0f), glm::vec3(0.0f, 0.0f, 1.0f));
+        paddle.record(recordedFrame.buffers[0]);
+
+        balls.record(recordedFrame.buffers[1]);
+    }
+
+    int numRows, numCols, numBalls;
+    std::unique_ptr<Board> board;
+    Paddle paddle;
+    BallPool balls;
+    std::vector<Block> disabledBlocks;
+    CollisionBlocks collision;
+    FrameArena arena;
+    InstanceLayer bricks;
+    size_t layerBroken = 0; // entradas de disabledBlocks já tiradas da camada
+
+    JobSystem* jobs = nullptr;
+    std::unique_ptr<RenderBackend> renderer;
+    Frame recordedFrame;
+};
@@ -0,0 +1,158 @@
+// Geradores de vértices dos exercícios da Lista-1 (ex6 e ex7), parametrizados pelo
+// número de segmentos. Sem GL: usados pelas cenas do bench e pelos microbenchmarks. Os
+// vetores saem de `resource`; as cenas passam a FrameArena do quadro, já que os vértices
+// são gerados de novo a cada quadro, e por isso cada vetor é reservado de uma vez.
+
+#pragma once
+
+#include <cmath>
+#include <memory_resource>
+#include <vector>
+
+#include <commons/JobSystem.h>
+
+inline std::pmr::vector<float> createCircleVertices(float radius, int numSegments, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+    const float PI = 3.14159265359f;
+    std::pmr::vector<float> vertices(resource);
+    vertices.reserve(2 * static_cast<size_t>(numSegments));
+
+    for (int i = 0; i < numSegments; ++i) {
+        float theta = 2.0f * PI * static_cast<float>(i) / static_cast<float>(numSegments);
+        vertices.push_back(radius * std::cos(theta));
+        vertices.push_back(radius * std::sin(theta));
+    }
+
+    return vertices;
+}
+
+inline std::pmr::vector<float> createCircleVerticesToTriangle(float radius, int numSegments, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+    const float PI = 3.14159265359f;
+    std::pmr::vector<float> vertices(resource);
+    vertices.reserve(6 * static_cast<size_t>(numSegments));
+
+    float theta;
+    for (int i = 0; i < 2; ++i) {
+        theta = 2.0f * PI * static_cast<float>(i) / static_cast<float>(numSegments);
+        vertices.push_back(radius * std::cos(theta));
+        vertices.push_back(radius * std::sin(theta));
+    }
+
+    vertices.push_back(0.0f);
+    vertices.push_back(0.0f);
+
+    for (int i = 2; i < numSegments + 1; ++i) {
+        theta = 2.0f * PI * static_cast<float>(i - 1) / static_cast<float>(numSegments);
+        vertices.push_back(radius * std::cos(theta));
+        vertices.push_back(radius * std::sin(theta));
+
+        theta = 2.0f * PI * static_cast<float>(i) / static_cast<float>(numSegments);
+        vertices.push_back(radius * std::cos(theta));
+        vertices.push_back(radius * std::sin(theta));
+
+        vertices.push_back(0.0f);
+        vertices.push_back(0.0f);
+    }
+
+    return vertices;
+}
+
+// Sem a impressão dos vértices que o exercício faz a cada chamada
+inline std::pmr::vector<float> createCircleVerticesToStar(std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+    std::pmr::vector<float> verticesIn = createCircleVertices(0.2f, 5, resource);
+    std::pmr::vector<float> verticesOut = createCircleVerticesToTriangle(0.5f, 10, resource);
+    std::pmr::vector<float> vertices(resource);
+    vertices.reserve(5 * 6);
+
+    int init = 0;
+    int initOut = 2;
+    for (int i = 0; i < 5; i++) {
+        int next = (i == 4) ? 0 : init + 2;
+        vertices.push_back(verticesIn[init]);
+        vertices.push_back(verticesIn[init + 1]);
+        vertices.push_back(verticesIn[next]);
+        vertices.push_back(verticesIn[next + 1]);
+        init = init + 2;
+
+        vertices.push_back(verticesOut[initOut]);
+        vertices.push_back(verticesOut[initOut + 1]);
+        initOut = initOut + 12;
+    }
+
+    return vertices;
+}
+
+inline std::pmr::vector<float> createSpiralVertices(int numSegments, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+    float angleIncrement = 0.3f;
+    float radiusIncrement = 0.005f;
+
+    std::pmr::vector<float> spiralVertices(resource);
+    spiralVertices.reserve(2 * static_cast<size_t>(numSegments));
+
+    float currentAngle = 0.0f;
+    float currentRadius = 0.1f;
+
+    for (int i = 0; i < numSegments; ++i) {
+        spiralVertices.push_back(currentRadius * std::cos(currentAngle));
+        spiralVertices.push_back(currentRadius * std::sin(currentAngle));
+
+        currentAngle += angleIncrement;
+        currentRadius += radiusIncrement;
+    }
+
+    return spiralVertices;
+}
+
+// --- Versões paralelas (JobSystem) ---
+//
+// Cada segmento só depende do próprio índice, então os trechos são escritos direto nas
+// posições finais e o resultado é idêntico ao das versões acima. A espiral acumula ângulo
+// e raio de um vértice para o outro e fica só na versão sequencial.
+
+const int GEOMETRY_GRAIN = 4096; // segmentos por trecho; abaixo disso não vale um job
+
+inline std::pmr::vector<float> createCircleVertices(JobSystem& jobs, float radius, int numSegments, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+    const float PI = 3.14159265359f;
+    std::pmr::vector<float> vertices(2 * static_cast<size_t>(numSegments), resource);
+
+    jobs.parallelFor(0, numSegments, GEOMETRY_GRAIN, [&](int first, int last) {
+        for (int i = first; i < last; ++i) {
+            float theta = 2.0f * PI * static_cast<float>(i) / static_cast<float>(numSegments);
+            vertices[2 * i] = radius * std::cos(theta);
+            vertices[2 * i + 1] = radius * std::sin(theta);
+        }
+    });
+
+    return vertices;
+}
+
+inline std::pmr::vector<float> createCircleVerticesToTriangle(JobSystem& jobs, float radius, int numSegments, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+    const float PI = 3.14159265359f;
+    std::pmr::vector<float> vertices(6 * static_cast<size_t>(numSegments), resource);
+
+    for (int i = 0; i < 2; ++i) {
+        float theta = 2.0f * PI * static_cast<float>(i) / static_cast<float>(numSegments);
+        vertices[2 * i] = radius * std::cos(theta);
+        vertices[2 * i + 1] = radius * std::sin(theta);
+    }
+    vertices[4] = 0.0f;
+    vertices[5] = 0.0f;
+
+    // O triângulo i (2 <= i <= numSegments) começa no float 6 * (i - 1)
+    jobs.parallelFor(2, numSegments + 1, GEOMETRY_GRAIN, [&](int first, int last) {
+        for (int i = first; i < last; ++i) {
+            float* triangle = vertices.data() + 6 * static_cast<size_t>(i - 1);
+            float theta = 2.0f * PI * static_cast<float>(i - 1) / static_cast<float>(numSegments);
+            triangle[0] = radius * std::cos(theta);
+            triangle[1] = radius * std::sin(theta);
+
+            theta = 2.0f * PI * static_cast<float>(i) / static_cast<float>(numSegments);
+            triangle[2] = radius * std::cos(theta);
+            triangle[3] = radius * std::sin(theta);
+
+            triangle[4] = 0.0f;
+            triangle[5] = 0.0f;
+        }
+    });
+
+    return vertices;
+}
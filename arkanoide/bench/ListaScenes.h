@@ -0,0 +1,320 @@
+// Cenas dos exercícios das Listas. Geometria e sequência de chamadas GL são as mesmas
+// de Lista-1/ex6_main.cpp, Lista-1/ex7_main.cpp e Lista-3/ex.cpp (inclusive recriar VAO
+// e VBO a cada desenho), só que com o número de segmentos/quadrados como parâmetro. Com
+// --software a mesma geometria vai para o rasterizador do bench.
+
+#pragma once
+
+#include <cstdlib>
+#include <memory_resource>
+#include <vector>
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+#include <commons/FrameArena.h>
+#include <commons/SoftRasterizer.h>
+
+#include "Geometry.h"
+#include "Scene.h"
+
+inline SoftPrimitive softPrimitive(GLenum primitive) {
+    switch (primitive) {
+    case GL_TRIANGLE_FAN:
+        return SoftPrimitive::TriangleFan;
+    case GL_LINE_STRIP:
+        return SoftPrimitive::LineStrip;
+    case GL_LINE_LOOP:
+        return SoftPrimitive::LineLoop;
+    case GL_POINTS:
+        return SoftPrimitive::Points;
+    case GL_TRIANGLES:
+    default:
+        return SoftPrimitive::Triangles;
+    }
+}
+
+// glClear, ou o começo de um quadro no rasterizador, com a largura de linha e o tamanho
+// de ponto padrão do GL (as Listas não mudam; o SoftwareRenderer muda)
+inline void beginListaFrame(SoftRasterizer* rasterizer) {
+    if (rasterizer) {
+        rasterizer->setLineWidth(1.0f);
+        rasterizer->setPointSize(1.0f);
+        rasterizer->clear(0xFF000000u);
+    } else {
+        glClear(GL_COLOR_BUFFER_BIT);
+    }
+}
+
+// O quadro de software só existe depois do finish(); no GL o bench chama glFinish
+inline void endListaFrame(SoftRasterizer* rasterizer) {
+    if (rasterizer) {
+        rasterizer->finish();
+    }
+}
+
+// Mesmo corpo dos renderShape/renderPacman/... das Listas: cria o VAO e o VBO, envia os
+// vértices, procura o uniform, desenha e apaga tudo
+inline void drawListaVertices(SoftRasterizer* rasterizer, GLuint shaderProgram, const std::pmr::vector<float>& vertices, GLenum primitive, GLsizei count, glm::vec3 color) {
+    if (rasterizer) {
+        rasterizer->draw(softPrimitive(primitive), reinterpret_cast<const glm::vec2*>(vertices.data()), count, color);
+        return;
+    }
+
+    GLuint VAO, VBO;
+    glGenVertexArrays(1, &VAO);
+    glGenBuffers(1, &VBO);
+
+    glBindVertexArray(VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), vertices.data(), GL_STATIC_DRAW);
+
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+
+    glUseProgram(shaderProgram);
+    GLint shapeColorLocation = glGetUniformLocation(shaderProgram, "shapeColor");
+    glUniform3f(shapeColorLocation, color.x, color.y, color.z);
+
+    glDrawArrays(primitive, 0, count);
+
+    glDeleteVertexArrays(1, &VAO);
+    glDeleteBuffers(1, &VBO);
+}
+
+// --- Lista-1 ex6 ---
+
+enum class Ex6Shape {
+    Circle,  // renderShape: GL_TRIANGLE_FAN com numSegments vértices
+    Pacman,  // renderPacman: leque em triângulos sem a "boca"
+    Pizza,   // renderPizza: leque em triângulos sem uma fatia maior
+    Star     // renderStar: 5 triângulos, não depende de numSegments
+};
+
+class Ex6Scene : public Scene {
+public:
+    Ex6Scene(Ex6Shape shape, int numSegments) : shape(shape), numSegments(numSegments) {
+    }
+
+    void setup(SceneContext& context) override {
+        jobs = context.jobs;
+        rasterizer = context.rasterizer;
+        if (!rasterizer) {
+            shaderProgram = context.shaders->get(ShaderFeature::None);
+        }
+    }
+
+    // Os vértices são gerados a cada quadro, como no exercício, com os segmentos divididos
+    // no JobSystem, mas na arena do quadro em vez do heap
+    void frame() override {
+        arena.reset();
+        beginListaFrame(rasterizer);
+        switch (shape) {
+        case Ex6Shape::Circle:
+            drawListaVertices(rasterizer, shaderProgram, createCircleVertices(*jobs, 0.2f, numSegments, &arena), GL_TRIANGLE_FAN, numSegments, glm::vec3(1.0f, 0.0f, 0.0f));
+            break;
+        case Ex6Shape::Pacman:
+            drawListaVertices(rasterizer, shaderProgram, createCircleVerticesToTriangle(*jobs, 0.5f, numSegments, &arena), GL_TRIANGLES, vertexCount(), glm::vec3(1.0f, 0.0f, 0.0f));
+            break;
+        case Ex6Shape::Pizza:
+            drawListaVertices(rasterizer, shaderProgram, createCircleVerticesToTriangle(*jobs, 0.5f, numSegments, &arena), GL_TRIANGLES, vertexCount(), glm::vec3(1.0f, 0.0f, 0.0f));
+            break;
+        case Ex6Shape::Star:
+            drawListaVertices(rasterizer, shaderProgram, createCircleVerticesToStar(&arena), GL_TRIANGLES, vertexCount(), glm::vec3(1.0f, 1.0f, 1.0f));
+            break;
+        }
+        endListaFrame(rasterizer);
+    }
+
+    void teardown(SceneContext&) override {
+    }
+
+    const char* unit() const override {
+        return "vertices";
+    }
+
+    uint64_t workPerFrame() const override {
+        return static_cast<uint64_t>(vertexCount());
+    }
+
+private:
+    GLsizei vertexCount() const {
+        switch (shape) {
+        case Ex6Shape::Pacman:
+            return numSegments * 3 - 9;
+        case Ex6Shape::Pizza:
+            return numSegments * 3 - 45;
+        case Ex6Shape::Star:
+            return 5 * 3;
+        case Ex6Shape::Circle:
+        default:
+            return numSegments;
+        }
+    }
+
+    Ex6Shape shape;
+    int numSegments;
+    GLuint shaderProgram = 0;
+    FrameArena arena;
+    JobSystem* jobs = nullptr;
+    SoftRasterizer* rasterizer = nullptr;
+};
+
+// --- Lista-1 ex7 ---
+
+class Ex7Scene : public Scene {
+public:
+    explicit Ex7Scene(int numSegments) : numSegments(numSegments) {
+    }
+
+    void setup(SceneContext& context) override {
+        rasterizer = context.rasterizer;
+        if (!rasterizer) {
+            shaderProgram = context.shaders->get(ShaderFeature::None);
+        }
+    }
+
+    void frame() override {
+        arena.reset();
+        beginListaFrame(rasterizer);
+        drawListaVertices(rasterizer, shaderProgram, createSpiralVertices(numSegments, &arena), GL_LINE_STRIP, numSegments, glm::vec3(1.0f, 0.0f, 0.0f));
+        endListaFrame(rasterizer);
+    }
+
+    void teardown(SceneContext&) override {
+    }
+
+    const char* unit() const override {
+        return "vertices";
+    }
+
+    uint64_t workPerFrame() const override {
+        return static_cast<uint64_t>(numSegments);
+    }
+
+private:
+    int numSegments;
+    GLuint shaderProgram = 0;
+    FrameArena arena;
+    SoftRasterizer* rasterizer = nullptr;
+};
+
+// --- Lista-3 ---
+
+// renderColoredSquareGrid com numRows x numCols; a projeção enquadra a grade inteira
+// para que todos os quadrados sejam rasterizados
+class GridScene : public Scene {
+public:
+    GridScene(int numRows, int numCols) : numRows(numRows), numCols(numCols) {
+    }
+
+    void setup(SceneContext& context) override {
+        rasterizer = context.rasterizer;
+        if (!rasterizer) {
+            shaderProgram = context.shaders->get(ShaderFeature::Projection | ShaderFeature::Model);
+        }
+        width = context.width;
+        height = context.height;
+
+        // Cores fixas entre execuções, para que duas rodadas desenhem a mesma coisa
+        srand(1);
+        randomColors.clear();
+        randomColors.reserve(static_cast<size_t>(numRows) * numCols);
+        for (int i = 0; i < numRows * numCols; ++i) {
+            float r = static_cast<float>(rand()) / RAND_MAX;
+            float g = static_cast<float>(rand()) / RAND_MAX;
+            float b = static_cast<float>(rand()) / RAND_MAX;
+            randomColors.push_back(glm::vec3(r, g, b));
+        }
+    }
+
+    void frame() override {
+        beginListaFrame(rasterizer);
+
+        float vertices[] = {
+            -0.5f, -0.5f,
+             0.5f, -0.5f,
+             0.5f,  0.5f,
+            -0.5f,  0.5f
+        };
+
+        if (rasterizer) {
+            drawSoftware(vertices);
+            endListaFrame(rasterizer);
+            return;
+        }
+
+        GLuint VAO, VBO;
+        glGenVertexArrays(1, &VAO);
+        glGenBuffers(1, &VBO);
+
+        glBindVertexArray(VAO);
+        glBindBuffer(GL_ARRAY_BUFFER, VBO);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+        glEnableVertexAttribArray(0);
+
+        glUseProgram(shaderProgram);
+
+        for (int row = 0; row < numRows; ++row) {
+            for (int col = 0; col < numCols; ++col) {
+                glm::mat4 model = glm::mat4(1.0f);
+                model = glm::translate(model, glm::vec3(col * 1.0f, row * 1.0f, 0.0f));
+
+                glm::vec3 randomColor = randomColors[row * numCols + col];
+                glUniform3f(glGetUniformLocation(shaderProgram, "shapeColor"), randomColor.x, randomColor.y, randomColor.z);
+
+                glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "model"), 1, GL_FALSE, glm::value_ptr(model));
+                glm::mat4 projection = glm::ortho(-0.5f, numCols - 0.5f, -0.5f, numRows - 0.5f, -1.0f, 1.0f);
+                GLint projectionLocation = glGetUniformLocation(shaderProgram, "projection");
+                glUniformMatrix4fv(projectionLocation, 1, false, glm::value_ptr(projection));
+
+                glViewport(0, 0, width, height);
+                glBindVertexArray(VAO);
+                glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
+            }
+        }
+
+        // O exercício não apaga estes objetos; aqui apaga para não vazar um par por quadro
+        glDeleteVertexArrays(1, &VAO);
+        glDeleteBuffers(1, &VBO);
+    }
+
+    void teardown(SceneContext&) override {
+        randomColors.clear();
+    }
+
+    const char* unit() const override {
+        return "squares";
+    }
+
+    uint64_t workPerFrame() const override {
+        return static_cast<uint64_t>(numRows) * numCols;
+    }
+
+private:
+    // Mesmas projeção e translação do shader, aplicadas aos quatro vértices de cada quadrado
+    void drawSoftware(const float* vertices) {
+        glm::mat4 projection = glm::ortho(-0.5f, numCols - 0.5f, -0.5f, numRows - 0.5f, -1.0f, 1.0f);
+        glm::vec2 square[4];
+        for (int row = 0; row < numRows; ++row) {
+            for (int col = 0; col < numCols; ++col) {
+                for (int i = 0; i < 4; ++i) {
+                    glm::vec4 position = projection * glm::vec4(vertices[i * 2] + col, vertices[i * 2 + 1] + row, 0.0f, 1.0f);
+                    square[i] = glm::vec2(position.x, position.y);
+                }
+                rasterizer->draw(SoftPrimitive::TriangleFan, square, 4, randomColors[row * numCols + col]);
+            }
+        }
+    }
+
+    int numRows, numCols;
+    int width = 0;
+    int height = 0;
+    GLuint shaderProgram = 0;
+    SoftRasterizer* rasterizer = nullptr;
+    std::vector<glm::vec3> randomColors;
+};
@@ -0,0 +1,160 @@
+// Harness mínimo de microbenchmarks, no estilo do Google Benchmark (sem a dependência):
+//
+//     static void collision(MicroState& state) {
+//         std::vector<Block> blocks = ...(state.range());
+//         while (state.keepRunning()) {
+//             for (auto& block : blocks) doNotOptimize(block.checkCollision(ball));
+//         }
+//         state.setOpsPerIteration(state.range());
+//     }
+//     MICRO_BENCHMARK(collision, 56, 1000, 100000);
+//
+// O número de iterações é calibrado até cada repetição durar --min-time; o resultado é
+// ns/op e alocações/op (contadas pelo operator new que micro.cpp substitui). Um benchmark
+// que chama state.expectNoAllocations() faz o micro sair com erro se alocar no laço.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <commons/Profiler.h>
+
+// Alimentados pelo operator new global de micro.cpp
+struct MicroAllocations {
+    static std::atomic<uint64_t>& count() {
+        static std::atomic<uint64_t> value{ 0 };
+        return value;
+    }
+
+    static std::atomic<uint64_t>& bytes() {
+        static std::atomic<uint64_t> value{ 0 };
+        return value;
+    }
+};
+
+// Impede o compilador de descartar um resultado ou de tirar um cálculo do laço
+template <typename T>
+inline void doNotOptimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+inline void clobberMemory() {
+    asm volatile("" : : : "memory");
+}
+
+class MicroState {
+public:
+    MicroState(int64_t range, uint64_t iterations) : rangeValue(range), remaining(iterations), iterations(iterations) {
+    }
+
+    int64_t range() const {
+        return rangeValue;
+    }
+
+    // Quantas operações cada iteração do laço faz (ex.: o número de blocos testados)
+    void setOpsPerIteration(int64_t ops) {
+        opsPerIteration = ops;
+    }
+
+    // Para benchmarks que não rodam nesta máquina (ex.: AVX-512); chamar antes do laço
+    void skip() {
+        skipped = true;
+        remaining = 0;
+    }
+
+    bool isSkipped() const {
+        return skipped;
+    }
+
+    // Para benchmarks que não podem alocar em regime (ex.: os que usam a FrameArena); chamar
+    // antes do laço. A primeira iteração fica de aquecimento e não entra na contagem, e
+    // qualquer alocação depois dela faz o micro terminar com erro.
+    void expectNoAllocations() {
+        noAllocations = true;
+    }
+
+    bool expectsNoAllocations() const {
+        return noAllocations;
+    }
+
+    // O relógio e os contadores de alocação só correm entre a primeira chamada e a
+    // que retorna false, então a preparação antes do laço fica fora da medida
+    bool keepRunning() {
+        if (remaining == iterations) {
+            allocationsAtStart = MicroAllocations::count().load(std::memory_order_relaxed);
+            bytesAtStart = MicroAllocations::bytes().load(std::memory_order_relaxed);
+            start = std::chrono::steady_clock::now();
+        } else if (noAllocations && remaining + 1 == iterations) {
+            allocationsAtStart = MicroAllocations::count().load(std::memory_order_relaxed);
+            bytesAtStart = MicroAllocations::bytes().load(std::memory_order_relaxed);
+        }
+        if (remaining == 0) {
+            elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+            allocations = MicroAllocations::count().load(std::memory_order_relaxed) - allocationsAtStart;
+            bytes = MicroAllocations::bytes().load(std::memory_order_relaxed) - bytesAtStart;
+            return false;
+        }
+        --remaining;
+        return true;
+    }
+
+    uint64_t getIterations() const {
+        return iterations;
+    }
+
+    double totalOps() const {
+        return static_cast<double>(iterations) * opsPerIteration;
+    }
+
+    double elapsedNs() const {
+        return elapsed;
+    }
+
+    uint64_t getAllocations() const {
+        return allocations;
+    }
+
+    uint64_t getBytes() const {
+        return bytes;
+    }
+
+private:
+    int64_t rangeValue;
+    uint64_t remaining;
+    uint64_t iterations;
+    int64_t opsPerIteration = 1;
+    bool skipped = false;
+    bool noAllocations = false;
+    std::chrono::steady_clock::time_point start;
+    double elapsed = 0.0;
+    uint64_t allocationsAtStart = 0;
+    uint64_t bytesAtStart = 0;
+    uint64_t allocations = 0;
+    uint64_t bytes = 0;
+};
+
+struct MicroBenchmark {
+    std::string name;
+    std::function<void(MicroState&)> function;
+    std::vector<int64_t> ranges;
+};
+
+inline std::vector<MicroBenchmark>& microBenchmarks() {
+    static std::vector<MicroBenchmark> benchmarks;
+    return benchmarks;
+}
+
+struct MicroRegistrar {
+    MicroRegistrar(const char* name, std::function<void(MicroState&)> function, std::vector<int64_t> ranges) {
+        microBenchmarks().push_back(MicroBenchmark{ name, std::move(function), std::move(ranges) });
+    }
+};
+
+// Nome do benchmark = nome da função; cada range vira uma entrada "nome/range"
+#define MICRO_BENCHMARK(function, ...) \
+    static MicroRegistrar PROFILE_CONCAT(microRegistrar, __LINE__)(#function, function, { __VA_ARGS__ })
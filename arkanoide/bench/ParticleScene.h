@@ -0,0 +1,73 @@
+// Cena das partículas de quebra de bloco: emissão contínua que mantém o anel cheio
+// (todas vivas), atualização em SIMD dividida em trechos no JobSystem e um upload de
+// GL_POINTS por quadro no Renderer, como em main.cpp.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <commons/CommandBuffer.h>
+#include <commons/JobSystem.h>
+#include <commons/RenderBackend.h>
+#include "ParticleSystem.h"
+
+#include "Scene.h"
+
+class ParticleScene : public Scene {
+public:
+    static constexpr float FRAME_TIME = 1.0f / 60.0f;
+
+    explicit ParticleScene(int capacity) : capacity(capacity), particles(capacity) {
+    }
+
+    void setup(SceneContext& context) override {
+        particles.clear();
+        jobs = context.jobs;
+
+        renderer = startRenderer(context);
+    }
+
+    // Um quadro a 60 Hz emite 1/60 da capacidade; partículas vivem pelo menos 1,2 s e
+    // não saem do campo nesse tempo, então depois do primeiro segundo o anel fica cheio
+    void frame() override {
+        float hue = static_cast<float>(frameIndex++ % 60) / 60.0f;
+        particles.emitBurst(glm::vec2(-0.75f, 0.3f), glm::vec2(1.4f, 0.5f), glm::vec3(hue, 1.0f - hue, 0.5f),
+                            capacity / 60 + 1, 0.3f, 2.4f);
+        record();
+        renderer->submit(recordedFrame);
+    }
+
+    void teardown(SceneContext& context) override {
+        stopRenderer(context, renderer);
+    }
+
+    const char* unit() const override {
+        return "particles";
+    }
+
+    uint64_t workPerFrame() const override {
+        return static_cast<uint64_t>(capacity);
+    }
+
+    bool drawsOnBenchThread() const override {
+        return false;
+    }
+
+private:
+    void record() {
+        recordedFrame.clear();
+        updateParticles(*jobs, particles, FRAME_TIME, recordedFrame);
+    }
+
+    int capacity;
+    ParticleSystem particles;
+    uint64_t frameIndex = 0;
+
+    JobSystem* jobs = nullptr;
+    std::unique_ptr<RenderBackend> renderer;
+    Frame recordedFrame;
+};
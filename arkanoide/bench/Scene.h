@@ -0,0 +1,81 @@
+// Interface das cenas do bench. Cada cena reproduz o caminho de desenho de um programa
+// do repositório com uma carga parametrizada; o catálogo fica em SceneCatalog.h.
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <commons/JobSystem.h>
+#include <commons/RenderBackend.h>
+#include <commons/Renderer.h>
+#include <commons/ShaderVariants.h>
+#include <commons/SoftRasterizer.h>
+#include <commons/SoftwareRenderer.h>
+
+// O que o bench entrega a cada cena; o contexto GL está corrente na thread do bench. Com
+// --software não há janela, contexto nem shaders: as cenas desenham em `rasterizer`. O
+// JobSystem é o mesmo para todas as cenas e para o rasterizador.
+struct SceneContext {
+    GLFWwindow* window;
+    ShaderVariants* shaders;
+    int width;
+    int height;
+    JobSystem* jobs;
+    SoftRasterizer* rasterizer = nullptr;
+};
+
+class Scene {
+public:
+    virtual ~Scene() = default;
+
+    // Cria os recursos; fora da medição
+    virtual void setup(SceneContext& context) = 0;
+
+    // Um quadro completo; o bench mede do início até o glFinish seguinte
+    virtual void frame() = 0;
+
+    virtual void teardown(SceneContext& context) = 0;
+
+    // Trabalho de um quadro na unidade da cena (vértices, quadrados, ...), para a vazão
+    virtual const char* unit() const = 0;
+    virtual uint64_t workPerFrame() const = 0;
+
+    // false se os comandos GL saem de outra thread (Renderer): aí o bench não chama
+    // glFinish nem lê os contadores de GlIntercept, que não são atômicos
+    virtual bool drawsOnBenchThread() const {
+        return true;
+    }
+};
+
+struct SceneInfo {
+    std::string name;
+    std::function<std::unique_ptr<Scene>()> create;
+};
+
+// Cenas com o pipeline do jogo: o Renderer leva o contexto GL para a sua thread até
+// stopRenderer, ou, com --software, o SoftwareRenderer leva o rasterizador do bench
+inline std::unique_ptr<RenderBackend> startRenderer(SceneContext& context) {
+    std::unique_ptr<RenderBackend> renderer;
+    if (context.rasterizer) {
+        renderer.reset(new SoftwareRenderer(*context.rasterizer, context.width, context.height));
+    } else {
+        glfwMakeContextCurrent(nullptr);
+        renderer.reset(new Renderer(context.window, context.width, context.height));
+    }
+    renderer->start();
+    return renderer;
+}
+
+inline void stopRenderer(SceneContext& context, std::unique_ptr<RenderBackend>& renderer) {
+    renderer->stop();
+    renderer.reset();
+    if (!context.rasterizer) {
+        glfwMakeContextCurrent(context.window);
+    }
+}
@@ -0,0 +1,54 @@
+// Catálogo fixo de cenas do bench. Os nomes fazem parte do formato dos resultados:
+// tools/bench_compare.py casa duas execuções pelo nome, então não renomeie cenas.
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "Scene.h"
+#include "ListaScenes.h"
+#include "ArkanoideScene.h"
+#include "ParticleScene.h"
+
+inline std::vector<SceneInfo> sceneCatalog() {
+    std::vector<SceneInfo> catalog;
+
+    // Lista-1 ex6: formas recriadas a cada quadro, como no exercício
+    for (int segments : { 16, 256, 4096, 65536 }) {
+        std::string suffix = "/" + std::to_string(segments);
+        catalog.push_back({ "ex6/circle" + suffix, [segments]() { return std::unique_ptr<Scene>(new Ex6Scene(Ex6Shape::Circle, segments)); } });
+        catalog.push_back({ "ex6/pacman" + suffix, [segments]() { return std::unique_ptr<Scene>(new Ex6Scene(Ex6Shape::Pacman, segments)); } });
+        catalog.push_back({ "ex6/pizza" + suffix, [segments]() { return std::unique_ptr<Scene>(new Ex6Scene(Ex6Shape::Pizza, segments)); } });
+    }
+    // A estrela do ex6 tem geometria fixa (5 pontas)
+    catalog.push_back({ "ex6/star", []() { return std::unique_ptr<Scene>(new Ex6Scene(Ex6Shape::Star, 10)); } });
+
+    // Lista-1 ex7: espiral em GL_LINE_STRIP
+    for (int segments : { 64, 10000, 1000000 }) {
+        catalog.push_back({ "ex7/spiral/" + std::to_string(segments), [segments]() { return std::unique_ptr<Scene>(new Ex7Scene(segments)); } });
+    }
+
+    // Lista-3: grade com um draw e três glGetUniformLocation por quadrado
+    for (int side : { 10, 100, 1000 }) {
+        std::string size = std::to_string(side) + "x" + std::to_string(side);
+        catalog.push_back({ "lista3/grid/" + size, [side]() { return std::unique_ptr<Scene>(new GridScene(side, side)); } });
+    }
+
+    // Arkanoide: tabuleiros de 56 a 100k blocos, de 1 a 10k bolas
+    struct BoardSize {
+        int rows, cols, balls;
+    };
+    for (BoardSize board : { BoardSize{ 7, 8, 1 }, BoardSize{ 7, 8, 100 }, BoardSize{ 28, 40, 1 }, BoardSize{ 28, 40, 100 },
+                             BoardSize{ 100, 100, 1 }, BoardSize{ 100, 100, 1000 }, BoardSize{ 250, 400, 1 }, BoardSize{ 250, 400, 10000 } }) {
+        std::string name = "arkanoide/" + std::to_string(board.rows * board.cols) + "-blocks/" + std::to_string(board.balls) + "-balls";
+        catalog.push_back({ name, [board]() { return std::unique_ptr<Scene>(new ArkanoideScene(board.rows, board.cols, board.balls)); } });
+    }
+
+    // Partículas de quebra de bloco, com o anel sempre cheio
+    for (int count : { 10000, 100000, 1000000 }) {
+        catalog.push_back({ "particles/" + std::to_string(count), [count]() { return std::unique_ptr<Scene>(new ParticleScene(count)); } });
+    }
+
+    return catalog;
+}
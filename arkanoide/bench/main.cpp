@@ -0,0 +1,390 @@
+// Bench: roda um catálogo fixo de cenas (SceneCatalog.h) numa janela invisível e
+// reporta estatísticas de tempo de quadro e vazão, em texto e em JSON. Dois JSON de
+// builds diferentes são comparados com tools/bench_compare.py. Com --software não abre
+// janela nem contexto GL: as cenas desenham no rasterizador por software
+// (commons/SoftRasterizer.h), e --dump grava o último quadro de cada cena em PPM.
+//
+//     ./bench --list
+//     ./bench --out antes.json
+//     ./bench --scene arkanoide/ --frames 500 --out depois.json
+//     ./bench --software --threads 8 --dump quadros/
+//
+// --threads vale para o JobSystem que as cenas e o rasterizador dividem.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <commons/GlIntercept.h>
+#include <commons/JobSystem.h>
+#include <commons/ShaderVariants.h>
+#include <commons/Simd.h>
+#include <commons/SoftRasterizer.h>
+
+#include "SceneCatalog.h"
+
+struct Options {
+    std::vector<std::string> filters;
+    int frames = 200;
+    int warmup = 20;
+    double maxSeconds = 10.0;
+    int width = 800;
+    int height = 600;
+    const char* out = nullptr;
+    bool list = false;
+    bool software = false;
+    int threads = 0;            // do JobSystem, contando a thread do bench; 0 = uma por núcleo
+    const char* dump = nullptr; // diretório dos PPM (só com --software)
+};
+
+struct Stats {
+    double mean = 0.0;
+    double stddev = 0.0;
+    double min = 0.0;
+    double p50 = 0.0;
+    double p95 = 0.0;
+    double p99 = 0.0;
+    double max = 0.0;
+};
+
+struct SceneResult {
+    std::string name;
+    const char* unit;
+    uint64_t workPerFrame;
+    std::vector<double> frameMs;  // do início do quadro ao fim do glFinish
+    std::vector<double> cpuMs;    // só a parte na CPU, antes do glFinish
+    Stats frame;
+    Stats cpu;
+    double throughput;            // unidades de trabalho por segundo
+    double drawCallsPerFrame;     // -1 quando a cena desenha em outra thread
+};
+
+static Stats computeStats(std::vector<double> samples) {
+    Stats stats;
+    if (samples.empty()) {
+        return stats;
+    }
+    std::sort(samples.begin(), samples.end());
+    auto percentile = [&samples](double fraction) {
+        return samples[static_cast<size_t>(fraction * (samples.size() - 1) + 0.5)];
+    };
+
+    double sum = 0.0;
+    for (double sample : samples) {
+        sum += sample;
+    }
+    stats.mean = sum / samples.size();
+    double squares = 0.0;
+    for (double sample : samples) {
+        squares += (sample - stats.mean) * (sample - stats.mean);
+    }
+    stats.stddev = samples.size() > 1 ? std::sqrt(squares / (samples.size() - 1)) : 0.0;
+    stats.min = samples.front();
+    stats.p50 = percentile(0.50);
+    stats.p95 = percentile(0.95);
+    stats.p99 = percentile(0.99);
+    stats.max = samples.back();
+    return stats;
+}
+
+static double millisecondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+static bool matches(const Options& options, const std::string& name) {
+    if (options.filters.empty()) {
+        return true;
+    }
+    for (const auto& filter : options.filters) {
+        if (name.find(filter) != std::string::npos) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Aquecimento e depois até `frames` quadros medidos, parando antes se passar de
+// maxSeconds (cenas muito pesadas medem ao menos um quadro)
+static SceneResult runScene(const SceneInfo& info, const Options& options, SceneContext& context) {
+    std::unique_ptr<Scene> scene = info.create();
+    scene->setup(context);
+    // No rasterizador o quadro já termina dentro de frame()
+    bool finish = scene->drawsOnBenchThread() && !context.rasterizer;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < options.warmup && millisecondsSince(start) < options.maxSeconds * 250.0; ++i) {
+        scene->frame();
+        if (finish) {
+            glFinish();
+        }
+    }
+
+    SceneResult result;
+    result.name = info.name;
+    result.unit = scene->unit();
+    result.workPerFrame = scene->workPerFrame();
+    result.frameMs.reserve(options.frames);
+    result.cpuMs.reserve(options.frames);
+
+    uint64_t drawCalls = 0;
+    GlIntercept::resetFrame();
+    start = std::chrono::steady_clock::now();
+    while (static_cast<int>(result.frameMs.size()) < options.frames &&
+           (result.frameMs.empty() || millisecondsSince(start) < options.maxSeconds * 1000.0)) {
+        auto frameStart = std::chrono::steady_clock::now();
+        scene->frame();
+        double cpu = millisecondsSince(frameStart);
+        if (finish) {
+            glFinish();
+            drawCalls += GlIntercept::frame().drawCalls;
+            GlIntercept::resetFrame();
+        }
+        result.frameMs.push_back(millisecondsSince(frameStart));
+        result.cpuMs.push_back(cpu);
+    }
+    double total = millisecondsSince(start);
+
+    scene->teardown(context);
+
+    result.frame = computeStats(result.frameMs);
+    result.cpu = computeStats(result.cpuMs);
+    result.throughput = total > 0.0 ? result.workPerFrame * result.frameMs.size() / (total / 1000.0) : 0.0;
+    result.drawCallsPerFrame = finish ? static_cast<double>(drawCalls) / result.frameMs.size() : -1.0;
+    return result;
+}
+
+static std::string jsonString(const char* text) {
+    std::string escaped = "\"";
+    for (const char* c = text ? text : ""; *c; ++c) {
+        if (*c == '"' || *c == '\\') {
+            escaped += '\\';
+            escaped += *c;
+        } else if (static_cast<unsigned char>(*c) < 0x20) {
+            char code[8];
+            std::snprintf(code, sizeof(code), "\\u%04x", *c);
+            escaped += code;
+        } else {
+            escaped += *c;
+        }
+    }
+    return escaped + "\"";
+}
+
+static void writeStats(std::ostream& out, const char* key, const Stats& stats) {
+    out << "      " << jsonString(key) << ": { \"mean\": " << stats.mean << ", \"stddev\": " << stats.stddev
+        << ", \"min\": " << stats.min << ", \"p50\": " << stats.p50 << ", \"p95\": " << stats.p95
+        << ", \"p99\": " << stats.p99 << ", \"max\": " << stats.max << " },\n";
+}
+
+static void writeSamples(std::ostream& out, const char* key, const std::vector<double>& samples, bool last) {
+    out << "      " << jsonString(key) << ": [";
+    for (size_t i = 0; i < samples.size(); ++i) {
+        out << (i ? ", " : "") << samples[i];
+    }
+    out << "]" << (last ? "\n" : ",\n");
+}
+
+// Formato lido por tools/bench_compare.py; as amostras brutas vão junto para que a
+// comparação possa testar se a diferença entre duas execuções é maior que o ruído
+static void writeJson(std::ostream& out, const Options& options, const std::string& renderer, const std::string& version,
+                      const std::vector<SceneResult>& results) {
+    char date[32];
+    std::time_t now = std::time(nullptr);
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+
+    out.precision(6);
+    out << "{\n";
+    out << "  \"version\": 1,\n";
+    out << "  \"date\": " << jsonString(date) << ",\n";
+    out << "  \"glRenderer\": " << jsonString(renderer.c_str()) << ",\n";
+    out << "  \"glVersion\": " << jsonString(version.c_str()) << ",\n";
+#ifdef __VERSION__
+    out << "  \"compiler\": " << jsonString(__VERSION__) << ",\n";
+#endif
+#ifdef __OPTIMIZE__
+    out << "  \"optimized\": true,\n";
+#else
+    out << "  \"optimized\": false,\n";
+#endif
+    out << "  \"frames\": " << options.frames << ",\n";
+    out << "  \"warmup\": " << options.warmup << ",\n";
+    out << "  \"scenes\": [\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const SceneResult& result = results[i];
+        out << "    {\n";
+        out << "      \"name\": " << jsonString(result.name.c_str()) << ",\n";
+        out << "      \"frames\": " << result.frameMs.size() << ",\n";
+        out << "      \"unit\": " << jsonString(result.unit) << ",\n";
+        out << "      \"workPerFrame\": " << result.workPerFrame << ",\n";
+        out << "      \"throughput\": " << result.throughput << ",\n";
+        if (result.drawCallsPerFrame >= 0.0) {
+            out << "      \"drawCallsPerFrame\": " << result.drawCallsPerFrame << ",\n";
+        }
+        writeStats(out, "frameMs", result.frame);
+        writeStats(out, "cpuMs", result.cpu);
+        writeSamples(out, "frameSamples", result.frameMs, true);
+        out << "    }" << (i + 1 < results.size() ? ",\n" : "\n");
+    }
+    out << "  ]\n";
+    out << "}\n";
+}
+
+static void printUsage(const char* program) {
+    std::cerr << "uso: " << program << " [--list] [--scene filtro]... [--frames N] [--warmup N]\n"
+              << "       [--max-seconds S] [--size LxA] [--threads N] [--out resultados.json]\n"
+              << "       [--software [--dump diretorio]]" << std::endl;
+}
+
+static bool parseOptions(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--list") {
+            options.list = true;
+        } else if (arg == "--scene" && hasValue) {
+            options.filters.push_back(argv[++i]);
+        } else if (arg == "--frames" && hasValue) {
+            options.frames = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--warmup" && hasValue) {
+            options.warmup = std::max(0, std::atoi(argv[++i]));
+        } else if (arg == "--max-seconds" && hasValue) {
+            options.maxSeconds = std::atof(argv[++i]);
+        } else if (arg == "--size" && hasValue) {
+            if (std::sscanf(argv[++i], "%dx%d", &options.width, &options.height) != 2) {
+                return false;
+            }
+        } else if (arg == "--out" && hasValue) {
+            options.out = argv[++i];
+        } else if (arg == "--software") {
+            options.software = true;
+        } else if (arg == "--threads" && hasValue) {
+            options.threads = std::max(0, std::atoi(argv[++i]));
+        } else if (arg == "--dump" && hasValue) {
+            options.dump = argv[++i];
+        } else {
+            return false;
+        }
+    }
+    // Sem --software não há quadro na memória para gravar
+    return options.software || !options.dump;
+}
+
+// Mesmo contexto do jogo, numa janela invisível e sem vsync; nullptr se falhar
+static GLFWwindow* createWindow(const Options& options) {
+    if (!glfwInit()) {
+        std::cerr << "Erro ao inicializar o GLFW" << std::endl;
+        return nullptr;
+    }
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    GLFWwindow* window = glfwCreateWindow(options.width, options.height, "bench", nullptr, nullptr);
+    if (!window) {
+        std::cerr << "Erro ao criar a janela GLFW" << std::endl;
+        glfwTerminate();
+        return nullptr;
+    }
+    glfwMakeContextCurrent(window);
+    glfwSwapInterval(0);
+    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+        std::cerr << "Erro ao inicializar o GLAD" << std::endl;
+        glfwTerminate();
+        return nullptr;
+    }
+    GlIntercept::install();
+
+    glViewport(0, 0, options.width, options.height);
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+    return window;
+}
+
+// "ex6/circle/16" -> "diretorio/ex6_circle_16.ppm"
+static std::string dumpPath(const char* directory, std::string name) {
+    std::replace(name.begin(), name.end(), '/', '_');
+    return std::string(directory) + "/" + name + ".ppm";
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    std::vector<SceneInfo> catalog = sceneCatalog();
+    if (options.list) {
+        for (const auto& info : catalog) {
+            std::cout << info.name << std::endl;
+        }
+        return 0;
+    }
+
+    GLFWwindow* window = nullptr;
+    JobSystem jobs(options.threads);
+    std::unique_ptr<SoftRasterizer> rasterizer;
+    std::string renderer;
+    std::string version;
+    if (options.software) {
+        rasterizer.reset(new SoftRasterizer(&jobs));
+        rasterizer->resize(options.width, options.height);
+        renderer = std::string("software (") + simdLevelName(rasterizer->getSimdLevel()) + ", " +
+                   std::to_string(rasterizer->getThreads()) + " threads)";
+    } else {
+        window = createWindow(options);
+        if (!window) {
+            return 1;
+        }
+        renderer = reinterpret_cast<const char*>(glGetString(GL_RENDERER));
+        version = reinterpret_cast<const char*>(glGetString(GL_VERSION));
+    }
+
+    std::vector<SceneResult> results;
+    {
+        // Compila com o contexto corrente: só no GL
+        std::unique_ptr<ShaderVariants> shaders(options.software ? nullptr : new ShaderVariants());
+        SceneContext context{ window, shaders.get(), options.width, options.height, &jobs, rasterizer.get() };
+
+        for (const auto& info : catalog) {
+            if (!matches(options, info.name)) {
+                continue;
+            }
+            results.push_back(runScene(info, options, context));
+
+            const SceneResult& result = results.back();
+            std::printf("%-36s %5zu quadros  p50 %9.3f  p95 %9.3f  p99 %9.3f ms  %10.4g %s/s\n",
+                        result.name.c_str(), result.frameMs.size(), result.frame.p50, result.frame.p95,
+                        result.frame.p99, result.throughput, result.unit);
+            std::fflush(stdout);
+
+            if (options.dump && !rasterizer->writePpm(dumpPath(options.dump, info.name))) {
+                std::cerr << "Erro ao gravar " << dumpPath(options.dump, info.name) << std::endl;
+            }
+        }
+    }
+
+    if (options.out) {
+        std::ofstream file(options.out);
+        if (!file) {
+            std::cerr << "Erro ao abrir " << options.out << std::endl;
+            glfwTerminate();
+            return 1;
+        }
+        writeJson(file, options, renderer, version, results);
+    }
+
+    glfwTerminate();
+    return 0;
+}
@@ -0,0 +1,816 @@
+// Microbenchmarks dos kernels de colisão e dos geradores de geometria, isolados do
+// GL: medem ns/op e alocações/op para comparar otimizações (SIMD, SoA, ...) sem o
+// ruído de uma cena inteira. Não abre janela nem precisa de contexto.
+//
+//     ./micro [--filter nome] [--min-time 0.1] [--repetitions 10] [--out micro.json]
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory_resource>
+#include <new>
+#include <string>
+#include <vector>
+
+#include <commons/FrameArena.h>
+#include <commons/JobSystem.h>
+#include <commons/SoftRasterizer.h>
+#include <commons/TripleBuffer.h>
+
+#include "Ball.h"
+#include "BallPool.h"
+#include "Block.h"
+#include "Board.h"
+#include "CollisionKernels.h"
+#include "Paddle.h"
+#include "ParticleSystem.h"
+#include "Simulation.h"
+
+#include "Geometry.h"
+#include "Micro.h"
+
+// --- Contagem de alocações: todo operator new do processo passa por aqui ---
+
+// malloc/free por baixo de new/delete é justamente o que a substituição faz; o GCC não
+// sabe disso depois de fazer o inline e avisa de um par trocado que não existe
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+void* operator new(std::size_t size) {
+    MicroAllocations::count().fetch_add(1, std::memory_order_relaxed);
+    MicroAllocations::bytes().fetch_add(size, std::memory_order_relaxed);
+    if (void* pointer = std::malloc(size ? size : 1)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+
+// Versões com alinhamento: o std::pmr::new_delete_resource (recurso padrão dos
+// std::pmr::vector) aloca por elas mesmo sem alinhamento especial
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    MicroAllocations::count().fetch_add(1, std::memory_order_relaxed);
+    MicroAllocations::bytes().fetch_add(size, std::memory_order_relaxed);
+    size_t align = std::max(static_cast<size_t>(alignment), sizeof(void*));
+    if (void* pointer = std::aligned_alloc(align, (size + align - 1) / align * align)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    return operator new(size, alignment);
+}
+
+void operator delete(void* pointer, std::align_val_t) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer, std::align_val_t) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t, std::align_val_t) noexcept {
+    std::free(pointer);
+}
+#pragma GCC diagnostic pop
+
+// --- Entradas ---
+
+// Mesmos tabuleiros do bench de cenas
+static Board boardWithBlocks(int64_t blocks) {
+    switch (blocks) {
+    case 56:
+        return Board(7, 8);
+    case 1120:
+        return Board(28, 40);
+    case 10000:
+        return Board(100, 100);
+    default:
+        return Board(250, 400);
+    }
+}
+
+// Um JobSystem para todos os microbenchmarks paralelos, uma thread por núcleo
+static JobSystem& microJobs() {
+    static JobSystem jobs;
+    return jobs;
+}
+
+static std::pmr::vector<Block> allBlocks(const Board& board) {
+    return board.getActiveBlocks({});
+}
+
+// Bolas espalhadas pelo campo com direções variadas, sempre as mesmas
+static std::vector<Ball> spreadBalls(int64_t count, float yMin, float yMax) {
+    std::vector<Ball> balls;
+    balls.reserve(count);
+    for (int64_t i = 0; i < count; ++i) {
+        uint32_t hash = static_cast<uint32_t>(i + 1) * 2654435761u;
+        float u = static_cast<float>(hash & 0xFFFF) / 65535.0f;
+        float v = static_cast<float>(hash >> 16) / 65535.0f;
+        glm::vec2 velocity((hash & 1) ? 0.8f : -0.8f, (hash & 2) ? 0.8f : -0.8f);
+        balls.push_back(Ball(0.02f, glm::vec2(-0.8f + 1.5f * u, yMin + (yMax - yMin) * v), velocity));
+    }
+    return balls;
+}
+
+// --- Kernels de colisão ---
+
+// Uma bola contra todos os blocos do tabuleiro, como verifyCollisionBlocks sem o break
+static void blockCheckCollision(MicroState& state) {
+    Board board = boardWithBlocks(state.range());
+    std::pmr::vector<Block> blocks = allBlocks(board);
+    Ball ball(0.02f, glm::vec2(0.0f, 0.5f), glm::vec2(0.8f, 0.8f));
+    while (state.keepRunning()) {
+        for (auto& block : blocks) {
+            doNotOptimize(block.checkCollision(ball));
+        }
+    }
+    state.setOpsPerIteration(static_cast<int64_t>(blocks.size()));
+}
+MICRO_BENCHMARK(blockCheckCollision, 56, 1120, 10000, 100000);
+
+// O mesmo teste pelos kernels SoA, um por conjunto de instruções; a bola fica fora do
+// tabuleiro para todos percorrerem os blocos até o fim (op = um bloco)
+static void collideCircleAt(MicroState& state, SimdLevel level) {
+    if (level > detectSimdLevel()) {
+        state.skip();
+        return;
+    }
+    Board board = boardWithBlocks(state.range());
+    BlockBounds bounds;
+    bounds.assign(allBlocks(board));
+    glm::vec2 center(0.0f, -0.5f);
+    while (state.keepRunning()) {
+        doNotOptimize(collideCircleWith(level, bounds, center, 0.02f));
+    }
+    state.setOpsPerIteration(bounds.count);
+}
+
+static void collideCircleScalar(MicroState& state) {
+    collideCircleAt(state, SimdLevel::Scalar);
+}
+MICRO_BENCHMARK(collideCircleScalar, 56, 1120, 10000, 100000);
+
+static void collideCircleSse2(MicroState& state) {
+    collideCircleAt(state, SimdLevel::Sse2);
+}
+MICRO_BENCHMARK(collideCircleSse2, 56, 1120, 10000, 100000);
+
+static void collideCircleAvx2(MicroState& state) {
+    collideCircleAt(state, SimdLevel::Avx2);
+}
+MICRO_BENCHMARK(collideCircleAvx2, 56, 1120, 10000, 100000);
+
+static void collideCircleAvx512(MicroState& state) {
+    collideCircleAt(state, SimdLevel::Avx512);
+}
+MICRO_BENCHMARK(collideCircleAvx512, 56, 1120, 10000, 100000);
+
+// Com máscara: marca todos os blocos atingidos, bola no meio do tabuleiro
+static void collideCircleMask(MicroState& state) {
+    Board board = boardWithBlocks(state.range());
+    BlockBounds bounds;
+    bounds.assign(allBlocks(board));
+    std::vector<uint64_t> hitMask(bounds.maskWords());
+    glm::vec2 center(0.0f, 0.5f);
+    while (state.keepRunning()) {
+        doNotOptimize(collideCircle(bounds, center, 0.02f, hitMask.data()));
+    }
+    state.setOpsPerIteration(bounds.count);
+}
+MICRO_BENCHMARK(collideCircleMask, 56, 1120, 10000, 100000);
+
+// Fase larga de um tick: N bolas espalhadas pelo campo contra os 1120 blocos do bench,
+// divididas no JobSystem (op = uma bola)
+static void collisionCandidates(MicroState& state) {
+    Board board = boardWithBlocks(1120);
+    BlockBounds bounds;
+    bounds.assign(allBlocks(board));
+    BallPool pool(static_cast<int>(state.range()));
+    for (const auto& ball : spreadBalls(state.range(), -0.9f, 0.9f)) {
+        pool.spawn(ball);
+    }
+    std::pmr::vector<int> candidates;
+    while (state.keepRunning()) {
+        findCollisionCandidates(microJobs(), bounds, pool, 0.0f, candidates);
+        doNotOptimize(candidates.data());
+    }
+    state.setOpsPerIteration(state.range());
+}
+MICRO_BENCHMARK(collisionCandidates, 100, 10000, 100000);
+
+// `count` blocos quebrados espalhados pelo tabuleiro inteiro, sempre os mesmos
+static std::vector<Block> brokenBlocks(const Board& board, int64_t count) {
+    std::pmr::vector<Block> blocks = allBlocks(board);
+    std::vector<Block> broken;
+    broken.reserve(board.size());
+    for (int64_t i = 0; i < count; ++i) {
+        broken.push_back(blocks[static_cast<size_t>(i * static_cast<int64_t>(blocks.size()) / count)]);
+    }
+    return broken;
+}
+
+// A parte da colisão de um tick de simulate(): caixas persistentes (CollisionBlocks), fase
+// larga com os candidatos na arena do tick e a resolução bola a bola, sem devolver as bolas
+// ao pool (op = uma bola). Os blocos atingidos continuam quebrados de uma iteração para a
+// outra. Qualquer alocação no laço é erro (expectNoAllocations).
+static void collisionTick(MicroState& state) {
+    Board board = boardWithBlocks(1120);
+    BallPool pool(static_cast<int>(state.range()));
+    for (const auto& ball : spreadBalls(state.range(), -0.9f, 0.9f)) {
+        pool.spawn(ball);
+    }
+    std::vector<Block> disabledBlocks;
+    disabledBlocks.reserve(board.size());
+    CollisionBlocks collision;
+    collision.assign(board.getActiveBlocks(disabledBlocks));
+    FrameArena arena;
+    state.expectNoAllocations();
+    while (state.keepRunning()) {
+        arena.reset();
+        collision.beginTick();
+        std::pmr::vector<int> candidates(&arena);
+        findCollisionCandidates(microJobs(), collision.bounds, pool, 0.0f, candidates);
+        for (int i = 0; i < pool.end(); ++i) {
+            Ball ball = pool.get(i);
+            verifyCollisionBlocks(collision.blocks, collision.bounds, ball, disabledBlocks, candidates[i]);
+            doNotOptimize(ball);
+        }
+    }
+    state.setOpsPerIteration(state.range());
+}
+MICRO_BENCHMARK(collisionTick, 16, 1024);
+
+// Um jogo em andamento no tabuleiro de 100 mil blocos, com `range` deles já quebrados: 100
+// bolas andam, quebram blocos (a lista de quebrados cresce a cada iteração) e voltam ao
+// ponto de partida quando caem (op = um tick). O custo não deve depender de range.
+static void collisionTickBroken(MicroState& state) {
+    Board board = boardWithBlocks(100000);
+    const int numBalls = 100;
+    std::vector<Ball> start = spreadBalls(numBalls, -0.9f, 0.9f);
+    BallPool pool(numBalls);
+    for (const auto& ball : start) {
+        pool.spawn(ball);
+    }
+    Paddle paddle(0.2f, 0.02f, 0.0f);
+    std::vector<Block> disabledBlocks = brokenBlocks(board, state.range());
+    CollisionBlocks collision;
+    collision.assign(board.getActiveBlocks(disabledBlocks));
+    FrameArena arena;
+    while (state.keepRunning()) {
+        arena.reset();
+        collision.beginTick();
+        integrateBalls(pool, 0.001f, paddle);
+        std::pmr::vector<int> candidates(&arena);
+        findCollisionCandidates(microJobs(), collision.bounds, pool, 0.0f, candidates);
+        for (int i = 0; i < numBalls; ++i) {
+            Ball ball = (pool.y[i] < -1.0f) ? start[i] : pool.get(i);
+            verifyCollisionBlocks(collision.blocks, collision.bounds, ball, disabledBlocks, candidates[i]);
+            pool.set(i, ball);
+        }
+    }
+    doNotOptimize(disabledBlocks.size());
+}
+MICRO_BENCHMARK(collisionTickBroken, 0, 1000, 10000);
+
+// O caminho inteiro da thread de simulação de main.cpp: Simulation::tick com `range` bolas
+// quebrando os 1120 blocos, a publicação no TripleBuffer e a leitura pela thread de quadros
+// (op = um tick). Quando o jogo acaba, recomeça do estado inicial. O estado e os slots são
+// reservados como no jogo, então qualquer alocação no laço é erro (expectNoAllocations).
+static void simulationPublish(MicroState& state) {
+    Board board = boardWithBlocks(1120);
+    GameInput input;
+    GameState initial = { Paddle(0.2f, 0.02f, 0.0f), BallPool(MAX_BALLS), {}, {}, true, false, 0, 0.0f, {} };
+    for (const auto& ball : spreadBalls(state.range(), -0.5f, 0.1f)) {
+        initial.balls.spawn(ball);
+    }
+    GameState game = initial;
+    reserveGameState(game, board, nullptr);
+    TripleBuffer<GameState> stateBuffer(initial);
+    stateBuffer.forEachSlot([&](GameState& slot) { reserveGameState(slot, board, nullptr); });
+    Simulation simulation(board, nullptr, 0.0f, input, microJobs());
+
+    double time = 0.0;
+    uint64_t brokenBlocks = 0;
+    state.expectNoAllocations();
+    while (state.keepRunning()) {
+        if (game.gameOver) {
+            brokenBlocks += game.brokenBlocks;
+            game = initial;
+            simulation.restart();
+        }
+        simulation.tick(game, time, time + SIMULATION_TICK);
+        time += SIMULATION_TICK;
+        stateBuffer.write() = game;
+        stateBuffer.publish();
+        doNotOptimize(stateBuffer.read().brokenBlocks);
+    }
+    doNotOptimize(brokenBlocks + game.brokenBlocks);
+}
+MICRO_BENCHMARK(simulationPublish, 16, 256);
+
+// Remontar os blocos ativos do tabuleiro de 100 mil com `range` quebrados, como simulate()
+// faz no primeiro tick e a rolagem quando um chunk entra ou sai (op = um bloco)
+static void activeBlocksRebuild(MicroState& state) {
+    Board board = boardWithBlocks(100000);
+    std::vector<Block> disabledBlocks = brokenBlocks(board, state.range());
+    while (state.keepRunning()) {
+        std::pmr::vector<Block> blocks = board.getActiveBlocks(disabledBlocks);
+        doNotOptimize(blocks.data());
+    }
+    state.setOpsPerIteration(board.size());
+}
+MICRO_BENCHMARK(activeBlocksRebuild, 0, 1000, 10000);
+
+// Bolas perto do paddle, metade delas colidindo
+static void paddleCheckCollision(MicroState& state) {
+    Paddle paddle(0.2f, 0.02f, 0.0f);
+    std::vector<Ball> balls = spreadBalls(state.range(), -0.95f, -0.85f);
+    while (state.keepRunning()) {
+        for (auto& ball : balls) {
+            doNotOptimize(checkCollisionPaddle(ball, paddle));
+        }
+    }
+    state.setOpsPerIteration(state.range());
+}
+MICRO_BENCHMARK(paddleCheckCollision, 1, 100, 10000);
+
+// Cada bola contra um bloco que ela atinge; a bola é copiada para o estado não mudar
+static void ballMoveCollision(MicroState& state) {
+    Board board = boardWithBlocks(1120);
+    std::pmr::vector<Block> blocks = allBlocks(board);
+    std::vector<Ball> balls;
+    std::vector<Block> targets;
+    for (int64_t i = 0; i < state.range(); ++i) {
+        const Block& block = blocks[(i * 7919) % blocks.size()];
+        float side = (i % 4 < 2) ? -1.0f : 1.0f;
+        glm::vec2 position = (i % 2) ? glm::vec2(block.getX() + side * 0.01f, block.getY() + block.getHeight() / 2.0f)
+                                     : glm::vec2(block.getX() + block.getWidth() / 2.0f, block.getY() + side * 0.01f);
+        balls.push_back(Ball(0.02f, position, glm::vec2(0.8f, 0.8f)));
+        targets.push_back(block);
+    }
+    while (state.keepRunning()) {
+        for (size_t i = 0; i < balls.size(); ++i) {
+            Ball ball = balls[i];
+            ball.moveCollision(targets[i]);
+            doNotOptimize(ball);
+        }
+    }
+    state.setOpsPerIteration(state.range());
+}
+MICRO_BENCHMARK(ballMoveCollision, 1, 100, 10000);
+
+// Ball::move com passo grande, para uma parte das bolas bater nas paredes e no teto
+static void ballMove(MicroState& state) {
+    std::vector<Ball> balls = spreadBalls(state.range(), -0.9f, 0.9f);
+    while (state.keepRunning()) {
+        for (const auto& original : balls) {
+            Ball ball = original;
+            ball.move(0.05f);
+            doNotOptimize(ball);
+        }
+    }
+    state.setOpsPerIteration(state.range());
+}
+MICRO_BENCHMARK(ballMove, 1, 100, 10000);
+
+// BallPool: Ball::move + checkCollisionPaddle para todas as bolas (op = uma bola), por
+// conjunto de instruções. O estado evolui entre iterações como num jogo de verdade.
+static void integrateBallsAt(MicroState& state, SimdLevel level) {
+    if (level > detectSimdLevel()) {
+        state.skip();
+        return;
+    }
+    Paddle paddle(0.2f, 0.02f, 0.0f);
+    BallPool pool(static_cast<int>(state.range()));
+    for (const auto& ball : spreadBalls(state.range(), -0.9f, 0.9f)) {
+        pool.spawn(ball);
+    }
+    while (state.keepRunning()) {
+        integrateBallsWith(level, pool, 0.001f, paddle);
+        clobberMemory();
+    }
+    state.setOpsPerIteration(state.range());
+}
+
+static void integrateBallsScalar(MicroState& state) {
+    integrateBallsAt(state, SimdLevel::Scalar);
+}
+MICRO_BENCHMARK(integrateBallsScalar, 100, 10000, 1000000);
+
+static void integrateBallsSse2(MicroState& state) {
+    integrateBallsAt(state, SimdLevel::Sse2);
+}
+MICRO_BENCHMARK(integrateBallsSse2, 100, 10000, 1000000);
+
+static void integrateBallsAvx2(MicroState& state) {
+    integrateBallsAt(state, SimdLevel::Avx2);
+}
+MICRO_BENCHMARK(integrateBallsAvx2, 100, 10000, 1000000);
+
+static void integrateBallsAvx512(MicroState& state) {
+    integrateBallsAt(state, SimdLevel::Avx512);
+}
+MICRO_BENCHMARK(integrateBallsAvx512, 100, 10000, 1000000);
+
+// Multibola: metade das bolas cai e é recriada a cada iteração, mais a cópia do pool que
+// o TripleBuffer faz por tick (op = uma bola). allocs/op deve ficar em zero.
+static void ballPoolChurn(MicroState& state) {
+    int count = static_cast<int>(state.range());
+    BallPool pool(count);
+    BallPool published(count);
+    std::vector<Ball> balls = spreadBalls(count, -0.9f, 0.9f);
+    for (const auto& ball : balls) {
+        pool.spawn(ball);
+    }
+    while (state.keepRunning()) {
+        for (int i = 0; i < count; i += 2) {
+            pool.despawn(i);
+        }
+        for (int i = 0; i < count; i += 2) {
+            pool.spawn(balls[i]);
+        }
+        published = pool;
+        doNotOptimize(published.size());
+    }
+    state.setOpsPerIteration(count);
+}
+MICRO_BENCHMARK(ballPoolChurn, 100, 10000);
+
+// --- Grafo do quadro ---
+
+// O grafo de recordFrame: nós capturando tanto quanto os de main.cpp (acima do que a
+// std::function guardaria sem alocar), um deles dependente de outro (op = um quadro).
+// Com a arena, montar e rodar o grafo não aloca.
+static void frameGraphWith(MicroState& state, JobGraph& graph, FrameArena* arena) {
+    int a = 0, b = 0, c = 0, d = 0, e = 0;
+    while (state.keepRunning()) {
+        graph.clear();
+        if (arena) {
+            arena->reset();
+        }
+        graph.add([&]() { a += b + c + d + e; });
+        int emit = graph.add([&]() { b += a + c + d + e; });
+        int update = graph.add([&]() { c += a + b + d + e; });
+        graph.precede(emit, update);
+        graph.add([&]() { d += a + b + c + e; });
+        graph.run(microJobs());
+    }
+    doNotOptimize(a + b + c + d);
+}
+
+static void frameGraphHeap(MicroState& state) {
+    JobGraph graph;
+    frameGraphWith(state, graph, nullptr);
+}
+MICRO_BENCHMARK(frameGraphHeap, 1);
+
+static void frameGraphArena(MicroState& state) {
+    FrameArena arena;
+    JobGraph graph(&arena);
+    state.expectNoAllocations();
+    frameGraphWith(state, graph, &arena);
+}
+MICRO_BENCHMARK(frameGraphArena, 1);
+
+// Camada dos blocos: um quadro em que 16 blocos espalhados quebram (remove + flush) e o
+// seguinte, em que voltam (op = um bloco). Mede o swap-remove e a varredura do bitmap;
+// não deve depender do tamanho do tabuleiro (as alocações são os nós do mapa de chaves).
+static void instanceLayerBreak(MicroState& state) {
+    const int BROKEN = 16;
+    Board board = boardWithBlocks(state.range());
+    std::pmr::vector<Block> blocks = allBlocks(board);
+    InstanceLayer layer;
+    board.fillLayer({}, layer);
+    LayerUpdate update;
+    layer.flush(update);
+
+    while (state.keepRunning()) {
+        for (int i = 0; i < BROKEN; ++i) {
+            layer.remove(board.getBlockKey(blocks[(i * blocks.size()) / BROKEN]));
+        }
+        layer.flush(update);
+        for (int i = 0; i < BROKEN; ++i) {
+            const Block& block = blocks[(i * blocks.size()) / BROKEN];
+            layer.add(board.getBlockKey(block), block.instance(board.getBlockColor(block)));
+        }
+        layer.flush(update);
+        doNotOptimize(update.data.data());
+    }
+    state.setOpsPerIteration(2 * BROKEN);
+}
+MICRO_BENCHMARK(instanceLayerBreak, 1120, 10000, 100000);
+
+// ParticleSystem: um quadro de updateParticles sobre o anel cheio, todas vivas (op = uma
+// partícula), por conjunto de instruções. Com deltaTime 0 o estado não muda entre
+// iterações: todas continuam vivas e são escritas a cada chamada.
+static void updateParticlesAt(MicroState& state, SimdLevel level) {
+    if (level > detectSimdLevel()) {
+        state.skip();
+        return;
+    }
+    int count = static_cast<int>(state.range());
+    ParticleSystem particles(count);
+    particles.emitBurst(glm::vec2(-0.75f, 0.3f), glm::vec2(1.4f, 0.5f), glm::vec3(1.0f, 0.5f, 0.0f), count, 0.3f, 2.0f);
+    std::vector<PointVertex> points(particles.end());
+    while (state.keepRunning()) {
+        doNotOptimize(updateParticlesWith(level, particles, 0, particles.end(), 0.0f, points.data()));
+        clobberMemory();
+    }
+    state.setOpsPerIteration(count);
+}
+
+static void updateParticlesScalar(MicroState& state) {
+    updateParticlesAt(state, SimdLevel::Scalar);
+}
+MICRO_BENCHMARK(updateParticlesScalar, 10000, 1000000);
+
+static void updateParticlesSse2(MicroState& state) {
+    updateParticlesAt(state, SimdLevel::Sse2);
+}
+MICRO_BENCHMARK(updateParticlesSse2, 10000, 1000000);
+
+static void updateParticlesAvx2(MicroState& state) {
+    updateParticlesAt(state, SimdLevel::Avx2);
+}
+MICRO_BENCHMARK(updateParticlesAvx2, 10000, 1000000);
+
+static void updateParticlesAvx512(MicroState& state) {
+    updateParticlesAt(state, SimdLevel::Avx512);
+}
+MICRO_BENCHMARK(updateParticlesAvx512, 10000, 1000000);
+
+// SoftRasterizer: um quadro 800x600 com um leque de N triângulos cobrindo um círculo de
+// raio 0.8, cores por vértice (op = um triângulo), numa thread, por conjunto de instruções
+static void softRasterizeAt(MicroState& state, SimdLevel level) {
+    if (level > detectSimdLevel()) {
+        state.skip();
+        return;
+    }
+    int count = static_cast<int>(state.range());
+    std::vector<glm::vec2> positions;
+    std::vector<glm::vec3> colors;
+    positions.push_back(glm::vec2(0.0f));
+    colors.push_back(glm::vec3(1.0f));
+    for (int i = 0; i <= count; ++i) {
+        float angle = 2.0f * 3.14159265f * i / count;
+        positions.push_back(0.8f * glm::vec2(std::cos(angle), std::sin(angle)));
+        colors.push_back(glm::vec3(0.5f + 0.5f * std::cos(angle), 0.5f + 0.5f * std::sin(angle), 0.5f));
+    }
+    SoftRasterizer rasterizer(nullptr, level);
+    rasterizer.resize(800, 600);
+    while (state.keepRunning()) {
+        rasterizer.clear(0xFF000000u);
+        rasterizer.draw(SoftPrimitive::TriangleFan, positions.data(), colors.data(), static_cast<int>(positions.size()));
+        rasterizer.finish();
+        doNotOptimize(rasterizer.getPixels());
+    }
+    state.setOpsPerIteration(count);
+}
+
+static void softRasterizeScalar(MicroState& state) {
+    softRasterizeAt(state, SimdLevel::Scalar);
+}
+MICRO_BENCHMARK(softRasterizeScalar, 64, 4096);
+
+static void softRasterizeSse2(MicroState& state) {
+    softRasterizeAt(state, SimdLevel::Sse2);
+}
+MICRO_BENCHMARK(softRasterizeSse2, 64, 4096);
+
+static void softRasterizeAvx2(MicroState& state) {
+    softRasterizeAt(state, SimdLevel::Avx2);
+}
+MICRO_BENCHMARK(softRasterizeAvx2, 64, 4096);
+
+// --- Geradores de geometria (uma op = uma chamada) ---
+
+static void circleVertices(MicroState& state) {
+    int numSegments = static_cast<int>(state.range());
+    while (state.keepRunning()) {
+        std::pmr::vector<float> vertices = createCircleVertices(0.2f, numSegments);
+        doNotOptimize(vertices.data());
+    }
+}
+MICRO_BENCHMARK(circleVertices, 16, 256, 4096, 65536);
+
+static void circleVerticesJobs(MicroState& state) {
+    int numSegments = static_cast<int>(state.range());
+    while (state.keepRunning()) {
+        std::pmr::vector<float> vertices = createCircleVertices(microJobs(), 0.2f, numSegments);
+        doNotOptimize(vertices.data());
+    }
+}
+MICRO_BENCHMARK(circleVerticesJobs, 4096, 65536, 1000000);
+
+// Como na cena ex6: os vértices do quadro na arena, que volta ao início a cada quadro
+static void circleVerticesArena(MicroState& state) {
+    int numSegments = static_cast<int>(state.range());
+    FrameArena arena;
+    // Um quadro antes do laço: se ele não couber, o reset da primeira iteração (aquecimento)
+    // já deixa a arena do tamanho do pico
+    createCircleVertices(0.2f, numSegments, &arena);
+    state.expectNoAllocations();
+    while (state.keepRunning()) {
+        arena.reset();
+        std::pmr::vector<float> vertices = createCircleVertices(0.2f, numSegments, &arena);
+        doNotOptimize(vertices.data());
+    }
+}
+MICRO_BENCHMARK(circleVerticesArena, 16, 256, 4096, 65536);
+
+static void circleVerticesToTriangle(MicroState& state) {
+    int numSegments = static_cast<int>(state.range());
+    while (state.keepRunning()) {
+        std::pmr::vector<float> vertices = createCircleVerticesToTriangle(0.5f, numSegments);
+        doNotOptimize(vertices.data());
+    }
+}
+MICRO_BENCHMARK(circleVerticesToTriangle, 16, 256, 4096, 65536);
+
+static void spiralVertices(MicroState& state) {
+    int numSegments = static_cast<int>(state.range());
+    while (state.keepRunning()) {
+        std::pmr::vector<float> vertices = createSpiralVertices(numSegments);
+        doNotOptimize(vertices.data());
+    }
+}
+MICRO_BENCHMARK(spiralVertices, 64, 10000, 1000000);
+
+// --- Execução ---
+
+struct MicroResult {
+    std::string name;
+    uint64_t iterations;
+    std::vector<double> nsPerOp; // uma amostra por repetição
+    double allocationsPerOp;
+    double bytesPerOp;
+    uint64_t unexpectedAllocations; // alocações de um benchmark com expectNoAllocations()
+};
+
+static MicroState runOnce(const MicroBenchmark& benchmark, int64_t range, uint64_t iterations) {
+    MicroState state(range, iterations);
+    benchmark.function(state);
+    return state;
+}
+
+// Dobra as iterações (ou extrapola pelo tempo medido) até uma rodada durar minTime
+static uint64_t calibrate(const MicroBenchmark& benchmark, int64_t range, double minTime) {
+    uint64_t iterations = 1;
+    while (true) {
+        MicroState state = runOnce(benchmark, range, iterations);
+        if (state.isSkipped()) {
+            return 0;
+        }
+        double seconds = state.elapsedNs() / 1e9;
+        if (seconds >= minTime || iterations >= 1000000000ull) {
+            return iterations;
+        }
+        double factor = seconds > 0.0 ? minTime * 1.4 / seconds : 100.0;
+        iterations = static_cast<uint64_t>(iterations * std::min(100.0, std::max(2.0, factor)));
+    }
+}
+
+static MicroResult run(const MicroBenchmark& benchmark, int64_t range, double minTime, int repetitions) {
+    MicroResult result;
+    result.name = benchmark.name + "/" + std::to_string(range);
+    result.iterations = calibrate(benchmark, range, minTime);
+    result.allocationsPerOp = 0.0;
+    result.bytesPerOp = 0.0;
+    result.unexpectedAllocations = 0;
+    if (result.iterations == 0) {
+        return result;
+    }
+    for (int i = 0; i < repetitions; ++i) {
+        MicroState state = runOnce(benchmark, range, result.iterations);
+        result.nsPerOp.push_back(state.elapsedNs() / state.totalOps());
+        result.allocationsPerOp = state.getAllocations() / state.totalOps();
+        result.bytesPerOp = state.getBytes() / state.totalOps();
+        if (state.expectsNoAllocations()) {
+            result.unexpectedAllocations += state.getAllocations();
+        }
+    }
+    return result;
+}
+
+static double median(std::vector<double> samples) {
+    std::sort(samples.begin(), samples.end());
+    return samples[samples.size() / 2];
+}
+
+// Lido por tools/bench_compare.py, como o JSON do bench de cenas
+static void writeJson(std::ostream& out, const std::vector<MicroResult>& results) {
+    out.precision(6);
+    out << "{\n";
+    out << "  \"version\": 1,\n";
+#ifdef __OPTIMIZE__
+    out << "  \"optimized\": true,\n";
+#else
+    out << "  \"optimized\": false,\n";
+#endif
+    out << "  \"benchmarks\": [\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const MicroResult& result = results[i];
+        out << "    { \"name\": \"" << result.name << "\", \"iterations\": " << result.iterations
+            << ", \"nsPerOp\": " << median(result.nsPerOp)
+            << ", \"allocationsPerOp\": " << result.allocationsPerOp
+            << ", \"bytesPerOp\": " << result.bytesPerOp << ", \"samples\": [";
+        for (size_t j = 0; j < result.nsPerOp.size(); ++j) {
+            out << (j ? ", " : "") << result.nsPerOp[j];
+        }
+        out << "] }" << (i + 1 < results.size() ? ",\n" : "\n");
+    }
+    out << "  ]\n";
+    out << "}\n";
+}
+
+int main(int argc, char** argv) {
+    std::vector<std::string> filters;
+    double minTime = 0.1;
+    int repetitions = 10;
+    const char* out = nullptr;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--filter" && hasValue) {
+            filters.push_back(argv[++i]);
+        } else if (arg == "--min-time" && hasValue) {
+            minTime = std::atof(argv[++i]);
+        } else if (arg == "--repetitions" && hasValue) {
+            repetitions = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--out" && hasValue) {
+            out = argv[++i];
+        } else {
+            std::cerr << "uso: " << argv[0] << " [--filter nome]... [--min-time s] [--repetitions N] [--out micro.json]" << std::endl;
+            return 1;
+        }
+    }
+
+    std::vector<MicroResult> results;
+    bool allocated = false;
+    std::printf("%-36s %12s %12s %12s %12s\n", "benchmark", "iterações", "ns/op", "aloc/op", "bytes/op");
+    for (const auto& benchmark : microBenchmarks()) {
+        for (int64_t range : benchmark.ranges) {
+            std::string name = benchmark.name + "/" + std::to_string(range);
+            bool selected = filters.empty();
+            for (const auto& filter : filters) {
+                selected = selected || name.find(filter) != std::string::npos;
+            }
+            if (!selected) {
+                continue;
+            }
+
+            MicroResult result = run(benchmark, range, minTime, repetitions);
+            if (result.nsPerOp.empty()) {
+                std::printf("%-36s %12s\n", name.c_str(), "(sem suporte nesta CPU)");
+                continue;
+            }
+            results.push_back(result);
+            std::printf("%-36s %12llu %12.3f %12.4g %12.4g\n", result.name.c_str(), static_cast<unsigned long long>(result.iterations),
+                        median(result.nsPerOp), result.allocationsPerOp, result.bytesPerOp);
+            std::fflush(stdout);
+            if (result.unexpectedAllocations > 0) {
+                std::cerr << "Erro: " << result.name << " não deveria alocar e alocou " << result.unexpectedAllocations << " vezes" << std::endl;
+                allocated = true;
+            }
+        }
+    }
+
+    if (out) {
+        std::ofstream file(out);
+        if (!file) {
+            std::cerr << "Erro ao abrir " << out << std::endl;
+            return 1;
+        }
+        writeJson(file, results);
+    }
+    return allocated ? 1 : 0;
+}
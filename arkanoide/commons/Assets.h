@@ -0,0 +1,28 @@
+// Resolve caminhos de assets (shaders, fases) a partir de uma raiz, em vez de caminhos absolutos.
+// Raiz: $ARKANOIDE_ASSETS se definida, senão o diretório do executável.
+
+#pragma once
+
+#include <cstdlib>
+#include <string>
+#include <unistd.h>
+
+inline const std::string& assetRoot() {
+    static const std::string root = []() {
+        if (const char* path = std::getenv("ARKANOIDE_ASSETS")) {
+            return std::string(path);
+        }
+        char executable[4096];
+        ssize_t length = readlink("/proc/self/exe", executable, sizeof(executable) - 1);
+        if (length > 0) {
+            std::string path(executable, length);
+            return path.substr(0, path.find_last_of('/'));
+        }
+        return std::string(".");
+    }();
+    return root;
+}
+
+inline std::string assetPath(const std::string& relativePath) {
+    return assetRoot() + "/" + relativePath;
+}
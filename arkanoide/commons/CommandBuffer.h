@@ -0,0 +1,132 @@
+// Pacotes de comando de desenho gravados pela simulação e consumidos pela thread de render.
+// Nenhuma chamada OpenGL acontece aqui: os objetos só descrevem o que querem desenhar,
+// e o Renderer (única thread dona do contexto GL) traduz isso em chamadas GL.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <glm/glm.hpp>
+
+// Malhas que o Renderer cria uma única vez na inicialização
+enum class Mesh {
+    Quad,     // quadrado unitário centrado na origem (GL_TRIANGLES, 6 vértices)
+    Contour   // moldura do campo (GL_LINE_STRIP, coordenadas absolutas)
+};
+
+// Vértices (x, y) de cada malha: o Renderer os envia uma vez para a GPU, o SoftwareRenderer
+// os lê direto
+inline const std::vector<glm::vec2>& meshVertices(Mesh mesh) {
+    // Quadrado unitário, escalado por largura/altura em cada instância
+    static const std::vector<glm::vec2> quad = {
+        glm::vec2(-0.5f, -0.5f),
+        glm::vec2( 0.5f, -0.5f),
+        glm::vec2( 0.5f,  0.5f),
+        glm::vec2( 0.5f,  0.5f),
+        glm::vec2(-0.5f,  0.5f),
+        glm::vec2(-0.5f, -0.5f)
+    };
+    static const std::vector<glm::vec2> contour = {
+        glm::vec2(-0.8f, -1.0f),
+        glm::vec2(-0.8f,  0.9f),
+        glm::vec2( 0.7f,  0.9f),
+        glm::vec2( 0.7f, -1.0f)
+    };
+    return mesh == Mesh::Contour ? contour : quad;
+}
+
+// Variantes do uber-shader que o jogo usa; comandos seguidos com o mesmo programa e
+// a mesma malha viram um único draw instanciado
+enum class Program {
+    Flat,     // cor sólida
+    Circle    // Mesh::Quad recortado em círculo de diâmetro = escala
+};
+
+struct DrawCommand {
+    Program program;
+    Mesh mesh;
+    glm::vec2 position;
+    glm::vec2 scale;
+    glm::vec3 color;
+};
+
+// Partícula já no formato do upload: um GL_POINT com cor RGBA8 (vermelho no byte mais baixo)
+struct PointVertex {
+    glm::vec2 position;
+    uint32_t color;
+};
+
+// Trecho [first, first + count) de Frame::points escrito por uma thread gravadora
+struct PointRange {
+    int first;
+    int count;
+};
+
+// Atributos por instância de Mesh::Quad, no formato do buffer de instâncias da GPU
+struct InstanceData {
+    glm::vec2 offset;
+    glm::vec2 scale;
+    glm::vec3 color;
+};
+
+// Trecho [first, first + count) de uma camada persistente a reenviar
+struct InstanceSpan {
+    int first;
+    int count;
+};
+
+// O que mudou numa camada persistente (InstanceLayer) desde o quadro anterior. O
+// Renderer guarda a camada na GPU e só aplica os trechos; como todo quadro entregue é
+// executado, em ordem, as mudanças se acumulam lá sem nunca reenviar o todo.
+struct LayerUpdate {
+    int count = 0;       // instâncias vivas, a partir de 0
+    int capacity = 0;    // capacidade do buffer; se mudou, os trechos cobrem [0, count)
+    std::vector<InstanceSpan> spans;
+    std::vector<InstanceData> data; // os trechos de spans, concatenados
+    glm::vec2 offset = glm::vec2(0.0f); // translação da camada inteira (rolagem)
+
+    // Onde a camada mudou de aparência, sem a translação: (min.x, min.y, max.x, max.y) de
+    // cada instância posta ou tirada. Mover uma instância de slot não muda nada na tela.
+    std::vector<glm::vec4> damage;
+    bool damageAll = false; // mudou demais para listar: considere a camada inteira
+};
+
+class CommandBuffer {
+public:
+    void clear() {
+        commands.clear();
+    }
+
+    void push(Program program, Mesh mesh, glm::vec2 position, glm::vec2 scale, glm::vec3 color) {
+        commands.push_back(DrawCommand{ program, mesh, position, scale, color });
+    }
+
+    const std::vector<DrawCommand>& getCommands() const {
+        return commands;
+    }
+
+private:
+    std::vector<DrawCommand> commands;
+};
+
+// Um quadro completo: o fundo estático e os blocos (camada persistente), desenhados
+// primeiro, um buffer por thread gravadora, submetidos na ordem do vetor, e as
+// partículas, por cima de tudo. O fundo e os blocos são guardados numa textura pelo
+// Renderer e só redesenhados onde mudam, então o fundo deve ser o mesmo de um quadro
+// para o outro. `points` não é limpo: cada thread sobrescreve o seu trecho e só o que
+// está em `pointRanges` é enviado. `bricks` também não: InstanceLayer::flush o reescreve.
+struct Frame {
+    CommandBuffer background;
+    LayerUpdate bricks;
+    std::vector<CommandBuffer> buffers;
+    std::vector<PointVertex> points;
+    std::vector<PointRange> pointRanges;
+
+    void clear() {
+        background.clear();
+        for (auto& buffer : buffers) {
+            buffer.clear();
+        }
+        pointRanges.clear();
+    }
+};
@@ -0,0 +1,145 @@
+// Gerado por tools/embed_shaders.py a partir de shaders/. Não editar à mão.
+
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+struct EmbeddedShader {
+    std::string_view path;
+    std::string_view source;
+    uint64_t hash;
+};
+
+inline constexpr EmbeddedShader embeddedShaders[] = {
+    { "shaders/uber.fs", R"glsl(#version 330 core
+#if defined(SCREEN_TEXTURE)
+in vec2 screenPosition;
+uniform sampler2D screenTexture;
+#elif defined(VERTEX_COLOR) || defined(INSTANCED)
+in vec3 fragColor;
+#else
+uniform vec3 shapeColor;
+#endif
+#ifdef SDF_CIRCLE
+in vec2 localPosition;
+#endif
+
+out vec4 FragColor;
+
+void main() {
+#ifdef SDF_CIRCLE
+    // Círculo desenhado num quadrado: descarta o que estiver fora do raio
+    if (dot(localPosition, localPosition) > 1.0) {
+        discard;
+    }
+#endif
+#if defined(SCREEN_TEXTURE)
+    FragColor = texture(screenTexture, screenPosition);
+#elif defined(VERTEX_COLOR) || defined(INSTANCED)
+    FragColor = vec4(fragColor, 1.0);
+#else
+    FragColor = vec4(shapeColor, 1.0);
+#endif
+}
+)glsl", 0xbb1c3503e16aaae3ull },
+    { "shaders/uber.vs", R"glsl(#version 330 core
+// Uber-shader: as variantes são escolhidas com #define (ver commons/ShaderVariants.h)
+layout(location = 0) in vec3 inPosition;
+#ifdef VERTEX_COLOR
+layout(location = 1) in vec3 inColor;
+#endif
+#ifdef INSTANCED
+layout(location = 2) in vec2 instanceOffset;
+layout(location = 3) in vec2 instanceScale;
+layout(location = 4) in vec3 instanceColor;
+#endif
+
+#ifdef PROJECTION
+uniform mat4 projection;
+#endif
+#ifdef MODEL
+uniform mat4 model;
+#endif
+#ifdef SCALE
+uniform float scale;
+#endif
+
+#if defined(VERTEX_COLOR) || defined(INSTANCED)
+out vec3 fragColor;
+#endif
+#ifdef SDF_CIRCLE
+out vec2 localPosition;
+#endif
+#ifdef SCREEN_TEXTURE
+out vec2 screenPosition;
+#endif
+
+void main() {
+    vec4 position = vec4(inPosition, 1.0);
+#ifdef SCALE
+    position.xy *= scale;
+#endif
+#ifdef SDF_CIRCLE
+    // Quadrado unitário (-0.5..0.5) vira o disco de raio 1 no fragment shader
+    localPosition = inPosition.xy * 2.0;
+#endif
+#ifdef INSTANCED
+    position.xy = position.xy * instanceScale + instanceOffset;
+    fragColor = instanceColor;
+#endif
+#ifdef MODEL
+    position = model * position;
+#endif
+#ifdef PROJECTION
+    position = projection * position;
+#endif
+#ifdef VERTEX_COLOR
+    fragColor = inColor;
+#endif
+#ifdef SCREEN_TEXTURE
+    // Coordenada de textura = posição na tela (clip -1..1 -> 0..1)
+    screenPosition = position.xy / position.w * 0.5 + 0.5;
+#endif
+    gl_Position = position;
+}
+)glsl", 0x6c8b6af5709f9322ull },
+};
+
+constexpr uint64_t embeddedShaderHash(std::string_view source) {
+    uint64_t value = 14695981039346656037ull;
+    for (char c : source) {
+        value ^= static_cast<unsigned char>(c);
+        value *= 1099511628211ull;
+    }
+    return value;
+}
+
+// Validação mínima: diretiva de versão, um main() e chaves/parênteses balanceados
+constexpr bool isValidEmbeddedShader(const EmbeddedShader& shader) {
+    if (shader.source.substr(0, 17) != "#version 330 core" || shader.source.find("void main()") == std::string_view::npos) {
+        return false;
+    }
+    int braces = 0;
+    int parentheses = 0;
+    for (char c : shader.source) {
+        braces += (c == '{') - (c == '}');
+        parentheses += (c == '(') - (c == ')');
+        if (braces < 0 || parentheses < 0) {
+            return false;
+        }
+    }
+    return braces == 0 && parentheses == 0 && embeddedShaderHash(shader.source) == shader.hash;
+}
+
+static_assert(isValidEmbeddedShader(embeddedShaders[0]), "shaders/uber.fs inválido ou desatualizado: rode tools/embed_shaders.py");
+static_assert(isValidEmbeddedShader(embeddedShaders[1]), "shaders/uber.vs inválido ou desatualizado: rode tools/embed_shaders.py");
+
+constexpr const EmbeddedShader* findEmbeddedShader(std::string_view path) {
+    for (const auto& shader : embeddedShaders) {
+        if (shader.path == path) {
+            return &shader;
+        }
+    }
+    return nullptr;
+}
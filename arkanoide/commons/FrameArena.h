@@ -0,0 +1,110 @@
+// Arena linear para os temporários de um quadro (ou de um tick da simulação): alocar é
+// só avançar um ponteiro, liberar não faz nada e reset() devolve tudo de uma vez. É um
+// std::pmr::memory_resource, então os arrays temporários viram std::pmr::vector<T>
+// construídos com &arena e saem daqui em vez do heap.
+//
+// Quando um quadro não cabe, o excedente vem do heap em blocos extras; no reset() seguinte
+// eles são trocados por um bloco só, do tamanho do pico (pelo menos o dobro do anterior).
+// Depois dos primeiros quadros a arena para de crescer e nenhum quadro chama new.
+// Uma arena por thread: nada aqui é sincronizado.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+
+class FrameArena : public std::pmr::memory_resource {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 64 * 1024;
+
+    explicit FrameArena(size_t capacity = DEFAULT_CAPACITY) {
+        use(newChunk(capacity, nullptr));
+    }
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    ~FrameArena() override {
+        freeChunks();
+    }
+
+    // Descarta tudo o que foi alocado desde o último reset: nada que saiu da arena pode
+    // continuar em uso (containers com ela precisam ter sido destruídos ou limpos antes)
+    void reset() {
+        if (chunks->next) {
+            size_t capacity = std::max(required, 2 * chunks->size);
+            freeChunks();
+            use(newChunk(capacity, nullptr));
+        }
+        cursor = chunks->data();
+        required = 0;
+    }
+
+    // Bytes do bloco atual
+    size_t capacity() const {
+        return chunks->size;
+    }
+
+private:
+    struct Chunk {
+        Chunk* next;
+        size_t size;
+
+        char* data() {
+            return reinterpret_cast<char*>(this + 1);
+        }
+    };
+
+    static constexpr size_t CHUNK_ALIGNMENT = alignof(std::max_align_t);
+
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        // Limite de espaço com qualquer alinhamento: é o que o próximo bloco precisa ter
+        required += bytes + alignment - 1;
+        char* pointer = align(cursor, alignment);
+        if (pointer > limit || bytes > static_cast<size_t>(limit - pointer)) {
+            use(newChunk(std::max(bytes + alignment, chunks->size), chunks));
+            pointer = align(cursor, alignment);
+        }
+        cursor = pointer + bytes;
+        return pointer;
+    }
+
+    void do_deallocate(void*, size_t, size_t) override {
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+    static char* align(char* pointer, size_t alignment) {
+        uintptr_t address = reinterpret_cast<uintptr_t>(pointer);
+        return pointer + ((alignment - address % alignment) % alignment);
+    }
+
+    static Chunk* newChunk(size_t size, Chunk* next) {
+        void* memory = std::pmr::new_delete_resource()->allocate(sizeof(Chunk) + size, CHUNK_ALIGNMENT);
+        return new (memory) Chunk{ next, size };
+    }
+
+    void use(Chunk* chunk) {
+        chunks = chunk;
+        cursor = chunk->data();
+        limit = cursor + chunk->size;
+    }
+
+    void freeChunks() {
+        while (chunks) {
+            Chunk* next = chunks->next;
+            std::pmr::new_delete_resource()->deallocate(chunks, sizeof(Chunk) + chunks->size, CHUNK_ALIGNMENT);
+            chunks = next;
+        }
+    }
+
+    Chunk* chunks = nullptr;  // o atual primeiro; os extras do quadro apontam para os anteriores
+    char* cursor = nullptr;
+    char* limit = nullptr;
+    size_t required = 0;      // bytes pedidos desde o reset, com folga para o alinhamento
+};
@@ -0,0 +1,320 @@
+// Camada de interceptação de chamadas GL sobre os ponteiros da glad.
+// install() troca glad_glDrawArrays & cia. por funções que contam e depois chamam a
+// original, então todo código que usa os nomes normais (glDrawArrays, ...) passa por
+// aqui sem mudar nada. Chamar uma vez, logo depois de gladLoadGLLoader.
+//
+// Os contadores não são atômicos: valem para programas com uma única thread GL (a
+// thread de render no arkanoide, a principal nas Listas).
+
+#pragma once
+
+#include <cstdint>
+
+#include <glad/glad.h>
+
+// Zerados a cada quadro por GlIntercept::resetFrame()
+struct GlFrameCounters {
+    uint64_t drawCalls = 0;
+    uint64_t instances = 0;
+    uint64_t programBinds = 0;
+    uint64_t vertexArrayBinds = 0;
+    uint64_t bufferBinds = 0;
+    uint64_t textureBinds = 0;
+    uint64_t framebufferBinds = 0;
+    uint64_t bytesUploaded = 0;  // glBufferData/glBufferSubData/glTexImage2D/glTexSubImage2D
+};
+
+// Objetos vivos desde install()
+struct GlObjectCounts {
+    int64_t buffers = 0;
+    int64_t vertexArrays = 0;
+    int64_t textures = 0;
+    int64_t framebuffers = 0;
+    int64_t programs = 0;
+    int64_t shaders = 0;
+    int64_t queries = 0;
+};
+
+class GlIntercept {
+public:
+    static void install() {
+        static bool installed = false;
+        if (installed) {
+            return;
+        }
+        installed = true;
+
+        Real& gl = real();
+        gl.drawArrays = glad_glDrawArrays;                   glad_glDrawArrays = drawArrays;
+        gl.drawArraysInstanced = glad_glDrawArraysInstanced; glad_glDrawArraysInstanced = drawArraysInstanced;
+        gl.drawElements = glad_glDrawElements;               glad_glDrawElements = drawElements;
+        gl.drawElementsInstanced = glad_glDrawElementsInstanced; glad_glDrawElementsInstanced = drawElementsInstanced;
+        gl.multiDrawArrays = glad_glMultiDrawArrays;         glad_glMultiDrawArrays = multiDrawArrays;
+
+        gl.useProgram = glad_glUseProgram;                   glad_glUseProgram = useProgram;
+        gl.bindVertexArray = glad_glBindVertexArray;         glad_glBindVertexArray = bindVertexArray;
+        gl.bindBuffer = glad_glBindBuffer;                   glad_glBindBuffer = bindBuffer;
+        gl.bindTexture = glad_glBindTexture;                 glad_glBindTexture = bindTexture;
+        gl.bindFramebuffer = glad_glBindFramebuffer;         glad_glBindFramebuffer = bindFramebuffer;
+
+        gl.bufferData = glad_glBufferData;                   glad_glBufferData = bufferData;
+        gl.bufferSubData = glad_glBufferSubData;             glad_glBufferSubData = bufferSubData;
+        gl.texImage2D = glad_glTexImage2D;                   glad_glTexImage2D = texImage2D;
+        gl.texSubImage2D = glad_glTexSubImage2D;             glad_glTexSubImage2D = texSubImage2D;
+
+        gl.genBuffers = glad_glGenBuffers;                   glad_glGenBuffers = genBuffers;
+        gl.deleteBuffers = glad_glDeleteBuffers;             glad_glDeleteBuffers = deleteBuffers;
+        gl.genVertexArrays = glad_glGenVertexArrays;         glad_glGenVertexArrays = genVertexArrays;
+        gl.deleteVertexArrays = glad_glDeleteVertexArrays;   glad_glDeleteVertexArrays = deleteVertexArrays;
+        gl.genTextures = glad_glGenTextures;                 glad_glGenTextures = genTextures;
+        gl.deleteTextures = glad_glDeleteTextures;           glad_glDeleteTextures = deleteTextures;
+        gl.genFramebuffers = glad_glGenFramebuffers;         glad_glGenFramebuffers = genFramebuffers;
+        gl.deleteFramebuffers = glad_glDeleteFramebuffers;   glad_glDeleteFramebuffers = deleteFramebuffers;
+        gl.genQueries = glad_glGenQueries;                   glad_glGenQueries = genQueries;
+        gl.deleteQueries = glad_glDeleteQueries;             glad_glDeleteQueries = deleteQueries;
+        gl.createProgram = glad_glCreateProgram;             glad_glCreateProgram = createProgram;
+        gl.deleteProgram = glad_glDeleteProgram;             glad_glDeleteProgram = deleteProgram;
+        gl.createShader = glad_glCreateShader;               glad_glCreateShader = createShader;
+        gl.deleteShader = glad_glDeleteShader;               glad_glDeleteShader = deleteShader;
+    }
+
+    static const GlFrameCounters& frame() {
+        return frameCounters();
+    }
+
+    static const GlObjectCounts& objects() {
+        return objectCounts();
+    }
+
+    static void resetFrame() {
+        frameCounters() = GlFrameCounters();
+    }
+
+    // Bytes lidos da memória do cliente num upload de textura, com as linhas alinhadas a
+    // 4 bytes (GL_UNPACK_ALIGNMENT padrão)
+    static uint64_t textureBytes(GLsizei width, GLsizei height, GLenum format, GLenum type) {
+        uint64_t components = 4;
+        switch (format) {
+        case GL_RED: case GL_DEPTH_COMPONENT: components = 1; break;
+        case GL_RG: case GL_DEPTH_STENCIL: components = 2; break;
+        case GL_RGB: case GL_BGR: components = 3; break;
+        default: break;
+        }
+        uint64_t size = 1;
+        switch (type) {
+        case GL_UNSIGNED_SHORT: case GL_SHORT: case GL_HALF_FLOAT: size = 2; break;
+        case GL_UNSIGNED_INT: case GL_INT: case GL_FLOAT: size = 4; break;
+        default: break;
+        }
+        uint64_t row = (static_cast<uint64_t>(width) * components * size + 3) & ~static_cast<uint64_t>(3);
+        return row * height;
+    }
+
+private:
+    struct Real {
+        PFNGLDRAWARRAYSPROC drawArrays;
+        PFNGLDRAWARRAYSINSTANCEDPROC drawArraysInstanced;
+        PFNGLDRAWELEMENTSPROC drawElements;
+        PFNGLDRAWELEMENTSINSTANCEDPROC drawElementsInstanced;
+        PFNGLMULTIDRAWARRAYSPROC multiDrawArrays;
+        PFNGLUSEPROGRAMPROC useProgram;
+        PFNGLBINDVERTEXARRAYPROC bindVertexArray;
+        PFNGLBINDBUFFERPROC bindBuffer;
+        PFNGLBINDTEXTUREPROC bindTexture;
+        PFNGLBINDFRAMEBUFFERPROC bindFramebuffer;
+        PFNGLBUFFERDATAPROC bufferData;
+        PFNGLBUFFERSUBDATAPROC bufferSubData;
+        PFNGLTEXIMAGE2DPROC texImage2D;
+        PFNGLTEXSUBIMAGE2DPROC texSubImage2D;
+        PFNGLGENBUFFERSPROC genBuffers;
+        PFNGLDELETEBUFFERSPROC deleteBuffers;
+        PFNGLGENVERTEXARRAYSPROC genVertexArrays;
+        PFNGLDELETEVERTEXARRAYSPROC deleteVertexArrays;
+        PFNGLGENTEXTURESPROC genTextures;
+        PFNGLDELETETEXTURESPROC deleteTextures;
+        PFNGLGENFRAMEBUFFERSPROC genFramebuffers;
+        PFNGLDELETEFRAMEBUFFERSPROC deleteFramebuffers;
+        PFNGLGENQUERIESPROC genQueries;
+        PFNGLDELETEQUERIESPROC deleteQueries;
+        PFNGLCREATEPROGRAMPROC createProgram;
+        PFNGLDELETEPROGRAMPROC deleteProgram;
+        PFNGLCREATESHADERPROC createShader;
+        PFNGLDELETESHADERPROC deleteShader;
+    };
+
+    static Real& real() {
+        static Real functions;
+        return functions;
+    }
+
+    static GlFrameCounters& frameCounters() {
+        static GlFrameCounters counters;
+        return counters;
+    }
+
+    static GlObjectCounts& objectCounts() {
+        static GlObjectCounts counts;
+        return counts;
+    }
+
+    // glDelete* ignora o nome 0, então ele não conta
+    static int64_t countNames(GLsizei n, const GLuint* names) {
+        int64_t count = 0;
+        for (GLsizei i = 0; i < n; ++i) {
+            count += names[i] != 0;
+        }
+        return count;
+    }
+
+    static void APIENTRY drawArrays(GLenum mode, GLint first, GLsizei count) {
+        frameCounters().drawCalls++;
+        frameCounters().instances++;
+        real().drawArrays(mode, first, count);
+    }
+
+    static void APIENTRY drawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) {
+        frameCounters().drawCalls++;
+        frameCounters().instances += instancecount;
+        real().drawArraysInstanced(mode, first, count, instancecount);
+    }
+
+    static void APIENTRY drawElements(GLenum mode, GLsizei count, GLenum type, const void* indices) {
+        frameCounters().drawCalls++;
+        frameCounters().instances++;
+        real().drawElements(mode, count, type, indices);
+    }
+
+    static void APIENTRY drawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instancecount) {
+        frameCounters().drawCalls++;
+        frameCounters().instances += instancecount;
+        real().drawElementsInstanced(mode, count, type, indices, instancecount);
+    }
+
+    // Um glMultiDrawArrays equivale a drawcount glDrawArrays, e é assim que conta
+    static void APIENTRY multiDrawArrays(GLenum mode, const GLint* first, const GLsizei* count, GLsizei drawcount) {
+        frameCounters().drawCalls += drawcount;
+        frameCounters().instances += drawcount;
+        real().multiDrawArrays(mode, first, count, drawcount);
+    }
+
+    static void APIENTRY useProgram(GLuint program) {
+        frameCounters().programBinds++;
+        real().useProgram(program);
+    }
+
+    static void APIENTRY bindVertexArray(GLuint array) {
+        frameCounters().vertexArrayBinds++;
+        real().bindVertexArray(array);
+    }
+
+    static void APIENTRY bindBuffer(GLenum target, GLuint buffer) {
+        frameCounters().bufferBinds++;
+        real().bindBuffer(target, buffer);
+    }
+
+    static void APIENTRY bindTexture(GLenum target, GLuint texture) {
+        frameCounters().textureBinds++;
+        real().bindTexture(target, texture);
+    }
+
+    static void APIENTRY bindFramebuffer(GLenum target, GLuint framebuffer) {
+        frameCounters().framebufferBinds++;
+        real().bindFramebuffer(target, framebuffer);
+    }
+
+    static void APIENTRY bufferData(GLenum target, GLsizeiptr size, const void* data, GLenum usage) {
+        if (data) {
+            frameCounters().bytesUploaded += size;
+        }
+        real().bufferData(target, size, data, usage);
+    }
+
+    static void APIENTRY bufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void* data) {
+        frameCounters().bytesUploaded += size;
+        real().bufferSubData(target, offset, size, data);
+    }
+
+    static void APIENTRY texImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void* pixels) {
+        if (pixels) {
+            frameCounters().bytesUploaded += textureBytes(width, height, format, type);
+        }
+        real().texImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+    }
+
+    static void APIENTRY texSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void* pixels) {
+        frameCounters().bytesUploaded += textureBytes(width, height, format, type);
+        real().texSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+    }
+
+    static void APIENTRY genBuffers(GLsizei n, GLuint* buffers) {
+        real().genBuffers(n, buffers);
+        objectCounts().buffers += n;
+    }
+
+    static void APIENTRY deleteBuffers(GLsizei n, const GLuint* buffers) {
+        objectCounts().buffers -= countNames(n, buffers);
+        real().deleteBuffers(n, buffers);
+    }
+
+    static void APIENTRY genVertexArrays(GLsizei n, GLuint* arrays) {
+        real().genVertexArrays(n, arrays);
+        objectCounts().vertexArrays += n;
+    }
+
+    static void APIENTRY deleteVertexArrays(GLsizei n, const GLuint* arrays) {
+        objectCounts().vertexArrays -= countNames(n, arrays);
+        real().deleteVertexArrays(n, arrays);
+    }
+
+    static void APIENTRY genTextures(GLsizei n, GLuint* textures) {
+        real().genTextures(n, textures);
+        objectCounts().textures += n;
+    }
+
+    static void APIENTRY deleteTextures(GLsizei n, const GLuint* textures) {
+        objectCounts().textures -= countNames(n, textures);
+        real().deleteTextures(n, textures);
+    }
+
+    static void APIENTRY genFramebuffers(GLsizei n, GLuint* framebuffers) {
+        real().genFramebuffers(n, framebuffers);
+        objectCounts().framebuffers += n;
+    }
+
+    static void APIENTRY deleteFramebuffers(GLsizei n, const GLuint* framebuffers) {
+        objectCounts().framebuffers -= countNames(n, framebuffers);
+        real().deleteFramebuffers(n, framebuffers);
+    }
+
+    static void APIENTRY genQueries(GLsizei n, GLuint* ids) {
+        real().genQueries(n, ids);
+        objectCounts().queries += n;
+    }
+
+    static void APIENTRY deleteQueries(GLsizei n, const GLuint* ids) {
+        objectCounts().queries -= countNames(n, ids);
+        real().deleteQueries(n, ids);
+    }
+
+    static GLuint APIENTRY createProgram() {
+        GLuint program = real().createProgram();
+        objectCounts().programs += program != 0;
+        return program;
+    }
+
+    static void APIENTRY deleteProgram(GLuint program) {
+        objectCounts().programs -= program != 0;
+        real().deleteProgram(program);
+    }
+
+    static GLuint APIENTRY createShader(GLenum type) {
+        GLuint shader = real().createShader(type);
+        objectCounts().shaders += shader != 0;
+        return shader;
+    }
+
+    static void APIENTRY deleteShader(GLuint shader) {
+        objectCounts().shaders -= shader != 0;
+        real().deleteShader(shader);
+    }
+};
@@ -0,0 +1,466 @@
+// Modo de depuração/trace sobre os ponteiros da glad. Ao contrário da GlIntercept (que
+// conta só o que o HUD mostra), install() envolve todas as funções carregadas: conta as
+// chamadas e mede o tempo passado no driver por função, e, com startRecording(), grava
+// um trace binário compacto que tools/gl_replay.cpp executa offline, sem a lógica do jogo.
+//
+// As funções envolvidas são geradas por tools/gen_gl_trace.py (GlTraceFunctions.h).
+// Uma única thread GL, como na GlIntercept; funções carregadas fora da glad (program
+// binaries do ShaderCache, extensões via glfwGetProcAddress) não passam por aqui.
+//
+// Formato: cabeçalho { "PGTR", versão, GlFunction::Count } seguido de registros
+// { uint16 função, uint32 tamanho do corpo, corpo }. Escalares vão com o tamanho do tipo;
+// ponteiros com tamanho conhecido vão como { uint32 bytes, dados alinhados a 8 bytes no
+// corpo } (0xFFFFFFFF = nulo), para o replay passar ao driver ponteiros alinhados.
+// FRAME_MARKER separa os quadros.
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ostream>
+#include <unordered_map>
+#include <vector>
+
+#include <glad/glad.h>
+
+#include "GlIntercept.h"
+
+namespace GlObject {
+    enum : uint8_t {
+        Buffer,
+        VertexArray,
+        Texture,
+        Framebuffer,
+        Renderbuffer,
+        Query,
+        Sampler,
+        TransformFeedback,
+        Program,
+        Shader,
+        Count
+    };
+}
+
+// Grava uma chamada; os wrappers gerados criam um por chamada
+class GlTraceRecord {
+public:
+    explicit GlTraceRecord(uint16_t function);
+
+    template <typename T>
+    void value(T data) {
+        if (active) {
+            append(&data, sizeof(data));
+        }
+    }
+
+    void offset(const void* pointer) {
+        value(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(pointer)));
+    }
+
+    void bytes(const void* data, uint64_t size) {
+        if (!active) {
+            return;
+        }
+        uint32_t length = data ? static_cast<uint32_t>(size) : NULL_BYTES;
+        append(&length, sizeof(length));
+        if (data) {
+            align();
+            append(data, size);
+        }
+    }
+
+    void string(const GLchar* text) {
+        bytes(text, text ? std::strlen(text) + 1 : 0);
+    }
+
+    // Cada trecho vira uma string terminada em zero, então o replay passa length = nullptr
+    void shaderSource(GLsizei count, const GLchar* const* strings, const GLint* lengths) {
+        if (!active) {
+            return;
+        }
+        for (GLsizei i = 0; i < count; ++i) {
+            size_t length = lengths && lengths[i] >= 0 ? static_cast<size_t>(lengths[i]) : std::strlen(strings[i]);
+            uint32_t stored = static_cast<uint32_t>(length + 1);
+            append(&stored, sizeof(stored));
+            align();
+            append(strings[i], length);
+            append("", 1);
+        }
+    }
+
+    void names(GLsizei n, const GLuint* names) {
+        if (active && n > 0) {
+            append(names, n * sizeof(GLuint));
+        }
+    }
+
+    // Chamada que o replay não sabe reproduzir: só o cabeçalho vai para o arquivo
+    void unsupported() {
+    }
+
+    void finish(uint64_t start);
+
+    static uint64_t now() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    static constexpr uint32_t NULL_BYTES = 0xFFFFFFFF;
+
+private:
+    void append(const void* data, size_t size);
+    void align();
+
+    uint16_t function;
+    bool active;
+};
+
+// Lê o corpo de um registro no replay e traduz nomes de objetos gravados para os do
+// contexto atual. Locations de uniform não são traduzidas: o replay assume o mesmo
+// driver e os mesmos shaders, que dão as mesmas locations.
+class GlTraceReader {
+public:
+    GlTraceReader() : scratchBuffer(SCRATCH_SIZE) {
+    }
+
+    // Copia o corpo para um buffer alinhado, onde os payloads também ficam alinhados
+    void reset(const char* data, size_t size) {
+        body.resize(size / sizeof(uint64_t) + 1);
+        std::memcpy(body.data(), data, size);
+        begin = reinterpret_cast<const char*>(body.data());
+        cursor = begin;
+        end = begin + size;
+    }
+
+    template <typename T>
+    T value() {
+        T data;
+        std::memcpy(&data, take(sizeof(T)), sizeof(T));
+        return data;
+    }
+
+    void* offset() {
+        return reinterpret_cast<void*>(static_cast<uintptr_t>(value<uint64_t>()));
+    }
+
+    const void* bytes() {
+        uint32_t length = value<uint32_t>();
+        if (length == GlTraceRecord::NULL_BYTES) {
+            return nullptr;
+        }
+        take((8 - (cursor - begin) % 8) % 8);
+        return take(length);
+    }
+
+    const GLchar* string() {
+        return static_cast<const GLchar*>(bytes());
+    }
+
+    const GLchar* const* shaderSource(GLsizei count) {
+        sources.clear();
+        for (GLsizei i = 0; i < count; ++i) {
+            sources.push_back(static_cast<const GLchar*>(bytes()));
+        }
+        return sources.data();
+    }
+
+    const GLint* shaderSourceLengths() {
+        return nullptr;
+    }
+
+    GLuint name(uint8_t kind, GLuint recorded) {
+        if (recorded == 0) {
+            return 0;
+        }
+        auto found = nameMaps[kind].find(recorded);
+        return found != nameMaps[kind].end() ? found->second : recorded;
+    }
+
+    const GLuint* names(uint8_t kind, GLsizei n) {
+        GLuint* translated = static_cast<GLuint*>(scratch());
+        for (GLsizei i = 0; i < n; ++i) {
+            translated[i] = name(kind, value<GLuint>());
+        }
+        return translated;
+    }
+
+    void mapName(uint8_t kind, GLuint recorded, GLuint actual) {
+        nameMaps[kind][recorded] = actual;
+    }
+
+    void mapNames(uint8_t kind, GLsizei n, const GLuint* actual) {
+        for (GLsizei i = 0; i < n; ++i) {
+            mapName(kind, value<GLuint>(), actual[i]);
+        }
+    }
+
+    // Destino das saídas (glGet*, glGen*) que o replay descarta
+    void* scratch() {
+        return scratchBuffer.data();
+    }
+
+private:
+    static const size_t SCRATCH_SIZE = 16 << 20;
+
+    const char* take(size_t size) {
+        const char* data = cursor;
+        cursor = std::min(cursor + size, end);
+        return data;
+    }
+
+    std::vector<uint64_t> body;
+    const char* begin = nullptr;
+    const char* cursor = nullptr;
+    const char* end = nullptr;
+    std::vector<char> scratchBuffer;
+    std::vector<const GLchar*> sources;
+    std::unordered_map<GLuint, GLuint> nameMaps[GlObject::Count];
+};
+
+#include "GlTraceFunctions.h"
+
+class GlTrace {
+public:
+    static constexpr uint32_t MAGIC = 0x52544750;  // "PGTR"
+    static constexpr uint32_t VERSION = 1;
+    static constexpr uint16_t FRAME_MARKER = 0xFFFF;
+
+    struct FunctionStats {
+        uint64_t calls = 0;
+        uint64_t nanoseconds = 0;
+    };
+
+    // Chamar uma vez, depois de gladLoadGLLoader (e de GlIntercept::install, se usada)
+    static void install() {
+        static bool installed = false;
+        if (!installed) {
+            installed = true;
+            glTraceInstallFunctions();
+        }
+    }
+
+    static bool startRecording(const char* path) {
+        State& state = shared();
+        stopRecording();
+        state.file = std::fopen(path, "wb");
+        if (!state.file) {
+            return false;
+        }
+        uint32_t header[3] = { MAGIC, VERSION, GlFunction::Count };
+        std::fwrite(header, sizeof(header), 1, state.file);
+        state.recording = true;
+        return true;
+    }
+
+    static void stopRecording() {
+        State& state = shared();
+        if (state.file) {
+            flush();
+            std::fclose(state.file);
+            state.file = nullptr;
+        }
+        state.recording = false;
+    }
+
+    static bool isRecording() {
+        return shared().recording;
+    }
+
+    // Fim de quadro (depois do swap); o replay mede o tempo entre marcadores
+    static void markFrame() {
+        State& state = shared();
+        if (state.recording) {
+            uint32_t size = 0;
+            write(&FRAME_MARKER, sizeof(FRAME_MARKER));
+            write(&size, sizeof(size));
+        }
+    }
+
+    static const FunctionStats* stats() {
+        return shared().stats;
+    }
+
+    // As `limit` funções com mais tempo no driver
+    static void writeReport(std::ostream& output, size_t limit = 20) {
+        report(output, shared().stats, limit);
+    }
+
+    static void report(std::ostream& output, const FunctionStats* stats, size_t limit) {
+        std::vector<uint16_t> order;
+        uint64_t totalCalls = 0;
+        uint64_t totalNanoseconds = 0;
+        for (uint16_t function = 0; function < GlFunction::Count; ++function) {
+            if (stats[function].calls > 0) {
+                order.push_back(function);
+                totalCalls += stats[function].calls;
+                totalNanoseconds += stats[function].nanoseconds;
+            }
+        }
+        std::sort(order.begin(), order.end(), [stats](uint16_t a, uint16_t b) {
+            return stats[a].nanoseconds > stats[b].nanoseconds;
+        });
+
+        char line[160];
+        std::snprintf(line, sizeof(line), "%-32s %12s %12s %10s\n", "funcao GL", "chamadas", "total ms", "ns/chamada");
+        output << line;
+        for (size_t i = 0; i < order.size() && i < limit; ++i) {
+            const FunctionStats& entry = stats[order[i]];
+            std::snprintf(line, sizeof(line), "%-32s %12llu %12.3f %10.0f\n", glFunctionNames[order[i]],
+                static_cast<unsigned long long>(entry.calls), entry.nanoseconds / 1e6, static_cast<double>(entry.nanoseconds) / entry.calls);
+            output << line;
+        }
+        std::snprintf(line, sizeof(line), "%-32s %12llu %12.3f\n", "total", static_cast<unsigned long long>(totalCalls), totalNanoseconds / 1e6);
+        output << line;
+    }
+
+private:
+    friend class GlTraceRecord;
+
+    struct State {
+        FunctionStats stats[GlFunction::Count];
+        bool recording = false;
+        FILE* file = nullptr;
+        std::vector<char> buffer;  // registros ainda não escritos
+        std::vector<char> body;    // corpo da chamada em andamento
+    };
+
+    static State& shared() {
+        static State state;
+        return state;
+    }
+
+    static void write(const void* data, size_t size) {
+        State& state = shared();
+        const char* bytes = static_cast<const char*>(data);
+        state.buffer.insert(state.buffer.end(), bytes, bytes + size);
+        if (state.buffer.size() >= (1 << 20)) {
+            flush();
+        }
+    }
+
+    static void flush() {
+        State& state = shared();
+        if (state.file && !state.buffer.empty()) {
+            std::fwrite(state.buffer.data(), 1, state.buffer.size(), state.file);
+        }
+        state.buffer.clear();
+    }
+};
+
+inline GlTraceRecord::GlTraceRecord(uint16_t function) {
+    this->function = function;
+    active = GlTrace::shared().recording;
+    if (active) {
+        GlTrace::shared().body.clear();
+    }
+}
+
+inline void GlTraceRecord::append(const void* data, size_t size) {
+    const char* bytes = static_cast<const char*>(data);
+    std::vector<char>& body = GlTrace::shared().body;
+    body.insert(body.end(), bytes, bytes + size);
+}
+
+inline void GlTraceRecord::align() {
+    std::vector<char>& body = GlTrace::shared().body;
+    body.resize((body.size() + 7) & ~static_cast<size_t>(7));
+}
+
+inline void GlTraceRecord::finish(uint64_t start) {
+    GlTrace::State& state = GlTrace::shared();
+    state.stats[function].calls++;
+    state.stats[function].nanoseconds += now() - start;
+    if (active) {
+        uint32_t size = static_cast<uint32_t>(state.body.size());
+        GlTrace::write(&function, sizeof(function));
+        GlTrace::write(&size, sizeof(size));
+        GlTrace::write(state.body.data(), state.body.size());
+    }
+}
+
+// Reproduz um trace gravado por GlTrace; precisa de um contexto GL corrente e da glad
+// carregada (sem GlTrace::install, para não medir o próprio replay duas vezes)
+class GlTracePlayer {
+public:
+    bool load(const char* path) {
+        FILE* file = std::fopen(path, "rb");
+        if (!file) {
+            return false;
+        }
+        std::fseek(file, 0, SEEK_END);
+        long size = std::ftell(file);
+        std::fseek(file, 0, SEEK_SET);
+        data.resize(size > 0 ? static_cast<size_t>(size) : 0);
+        size_t read = std::fread(data.data(), 1, data.size(), file);
+        std::fclose(file);
+
+        uint32_t header[3];
+        if (read != data.size() || data.size() < sizeof(header)) {
+            return false;
+        }
+        std::memcpy(header, data.data(), sizeof(header));
+        // O número de funções muda se a glad for regenerada: os ids deixariam de bater
+        if (header[0] != GlTrace::MAGIC || header[1] != GlTrace::VERSION || header[2] != GlFunction::Count) {
+            return false;
+        }
+        position = sizeof(header);
+        return true;
+    }
+
+    // Executa as chamadas até o próximo marcador de quadro; false quando o trace acaba
+    bool playFrame() {
+        const size_t recordHeader = sizeof(uint16_t) + sizeof(uint32_t);
+        bool played = false;
+        while (position + recordHeader <= data.size()) {
+            uint16_t function;
+            uint32_t size;
+            std::memcpy(&function, &data[position], sizeof(function));
+            std::memcpy(&size, &data[position + sizeof(function)], sizeof(size));
+            position += recordHeader;
+            if (position + size > data.size()) {
+                position = data.size();
+                break;
+            }
+            played = true;
+            if (function == GlTrace::FRAME_MARKER) {
+                ++frames;
+                return true;
+            }
+
+            reader.reset(&data[position], size);
+            uint64_t start = GlTraceRecord::now();
+            bool supported = function < GlFunction::Count && glTraceReplay(function, reader);
+            uint64_t elapsed = GlTraceRecord::now() - start;
+            if (supported) {
+                replayStats[function].calls++;
+                replayStats[function].nanoseconds += elapsed;
+            } else {
+                ++skipped;
+            }
+            position += size;
+        }
+        return played;
+    }
+
+    const GlTrace::FunctionStats* stats() const {
+        return replayStats;
+    }
+
+    uint64_t skippedCalls() const {
+        return skipped;
+    }
+
+    uint64_t frameCount() const {
+        return frames;
+    }
+
+private:
+    std::vector<char> data;
+    size_t position = 0;
+    GlTraceReader reader;
+    GlTrace::FunctionStats replayStats[GlFunction::Count];
+    uint64_t skipped = 0;
+    uint64_t frames = 0;
+};
@@ -0,0 +1,13843 @@
+// Gerado por tools/gen_gl_trace.py a partir de glad/glad.h. Não editar à mão.
+// Incluído por GlTrace.h, que define GlTraceRecord e GlTraceReader.
+
+#pragma once
+
+namespace GlFunction {
+    enum : uint16_t {
+        CullFace,
+        FrontFace,
+        Hint,
+        LineWidth,
+        PointSize,
+        PolygonMode,
+        Scissor,
+        TexParameterf,
+        TexParameterfv,
+        TexParameteri,
+        TexParameteriv,
+        TexImage1D,
+        TexImage2D,
+        DrawBuffer,
+        Clear,
+        ClearColor,
+        ClearStencil,
+        ClearDepth,
+        StencilMask,
+        ColorMask,
+        DepthMask,
+        Disable,
+        Enable,
+        Finish,
+        Flush,
+        BlendFunc,
+        LogicOp,
+        StencilFunc,
+        StencilOp,
+        DepthFunc,
+        PixelStoref,
+        PixelStorei,
+        ReadBuffer,
+        ReadPixels,
+        GetBooleanv,
+        GetDoublev,
+        GetError,
+        GetFloatv,
+        GetIntegerv,
+        GetString,
+        GetTexImage,
+        GetTexParameterfv,
+        GetTexParameteriv,
+        GetTexLevelParameterfv,
+        GetTexLevelParameteriv,
+        IsEnabled,
+        DepthRange,
+        Viewport,
+        NewList,
+        EndList,
+        CallList,
+        CallLists,
+        DeleteLists,
+        GenLists,
+        ListBase,
+        Begin,
+        Bitmap,
+        Color3b,
+        Color3bv,
+        Color3d,
+        Color3dv,
+        Color3f,
+        Color3fv,
+        Color3i,
+        Color3iv,
+        Color3s,
+        Color3sv,
+        Color3ub,
+        Color3ubv,
+        Color3ui,
+        Color3uiv,
+        Color3us,
+        Color3usv,
+        Color4b,
+        Color4bv,
+        Color4d,
+        Color4dv,
+        Color4f,
+        Color4fv,
+        Color4i,
+        Color4iv,
+        Color4s,
+        Color4sv,
+        Color4ub,
+        Color4ubv,
+        Color4ui,
+        Color4uiv,
+        Color4us,
+        Color4usv,
+        EdgeFlag,
+        EdgeFlagv,
+        End,
+        Indexd,
+        Indexdv,
+        Indexf,
+        Indexfv,
+        Indexi,
+        Indexiv,
+        Indexs,
+        Indexsv,
+        Normal3b,
+        Normal3bv,
+        Normal3d,
+        Normal3dv,
+        Normal3f,
+        Normal3fv,
+        Normal3i,
+        Normal3iv,
+        Normal3s,
+        Normal3sv,
+        RasterPos2d,
+        RasterPos2dv,
+        RasterPos2f,
+        RasterPos2fv,
+        RasterPos2i,
+        RasterPos2iv,
+        RasterPos2s,
+        RasterPos2sv,
+        RasterPos3d,
+        RasterPos3dv,
+        RasterPos3f,
+        RasterPos3fv,
+        RasterPos3i,
+        RasterPos3iv,
+        RasterPos3s,
+        RasterPos3sv,
+        RasterPos4d,
+        RasterPos4dv,
+        RasterPos4f,
+        RasterPos4fv,
+        RasterPos4i,
+        RasterPos4iv,
+        RasterPos4s,
+        RasterPos4sv,
+        Rectd,
+        Rectdv,
+        Rectf,
+        Rectfv,
+        Recti,
+        Rectiv,
+        Rects,
+        Rectsv,
+        TexCoord1d,
+        TexCoord1dv,
+        TexCoord1f,
+        TexCoord1fv,
+        TexCoord1i,
+        TexCoord1iv,
+        TexCoord1s,
+        TexCoord1sv,
+        TexCoord2d,
+        TexCoord2dv,
+        TexCoord2f,
+        TexCoord2fv,
+        TexCoord2i,
+        TexCoord2iv,
+        TexCoord2s,
+        TexCoord2sv,
+        TexCoord3d,
+        TexCoord3dv,
+        TexCoord3f,
+        TexCoord3fv,
+        TexCoord3i,
+        TexCoord3iv,
+        TexCoord3s,
+        TexCoord3sv,
+        TexCoord4d,
+        TexCoord4dv,
+        TexCoord4f,
+        TexCoord4fv,
+        TexCoord4i,
+        TexCoord4iv,
+        TexCoord4s,
+        TexCoord4sv,
+        Vertex2d,
+        Vertex2dv,
+        Vertex2f,
+        Vertex2fv,
+        Vertex2i,
+        Vertex2iv,
+        Vertex2s,
+        Vertex2sv,
+        Vertex3d,
+        Vertex3dv,
+        Vertex3f,
+        Vertex3fv,
+        Vertex3i,
+        Vertex3iv,
+        Vertex3s,
+        Vertex3sv,
+        Vertex4d,
+        Vertex4dv,
+        Vertex4f,
+        Vertex4fv,
+        Vertex4i,
+        Vertex4iv,
+        Vertex4s,
+        Vertex4sv,
+        ClipPlane,
+        ColorMaterial,
+        Fogf,
+        Fogfv,
+        Fogi,
+        Fogiv,
+        Lightf,
+        Lightfv,
+        Lighti,
+        Lightiv,
+        LightModelf,
+        LightModelfv,
+        LightModeli,
+        LightModeliv,
+        LineStipple,
+        Materialf,
+        Materialfv,
+        Materiali,
+        Materialiv,
+        PolygonStipple,
+        ShadeModel,
+        TexEnvf,
+        TexEnvfv,
+        TexEnvi,
+        TexEnviv,
+        TexGend,
+        TexGendv,
+        TexGenf,
+        TexGenfv,
+        TexGeni,
+        TexGeniv,
+        FeedbackBuffer,
+        SelectBuffer,
+        RenderMode,
+        InitNames,
+        LoadName,
+        PassThrough,
+        PopName,
+        PushName,
+        ClearAccum,
+        ClearIndex,
+        IndexMask,
+        Accum,
+        PopAttrib,
+        PushAttrib,
+        Map1d,
+        Map1f,
+        Map2d,
+        Map2f,
+        MapGrid1d,
+        MapGrid1f,
+        MapGrid2d,
+        MapGrid2f,
+        EvalCoord1d,
+        EvalCoord1dv,
+        EvalCoord1f,
+        EvalCoord1fv,
+        EvalCoord2d,
+        EvalCoord2dv,
+        EvalCoord2f,
+        EvalCoord2fv,
+        EvalMesh1,
+        EvalPoint1,
+        EvalMesh2,
+        EvalPoint2,
+        AlphaFunc,
+        PixelZoom,
+        PixelTransferf,
+        PixelTransferi,
+        PixelMapfv,
+        PixelMapuiv,
+        PixelMapusv,
+        CopyPixels,
+        DrawPixels,
+        GetClipPlane,
+        GetLightfv,
+        GetLightiv,
+        GetMapdv,
+        GetMapfv,
+        GetMapiv,
+        GetMaterialfv,
+        GetMaterialiv,
+        GetPixelMapfv,
+        GetPixelMapuiv,
+        GetPixelMapusv,
+        GetPolygonStipple,
+        GetTexEnvfv,
+        GetTexEnviv,
+        GetTexGendv,
+        GetTexGenfv,
+        GetTexGeniv,
+        IsList,
+        Frustum,
+        LoadIdentity,
+        LoadMatrixf,
+        LoadMatrixd,
+        MatrixMode,
+        MultMatrixf,
+        MultMatrixd,
+        Ortho,
+        PopMatrix,
+        PushMatrix,
+        Rotated,
+        Rotatef,
+        Scaled,
+        Scalef,
+        Translated,
+        Translatef,
+        DrawArrays,
+        DrawElements,
+        GetPointerv,
+        PolygonOffset,
+        CopyTexImage1D,
+        CopyTexImage2D,
+        CopyTexSubImage1D,
+        CopyTexSubImage2D,
+        TexSubImage1D,
+        TexSubImage2D,
+        BindTexture,
+        DeleteTextures,
+        GenTextures,
+        IsTexture,
+        ArrayElement,
+        ColorPointer,
+        DisableClientState,
+        EdgeFlagPointer,
+        EnableClientState,
+        IndexPointer,
+        InterleavedArrays,
+        NormalPointer,
+        TexCoordPointer,
+        VertexPointer,
+        AreTexturesResident,
+        PrioritizeTextures,
+        Indexub,
+        Indexubv,
+        PopClientAttrib,
+        PushClientAttrib,
+        DrawRangeElements,
+        TexImage3D,
+        TexSubImage3D,
+        CopyTexSubImage3D,
+        ActiveTexture,
+        SampleCoverage,
+        CompressedTexImage3D,
+        CompressedTexImage2D,
+        CompressedTexImage1D,
+        CompressedTexSubImage3D,
+        CompressedTexSubImage2D,
+        CompressedTexSubImage1D,
+        GetCompressedTexImage,
+        ClientActiveTexture,
+        MultiTexCoord1d,
+        MultiTexCoord1dv,
+        MultiTexCoord1f,
+        MultiTexCoord1fv,
+        MultiTexCoord1i,
+        MultiTexCoord1iv,
+        MultiTexCoord1s,
+        MultiTexCoord1sv,
+        MultiTexCoord2d,
+        MultiTexCoord2dv,
+        MultiTexCoord2f,
+        MultiTexCoord2fv,
+        MultiTexCoord2i,
+        MultiTexCoord2iv,
+        MultiTexCoord2s,
+        MultiTexCoord2sv,
+        MultiTexCoord3d,
+        MultiTexCoord3dv,
+        MultiTexCoord3f,
+        MultiTexCoord3fv,
+        MultiTexCoord3i,
+        MultiTexCoord3iv,
+        MultiTexCoord3s,
+        MultiTexCoord3sv,
+        MultiTexCoord4d,
+        MultiTexCoord4dv,
+        MultiTexCoord4f,
+        MultiTexCoord4fv,
+        MultiTexCoord4i,
+        MultiTexCoord4iv,
+        MultiTexCoord4s,
+        MultiTexCoord4sv,
+        LoadTransposeMatrixf,
+        LoadTransposeMatrixd,
+        MultTransposeMatrixf,
+        MultTransposeMatrixd,
+        BlendFuncSeparate,
+        MultiDrawArrays,
+        MultiDrawElements,
+        PointParameterf,
+        PointParameterfv,
+        PointParameteri,
+        PointParameteriv,
+        FogCoordf,
+        FogCoordfv,
+        FogCoordd,
+        FogCoorddv,
+        FogCoordPointer,
+        SecondaryColor3b,
+        SecondaryColor3bv,
+        SecondaryColor3d,
+        SecondaryColor3dv,
+        SecondaryColor3f,
+        SecondaryColor3fv,
+        SecondaryColor3i,
+        SecondaryColor3iv,
+        SecondaryColor3s,
+        SecondaryColor3sv,
+        SecondaryColor3ub,
+        SecondaryColor3ubv,
+        SecondaryColor3ui,
+        SecondaryColor3uiv,
+        SecondaryColor3us,
+        SecondaryColor3usv,
+        SecondaryColorPointer,
+        WindowPos2d,
+        WindowPos2dv,
+        WindowPos2f,
+        WindowPos2fv,
+        WindowPos2i,
+        WindowPos2iv,
+        WindowPos2s,
+        WindowPos2sv,
+        WindowPos3d,
+        WindowPos3dv,
+        WindowPos3f,
+        WindowPos3fv,
+        WindowPos3i,
+        WindowPos3iv,
+        WindowPos3s,
+        WindowPos3sv,
+        BlendColor,
+        BlendEquation,
+        GenQueries,
+        DeleteQueries,
+        IsQuery,
+        BeginQuery,
+        EndQuery,
+        GetQueryiv,
+        GetQueryObjectiv,
+        GetQueryObjectuiv,
+        BindBuffer,
+        DeleteBuffers,
+        GenBuffers,
+        IsBuffer,
+        BufferData,
+        BufferSubData,
+        GetBufferSubData,
+        MapBuffer,
+        UnmapBuffer,
+        GetBufferParameteriv,
+        GetBufferPointerv,
+        BlendEquationSeparate,
+        DrawBuffers,
+        StencilOpSeparate,
+        StencilFuncSeparate,
+        StencilMaskSeparate,
+        AttachShader,
+        BindAttribLocation,
+        CompileShader,
+        CreateProgram,
+        CreateShader,
+        DeleteProgram,
+        DeleteShader,
+        DetachShader,
+        DisableVertexAttribArray,
+        EnableVertexAttribArray,
+        GetActiveAttrib,
+        GetActiveUniform,
+        GetAttachedShaders,
+        GetAttribLocation,
+        GetProgramiv,
+        GetProgramInfoLog,
+        GetShaderiv,
+        GetShaderInfoLog,
+        GetShaderSource,
+        GetUniformLocation,
+        GetUniformfv,
+        GetUniformiv,
+        GetVertexAttribdv,
+        GetVertexAttribfv,
+        GetVertexAttribiv,
+        GetVertexAttribPointerv,
+        IsProgram,
+        IsShader,
+        LinkProgram,
+        ShaderSource,
+        UseProgram,
+        Uniform1f,
+        Uniform2f,
+        Uniform3f,
+        Uniform4f,
+        Uniform1i,
+        Uniform2i,
+        Uniform3i,
+        Uniform4i,
+        Uniform1fv,
+        Uniform2fv,
+        Uniform3fv,
+        Uniform4fv,
+        Uniform1iv,
+        Uniform2iv,
+        Uniform3iv,
+        Uniform4iv,
+        UniformMatrix2fv,
+        UniformMatrix3fv,
+        UniformMatrix4fv,
+        ValidateProgram,
+        VertexAttrib1d,
+        VertexAttrib1dv,
+        VertexAttrib1f,
+        VertexAttrib1fv,
+        VertexAttrib1s,
+        VertexAttrib1sv,
+        VertexAttrib2d,
+        VertexAttrib2dv,
+        VertexAttrib2f,
+        VertexAttrib2fv,
+        VertexAttrib2s,
+        VertexAttrib2sv,
+        VertexAttrib3d,
+        VertexAttrib3dv,
+        VertexAttrib3f,
+        VertexAttrib3fv,
+        VertexAttrib3s,
+        VertexAttrib3sv,
+        VertexAttrib4Nbv,
+        VertexAttrib4Niv,
+        VertexAttrib4Nsv,
+        VertexAttrib4Nub,
+        VertexAttrib4Nubv,
+        VertexAttrib4Nuiv,
+        VertexAttrib4Nusv,
+        VertexAttrib4bv,
+        VertexAttrib4d,
+        VertexAttrib4dv,
+        VertexAttrib4f,
+        VertexAttrib4fv,
+        VertexAttrib4iv,
+        VertexAttrib4s,
+        VertexAttrib4sv,
+        VertexAttrib4ubv,
+        VertexAttrib4uiv,
+        VertexAttrib4usv,
+        VertexAttribPointer,
+        UniformMatrix2x3fv,
+        UniformMatrix3x2fv,
+        UniformMatrix2x4fv,
+        UniformMatrix4x2fv,
+        UniformMatrix3x4fv,
+        UniformMatrix4x3fv,
+        ColorMaski,
+        GetBooleani_v,
+        GetIntegeri_v,
+        Enablei,
+        Disablei,
+        IsEnabledi,
+        BeginTransformFeedback,
+        EndTransformFeedback,
+        BindBufferRange,
+        BindBufferBase,
+        TransformFeedbackVaryings,
+        GetTransformFeedbackVarying,
+        ClampColor,
+        BeginConditionalRender,
+        EndConditionalRender,
+        VertexAttribIPointer,
+        GetVertexAttribIiv,
+        GetVertexAttribIuiv,
+        VertexAttribI1i,
+        VertexAttribI2i,
+        VertexAttribI3i,
+        VertexAttribI4i,
+        VertexAttribI1ui,
+        VertexAttribI2ui,
+        VertexAttribI3ui,
+        VertexAttribI4ui,
+        VertexAttribI1iv,
+        VertexAttribI2iv,
+        VertexAttribI3iv,
+        VertexAttribI4iv,
+        VertexAttribI1uiv,
+        VertexAttribI2uiv,
+        VertexAttribI3uiv,
+        VertexAttribI4uiv,
+        VertexAttribI4bv,
+        VertexAttribI4sv,
+        VertexAttribI4ubv,
+        VertexAttribI4usv,
+        GetUniformuiv,
+        BindFragDataLocation,
+        GetFragDataLocation,
+        Uniform1ui,
+        Uniform2ui,
+        Uniform3ui,
+        Uniform4ui,
+        Uniform1uiv,
+        Uniform2uiv,
+        Uniform3uiv,
+        Uniform4uiv,
+        TexParameterIiv,
+        TexParameterIuiv,
+        GetTexParameterIiv,
+        GetTexParameterIuiv,
+        ClearBufferiv,
+        ClearBufferuiv,
+        ClearBufferfv,
+        ClearBufferfi,
+        GetStringi,
+        IsRenderbuffer,
+        BindRenderbuffer,
+        DeleteRenderbuffers,
+        GenRenderbuffers,
+        RenderbufferStorage,
+        GetRenderbufferParameteriv,
+        IsFramebuffer,
+        BindFramebuffer,
+        DeleteFramebuffers,
+        GenFramebuffers,
+        CheckFramebufferStatus,
+        FramebufferTexture1D,
+        FramebufferTexture2D,
+        FramebufferTexture3D,
+        FramebufferRenderbuffer,
+        GetFramebufferAttachmentParameteriv,
+        GenerateMipmap,
+        BlitFramebuffer,
+        RenderbufferStorageMultisample,
+        FramebufferTextureLayer,
+        MapBufferRange,
+        FlushMappedBufferRange,
+        BindVertexArray,
+        DeleteVertexArrays,
+        GenVertexArrays,
+        IsVertexArray,
+        DrawArraysInstanced,
+        DrawElementsInstanced,
+        TexBuffer,
+        PrimitiveRestartIndex,
+        CopyBufferSubData,
+        GetUniformIndices,
+        GetActiveUniformsiv,
+        GetActiveUniformName,
+        GetUniformBlockIndex,
+        GetActiveUniformBlockiv,
+        GetActiveUniformBlockName,
+        UniformBlockBinding,
+        DrawElementsBaseVertex,
+        DrawRangeElementsBaseVertex,
+        DrawElementsInstancedBaseVertex,
+        MultiDrawElementsBaseVertex,
+        ProvokingVertex,
+        FenceSync,
+        IsSync,
+        DeleteSync,
+        ClientWaitSync,
+        WaitSync,
+        GetInteger64v,
+        GetSynciv,
+        GetInteger64i_v,
+        GetBufferParameteri64v,
+        FramebufferTexture,
+        TexImage2DMultisample,
+        TexImage3DMultisample,
+        GetMultisamplefv,
+        SampleMaski,
+        BindFragDataLocationIndexed,
+        GetFragDataIndex,
+        GenSamplers,
+        DeleteSamplers,
+        IsSampler,
+        BindSampler,
+        SamplerParameteri,
+        SamplerParameteriv,
+        SamplerParameterf,
+        SamplerParameterfv,
+        SamplerParameterIiv,
+        SamplerParameterIuiv,
+        GetSamplerParameteriv,
+        GetSamplerParameterIiv,
+        GetSamplerParameterfv,
+        GetSamplerParameterIuiv,
+        QueryCounter,
+        GetQueryObjecti64v,
+        GetQueryObjectui64v,
+        VertexAttribDivisor,
+        VertexAttribP1ui,
+        VertexAttribP1uiv,
+        VertexAttribP2ui,
+        VertexAttribP2uiv,
+        VertexAttribP3ui,
+        VertexAttribP3uiv,
+        VertexAttribP4ui,
+        VertexAttribP4uiv,
+        VertexP2ui,
+        VertexP2uiv,
+        VertexP3ui,
+        VertexP3uiv,
+        VertexP4ui,
+        VertexP4uiv,
+        TexCoordP1ui,
+        TexCoordP1uiv,
+        TexCoordP2ui,
+        TexCoordP2uiv,
+        TexCoordP3ui,
+        TexCoordP3uiv,
+        TexCoordP4ui,
+        TexCoordP4uiv,
+        MultiTexCoordP1ui,
+        MultiTexCoordP1uiv,
+        MultiTexCoordP2ui,
+        MultiTexCoordP2uiv,
+        MultiTexCoordP3ui,
+        MultiTexCoordP3uiv,
+        MultiTexCoordP4ui,
+        MultiTexCoordP4uiv,
+        NormalP3ui,
+        NormalP3uiv,
+        ColorP3ui,
+        ColorP3uiv,
+        ColorP4ui,
+        ColorP4uiv,
+        SecondaryColorP3ui,
+        SecondaryColorP3uiv,
+        MinSampleShading,
+        BlendEquationi,
+        BlendEquationSeparatei,
+        BlendFunci,
+        BlendFuncSeparatei,
+        DrawArraysIndirect,
+        DrawElementsIndirect,
+        Uniform1d,
+        Uniform2d,
+        Uniform3d,
+        Uniform4d,
+        Uniform1dv,
+        Uniform2dv,
+        Uniform3dv,
+        Uniform4dv,
+        UniformMatrix2dv,
+        UniformMatrix3dv,
+        UniformMatrix4dv,
+        UniformMatrix2x3dv,
+        UniformMatrix2x4dv,
+        UniformMatrix3x2dv,
+        UniformMatrix3x4dv,
+        UniformMatrix4x2dv,
+        UniformMatrix4x3dv,
+        GetUniformdv,
+        GetSubroutineUniformLocation,
+        GetSubroutineIndex,
+        GetActiveSubroutineUniformiv,
+        GetActiveSubroutineUniformName,
+        GetActiveSubroutineName,
+        UniformSubroutinesuiv,
+        GetUniformSubroutineuiv,
+        GetProgramStageiv,
+        PatchParameteri,
+        PatchParameterfv,
+        BindTransformFeedback,
+        DeleteTransformFeedbacks,
+        GenTransformFeedbacks,
+        IsTransformFeedback,
+        PauseTransformFeedback,
+        ResumeTransformFeedback,
+        DrawTransformFeedback,
+        DrawTransformFeedbackStream,
+        BeginQueryIndexed,
+        EndQueryIndexed,
+        GetQueryIndexediv,
+        Count
+    };
+}
+
+inline const char* const glFunctionNames[] = {
+    "glCullFace",
+    "glFrontFace",
+    "glHint",
+    "glLineWidth",
+    "glPointSize",
+    "glPolygonMode",
+    "glScissor",
+    "glTexParameterf",
+    "glTexParameterfv",
+    "glTexParameteri",
+    "glTexParameteriv",
+    "glTexImage1D",
+    "glTexImage2D",
+    "glDrawBuffer",
+    "glClear",
+    "glClearColor",
+    "glClearStencil",
+    "glClearDepth",
+    "glStencilMask",
+    "glColorMask",
+    "glDepthMask",
+    "glDisable",
+    "glEnable",
+    "glFinish",
+    "glFlush",
+    "glBlendFunc",
+    "glLogicOp",
+    "glStencilFunc",
+    "glStencilOp",
+    "glDepthFunc",
+    "glPixelStoref",
+    "glPixelStorei",
+    "glReadBuffer",
+    "glReadPixels",
+    "glGetBooleanv",
+    "glGetDoublev",
+    "glGetError",
+    "glGetFloatv",
+    "glGetIntegerv",
+    "glGetString",
+    "glGetTexImage",
+    "glGetTexParameterfv",
+    "glGetTexParameteriv",
+    "glGetTexLevelParameterfv",
+    "glGetTexLevelParameteriv",
+    "glIsEnabled",
+    "glDepthRange",
+    "glViewport",
+    "glNewList",
+    "glEndList",
+    "glCallList",
+    "glCallLists",
+    "glDeleteLists",
+    "glGenLists",
+    "glListBase",
+    "glBegin",
+    "glBitmap",
+    "glColor3b",
+    "glColor3bv",
+    "glColor3d",
+    "glColor3dv",
+    "glColor3f",
+    "glColor3fv",
+    "glColor3i",
+    "glColor3iv",
+    "glColor3s",
+    "glColor3sv",
+    "glColor3ub",
+    "glColor3ubv",
+    "glColor3ui",
+    "glColor3uiv",
+    "glColor3us",
+    "glColor3usv",
+    "glColor4b",
+    "glColor4bv",
+    "glColor4d",
+    "glColor4dv",
+    "glColor4f",
+    "glColor4fv",
+    "glColor4i",
+    "glColor4iv",
+    "glColor4s",
+    "glColor4sv",
+    "glColor4ub",
+    "glColor4ubv",
+    "glColor4ui",
+    "glColor4uiv",
+    "glColor4us",
+    "glColor4usv",
+    "glEdgeFlag",
+    "glEdgeFlagv",
+    "glEnd",
+    "glIndexd",
+    "glIndexdv",
+    "glIndexf",
+    "glIndexfv",
+    "glIndexi",
+    "glIndexiv",
+    "glIndexs",
+    "glIndexsv",
+    "glNormal3b",
+    "glNormal3bv",
+    "glNormal3d",
+    "glNormal3dv",
+    "glNormal3f",
+    "glNormal3fv",
+    "glNormal3i",
+    "glNormal3iv",
+    "glNormal3s",
+    "glNormal3sv",
+    "glRasterPos2d",
+    "glRasterPos2dv",
+    "glRasterPos2f",
+    "glRasterPos2fv",
+    "glRasterPos2i",
+    "glRasterPos2iv",
+    "glRasterPos2s",
+    "glRasterPos2sv",
+    "glRasterPos3d",
+    "glRasterPos3dv",
+    "glRasterPos3f",
+    "glRasterPos3fv",
+    "glRasterPos3i",
+    "glRasterPos3iv",
+    "glRasterPos3s",
+    "glRasterPos3sv",
+    "glRasterPos4d",
+    "glRasterPos4dv",
+    "glRasterPos4f",
+    "glRasterPos4fv",
+    "glRasterPos4i",
+    "glRasterPos4iv",
+    "glRasterPos4s",
+    "glRasterPos4sv",
+    "glRectd",
+    "glRectdv",
+    "glRectf",
+    "glRectfv",
+    "glRecti",
+    "glRectiv",
+    "glRects",
+    "glRectsv",
+    "glTexCoord1d",
+    "glTexCoord1dv",
+    "glTexCoord1f",
+    "glTexCoord1fv",
+    "glTexCoord1i",
+    "glTexCoord1iv",
+    "glTexCoord1s",
+    "glTexCoord1sv",
+    "glTexCoord2d",
+    "glTexCoord2dv",
+    "glTexCoord2f",
+    "glTexCoord2fv",
+    "glTexCoord2i",
+    "glTexCoord2iv",
+    "glTexCoord2s",
+    "glTexCoord2sv",
+    "glTexCoord3d",
+    "glTexCoord3dv",
+    "glTexCoord3f",
+    "glTexCoord3fv",
+    "glTexCoord3i",
+    "glTexCoord3iv",
+    "glTexCoord3s",
+    "glTexCoord3sv",
+    "glTexCoord4d",
+    "glTexCoord4dv",
+    "glTexCoord4f",
+    "glTexCoord4fv",
+    "glTexCoord4i",
+    "glTexCoord4iv",
+    "glTexCoord4s",
+    "glTexCoord4sv",
+    "glVertex2d",
+    "glVertex2dv",
+    "glVertex2f",
+    "glVertex2fv",
+    "glVertex2i",
+    "glVertex2iv",
+    "glVertex2s",
+    "glVertex2sv",
+    "glVertex3d",
+    "glVertex3dv",
+    "glVertex3f",
+    "glVertex3fv",
+    "glVertex3i",
+    "glVertex3iv",
+    "glVertex3s",
+    "glVertex3sv",
+    "glVertex4d",
+    "glVertex4dv",
+    "glVertex4f",
+    "glVertex4fv",
+    "glVertex4i",
+    "glVertex4iv",
+    "glVertex4s",
+    "glVertex4sv",
+    "glClipPlane",
+    "glColorMaterial",
+    "glFogf",
+    "glFogfv",
+    "glFogi",
+    "glFogiv",
+    "glLightf",
+    "glLightfv",
+    "glLighti",
+    "glLightiv",
+    "glLightModelf",
+    "glLightModelfv",
+    "glLightModeli",
+    "glLightModeliv",
+    "glLineStipple",
+    "glMaterialf",
+    "glMaterialfv",
+    "glMateriali",
+    "glMaterialiv",
+    "glPolygonStipple",
+    "glShadeModel",
+    "glTexEnvf",
+    "glTexEnvfv",
+    "glTexEnvi",
+    "glTexEnviv",
+    "glTexGend",
+    "glTexGendv",
+    "glTexGenf",
+    "glTexGenfv",
+    "glTexGeni",
+    "glTexGeniv",
+    "glFeedbackBuffer",
+    "glSelectBuffer",
+    "glRenderMode",
+    "glInitNames",
+    "glLoadName",
+    "glPassThrough",
+    "glPopName",
+    "glPushName",
+    "glClearAccum",
+    "glClearIndex",
+    "glIndexMask",
+    "glAccum",
+    "glPopAttrib",
+    "glPushAttrib",
+    "glMap1d",
+    "glMap1f",
+    "glMap2d",
+    "glMap2f",
+    "glMapGrid1d",
+    "glMapGrid1f",
+    "glMapGrid2d",
+    "glMapGrid2f",
+    "glEvalCoord1d",
+    "glEvalCoord1dv",
+    "glEvalCoord1f",
+    "glEvalCoord1fv",
+    "glEvalCoord2d",
+    "glEvalCoord2dv",
+    "glEvalCoord2f",
+    "glEvalCoord2fv",
+    "glEvalMesh1",
+    "glEvalPoint1",
+    "glEvalMesh2",
+    "glEvalPoint2",
+    "glAlphaFunc",
+    "glPixelZoom",
+    "glPixelTransferf",
+    "glPixelTransferi",
+    "glPixelMapfv",
+    "glPixelMapuiv",
+    "glPixelMapusv",
+    "glCopyPixels",
+    "glDrawPixels",
+    "glGetClipPlane",
+    "glGetLightfv",
+    "glGetLightiv",
+    "glGetMapdv",
+    "glGetMapfv",
+    "glGetMapiv",
+    "glGetMaterialfv",
+    "glGetMaterialiv",
+    "glGetPixelMapfv",
+    "glGetPixelMapuiv",
+    "glGetPixelMapusv",
+    "glGetPolygonStipple",
+    "glGetTexEnvfv",
+    "glGetTexEnviv",
+    "glGetTexGendv",
+    "glGetTexGenfv",
+    "glGetTexGeniv",
+    "glIsList",
+    "glFrustum",
+    "glLoadIdentity",
+    "glLoadMatrixf",
+    "glLoadMatrixd",
+    "glMatrixMode",
+    "glMultMatrixf",
+    "glMultMatrixd",
+    "glOrtho",
+    "glPopMatrix",
+    "glPushMatrix",
+    "glRotated",
+    "glRotatef",
+    "glScaled",
+    "glScalef",
+    "glTranslated",
+    "glTranslatef",
+    "glDrawArrays",
+    "glDrawElements",
+    "glGetPointerv",
+    "glPolygonOffset",
+    "glCopyTexImage1D",
+    "glCopyTexImage2D",
+    "glCopyTexSubImage1D",
+    "glCopyTexSubImage2D",
+    "glTexSubImage1D",
+    "glTexSubImage2D",
+    "glBindTexture",
+    "glDeleteTextures",
+    "glGenTextures",
+    "glIsTexture",
+    "glArrayElement",
+    "glColorPointer",
+    "glDisableClientState",
+    "glEdgeFlagPointer",
+    "glEnableClientState",
+    "glIndexPointer",
+    "glInterleavedArrays",
+    "glNormalPointer",
+    "glTexCoordPointer",
+    "glVertexPointer",
+    "glAreTexturesResident",
+    "glPrioritizeTextures",
+    "glIndexub",
+    "glIndexubv",
+    "glPopClientAttrib",
+    "glPushClientAttrib",
+    "glDrawRangeElements",
+    "glTexImage3D",
+    "glTexSubImage3D",
+    "glCopyTexSubImage3D",
+    "glActiveTexture",
+    "glSampleCoverage",
+    "glCompressedTexImage3D",
+    "glCompressedTexImage2D",
+    "glCompressedTexImage1D",
+    "glCompressedTexSubImage3D",
+    "glCompressedTexSubImage2D",
+    "glCompressedTexSubImage1D",
+    "glGetCompressedTexImage",
+    "glClientActiveTexture",
+    "glMultiTexCoord1d",
+    "glMultiTexCoord1dv",
+    "glMultiTexCoord1f",
+    "glMultiTexCoord1fv",
+    "glMultiTexCoord1i",
+    "glMultiTexCoord1iv",
+    "glMultiTexCoord1s",
+    "glMultiTexCoord1sv",
+    "glMultiTexCoord2d",
+    "glMultiTexCoord2dv",
+    "glMultiTexCoord2f",
+    "glMultiTexCoord2fv",
+    "glMultiTexCoord2i",
+    "glMultiTexCoord2iv",
+    "glMultiTexCoord2s",
+    "glMultiTexCoord2sv",
+    "glMultiTexCoord3d",
+    "glMultiTexCoord3dv",
+    "glMultiTexCoord3f",
+    "glMultiTexCoord3fv",
+    "glMultiTexCoord3i",
+    "glMultiTexCoord3iv",
+    "glMultiTexCoord3s",
+    "glMultiTexCoord3sv",
+    "glMultiTexCoord4d",
+    "glMultiTexCoord4dv",
+    "glMultiTexCoord4f",
+    "glMultiTexCoord4fv",
+    "glMultiTexCoord4i",
+    "glMultiTexCoord4iv",
+    "glMultiTexCoord4s",
+    "glMultiTexCoord4sv",
+    "glLoadTransposeMatrixf",
+    "glLoadTransposeMatrixd",
+    "glMultTransposeMatrixf",
+    "glMultTransposeMatrixd",
+    "glBlendFuncSeparate",
+    "glMultiDrawArrays",
+    "glMultiDrawElements",
+    "glPointParameterf",
+    "glPointParameterfv",
+    "glPointParameteri",
+    "glPointParameteriv",
+    "glFogCoordf",
+    "glFogCoordfv",
+    "glFogCoordd",
+    "glFogCoorddv",
+    "glFogCoordPointer",
+    "glSecondaryColor3b",
+    "glSecondaryColor3bv",
+    "glSecondaryColor3d",
+    "glSecondaryColor3dv",
+    "glSecondaryColor3f",
+    "glSecondaryColor3fv",
+    "glSecondaryColor3i",
+    "glSecondaryColor3iv",
+    "glSecondaryColor3s",
+    "glSecondaryColor3sv",
+    "glSecondaryColor3ub",
+    "glSecondaryColor3ubv",
+    "glSecondaryColor3ui",
+    "glSecondaryColor3uiv",
+    "glSecondaryColor3us",
+    "glSecondaryColor3usv",
+    "glSecondaryColorPointer",
+    "glWindowPos2d",
+    "glWindowPos2dv",
+    "glWindowPos2f",
+    "glWindowPos2fv",
+    "glWindowPos2i",
+    "glWindowPos2iv",
+    "glWindowPos2s",
+    "glWindowPos2sv",
+    "glWindowPos3d",
+    "glWindowPos3dv",
+    "glWindowPos3f",
+    "glWindowPos3fv",
+    "glWindowPos3i",
+    "glWindowPos3iv",
+    "glWindowPos3s",
+    "glWindowPos3sv",
+    "glBlendColor",
+    "glBlendEquation",
+    "glGenQueries",
+    "glDeleteQueries",
+    "glIsQuery",
+    "glBeginQuery",
+    "glEndQuery",
+    "glGetQueryiv",
+    "glGetQueryObjectiv",
+    "glGetQueryObjectuiv",
+    "glBindBuffer",
+    "glDeleteBuffers",
+    "glGenBuffers",
+    "glIsBuffer",
+    "glBufferData",
+    "glBufferSubData",
+    "glGetBufferSubData",
+    "glMapBuffer",
+    "glUnmapBuffer",
+    "glGetBufferParameteriv",
+    "glGetBufferPointerv",
+    "glBlendEquationSeparate",
+    "glDrawBuffers",
+    "glStencilOpSeparate",
+    "glStencilFuncSeparate",
+    "glStencilMaskSeparate",
+    "glAttachShader",
+    "glBindAttribLocation",
+    "glCompileShader",
+    "glCreateProgram",
+    "glCreateShader",
+    "glDeleteProgram",
+    "glDeleteShader",
+    "glDetachShader",
+    "glDisableVertexAttribArray",
+    "glEnableVertexAttribArray",
+    "glGetActiveAttrib",
+    "glGetActiveUniform",
+    "glGetAttachedShaders",
+    "glGetAttribLocation",
+    "glGetProgramiv",
+    "glGetProgramInfoLog",
+    "glGetShaderiv",
+    "glGetShaderInfoLog",
+    "glGetShaderSource",
+    "glGetUniformLocation",
+    "glGetUniformfv",
+    "glGetUniformiv",
+    "glGetVertexAttribdv",
+    "glGetVertexAttribfv",
+    "glGetVertexAttribiv",
+    "glGetVertexAttribPointerv",
+    "glIsProgram",
+    "glIsShader",
+    "glLinkProgram",
+    "glShaderSource",
+    "glUseProgram",
+    "glUniform1f",
+    "glUniform2f",
+    "glUniform3f",
+    "glUniform4f",
+    "glUniform1i",
+    "glUniform2i",
+    "glUniform3i",
+    "glUniform4i",
+    "glUniform1fv",
+    "glUniform2fv",
+    "glUniform3fv",
+    "glUniform4fv",
+    "glUniform1iv",
+    "glUniform2iv",
+    "glUniform3iv",
+    "glUniform4iv",
+    "glUniformMatrix2fv",
+    "glUniformMatrix3fv",
+    "glUniformMatrix4fv",
+    "glValidateProgram",
+    "glVertexAttrib1d",
+    "glVertexAttrib1dv",
+    "glVertexAttrib1f",
+    "glVertexAttrib1fv",
+    "glVertexAttrib1s",
+    "glVertexAttrib1sv",
+    "glVertexAttrib2d",
+    "glVertexAttrib2dv",
+    "glVertexAttrib2f",
+    "glVertexAttrib2fv",
+    "glVertexAttrib2s",
+    "glVertexAttrib2sv",
+    "glVertexAttrib3d",
+    "glVertexAttrib3dv",
+    "glVertexAttrib3f",
+    "glVertexAttrib3fv",
+    "glVertexAttrib3s",
+    "glVertexAttrib3sv",
+    "glVertexAttrib4Nbv",
+    "glVertexAttrib4Niv",
+    "glVertexAttrib4Nsv",
+    "glVertexAttrib4Nub",
+    "glVertexAttrib4Nubv",
+    "glVertexAttrib4Nuiv",
+    "glVertexAttrib4Nusv",
+    "glVertexAttrib4bv",
+    "glVertexAttrib4d",
+    "glVertexAttrib4dv",
+    "glVertexAttrib4f",
+    "glVertexAttrib4fv",
+    "glVertexAttrib4iv",
+    "glVertexAttrib4s",
+    "glVertexAttrib4sv",
+    "glVertexAttrib4ubv",
+    "glVertexAttrib4uiv",
+    "glVertexAttrib4usv",
+    "glVertexAttribPointer",
+    "glUniformMatrix2x3fv",
+    "glUniformMatrix3x2fv",
+    "glUniformMatrix2x4fv",
+    "glUniformMatrix4x2fv",
+    "glUniformMatrix3x4fv",
+    "glUniformMatrix4x3fv",
+    "glColorMaski",
+    "glGetBooleani_v",
+    "glGetIntegeri_v",
+    "glEnablei",
+    "glDisablei",
+    "glIsEnabledi",
+    "glBeginTransformFeedback",
+    "glEndTransformFeedback",
+    "glBindBufferRange",
+    "glBindBufferBase",
+    "glTransformFeedbackVaryings",
+    "glGetTransformFeedbackVarying",
+    "glClampColor",
+    "glBeginConditionalRender",
+    "glEndConditionalRender",
+    "glVertexAttribIPointer",
+    "glGetVertexAttribIiv",
+    "glGetVertexAttribIuiv",
+    "glVertexAttribI1i",
+    "glVertexAttribI2i",
+    "glVertexAttribI3i",
+    "glVertexAttribI4i",
+    "glVertexAttribI1ui",
+    "glVertexAttribI2ui",
+    "glVertexAttribI3ui",
+    "glVertexAttribI4ui",
+    "glVertexAttribI1iv",
+    "glVertexAttribI2iv",
+    "glVertexAttribI3iv",
+    "glVertexAttribI4iv",
+    "glVertexAttribI1uiv",
+    "glVertexAttribI2uiv",
+    "glVertexAttribI3uiv",
+    "glVertexAttribI4uiv",
+    "glVertexAttribI4bv",
+    "glVertexAttribI4sv",
+    "glVertexAttribI4ubv",
+    "glVertexAttribI4usv",
+    "glGetUniformuiv",
+    "glBindFragDataLocation",
+    "glGetFragDataLocation",
+    "glUniform1ui",
+    "glUniform2ui",
+    "glUniform3ui",
+    "glUniform4ui",
+    "glUniform1uiv",
+    "glUniform2uiv",
+    "glUniform3uiv",
+    "glUniform4uiv",
+    "glTexParameterIiv",
+    "glTexParameterIuiv",
+    "glGetTexParameterIiv",
+    "glGetTexParameterIuiv",
+    "glClearBufferiv",
+    "glClearBufferuiv",
+    "glClearBufferfv",
+    "glClearBufferfi",
+    "glGetStringi",
+    "glIsRenderbuffer",
+    "glBindRenderbuffer",
+    "glDeleteRenderbuffers",
+    "glGenRenderbuffers",
+    "glRenderbufferStorage",
+    "glGetRenderbufferParameteriv",
+    "glIsFramebuffer",
+    "glBindFramebuffer",
+    "glDeleteFramebuffers",
+    "glGenFramebuffers",
+    "glCheckFramebufferStatus",
+    "glFramebufferTexture1D",
+    "glFramebufferTexture2D",
+    "glFramebufferTexture3D",
+    "glFramebufferRenderbuffer",
+    "glGetFramebufferAttachmentParameteriv",
+    "glGenerateMipmap",
+    "glBlitFramebuffer",
+    "glRenderbufferStorageMultisample",
+    "glFramebufferTextureLayer",
+    "glMapBufferRange",
+    "glFlushMappedBufferRange",
+    "glBindVertexArray",
+    "glDeleteVertexArrays",
+    "glGenVertexArrays",
+    "glIsVertexArray",
+    "glDrawArraysInstanced",
+    "glDrawElementsInstanced",
+    "glTexBuffer",
+    "glPrimitiveRestartIndex",
+    "glCopyBufferSubData",
+    "glGetUniformIndices",
+    "glGetActiveUniformsiv",
+    "glGetActiveUniformName",
+    "glGetUniformBlockIndex",
+    "glGetActiveUniformBlockiv",
+    "glGetActiveUniformBlockName",
+    "glUniformBlockBinding",
+    "glDrawElementsBaseVertex",
+    "glDrawRangeElementsBaseVertex",
+    "glDrawElementsInstancedBaseVertex",
+    "glMultiDrawElementsBaseVertex",
+    "glProvokingVertex",
+    "glFenceSync",
+    "glIsSync",
+    "glDeleteSync",
+    "glClientWaitSync",
+    "glWaitSync",
+    "glGetInteger64v",
+    "glGetSynciv",
+    "glGetInteger64i_v",
+    "glGetBufferParameteri64v",
+    "glFramebufferTexture",
+    "glTexImage2DMultisample",
+    "glTexImage3DMultisample",
+    "glGetMultisamplefv",
+    "glSampleMaski",
+    "glBindFragDataLocationIndexed",
+    "glGetFragDataIndex",
+    "glGenSamplers",
+    "glDeleteSamplers",
+    "glIsSampler",
+    "glBindSampler",
+    "glSamplerParameteri",
+    "glSamplerParameteriv",
+    "glSamplerParameterf",
+    "glSamplerParameterfv",
+    "glSamplerParameterIiv",
+    "glSamplerParameterIuiv",
+    "glGetSamplerParameteriv",
+    "glGetSamplerParameterIiv",
+    "glGetSamplerParameterfv",
+    "glGetSamplerParameterIuiv",
+    "glQueryCounter",
+    "glGetQueryObjecti64v",
+    "glGetQueryObjectui64v",
+    "glVertexAttribDivisor",
+    "glVertexAttribP1ui",
+    "glVertexAttribP1uiv",
+    "glVertexAttribP2ui",
+    "glVertexAttribP2uiv",
+    "glVertexAttribP3ui",
+    "glVertexAttribP3uiv",
+    "glVertexAttribP4ui",
+    "glVertexAttribP4uiv",
+    "glVertexP2ui",
+    "glVertexP2uiv",
+    "glVertexP3ui",
+    "glVertexP3uiv",
+    "glVertexP4ui",
+    "glVertexP4uiv",
+    "glTexCoordP1ui",
+    "glTexCoordP1uiv",
+    "glTexCoordP2ui",
+    "glTexCoordP2uiv",
+    "glTexCoordP3ui",
+    "glTexCoordP3uiv",
+    "glTexCoordP4ui",
+    "glTexCoordP4uiv",
+    "glMultiTexCoordP1ui",
+    "glMultiTexCoordP1uiv",
+    "glMultiTexCoordP2ui",
+    "glMultiTexCoordP2uiv",
+    "glMultiTexCoordP3ui",
+    "glMultiTexCoordP3uiv",
+    "glMultiTexCoordP4ui",
+    "glMultiTexCoordP4uiv",
+    "glNormalP3ui",
+    "glNormalP3uiv",
+    "glColorP3ui",
+    "glColorP3uiv",
+    "glColorP4ui",
+    "glColorP4uiv",
+    "glSecondaryColorP3ui",
+    "glSecondaryColorP3uiv",
+    "glMinSampleShading",
+    "glBlendEquationi",
+    "glBlendEquationSeparatei",
+    "glBlendFunci",
+    "glBlendFuncSeparatei",
+    "glDrawArraysIndirect",
+    "glDrawElementsIndirect",
+    "glUniform1d",
+    "glUniform2d",
+    "glUniform3d",
+    "glUniform4d",
+    "glUniform1dv",
+    "glUniform2dv",
+    "glUniform3dv",
+    "glUniform4dv",
+    "glUniformMatrix2dv",
+    "glUniformMatrix3dv",
+    "glUniformMatrix4dv",
+    "glUniformMatrix2x3dv",
+    "glUniformMatrix2x4dv",
+    "glUniformMatrix3x2dv",
+    "glUniformMatrix3x4dv",
+    "glUniformMatrix4x2dv",
+    "glUniformMatrix4x3dv",
+    "glGetUniformdv",
+    "glGetSubroutineUniformLocation",
+    "glGetSubroutineIndex",
+    "glGetActiveSubroutineUniformiv",
+    "glGetActiveSubroutineUniformName",
+    "glGetActiveSubroutineName",
+    "glUniformSubroutinesuiv",
+    "glGetUniformSubroutineuiv",
+    "glGetProgramStageiv",
+    "glPatchParameteri",
+    "glPatchParameterfv",
+    "glBindTransformFeedback",
+    "glDeleteTransformFeedbacks",
+    "glGenTransformFeedbacks",
+    "glIsTransformFeedback",
+    "glPauseTransformFeedback",
+    "glResumeTransformFeedback",
+    "glDrawTransformFeedback",
+    "glDrawTransformFeedbackStream",
+    "glBeginQueryIndexed",
+    "glEndQueryIndexed",
+    "glGetQueryIndexediv",
+};
+
+inline PFNGLCULLFACEPROC glTraceReal_CullFace = nullptr;
+inline PFNGLFRONTFACEPROC glTraceReal_FrontFace = nullptr;
+inline PFNGLHINTPROC glTraceReal_Hint = nullptr;
+inline PFNGLLINEWIDTHPROC glTraceReal_LineWidth = nullptr;
+inline PFNGLPOINTSIZEPROC glTraceReal_PointSize = nullptr;
+inline PFNGLPOLYGONMODEPROC glTraceReal_PolygonMode = nullptr;
+inline PFNGLSCISSORPROC glTraceReal_Scissor = nullptr;
+inline PFNGLTEXPARAMETERFPROC glTraceReal_TexParameterf = nullptr;
+inline PFNGLTEXPARAMETERFVPROC glTraceReal_TexParameterfv = nullptr;
+inline PFNGLTEXPARAMETERIPROC glTraceReal_TexParameteri = nullptr;
+inline PFNGLTEXPARAMETERIVPROC glTraceReal_TexParameteriv = nullptr;
+inline PFNGLTEXIMAGE1DPROC glTraceReal_TexImage1D = nullptr;
+inline PFNGLTEXIMAGE2DPROC glTraceReal_TexImage2D = nullptr;
+inline PFNGLDRAWBUFFERPROC glTraceReal_DrawBuffer = nullptr;
+inline PFNGLCLEARPROC glTraceReal_Clear = nullptr;
+inline PFNGLCLEARCOLORPROC glTraceReal_ClearColor = nullptr;
+inline PFNGLCLEARSTENCILPROC glTraceReal_ClearStencil = nullptr;
+inline PFNGLCLEARDEPTHPROC glTraceReal_ClearDepth = nullptr;
+inline PFNGLSTENCILMASKPROC glTraceReal_StencilMask = nullptr;
+inline PFNGLCOLORMASKPROC glTraceReal_ColorMask = nullptr;
+inline PFNGLDEPTHMASKPROC glTraceReal_DepthMask = nullptr;
+inline PFNGLDISABLEPROC glTraceReal_Disable = nullptr;
+inline PFNGLENABLEPROC glTraceReal_Enable = nullptr;
+inline PFNGLFINISHPROC glTraceReal_Finish = nullptr;
+inline PFNGLFLUSHPROC glTraceReal_Flush = nullptr;
+inline PFNGLBLENDFUNCPROC glTraceReal_BlendFunc = nullptr;
+inline PFNGLLOGICOPPROC glTraceReal_LogicOp = nullptr;
+inline PFNGLSTENCILFUNCPROC glTraceReal_StencilFunc = nullptr;
+inline PFNGLSTENCILOPPROC glTraceReal_StencilOp = nullptr;
+inline PFNGLDEPTHFUNCPROC glTraceReal_DepthFunc = nullptr;
+inline PFNGLPIXELSTOREFPROC glTraceReal_PixelStoref = nullptr;
+inline PFNGLPIXELSTOREIPROC glTraceReal_PixelStorei = nullptr;
+inline PFNGLREADBUFFERPROC glTraceReal_ReadBuffer = nullptr;
+inline PFNGLREADPIXELSPROC glTraceReal_ReadPixels = nullptr;
+inline PFNGLGETBOOLEANVPROC glTraceReal_GetBooleanv = nullptr;
+inline PFNGLGETDOUBLEVPROC glTraceReal_GetDoublev = nullptr;
+inline PFNGLGETERRORPROC glTraceReal_GetError = nullptr;
+inline PFNGLGETFLOATVPROC glTraceReal_GetFloatv = nullptr;
+inline PFNGLGETINTEGERVPROC glTraceReal_GetIntegerv = nullptr;
+inline PFNGLGETSTRINGPROC glTraceReal_GetString = nullptr;
+inline PFNGLGETTEXIMAGEPROC glTraceReal_GetTexImage = nullptr;
+inline PFNGLGETTEXPARAMETERFVPROC glTraceReal_GetTexParameterfv = nullptr;
+inline PFNGLGETTEXPARAMETERIVPROC glTraceReal_GetTexParameteriv = nullptr;
+inline PFNGLGETTEXLEVELPARAMETERFVPROC glTraceReal_GetTexLevelParameterfv = nullptr;
+inline PFNGLGETTEXLEVELPARAMETERIVPROC glTraceReal_GetTexLevelParameteriv = nullptr;
+inline PFNGLISENABLEDPROC glTraceReal_IsEnabled = nullptr;
+inline PFNGLDEPTHRANGEPROC glTraceReal_DepthRange = nullptr;
+inline PFNGLVIEWPORTPROC glTraceReal_Viewport = nullptr;
+inline PFNGLNEWLISTPROC glTraceReal_NewList = nullptr;
+inline PFNGLENDLISTPROC glTraceReal_EndList = nullptr;
+inline PFNGLCALLLISTPROC glTraceReal_CallList = nullptr;
+inline PFNGLCALLLISTSPROC glTraceReal_CallLists = nullptr;
+inline PFNGLDELETELISTSPROC glTraceReal_DeleteLists = nullptr;
+inline PFNGLGENLISTSPROC glTraceReal_GenLists = nullptr;
+inline PFNGLLISTBASEPROC glTraceReal_ListBase = nullptr;
+inline PFNGLBEGINPROC glTraceReal_Begin = nullptr;
+inline PFNGLBITMAPPROC glTraceReal_Bitmap = nullptr;
+inline PFNGLCOLOR3BPROC glTraceReal_Color3b = nullptr;
+inline PFNGLCOLOR3BVPROC glTraceReal_Color3bv = nullptr;
+inline PFNGLCOLOR3DPROC glTraceReal_Color3d = nullptr;
+inline PFNGLCOLOR3DVPROC glTraceReal_Color3dv = nullptr;
+inline PFNGLCOLOR3FPROC glTraceReal_Color3f = nullptr;
+inline PFNGLCOLOR3FVPROC glTraceReal_Color3fv = nullptr;
+inline PFNGLCOLOR3IPROC glTraceReal_Color3i = nullptr;
+inline PFNGLCOLOR3IVPROC glTraceReal_Color3iv = nullptr;
+inline PFNGLCOLOR3SPROC glTraceReal_Color3s = nullptr;
+inline PFNGLCOLOR3SVPROC glTraceReal_Color3sv = nullptr;
+inline PFNGLCOLOR3UBPROC glTraceReal_Color3ub = nullptr;
+inline PFNGLCOLOR3UBVPROC glTraceReal_Color3ubv = nullptr;
+inline PFNGLCOLOR3UIPROC glTraceReal_Color3ui = nullptr;
+inline PFNGLCOLOR3UIVPROC glTraceReal_Color3uiv = nullptr;
+inline PFNGLCOLOR3USPROC glTraceReal_Color3us = nullptr;
+inline PFNGLCOLOR3USVPROC glTraceReal_Color3usv = nullptr;
+inline PFNGLCOLOR4BPROC glTraceReal_Color4b = nullptr;
+inline PFNGLCOLOR4BVPROC glTraceReal_Color4bv = nullptr;
+inline PFNGLCOLOR4DPROC glTraceReal_Color4d = nullptr;
+inline PFNGLCOLOR4DVPROC glTraceReal_Color4dv = nullptr;
+inline PFNGLCOLOR4FPROC glTraceReal_Color4f = nullptr;
+inline PFNGLCOLOR4FVPROC glTraceReal_Color4fv = nullptr;
+inline PFNGLCOLOR4IPROC glTraceReal_Color4i = nullptr;
+inline PFNGLCOLOR4IVPROC glTraceReal_Color4iv = nullptr;
+inline PFNGLCOLOR4SPROC glTraceReal_Color4s = nullptr;
+inline PFNGLCOLOR4SVPROC glTraceReal_Color4sv = nullptr;
+inline PFNGLCOLOR4UBPROC glTraceReal_Color4ub = nullptr;
+inline PFNGLCOLOR4UBVPROC glTraceReal_Color4ubv = nullptr;
+inline PFNGLCOLOR4UIPROC glTraceReal_Color4ui = nullptr;
+inline PFNGLCOLOR4UIVPROC glTraceReal_Color4uiv = nullptr;
+inline PFNGLCOLOR4USPROC glTraceReal_Color4us = nullptr;
+inline PFNGLCOLOR4USVPROC glTraceReal_Color4usv = nullptr;
+inline PFNGLEDGEFLAGPROC glTraceReal_EdgeFlag = nullptr;
+inline PFNGLEDGEFLAGVPROC glTraceReal_EdgeFlagv = nullptr;
+inline PFNGLENDPROC glTraceReal_End = nullptr;
+inline PFNGLINDEXDPROC glTraceReal_Indexd = nullptr;
+inline PFNGLINDEXDVPROC glTraceReal_Indexdv = nullptr;
+inline PFNGLINDEXFPROC glTraceReal_Indexf = nullptr;
+inline PFNGLINDEXFVPROC glTraceReal_Indexfv = nullptr;
+inline PFNGLINDEXIPROC glTraceReal_Indexi = nullptr;
+inline PFNGLINDEXIVPROC glTraceReal_Indexiv = nullptr;
+inline PFNGLINDEXSPROC glTraceReal_Indexs = nullptr;
+inline PFNGLINDEXSVPROC glTraceReal_Indexsv = nullptr;
+inline PFNGLNORMAL3BPROC glTraceReal_Normal3b = nullptr;
+inline PFNGLNORMAL3BVPROC glTraceReal_Normal3bv = nullptr;
+inline PFNGLNORMAL3DPROC glTraceReal_Normal3d = nullptr;
+inline PFNGLNORMAL3DVPROC glTraceReal_Normal3dv = nullptr;
+inline PFNGLNORMAL3FPROC glTraceReal_Normal3f = nullptr;
+inline PFNGLNORMAL3FVPROC glTraceReal_Normal3fv = nullptr;
+inline PFNGLNORMAL3IPROC glTraceReal_Normal3i = nullptr;
+inline PFNGLNORMAL3IVPROC glTraceReal_Normal3iv = nullptr;
+inline PFNGLNORMAL3SPROC glTraceReal_Normal3s = nullptr;
+inline PFNGLNORMAL3SVPROC glTraceReal_Normal3sv = nullptr;
+inline PFNGLRASTERPOS2DPROC glTraceReal_RasterPos2d = nullptr;
+inline PFNGLRASTERPOS2DVPROC glTraceReal_RasterPos2dv = nullptr;
+inline PFNGLRASTERPOS2FPROC glTraceReal_RasterPos2f = nullptr;
+inline PFNGLRASTERPOS2FVPROC glTraceReal_RasterPos2fv = nullptr;
+inline PFNGLRASTERPOS2IPROC glTraceReal_RasterPos2i = nullptr;
+inline PFNGLRASTERPOS2IVPROC glTraceReal_RasterPos2iv = nullptr;
+inline PFNGLRASTERPOS2SPROC glTraceReal_RasterPos2s = nullptr;
+inline PFNGLRASTERPOS2SVPROC glTraceReal_RasterPos2sv = nullptr;
+inline PFNGLRASTERPOS3DPROC glTraceReal_RasterPos3d = nullptr;
+inline PFNGLRASTERPOS3DVPROC glTraceReal_RasterPos3dv = nullptr;
+inline PFNGLRASTERPOS3FPROC glTraceReal_RasterPos3f = nullptr;
+inline PFNGLRASTERPOS3FVPROC glTraceReal_RasterPos3fv = nullptr;
+inline PFNGLRASTERPOS3IPROC glTraceReal_RasterPos3i = nullptr;
+inline PFNGLRASTERPOS3IVPROC glTraceReal_RasterPos3iv = nullptr;
+inline PFNGLRASTERPOS3SPROC glTraceReal_RasterPos3s = nullptr;
+inline PFNGLRASTERPOS3SVPROC glTraceReal_RasterPos3sv = nullptr;
+inline PFNGLRASTERPOS4DPROC glTraceReal_RasterPos4d = nullptr;
+inline PFNGLRASTERPOS4DVPROC glTraceReal_RasterPos4dv = nullptr;
+inline PFNGLRASTERPOS4FPROC glTraceReal_RasterPos4f = nullptr;
+inline PFNGLRASTERPOS4FVPROC glTraceReal_RasterPos4fv = nullptr;
+inline PFNGLRASTERPOS4IPROC glTraceReal_RasterPos4i = nullptr;
+inline PFNGLRASTERPOS4IVPROC glTraceReal_RasterPos4iv = nullptr;
+inline PFNGLRASTERPOS4SPROC glTraceReal_RasterPos4s = nullptr;
+inline PFNGLRASTERPOS4SVPROC glTraceReal_RasterPos4sv = nullptr;
+inline PFNGLRECTDPROC glTraceReal_Rectd = nullptr;
+inline PFNGLRECTDVPROC glTraceReal_Rectdv = nullptr;
+inline PFNGLRECTFPROC glTraceReal_Rectf = nullptr;
+inline PFNGLRECTFVPROC glTraceReal_Rectfv = nullptr;
+inline PFNGLRECTIPROC glTraceReal_Recti = nullptr;
+inline PFNGLRECTIVPROC glTraceReal_Rectiv = nullptr;
+inline PFNGLRECTSPROC glTraceReal_Rects = nullptr;
+inline PFNGLRECTSVPROC glTraceReal_Rectsv = nullptr;
+inline PFNGLTEXCOORD1DPROC glTraceReal_TexCoord1d = nullptr;
+inline PFNGLTEXCOORD1DVPROC glTraceReal_TexCoord1dv = nullptr;
+inline PFNGLTEXCOORD1FPROC glTraceReal_TexCoord1f = nullptr;
+inline PFNGLTEXCOORD1FVPROC glTraceReal_TexCoord1fv = nullptr;
+inline PFNGLTEXCOORD1IPROC glTraceReal_TexCoord1i = nullptr;
+inline PFNGLTEXCOORD1IVPROC glTraceReal_TexCoord1iv = nullptr;
+inline PFNGLTEXCOORD1SPROC glTraceReal_TexCoord1s = nullptr;
+inline PFNGLTEXCOORD1SVPROC glTraceReal_TexCoord1sv = nullptr;
+inline PFNGLTEXCOORD2DPROC glTraceReal_TexCoord2d = nullptr;
+inline PFNGLTEXCOORD2DVPROC glTraceReal_TexCoord2dv = nullptr;
+inline PFNGLTEXCOORD2FPROC glTraceReal_TexCoord2f = nullptr;
+inline PFNGLTEXCOORD2FVPROC glTraceReal_TexCoord2fv = nullptr;
+inline PFNGLTEXCOORD2IPROC glTraceReal_TexCoord2i = nullptr;
+inline PFNGLTEXCOORD2IVPROC glTraceReal_TexCoord2iv = nullptr;
+inline PFNGLTEXCOORD2SPROC glTraceReal_TexCoord2s = nullptr;
+inline PFNGLTEXCOORD2SVPROC glTraceReal_TexCoord2sv = nullptr;
+inline PFNGLTEXCOORD3DPROC glTraceReal_TexCoord3d = nullptr;
+inline PFNGLTEXCOORD3DVPROC glTraceReal_TexCoord3dv = nullptr;
+inline PFNGLTEXCOORD3FPROC glTraceReal_TexCoord3f = nullptr;
+inline PFNGLTEXCOORD3FVPROC glTraceReal_TexCoord3fv = nullptr;
+inline PFNGLTEXCOORD3IPROC glTraceReal_TexCoord3i = nullptr;
+inline PFNGLTEXCOORD3IVPROC glTraceReal_TexCoord3iv = nullptr;
+inline PFNGLTEXCOORD3SPROC glTraceReal_TexCoord3s = nullptr;
+inline PFNGLTEXCOORD3SVPROC glTraceReal_TexCoord3sv = nullptr;
+inline PFNGLTEXCOORD4DPROC glTraceReal_TexCoord4d = nullptr;
+inline PFNGLTEXCOORD4DVPROC glTraceReal_TexCoord4dv = nullptr;
+inline PFNGLTEXCOORD4FPROC glTraceReal_TexCoord4f = nullptr;
+inline PFNGLTEXCOORD4FVPROC glTraceReal_TexCoord4fv = nullptr;
+inline PFNGLTEXCOORD4IPROC glTraceReal_TexCoord4i = nullptr;
+inline PFNGLTEXCOORD4IVPROC glTraceReal_TexCoord4iv = nullptr;
+inline PFNGLTEXCOORD4SPROC glTraceReal_TexCoord4s = nullptr;
+inline PFNGLTEXCOORD4SVPROC glTraceReal_TexCoord4sv = nullptr;
+inline PFNGLVERTEX2DPROC glTraceReal_Vertex2d = nullptr;
+inline PFNGLVERTEX2DVPROC glTraceReal_Vertex2dv = nullptr;
+inline PFNGLVERTEX2FPROC glTraceReal_Vertex2f = nullptr;
+inline PFNGLVERTEX2FVPROC glTraceReal_Vertex2fv = nullptr;
+inline PFNGLVERTEX2IPROC glTraceReal_Vertex2i = nullptr;
+inline PFNGLVERTEX2IVPROC glTraceReal_Vertex2iv = nullptr;
+inline PFNGLVERTEX2SPROC glTraceReal_Vertex2s = nullptr;
+inline PFNGLVERTEX2SVPROC glTraceReal_Vertex2sv = nullptr;
+inline PFNGLVERTEX3DPROC glTraceReal_Vertex3d = nullptr;
+inline PFNGLVERTEX3DVPROC glTraceReal_Vertex3dv = nullptr;
+inline PFNGLVERTEX3FPROC glTraceReal_Vertex3f = nullptr;
+inline PFNGLVERTEX3FVPROC glTraceReal_Vertex3fv = nullptr;
+inline PFNGLVERTEX3IPROC glTraceReal_Vertex3i = nullptr;
+inline PFNGLVERTEX3IVPROC glTraceReal_Vertex3iv = nullptr;
+inline PFNGLVERTEX3SPROC glTraceReal_Vertex3s = nullptr;
+inline PFNGLVERTEX3SVPROC glTraceReal_Vertex3sv = nullptr;
+inline PFNGLVERTEX4DPROC glTraceReal_Vertex4d = nullptr;
+inline PFNGLVERTEX4DVPROC glTraceReal_Vertex4dv = nullptr;
+inline PFNGLVERTEX4FPROC glTraceReal_Vertex4f = nullptr;
+inline PFNGLVERTEX4FVPROC glTraceReal_Vertex4fv = nullptr;
+inline PFNGLVERTEX4IPROC glTraceReal_Vertex4i = nullptr;
+inline PFNGLVERTEX4IVPROC glTraceReal_Vertex4iv = nullptr;
+inline PFNGLVERTEX4SPROC glTraceReal_Vertex4s = nullptr;
+inline PFNGLVERTEX4SVPROC glTraceReal_Vertex4sv = nullptr;
+inline PFNGLCLIPPLANEPROC glTraceReal_ClipPlane = nullptr;
+inline PFNGLCOLORMATERIALPROC glTraceReal_ColorMaterial = nullptr;
+inline PFNGLFOGFPROC glTraceReal_Fogf = nullptr;
+inline PFNGLFOGFVPROC glTraceReal_Fogfv = nullptr;
+inline PFNGLFOGIPROC glTraceReal_Fogi = nullptr;
+inline PFNGLFOGIVPROC glTraceReal_Fogiv = nullptr;
+inline PFNGLLIGHTFPROC glTraceReal_Lightf = nullptr;
+inline PFNGLLIGHTFVPROC glTraceReal_Lightfv = nullptr;
+inline PFNGLLIGHTIPROC glTraceReal_Lighti = nullptr;
+inline PFNGLLIGHTIVPROC glTraceReal_Lightiv = nullptr;
+inline PFNGLLIGHTMODELFPROC glTraceReal_LightModelf = nullptr;
+inline PFNGLLIGHTMODELFVPROC glTraceReal_LightModelfv = nullptr;
+inline PFNGLLIGHTMODELIPROC glTraceReal_LightModeli = nullptr;
+inline PFNGLLIGHTMODELIVPROC glTraceReal_LightModeliv = nullptr;
+inline PFNGLLINESTIPPLEPROC glTraceReal_LineStipple = nullptr;
+inline PFNGLMATERIALFPROC glTraceReal_Materialf = nullptr;
+inline PFNGLMATERIALFVPROC glTraceReal_Materialfv = nullptr;
+inline PFNGLMATERIALIPROC glTraceReal_Materiali = nullptr;
+inline PFNGLMATERIALIVPROC glTraceReal_Materialiv = nullptr;
+inline PFNGLPOLYGONSTIPPLEPROC glTraceReal_PolygonStipple = nullptr;
+inline PFNGLSHADEMODELPROC glTraceReal_ShadeModel = nullptr;
+inline PFNGLTEXENVFPROC glTraceReal_TexEnvf = nullptr;
+inline PFNGLTEXENVFVPROC glTraceReal_TexEnvfv = nullptr;
+inline PFNGLTEXENVIPROC glTraceReal_TexEnvi = nullptr;
+inline PFNGLTEXENVIVPROC glTraceReal_TexEnviv = nullptr;
+inline PFNGLTEXGENDPROC glTraceReal_TexGend = nullptr;
+inline PFNGLTEXGENDVPROC glTraceReal_TexGendv = nullptr;
+inline PFNGLTEXGENFPROC glTraceReal_TexGenf = nullptr;
+inline PFNGLTEXGENFVPROC glTraceReal_TexGenfv = nullptr;
+inline PFNGLTEXGENIPROC glTraceReal_TexGeni = nullptr;
+inline PFNGLTEXGENIVPROC glTraceReal_TexGeniv = nullptr;
+inline PFNGLFEEDBACKBUFFERPROC glTraceReal_FeedbackBuffer = nullptr;
+inline PFNGLSELECTBUFFERPROC glTraceReal_SelectBuffer = nullptr;
+inline PFNGLRENDERMODEPROC glTraceReal_RenderMode = nullptr;
+inline PFNGLINITNAMESPROC glTraceReal_InitNames = nullptr;
+inline PFNGLLOADNAMEPROC glTraceReal_LoadName = nullptr;
+inline PFNGLPASSTHROUGHPROC glTraceReal_PassThrough = nullptr;
+inline PFNGLPOPNAMEPROC glTraceReal_PopName = nullptr;
+inline PFNGLPUSHNAMEPROC glTraceReal_PushName = nullptr;
+inline PFNGLCLEARACCUMPROC glTraceReal_ClearAccum = nullptr;
+inline PFNGLCLEARINDEXPROC glTraceReal_ClearIndex = nullptr;
+inline PFNGLINDEXMASKPROC glTraceReal_IndexMask = nullptr;
+inline PFNGLACCUMPROC glTraceReal_Accum = nullptr;
+inline PFNGLPOPATTRIBPROC glTraceReal_PopAttrib = nullptr;
+inline PFNGLPUSHATTRIBPROC glTraceReal_PushAttrib = nullptr;
+inline PFNGLMAP1DPROC glTraceReal_Map1d = nullptr;
+inline PFNGLMAP1FPROC glTraceReal_Map1f = nullptr;
+inline PFNGLMAP2DPROC glTraceReal_Map2d = nullptr;
+inline PFNGLMAP2FPROC glTraceReal_Map2f = nullptr;
+inline PFNGLMAPGRID1DPROC glTraceReal_MapGrid1d = nullptr;
+inline PFNGLMAPGRID1FPROC glTraceReal_MapGrid1f = nullptr;
+inline PFNGLMAPGRID2DPROC glTraceReal_MapGrid2d = nullptr;
+inline PFNGLMAPGRID2FPROC glTraceReal_MapGrid2f = nullptr;
+inline PFNGLEVALCOORD1DPROC glTraceReal_EvalCoord1d = nullptr;
+inline PFNGLEVALCOORD1DVPROC glTraceReal_EvalCoord1dv = nullptr;
+inline PFNGLEVALCOORD1FPROC glTraceReal_EvalCoord1f = nullptr;
+inline PFNGLEVALCOORD1FVPROC glTraceReal_EvalCoord1fv = nullptr;
+inline PFNGLEVALCOORD2DPROC glTraceReal_EvalCoord2d = nullptr;
+inline PFNGLEVALCOORD2DVPROC glTraceReal_EvalCoord2dv = nullptr;
+inline PFNGLEVALCOORD2FPROC glTraceReal_EvalCoord2f = nullptr;
+inline PFNGLEVALCOORD2FVPROC glTraceReal_EvalCoord2fv = nullptr;
+inline PFNGLEVALMESH1PROC glTraceReal_EvalMesh1 = nullptr;
+inline PFNGLEVALPOINT1PROC glTraceReal_EvalPoint1 = nullptr;
+inline PFNGLEVALMESH2PROC glTraceReal_EvalMesh2 = nullptr;
+inline PFNGLEVALPOINT2PROC glTraceReal_EvalPoint2 = nullptr;
+inline PFNGLALPHAFUNCPROC glTraceReal_AlphaFunc = nullptr;
+inline PFNGLPIXELZOOMPROC glTraceReal_PixelZoom = nullptr;
+inline PFNGLPIXELTRANSFERFPROC glTraceReal_PixelTransferf = nullptr;
+inline PFNGLPIXELTRANSFERIPROC glTraceReal_PixelTransferi = nullptr;
+inline PFNGLPIXELMAPFVPROC glTraceReal_PixelMapfv = nullptr;
+inline PFNGLPIXELMAPUIVPROC glTraceReal_PixelMapuiv = nullptr;
+inline PFNGLPIXELMAPUSVPROC glTraceReal_PixelMapusv = nullptr;
+inline PFNGLCOPYPIXELSPROC glTraceReal_CopyPixels = nullptr;
+inline PFNGLDRAWPIXELSPROC glTraceReal_DrawPixels = nullptr;
+inline PFNGLGETCLIPPLANEPROC glTraceReal_GetClipPlane = nullptr;
+inline PFNGLGETLIGHTFVPROC glTraceReal_GetLightfv = nullptr;
+inline PFNGLGETLIGHTIVPROC glTraceReal_GetLightiv = nullptr;
+inline PFNGLGETMAPDVPROC glTraceReal_GetMapdv = nullptr;
+inline PFNGLGETMAPFVPROC glTraceReal_GetMapfv = nullptr;
+inline PFNGLGETMAPIVPROC glTraceReal_GetMapiv = nullptr;
+inline PFNGLGETMATERIALFVPROC glTraceReal_GetMaterialfv = nullptr;
+inline PFNGLGETMATERIALIVPROC glTraceReal_GetMaterialiv = nullptr;
+inline PFNGLGETPIXELMAPFVPROC glTraceReal_GetPixelMapfv = nullptr;
+inline PFNGLGETPIXELMAPUIVPROC glTraceReal_GetPixelMapuiv = nullptr;
+inline PFNGLGETPIXELMAPUSVPROC glTraceReal_GetPixelMapusv = nullptr;
+inline PFNGLGETPOLYGONSTIPPLEPROC glTraceReal_GetPolygonStipple = nullptr;
+inline PFNGLGETTEXENVFVPROC glTraceReal_GetTexEnvfv = nullptr;
+inline PFNGLGETTEXENVIVPROC glTraceReal_GetTexEnviv = nullptr;
+inline PFNGLGETTEXGENDVPROC glTraceReal_GetTexGendv = nullptr;
+inline PFNGLGETTEXGENFVPROC glTraceReal_GetTexGenfv = nullptr;
+inline PFNGLGETTEXGENIVPROC glTraceReal_GetTexGeniv = nullptr;
+inline PFNGLISLISTPROC glTraceReal_IsList = nullptr;
+inline PFNGLFRUSTUMPROC glTraceReal_Frustum = nullptr;
+inline PFNGLLOADIDENTITYPROC glTraceReal_LoadIdentity = nullptr;
+inline PFNGLLOADMATRIXFPROC glTraceReal_LoadMatrixf = nullptr;
+inline PFNGLLOADMATRIXDPROC glTraceReal_LoadMatrixd = nullptr;
+inline PFNGLMATRIXMODEPROC glTraceReal_MatrixMode = nullptr;
+inline PFNGLMULTMATRIXFPROC glTraceReal_MultMatrixf = nullptr;
+inline PFNGLMULTMATRIXDPROC glTraceReal_MultMatrixd = nullptr;
+inline PFNGLORTHOPROC glTraceReal_Ortho = nullptr;
+inline PFNGLPOPMATRIXPROC glTraceReal_PopMatrix = nullptr;
+inline PFNGLPUSHMATRIXPROC glTraceReal_PushMatrix = nullptr;
+inline PFNGLROTATEDPROC glTraceReal_Rotated = nullptr;
+inline PFNGLROTATEFPROC glTraceReal_Rotatef = nullptr;
+inline PFNGLSCALEDPROC glTraceReal_Scaled = nullptr;
+inline PFNGLSCALEFPROC glTraceReal_Scalef = nullptr;
+inline PFNGLTRANSLATEDPROC glTraceReal_Translated = nullptr;
+inline PFNGLTRANSLATEFPROC glTraceReal_Translatef = nullptr;
+inline PFNGLDRAWARRAYSPROC glTraceReal_DrawArrays = nullptr;
+inline PFNGLDRAWELEMENTSPROC glTraceReal_DrawElements = nullptr;
+inline PFNGLGETPOINTERVPROC glTraceReal_GetPointerv = nullptr;
+inline PFNGLPOLYGONOFFSETPROC glTraceReal_PolygonOffset = nullptr;
+inline PFNGLCOPYTEXIMAGE1DPROC glTraceReal_CopyTexImage1D = nullptr;
+inline PFNGLCOPYTEXIMAGE2DPROC glTraceReal_CopyTexImage2D = nullptr;
+inline PFNGLCOPYTEXSUBIMAGE1DPROC glTraceReal_CopyTexSubImage1D = nullptr;
+inline PFNGLCOPYTEXSUBIMAGE2DPROC glTraceReal_CopyTexSubImage2D = nullptr;
+inline PFNGLTEXSUBIMAGE1DPROC glTraceReal_TexSubImage1D = nullptr;
+inline PFNGLTEXSUBIMAGE2DPROC glTraceReal_TexSubImage2D = nullptr;
+inline PFNGLBINDTEXTUREPROC glTraceReal_BindTexture = nullptr;
+inline PFNGLDELETETEXTURESPROC glTraceReal_DeleteTextures = nullptr;
+inline PFNGLGENTEXTURESPROC glTraceReal_GenTextures = nullptr;
+inline PFNGLISTEXTUREPROC glTraceReal_IsTexture = nullptr;
+inline PFNGLARRAYELEMENTPROC glTraceReal_ArrayElement = nullptr;
+inline PFNGLCOLORPOINTERPROC glTraceReal_ColorPointer = nullptr;
+inline PFNGLDISABLECLIENTSTATEPROC glTraceReal_DisableClientState = nullptr;
+inline PFNGLEDGEFLAGPOINTERPROC glTraceReal_EdgeFlagPointer = nullptr;
+inline PFNGLENABLECLIENTSTATEPROC glTraceReal_EnableClientState = nullptr;
+inline PFNGLINDEXPOINTERPROC glTraceReal_IndexPointer = nullptr;
+inline PFNGLINTERLEAVEDARRAYSPROC glTraceReal_InterleavedArrays = nullptr;
+inline PFNGLNORMALPOINTERPROC glTraceReal_NormalPointer = nullptr;
+inline PFNGLTEXCOORDPOINTERPROC glTraceReal_TexCoordPointer = nullptr;
+inline PFNGLVERTEXPOINTERPROC glTraceReal_VertexPointer = nullptr;
+inline PFNGLARETEXTURESRESIDENTPROC glTraceReal_AreTexturesResident = nullptr;
+inline PFNGLPRIORITIZETEXTURESPROC glTraceReal_PrioritizeTextures = nullptr;
+inline PFNGLINDEXUBPROC glTraceReal_Indexub = nullptr;
+inline PFNGLINDEXUBVPROC glTraceReal_Indexubv = nullptr;
+inline PFNGLPOPCLIENTATTRIBPROC glTraceReal_PopClientAttrib = nullptr;
+inline PFNGLPUSHCLIENTATTRIBPROC glTraceReal_PushClientAttrib = nullptr;
+inline PFNGLDRAWRANGEELEMENTSPROC glTraceReal_DrawRangeElements = nullptr;
+inline PFNGLTEXIMAGE3DPROC glTraceReal_TexImage3D = nullptr;
+inline PFNGLTEXSUBIMAGE3DPROC glTraceReal_TexSubImage3D = nullptr;
+inline PFNGLCOPYTEXSUBIMAGE3DPROC glTraceReal_CopyTexSubImage3D = nullptr;
+inline PFNGLACTIVETEXTUREPROC glTraceReal_ActiveTexture = nullptr;
+inline PFNGLSAMPLECOVERAGEPROC glTraceReal_SampleCoverage = nullptr;
+inline PFNGLCOMPRESSEDTEXIMAGE3DPROC glTraceReal_CompressedTexImage3D = nullptr;
+inline PFNGLCOMPRESSEDTEXIMAGE2DPROC glTraceReal_CompressedTexImage2D = nullptr;
+inline PFNGLCOMPRESSEDTEXIMAGE1DPROC glTraceReal_CompressedTexImage1D = nullptr;
+inline PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC glTraceReal_CompressedTexSubImage3D = nullptr;
+inline PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC glTraceReal_CompressedTexSubImage2D = nullptr;
+inline PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC glTraceReal_CompressedTexSubImage1D = nullptr;
+inline PFNGLGETCOMPRESSEDTEXIMAGEPROC glTraceReal_GetCompressedTexImage = nullptr;
+inline PFNGLCLIENTACTIVETEXTUREPROC glTraceReal_ClientActiveTexture = nullptr;
+inline PFNGLMULTITEXCOORD1DPROC glTraceReal_MultiTexCoord1d = nullptr;
+inline PFNGLMULTITEXCOORD1DVPROC glTraceReal_MultiTexCoord1dv = nullptr;
+inline PFNGLMULTITEXCOORD1FPROC glTraceReal_MultiTexCoord1f = nullptr;
+inline PFNGLMULTITEXCOORD1FVPROC glTraceReal_MultiTexCoord1fv = nullptr;
+inline PFNGLMULTITEXCOORD1IPROC glTraceReal_MultiTexCoord1i = nullptr;
+inline PFNGLMULTITEXCOORD1IVPROC glTraceReal_MultiTexCoord1iv = nullptr;
+inline PFNGLMULTITEXCOORD1SPROC glTraceReal_MultiTexCoord1s = nullptr;
+inline PFNGLMULTITEXCOORD1SVPROC glTraceReal_MultiTexCoord1sv = nullptr;
+inline PFNGLMULTITEXCOORD2DPROC glTraceReal_MultiTexCoord2d = nullptr;
+inline PFNGLMULTITEXCOORD2DVPROC glTraceReal_MultiTexCoord2dv = nullptr;
+inline PFNGLMULTITEXCOORD2FPROC glTraceReal_MultiTexCoord2f = nullptr;
+inline PFNGLMULTITEXCOORD2FVPROC glTraceReal_MultiTexCoord2fv = nullptr;
+inline PFNGLMULTITEXCOORD2IPROC glTraceReal_MultiTexCoord2i = nullptr;
+inline PFNGLMULTITEXCOORD2IVPROC glTraceReal_MultiTexCoord2iv = nullptr;
+inline PFNGLMULTITEXCOORD2SPROC glTraceReal_MultiTexCoord2s = nullptr;
+inline PFNGLMULTITEXCOORD2SVPROC glTraceReal_MultiTexCoord2sv = nullptr;
+inline PFNGLMULTITEXCOORD3DPROC glTraceReal_MultiTexCoord3d = nullptr;
+inline PFNGLMULTITEXCOORD3DVPROC glTraceReal_MultiTexCoord3dv = nullptr;
+inline PFNGLMULTITEXCOORD3FPROC glTraceReal_MultiTexCoord3f = nullptr;
+inline PFNGLMULTITEXCOORD3FVPROC glTraceReal_MultiTexCoord3fv = nullptr;
+inline PFNGLMULTITEXCOORD3IPROC glTraceReal_MultiTexCoord3i = nullptr;
+inline PFNGLMULTITEXCOORD3IVPROC glTraceReal_MultiTexCoord3iv = nullptr;
+inline PFNGLMULTITEXCOORD3SPROC glTraceReal_MultiTexCoord3s = nullptr;
+inline PFNGLMULTITEXCOORD3SVPROC glTraceReal_MultiTexCoord3sv = nullptr;
+inline PFNGLMULTITEXCOORD4DPROC glTraceReal_MultiTexCoord4d = nullptr;
+inline PFNGLMULTITEXCOORD4DVPROC glTraceReal_MultiTexCoord4dv = nullptr;
+inline PFNGLMULTITEXCOORD4FPROC glTraceReal_MultiTexCoord4f = nullptr;
+inline PFNGLMULTITEXCOORD4FVPROC glTraceReal_MultiTexCoord4fv = nullptr;
+inline PFNGLMULTITEXCOORD4IPROC glTraceReal_MultiTexCoord4i = nullptr;
+inline PFNGLMULTITEXCOORD4IVPROC glTraceReal_MultiTexCoord4iv = nullptr;
+inline PFNGLMULTITEXCOORD4SPROC glTraceReal_MultiTexCoord4s = nullptr;
+inline PFNGLMULTITEXCOORD4SVPROC glTraceReal_MultiTexCoord4sv = nullptr;
+inline PFNGLLOADTRANSPOSEMATRIXFPROC glTraceReal_LoadTransposeMatrixf = nullptr;
+inline PFNGLLOADTRANSPOSEMATRIXDPROC glTraceReal_LoadTransposeMatrixd = nullptr;
+inline PFNGLMULTTRANSPOSEMATRIXFPROC glTraceReal_MultTransposeMatrixf = nullptr;
+inline PFNGLMULTTRANSPOSEMATRIXDPROC glTraceReal_MultTransposeMatrixd = nullptr;
+inline PFNGLBLENDFUNCSEPARATEPROC glTraceReal_BlendFuncSeparate = nullptr;
+inline PFNGLMULTIDRAWARRAYSPROC glTraceReal_MultiDrawArrays = nullptr;
+inline PFNGLMULTIDRAWELEMENTSPROC glTraceReal_MultiDrawElements = nullptr;
+inline PFNGLPOINTPARAMETERFPROC glTraceReal_PointParameterf = nullptr;
+inline PFNGLPOINTPARAMETERFVPROC glTraceReal_PointParameterfv = nullptr;
+inline PFNGLPOINTPARAMETERIPROC glTraceReal_PointParameteri = nullptr;
+inline PFNGLPOINTPARAMETERIVPROC glTraceReal_PointParameteriv = nullptr;
+inline PFNGLFOGCOORDFPROC glTraceReal_FogCoordf = nullptr;
+inline PFNGLFOGCOORDFVPROC glTraceReal_FogCoordfv = nullptr;
+inline PFNGLFOGCOORDDPROC glTraceReal_FogCoordd = nullptr;
+inline PFNGLFOGCOORDDVPROC glTraceReal_FogCoorddv = nullptr;
+inline PFNGLFOGCOORDPOINTERPROC glTraceReal_FogCoordPointer = nullptr;
+inline PFNGLSECONDARYCOLOR3BPROC glTraceReal_SecondaryColor3b = nullptr;
+inline PFNGLSECONDARYCOLOR3BVPROC glTraceReal_SecondaryColor3bv = nullptr;
+inline PFNGLSECONDARYCOLOR3DPROC glTraceReal_SecondaryColor3d = nullptr;
+inline PFNGLSECONDARYCOLOR3DVPROC glTraceReal_SecondaryColor3dv = nullptr;
+inline PFNGLSECONDARYCOLOR3FPROC glTraceReal_SecondaryColor3f = nullptr;
+inline PFNGLSECONDARYCOLOR3FVPROC glTraceReal_SecondaryColor3fv = nullptr;
+inline PFNGLSECONDARYCOLOR3IPROC glTraceReal_SecondaryColor3i = nullptr;
+inline PFNGLSECONDARYCOLOR3IVPROC glTraceReal_SecondaryColor3iv = nullptr;
+inline PFNGLSECONDARYCOLOR3SPROC glTraceReal_SecondaryColor3s = nullptr;
+inline PFNGLSECONDARYCOLOR3SVPROC glTraceReal_SecondaryColor3sv = nullptr;
+inline PFNGLSECONDARYCOLOR3UBPROC glTraceReal_SecondaryColor3ub = nullptr;
+inline PFNGLSECONDARYCOLOR3UBVPROC glTraceReal_SecondaryColor3ubv = nullptr;
+inline PFNGLSECONDARYCOLOR3UIPROC glTraceReal_SecondaryColor3ui = nullptr;
+inline PFNGLSECONDARYCOLOR3UIVPROC glTraceReal_SecondaryColor3uiv = nullptr;
+inline PFNGLSECONDARYCOLOR3USPROC glTraceReal_SecondaryColor3us = nullptr;
+inline PFNGLSECONDARYCOLOR3USVPROC glTraceReal_SecondaryColor3usv = nullptr;
+inline PFNGLSECONDARYCOLORPOINTERPROC glTraceReal_SecondaryColorPointer = nullptr;
+inline PFNGLWINDOWPOS2DPROC glTraceReal_WindowPos2d = nullptr;
+inline PFNGLWINDOWPOS2DVPROC glTraceReal_WindowPos2dv = nullptr;
+inline PFNGLWINDOWPOS2FPROC glTraceReal_WindowPos2f = nullptr;
+inline PFNGLWINDOWPOS2FVPROC glTraceReal_WindowPos2fv = nullptr;
+inline PFNGLWINDOWPOS2IPROC glTraceReal_WindowPos2i = nullptr;
+inline PFNGLWINDOWPOS2IVPROC glTraceReal_WindowPos2iv = nullptr;
+inline PFNGLWINDOWPOS2SPROC glTraceReal_WindowPos2s = nullptr;
+inline PFNGLWINDOWPOS2SVPROC glTraceReal_WindowPos2sv = nullptr;
+inline PFNGLWINDOWPOS3DPROC glTraceReal_WindowPos3d = nullptr;
+inline PFNGLWINDOWPOS3DVPROC glTraceReal_WindowPos3dv = nullptr;
+inline PFNGLWINDOWPOS3FPROC glTraceReal_WindowPos3f = nullptr;
+inline PFNGLWINDOWPOS3FVPROC glTraceReal_WindowPos3fv = nullptr;
+inline PFNGLWINDOWPOS3IPROC glTraceReal_WindowPos3i = nullptr;
+inline PFNGLWINDOWPOS3IVPROC glTraceReal_WindowPos3iv = nullptr;
+inline PFNGLWINDOWPOS3SPROC glTraceReal_WindowPos3s = nullptr;
+inline PFNGLWINDOWPOS3SVPROC glTraceReal_WindowPos3sv = nullptr;
+inline PFNGLBLENDCOLORPROC glTraceReal_BlendColor = nullptr;
+inline PFNGLBLENDEQUATIONPROC glTraceReal_BlendEquation = nullptr;
+inline PFNGLGENQUERIESPROC glTraceReal_GenQueries = nullptr;
+inline PFNGLDELETEQUERIESPROC glTraceReal_DeleteQueries = nullptr;
+inline PFNGLISQUERYPROC glTraceReal_IsQuery = nullptr;
+inline PFNGLBEGINQUERYPROC glTraceReal_BeginQuery = nullptr;
+inline PFNGLENDQUERYPROC glTraceReal_EndQuery = nullptr;
+inline PFNGLGETQUERYIVPROC glTraceReal_GetQueryiv = nullptr;
+inline PFNGLGETQUERYOBJECTIVPROC glTraceReal_GetQueryObjectiv = nullptr;
+inline PFNGLGETQUERYOBJECTUIVPROC glTraceReal_GetQueryObjectuiv = nullptr;
+inline PFNGLBINDBUFFERPROC glTraceReal_BindBuffer = nullptr;
+inline PFNGLDELETEBUFFERSPROC glTraceReal_DeleteBuffers = nullptr;
+inline PFNGLGENBUFFERSPROC glTraceReal_GenBuffers = nullptr;
+inline PFNGLISBUFFERPROC glTraceReal_IsBuffer = nullptr;
+inline PFNGLBUFFERDATAPROC glTraceReal_BufferData = nullptr;
+inline PFNGLBUFFERSUBDATAPROC glTraceReal_BufferSubData = nullptr;
+inline PFNGLGETBUFFERSUBDATAPROC glTraceReal_GetBufferSubData = nullptr;
+inline PFNGLMAPBUFFERPROC glTraceReal_MapBuffer = nullptr;
+inline PFNGLUNMAPBUFFERPROC glTraceReal_UnmapBuffer = nullptr;
+inline PFNGLGETBUFFERPARAMETERIVPROC glTraceReal_GetBufferParameteriv = nullptr;
+inline PFNGLGETBUFFERPOINTERVPROC glTraceReal_GetBufferPointerv = nullptr;
+inline PFNGLBLENDEQUATIONSEPARATEPROC glTraceReal_BlendEquationSeparate = nullptr;
+inline PFNGLDRAWBUFFERSPROC glTraceReal_DrawBuffers = nullptr;
+inline PFNGLSTENCILOPSEPARATEPROC glTraceReal_StencilOpSeparate = nullptr;
+inline PFNGLSTENCILFUNCSEPARATEPROC glTraceReal_StencilFuncSeparate = nullptr;
+inline PFNGLSTENCILMASKSEPARATEPROC glTraceReal_StencilMaskSeparate = nullptr;
+inline PFNGLATTACHSHADERPROC glTraceReal_AttachShader = nullptr;
+inline PFNGLBINDATTRIBLOCATIONPROC glTraceReal_BindAttribLocation = nullptr;
+inline PFNGLCOMPILESHADERPROC glTraceReal_CompileShader = nullptr;
+inline PFNGLCREATEPROGRAMPROC glTraceReal_CreateProgram = nullptr;
+inline PFNGLCREATESHADERPROC glTraceReal_CreateShader = nullptr;
+inline PFNGLDELETEPROGRAMPROC glTraceReal_DeleteProgram = nullptr;
+inline PFNGLDELETESHADERPROC glTraceReal_DeleteShader = nullptr;
+inline PFNGLDETACHSHADERPROC glTraceReal_DetachShader = nullptr;
+inline PFNGLDISABLEVERTEXATTRIBARRAYPROC glTraceReal_DisableVertexAttribArray = nullptr;
+inline PFNGLENABLEVERTEXATTRIBARRAYPROC glTraceReal_EnableVertexAttribArray = nullptr;
+inline PFNGLGETACTIVEATTRIBPROC glTraceReal_GetActiveAttrib = nullptr;
+inline PFNGLGETACTIVEUNIFORMPROC glTraceReal_GetActiveUniform = nullptr;
+inline PFNGLGETATTACHEDSHADERSPROC glTraceReal_GetAttachedShaders = nullptr;
+inline PFNGLGETATTRIBLOCATIONPROC glTraceReal_GetAttribLocation = nullptr;
+inline PFNGLGETPROGRAMIVPROC glTraceReal_GetProgramiv = nullptr;
+inline PFNGLGETPROGRAMINFOLOGPROC glTraceReal_GetProgramInfoLog = nullptr;
+inline PFNGLGETSHADERIVPROC glTraceReal_GetShaderiv = nullptr;
+inline PFNGLGETSHADERINFOLOGPROC glTraceReal_GetShaderInfoLog = nullptr;
+inline PFNGLGETSHADERSOURCEPROC glTraceReal_GetShaderSource = nullptr;
+inline PFNGLGETUNIFORMLOCATIONPROC glTraceReal_GetUniformLocation = nullptr;
+inline PFNGLGETUNIFORMFVPROC glTraceReal_GetUniformfv = nullptr;
+inline PFNGLGETUNIFORMIVPROC glTraceReal_GetUniformiv = nullptr;
+inline PFNGLGETVERTEXATTRIBDVPROC glTraceReal_GetVertexAttribdv = nullptr;
+inline PFNGLGETVERTEXATTRIBFVPROC glTraceReal_GetVertexAttribfv = nullptr;
+inline PFNGLGETVERTEXATTRIBIVPROC glTraceReal_GetVertexAttribiv = nullptr;
+inline PFNGLGETVERTEXATTRIBPOINTERVPROC glTraceReal_GetVertexAttribPointerv = nullptr;
+inline PFNGLISPROGRAMPROC glTraceReal_IsProgram = nullptr;
+inline PFNGLISSHADERPROC glTraceReal_IsShader = nullptr;
+inline PFNGLLINKPROGRAMPROC glTraceReal_LinkProgram = nullptr;
+inline PFNGLSHADERSOURCEPROC glTraceReal_ShaderSource = nullptr;
+inline PFNGLUSEPROGRAMPROC glTraceReal_UseProgram = nullptr;
+inline PFNGLUNIFORM1FPROC glTraceReal_Uniform1f = nullptr;
+inline PFNGLUNIFORM2FPROC glTraceReal_Uniform2f = nullptr;
+inline PFNGLUNIFORM3FPROC glTraceReal_Uniform3f = nullptr;
+inline PFNGLUNIFORM4FPROC glTraceReal_Uniform4f = nullptr;
+inline PFNGLUNIFORM1IPROC glTraceReal_Uniform1i = nullptr;
+inline PFNGLUNIFORM2IPROC glTraceReal_Uniform2i = nullptr;
+inline PFNGLUNIFORM3IPROC glTraceReal_Uniform3i = nullptr;
+inline PFNGLUNIFORM4IPROC glTraceReal_Uniform4i = nullptr;
+inline PFNGLUNIFORM1FVPROC glTraceReal_Uniform1fv = nullptr;
+inline PFNGLUNIFORM2FVPROC glTraceReal_Uniform2fv = nullptr;
+inline PFNGLUNIFORM3FVPROC glTraceReal_Uniform3fv = nullptr;
+inline PFNGLUNIFORM4FVPROC glTraceReal_Uniform4fv = nullptr;
+inline PFNGLUNIFORM1IVPROC glTraceReal_Uniform1iv = nullptr;
+inline PFNGLUNIFORM2IVPROC glTraceReal_Uniform2iv = nullptr;
+inline PFNGLUNIFORM3IVPROC glTraceReal_Uniform3iv = nullptr;
+inline PFNGLUNIFORM4IVPROC glTraceReal_Uniform4iv = nullptr;
+inline PFNGLUNIFORMMATRIX2FVPROC glTraceReal_UniformMatrix2fv = nullptr;
+inline PFNGLUNIFORMMATRIX3FVPROC glTraceReal_UniformMatrix3fv = nullptr;
+inline PFNGLUNIFORMMATRIX4FVPROC glTraceReal_UniformMatrix4fv = nullptr;
+inline PFNGLVALIDATEPROGRAMPROC glTraceReal_ValidateProgram = nullptr;
+inline PFNGLVERTEXATTRIB1DPROC glTraceReal_VertexAttrib1d = nullptr;
+inline PFNGLVERTEXATTRIB1DVPROC glTraceReal_VertexAttrib1dv = nullptr;
+inline PFNGLVERTEXATTRIB1FPROC glTraceReal_VertexAttrib1f = nullptr;
+inline PFNGLVERTEXATTRIB1FVPROC glTraceReal_VertexAttrib1fv = nullptr;
+inline PFNGLVERTEXATTRIB1SPROC glTraceReal_VertexAttrib1s = nullptr;
+inline PFNGLVERTEXATTRIB1SVPROC glTraceReal_VertexAttrib1sv = nullptr;
+inline PFNGLVERTEXATTRIB2DPROC glTraceReal_VertexAttrib2d = nullptr;
+inline PFNGLVERTEXATTRIB2DVPROC glTraceReal_VertexAttrib2dv = nullptr;
+inline PFNGLVERTEXATTRIB2FPROC glTraceReal_VertexAttrib2f = nullptr;
+inline PFNGLVERTEXATTRIB2FVPROC glTraceReal_VertexAttrib2fv = nullptr;
+inline PFNGLVERTEXATTRIB2SPROC glTraceReal_VertexAttrib2s = nullptr;
+inline PFNGLVERTEXATTRIB2SVPROC glTraceReal_VertexAttrib2sv = nullptr;
+inline PFNGLVERTEXATTRIB3DPROC glTraceReal_VertexAttrib3d = nullptr;
+inline PFNGLVERTEXATTRIB3DVPROC glTraceReal_VertexAttrib3dv = nullptr;
+inline PFNGLVERTEXATTRIB3FPROC glTraceReal_VertexAttrib3f = nullptr;
+inline PFNGLVERTEXATTRIB3FVPROC glTraceReal_VertexAttrib3fv = nullptr;
+inline PFNGLVERTEXATTRIB3SPROC glTraceReal_VertexAttrib3s = nullptr;
+inline PFNGLVERTEXATTRIB3SVPROC glTraceReal_VertexAttrib3sv = nullptr;
+inline PFNGLVERTEXATTRIB4NBVPROC glTraceReal_VertexAttrib4Nbv = nullptr;
+inline PFNGLVERTEXATTRIB4NIVPROC glTraceReal_VertexAttrib4Niv = nullptr;
+inline PFNGLVERTEXATTRIB4NSVPROC glTraceReal_VertexAttrib4Nsv = nullptr;
+inline PFNGLVERTEXATTRIB4NUBPROC glTraceReal_VertexAttrib4Nub = nullptr;
+inline PFNGLVERTEXATTRIB4NUBVPROC glTraceReal_VertexAttrib4Nubv = nullptr;
+inline PFNGLVERTEXATTRIB4NUIVPROC glTraceReal_VertexAttrib4Nuiv = nullptr;
+inline PFNGLVERTEXATTRIB4NUSVPROC glTraceReal_VertexAttrib4Nusv = nullptr;
+inline PFNGLVERTEXATTRIB4BVPROC glTraceReal_VertexAttrib4bv = nullptr;
+inline PFNGLVERTEXATTRIB4DPROC glTraceReal_VertexAttrib4d = nullptr;
+inline PFNGLVERTEXATTRIB4DVPROC glTraceReal_VertexAttrib4dv = nullptr;
+inline PFNGLVERTEXATTRIB4FPROC glTraceReal_VertexAttrib4f = nullptr;
+inline PFNGLVERTEXATTRIB4FVPROC glTraceReal_VertexAttrib4fv = nullptr;
+inline PFNGLVERTEXATTRIB4IVPROC glTraceReal_VertexAttrib4iv = nullptr;
+inline PFNGLVERTEXATTRIB4SPROC glTraceReal_VertexAttrib4s = nullptr;
+inline PFNGLVERTEXATTRIB4SVPROC glTraceReal_VertexAttrib4sv = nullptr;
+inline PFNGLVERTEXATTRIB4UBVPROC glTraceReal_VertexAttrib4ubv = nullptr;
+inline PFNGLVERTEXATTRIB4UIVPROC glTraceReal_VertexAttrib4uiv = nullptr;
+inline PFNGLVERTEXATTRIB4USVPROC glTraceReal_VertexAttrib4usv = nullptr;
+inline PFNGLVERTEXATTRIBPOINTERPROC glTraceReal_VertexAttribPointer = nullptr;
+inline PFNGLUNIFORMMATRIX2X3FVPROC glTraceReal_UniformMatrix2x3fv = nullptr;
+inline PFNGLUNIFORMMATRIX3X2FVPROC glTraceReal_UniformMatrix3x2fv = nullptr;
+inline PFNGLUNIFORMMATRIX2X4FVPROC glTraceReal_UniformMatrix2x4fv = nullptr;
+inline PFNGLUNIFORMMATRIX4X2FVPROC glTraceReal_UniformMatrix4x2fv = nullptr;
+inline PFNGLUNIFORMMATRIX3X4FVPROC glTraceReal_UniformMatrix3x4fv = nullptr;
+inline PFNGLUNIFORMMATRIX4X3FVPROC glTraceReal_UniformMatrix4x3fv = nullptr;
+inline PFNGLCOLORMASKIPROC glTraceReal_ColorMaski = nullptr;
+inline PFNGLGETBOOLEANI_VPROC glTraceReal_GetBooleani_v = nullptr;
+inline PFNGLGETINTEGERI_VPROC glTraceReal_GetIntegeri_v = nullptr;
+inline PFNGLENABLEIPROC glTraceReal_Enablei = nullptr;
+inline PFNGLDISABLEIPROC glTraceReal_Disablei = nullptr;
+inline PFNGLISENABLEDIPROC glTraceReal_IsEnabledi = nullptr;
+inline PFNGLBEGINTRANSFORMFEEDBACKPROC glTraceReal_BeginTransformFeedback = nullptr;
+inline PFNGLENDTRANSFORMFEEDBACKPROC glTraceReal_EndTransformFeedback = nullptr;
+inline PFNGLBINDBUFFERRANGEPROC glTraceReal_BindBufferRange = nullptr;
+inline PFNGLBINDBUFFERBASEPROC glTraceReal_BindBufferBase = nullptr;
+inline PFNGLTRANSFORMFEEDBACKVARYINGSPROC glTraceReal_TransformFeedbackVaryings = nullptr;
+inline PFNGLGETTRANSFORMFEEDBACKVARYINGPROC glTraceReal_GetTransformFeedbackVarying = nullptr;
+inline PFNGLCLAMPCOLORPROC glTraceReal_ClampColor = nullptr;
+inline PFNGLBEGINCONDITIONALRENDERPROC glTraceReal_BeginConditionalRender = nullptr;
+inline PFNGLENDCONDITIONALRENDERPROC glTraceReal_EndConditionalRender = nullptr;
+inline PFNGLVERTEXATTRIBIPOINTERPROC glTraceReal_VertexAttribIPointer = nullptr;
+inline PFNGLGETVERTEXATTRIBIIVPROC glTraceReal_GetVertexAttribIiv = nullptr;
+inline PFNGLGETVERTEXATTRIBIUIVPROC glTraceReal_GetVertexAttribIuiv = nullptr;
+inline PFNGLVERTEXATTRIBI1IPROC glTraceReal_VertexAttribI1i = nullptr;
+inline PFNGLVERTEXATTRIBI2IPROC glTraceReal_VertexAttribI2i = nullptr;
+inline PFNGLVERTEXATTRIBI3IPROC glTraceReal_VertexAttribI3i = nullptr;
+inline PFNGLVERTEXATTRIBI4IPROC glTraceReal_VertexAttribI4i = nullptr;
+inline PFNGLVERTEXATTRIBI1UIPROC glTraceReal_VertexAttribI1ui = nullptr;
+inline PFNGLVERTEXATTRIBI2UIPROC glTraceReal_VertexAttribI2ui = nullptr;
+inline PFNGLVERTEXATTRIBI3UIPROC glTraceReal_VertexAttribI3ui = nullptr;
+inline PFNGLVERTEXATTRIBI4UIPROC glTraceReal_VertexAttribI4ui = nullptr;
+inline PFNGLVERTEXATTRIBI1IVPROC glTraceReal_VertexAttribI1iv = nullptr;
+inline PFNGLVERTEXATTRIBI2IVPROC glTraceReal_VertexAttribI2iv = nullptr;
+inline PFNGLVERTEXATTRIBI3IVPROC glTraceReal_VertexAttribI3iv = nullptr;
+inline PFNGLVERTEXATTRIBI4IVPROC glTraceReal_VertexAttribI4iv = nullptr;
+inline PFNGLVERTEXATTRIBI1UIVPROC glTraceReal_VertexAttribI1uiv = nullptr;
+inline PFNGLVERTEXATTRIBI2UIVPROC glTraceReal_VertexAttribI2uiv = nullptr;
+inline PFNGLVERTEXATTRIBI3UIVPROC glTraceReal_VertexAttribI3uiv = nullptr;
+inline PFNGLVERTEXATTRIBI4UIVPROC glTraceReal_VertexAttribI4uiv = nullptr;
+inline PFNGLVERTEXATTRIBI4BVPROC glTraceReal_VertexAttribI4bv = nullptr;
+inline PFNGLVERTEXATTRIBI4SVPROC glTraceReal_VertexAttribI4sv = nullptr;
+inline PFNGLVERTEXATTRIBI4UBVPROC glTraceReal_VertexAttribI4ubv = nullptr;
+inline PFNGLVERTEXATTRIBI4USVPROC glTraceReal_VertexAttribI4usv = nullptr;
+inline PFNGLGETUNIFORMUIVPROC glTraceReal_GetUniformuiv = nullptr;
+inline PFNGLBINDFRAGDATALOCATIONPROC glTraceReal_BindFragDataLocation = nullptr;
+inline PFNGLGETFRAGDATALOCATIONPROC glTraceReal_GetFragDataLocation = nullptr;
+inline PFNGLUNIFORM1UIPROC glTraceReal_Uniform1ui = nullptr;
+inline PFNGLUNIFORM2UIPROC glTraceReal_Uniform2ui = nullptr;
+inline PFNGLUNIFORM3UIPROC glTraceReal_Uniform3ui = nullptr;
+inline PFNGLUNIFORM4UIPROC glTraceReal_Uniform4ui = nullptr;
+inline PFNGLUNIFORM1UIVPROC glTraceReal_Uniform1uiv = nullptr;
+inline PFNGLUNIFORM2UIVPROC glTraceReal_Uniform2uiv = nullptr;
+inline PFNGLUNIFORM3UIVPROC glTraceReal_Uniform3uiv = nullptr;
+inline PFNGLUNIFORM4UIVPROC glTraceReal_Uniform4uiv = nullptr;
+inline PFNGLTEXPARAMETERIIVPROC glTraceReal_TexParameterIiv = nullptr;
+inline PFNGLTEXPARAMETERIUIVPROC glTraceReal_TexParameterIuiv = nullptr;
+inline PFNGLGETTEXPARAMETERIIVPROC glTraceReal_GetTexParameterIiv = nullptr;
+inline PFNGLGETTEXPARAMETERIUIVPROC glTraceReal_GetTexParameterIuiv = nullptr;
+inline PFNGLCLEARBUFFERIVPROC glTraceReal_ClearBufferiv = nullptr;
+inline PFNGLCLEARBUFFERUIVPROC glTraceReal_ClearBufferuiv = nullptr;
+inline PFNGLCLEARBUFFERFVPROC glTraceReal_ClearBufferfv = nullptr;
+inline PFNGLCLEARBUFFERFIPROC glTraceReal_ClearBufferfi = nullptr;
+inline PFNGLGETSTRINGIPROC glTraceReal_GetStringi = nullptr;
+inline PFNGLISRENDERBUFFERPROC glTraceReal_IsRenderbuffer = nullptr;
+inline PFNGLBINDRENDERBUFFERPROC glTraceReal_BindRenderbuffer = nullptr;
+inline PFNGLDELETERENDERBUFFERSPROC glTraceReal_DeleteRenderbuffers = nullptr;
+inline PFNGLGENRENDERBUFFERSPROC glTraceReal_GenRenderbuffers = nullptr;
+inline PFNGLRENDERBUFFERSTORAGEPROC glTraceReal_RenderbufferStorage = nullptr;
+inline PFNGLGETRENDERBUFFERPARAMETERIVPROC glTraceReal_GetRenderbufferParameteriv = nullptr;
+inline PFNGLISFRAMEBUFFERPROC glTraceReal_IsFramebuffer = nullptr;
+inline PFNGLBINDFRAMEBUFFERPROC glTraceReal_BindFramebuffer = nullptr;
+inline PFNGLDELETEFRAMEBUFFERSPROC glTraceReal_DeleteFramebuffers = nullptr;
+inline PFNGLGENFRAMEBUFFERSPROC glTraceReal_GenFramebuffers = nullptr;
+inline PFNGLCHECKFRAMEBUFFERSTATUSPROC glTraceReal_CheckFramebufferStatus = nullptr;
+inline PFNGLFRAMEBUFFERTEXTURE1DPROC glTraceReal_FramebufferTexture1D = nullptr;
+inline PFNGLFRAMEBUFFERTEXTURE2DPROC glTraceReal_FramebufferTexture2D = nullptr;
+inline PFNGLFRAMEBUFFERTEXTURE3DPROC glTraceReal_FramebufferTexture3D = nullptr;
+inline PFNGLFRAMEBUFFERRENDERBUFFERPROC glTraceReal_FramebufferRenderbuffer = nullptr;
+inline PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC glTraceReal_GetFramebufferAttachmentParameteriv = nullptr;
+inline PFNGLGENERATEMIPMAPPROC glTraceReal_GenerateMipmap = nullptr;
+inline PFNGLBLITFRAMEBUFFERPROC glTraceReal_BlitFramebuffer = nullptr;
+inline PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glTraceReal_RenderbufferStorageMultisample = nullptr;
+inline PFNGLFRAMEBUFFERTEXTURELAYERPROC glTraceReal_FramebufferTextureLayer = nullptr;
+inline PFNGLMAPBUFFERRANGEPROC glTraceReal_MapBufferRange = nullptr;
+inline PFNGLFLUSHMAPPEDBUFFERRANGEPROC glTraceReal_FlushMappedBufferRange = nullptr;
+inline PFNGLBINDVERTEXARRAYPROC glTraceReal_BindVertexArray = nullptr;
+inline PFNGLDELETEVERTEXARRAYSPROC glTraceReal_DeleteVertexArrays = nullptr;
+inline PFNGLGENVERTEXARRAYSPROC glTraceReal_GenVertexArrays = nullptr;
+inline PFNGLISVERTEXARRAYPROC glTraceReal_IsVertexArray = nullptr;
+inline PFNGLDRAWARRAYSINSTANCEDPROC glTraceReal_DrawArraysInstanced = nullptr;
+inline PFNGLDRAWELEMENTSINSTANCEDPROC glTraceReal_DrawElementsInstanced = nullptr;
+inline PFNGLTEXBUFFERPROC glTraceReal_TexBuffer = nullptr;
+inline PFNGLPRIMITIVERESTARTINDEXPROC glTraceReal_PrimitiveRestartIndex = nullptr;
+inline PFNGLCOPYBUFFERSUBDATAPROC glTraceReal_CopyBufferSubData = nullptr;
+inline PFNGLGETUNIFORMINDICESPROC glTraceReal_GetUniformIndices = nullptr;
+inline PFNGLGETACTIVEUNIFORMSIVPROC glTraceReal_GetActiveUniformsiv = nullptr;
+inline PFNGLGETACTIVEUNIFORMNAMEPROC glTraceReal_GetActiveUniformName = nullptr;
+inline PFNGLGETUNIFORMBLOCKINDEXPROC glTraceReal_GetUniformBlockIndex = nullptr;
+inline PFNGLGETACTIVEUNIFORMBLOCKIVPROC glTraceReal_GetActiveUniformBlockiv = nullptr;
+inline PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC glTraceReal_GetActiveUniformBlockName = nullptr;
+inline PFNGLUNIFORMBLOCKBINDINGPROC glTraceReal_UniformBlockBinding = nullptr;
+inline PFNGLDRAWELEMENTSBASEVERTEXPROC glTraceReal_DrawElementsBaseVertex = nullptr;
+inline PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC glTraceReal_DrawRangeElementsBaseVertex = nullptr;
+inline PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glTraceReal_DrawElementsInstancedBaseVertex = nullptr;
+inline PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glTraceReal_MultiDrawElementsBaseVertex = nullptr;
+inline PFNGLPROVOKINGVERTEXPROC glTraceReal_ProvokingVertex = nullptr;
+inline PFNGLFENCESYNCPROC glTraceReal_FenceSync = nullptr;
+inline PFNGLISSYNCPROC glTraceReal_IsSync = nullptr;
+inline PFNGLDELETESYNCPROC glTraceReal_DeleteSync = nullptr;
+inline PFNGLCLIENTWAITSYNCPROC glTraceReal_ClientWaitSync = nullptr;
+inline PFNGLWAITSYNCPROC glTraceReal_WaitSync = nullptr;
+inline PFNGLGETINTEGER64VPROC glTraceReal_GetInteger64v = nullptr;
+inline PFNGLGETSYNCIVPROC glTraceReal_GetSynciv = nullptr;
+inline PFNGLGETINTEGER64I_VPROC glTraceReal_GetInteger64i_v = nullptr;
+inline PFNGLGETBUFFERPARAMETERI64VPROC glTraceReal_GetBufferParameteri64v = nullptr;
+inline PFNGLFRAMEBUFFERTEXTUREPROC glTraceReal_FramebufferTexture = nullptr;
+inline PFNGLTEXIMAGE2DMULTISAMPLEPROC glTraceReal_TexImage2DMultisample = nullptr;
+inline PFNGLTEXIMAGE3DMULTISAMPLEPROC glTraceReal_TexImage3DMultisample = nullptr;
+inline PFNGLGETMULTISAMPLEFVPROC glTraceReal_GetMultisamplefv = nullptr;
+inline PFNGLSAMPLEMASKIPROC glTraceReal_SampleMaski = nullptr;
+inline PFNGLBINDFRAGDATALOCATIONINDEXEDPROC glTraceReal_BindFragDataLocationIndexed = nullptr;
+inline PFNGLGETFRAGDATAINDEXPROC glTraceReal_GetFragDataIndex = nullptr;
+inline PFNGLGENSAMPLERSPROC glTraceReal_GenSamplers = nullptr;
+inline PFNGLDELETESAMPLERSPROC glTraceReal_DeleteSamplers = nullptr;
+inline PFNGLISSAMPLERPROC glTraceReal_IsSampler = nullptr;
+inline PFNGLBINDSAMPLERPROC glTraceReal_BindSampler = nullptr;
+inline PFNGLSAMPLERPARAMETERIPROC glTraceReal_SamplerParameteri = nullptr;
+inline PFNGLSAMPLERPARAMETERIVPROC glTraceReal_SamplerParameteriv = nullptr;
+inline PFNGLSAMPLERPARAMETERFPROC glTraceReal_SamplerParameterf = nullptr;
+inline PFNGLSAMPLERPARAMETERFVPROC glTraceReal_SamplerParameterfv = nullptr;
+inline PFNGLSAMPLERPARAMETERIIVPROC glTraceReal_SamplerParameterIiv = nullptr;
+inline PFNGLSAMPLERPARAMETERIUIVPROC glTraceReal_SamplerParameterIuiv = nullptr;
+inline PFNGLGETSAMPLERPARAMETERIVPROC glTraceReal_GetSamplerParameteriv = nullptr;
+inline PFNGLGETSAMPLERPARAMETERIIVPROC glTraceReal_GetSamplerParameterIiv = nullptr;
+inline PFNGLGETSAMPLERPARAMETERFVPROC glTraceReal_GetSamplerParameterfv = nullptr;
+inline PFNGLGETSAMPLERPARAMETERIUIVPROC glTraceReal_GetSamplerParameterIuiv = nullptr;
+inline PFNGLQUERYCOUNTERPROC glTraceReal_QueryCounter = nullptr;
+inline PFNGLGETQUERYOBJECTI64VPROC glTraceReal_GetQueryObjecti64v = nullptr;
+inline PFNGLGETQUERYOBJECTUI64VPROC glTraceReal_GetQueryObjectui64v = nullptr;
+inline PFNGLVERTEXATTRIBDIVISORPROC glTraceReal_VertexAttribDivisor = nullptr;
+inline PFNGLVERTEXATTRIBP1UIPROC glTraceReal_VertexAttribP1ui = nullptr;
+inline PFNGLVERTEXATTRIBP1UIVPROC glTraceReal_VertexAttribP1uiv = nullptr;
+inline PFNGLVERTEXATTRIBP2UIPROC glTraceReal_VertexAttribP2ui = nullptr;
+inline PFNGLVERTEXATTRIBP2UIVPROC glTraceReal_VertexAttribP2uiv = nullptr;
+inline PFNGLVERTEXATTRIBP3UIPROC glTraceReal_VertexAttribP3ui = nullptr;
+inline PFNGLVERTEXATTRIBP3UIVPROC glTraceReal_VertexAttribP3uiv = nullptr;
+inline PFNGLVERTEXATTRIBP4UIPROC glTraceReal_VertexAttribP4ui = nullptr;
+inline PFNGLVERTEXATTRIBP4UIVPROC glTraceReal_VertexAttribP4uiv = nullptr;
+inline PFNGLVERTEXP2UIPROC glTraceReal_VertexP2ui = nullptr;
+inline PFNGLVERTEXP2UIVPROC glTraceReal_VertexP2uiv = nullptr;
+inline PFNGLVERTEXP3UIPROC glTraceReal_VertexP3ui = nullptr;
+inline PFNGLVERTEXP3UIVPROC glTraceReal_VertexP3uiv = nullptr;
+inline PFNGLVERTEXP4UIPROC glTraceReal_VertexP4ui = nullptr;
+inline PFNGLVERTEXP4UIVPROC glTraceReal_VertexP4uiv = nullptr;
+inline PFNGLTEXCOORDP1UIPROC glTraceReal_TexCoordP1ui = nullptr;
+inline PFNGLTEXCOORDP1UIVPROC glTraceReal_TexCoordP1uiv = nullptr;
+inline PFNGLTEXCOORDP2UIPROC glTraceReal_TexCoordP2ui = nullptr;
+inline PFNGLTEXCOORDP2UIVPROC glTraceReal_TexCoordP2uiv = nullptr;
+inline PFNGLTEXCOORDP3UIPROC glTraceReal_TexCoordP3ui = nullptr;
+inline PFNGLTEXCOORDP3UIVPROC glTraceReal_TexCoordP3uiv = nullptr;
+inline PFNGLTEXCOORDP4UIPROC glTraceReal_TexCoordP4ui = nullptr;
+inline PFNGLTEXCOORDP4UIVPROC glTraceReal_TexCoordP4uiv = nullptr;
+inline PFNGLMULTITEXCOORDP1UIPROC glTraceReal_MultiTexCoordP1ui = nullptr;
+inline PFNGLMULTITEXCOORDP1UIVPROC glTraceReal_MultiTexCoordP1uiv = nullptr;
+inline PFNGLMULTITEXCOORDP2UIPROC glTraceReal_MultiTexCoordP2ui = nullptr;
+inline PFNGLMULTITEXCOORDP2UIVPROC glTraceReal_MultiTexCoordP2uiv = nullptr;
+inline PFNGLMULTITEXCOORDP3UIPROC glTraceReal_MultiTexCoordP3ui = nullptr;
+inline PFNGLMULTITEXCOORDP3UIVPROC glTraceReal_MultiTexCoordP3uiv = nullptr;
+inline PFNGLMULTITEXCOORDP4UIPROC glTraceReal_MultiTexCoordP4ui = nullptr;
+inline PFNGLMULTITEXCOORDP4UIVPROC glTraceReal_MultiTexCoordP4uiv = nullptr;
+inline PFNGLNORMALP3UIPROC glTraceReal_NormalP3ui = nullptr;
+inline PFNGLNORMALP3UIVPROC glTraceReal_NormalP3uiv = nullptr;
+inline PFNGLCOLORP3UIPROC glTraceReal_ColorP3ui = nullptr;
+inline PFNGLCOLORP3UIVPROC glTraceReal_ColorP3uiv = nullptr;
+inline PFNGLCOLORP4UIPROC glTraceReal_ColorP4ui = nullptr;
+inline PFNGLCOLORP4UIVPROC glTraceReal_ColorP4uiv = nullptr;
+inline PFNGLSECONDARYCOLORP3UIPROC glTraceReal_SecondaryColorP3ui = nullptr;
+inline PFNGLSECONDARYCOLORP3UIVPROC glTraceReal_SecondaryColorP3uiv = nullptr;
+inline PFNGLMINSAMPLESHADINGPROC glTraceReal_MinSampleShading = nullptr;
+inline PFNGLBLENDEQUATIONIPROC glTraceReal_BlendEquationi = nullptr;
+inline PFNGLBLENDEQUATIONSEPARATEIPROC glTraceReal_BlendEquationSeparatei = nullptr;
+inline PFNGLBLENDFUNCIPROC glTraceReal_BlendFunci = nullptr;
+inline PFNGLBLENDFUNCSEPARATEIPROC glTraceReal_BlendFuncSeparatei = nullptr;
+inline PFNGLDRAWARRAYSINDIRECTPROC glTraceReal_DrawArraysIndirect = nullptr;
+inline PFNGLDRAWELEMENTSINDIRECTPROC glTraceReal_DrawElementsIndirect = nullptr;
+inline PFNGLUNIFORM1DPROC glTraceReal_Uniform1d = nullptr;
+inline PFNGLUNIFORM2DPROC glTraceReal_Uniform2d = nullptr;
+inline PFNGLUNIFORM3DPROC glTraceReal_Uniform3d = nullptr;
+inline PFNGLUNIFORM4DPROC glTraceReal_Uniform4d = nullptr;
+inline PFNGLUNIFORM1DVPROC glTraceReal_Uniform1dv = nullptr;
+inline PFNGLUNIFORM2DVPROC glTraceReal_Uniform2dv = nullptr;
+inline PFNGLUNIFORM3DVPROC glTraceReal_Uniform3dv = nullptr;
+inline PFNGLUNIFORM4DVPROC glTraceReal_Uniform4dv = nullptr;
+inline PFNGLUNIFORMMATRIX2DVPROC glTraceReal_UniformMatrix2dv = nullptr;
+inline PFNGLUNIFORMMATRIX3DVPROC glTraceReal_UniformMatrix3dv = nullptr;
+inline PFNGLUNIFORMMATRIX4DVPROC glTraceReal_UniformMatrix4dv = nullptr;
+inline PFNGLUNIFORMMATRIX2X3DVPROC glTraceReal_UniformMatrix2x3dv = nullptr;
+inline PFNGLUNIFORMMATRIX2X4DVPROC glTraceReal_UniformMatrix2x4dv = nullptr;
+inline PFNGLUNIFORMMATRIX3X2DVPROC glTraceReal_UniformMatrix3x2dv = nullptr;
+inline PFNGLUNIFORMMATRIX3X4DVPROC glTraceReal_UniformMatrix3x4dv = nullptr;
+inline PFNGLUNIFORMMATRIX4X2DVPROC glTraceReal_UniformMatrix4x2dv = nullptr;
+inline PFNGLUNIFORMMATRIX4X3DVPROC glTraceReal_UniformMatrix4x3dv = nullptr;
+inline PFNGLGETUNIFORMDVPROC glTraceReal_GetUniformdv = nullptr;
+inline PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC glTraceReal_GetSubroutineUniformLocation = nullptr;
+inline PFNGLGETSUBROUTINEINDEXPROC glTraceReal_GetSubroutineIndex = nullptr;
+inline PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC glTraceReal_GetActiveSubroutineUniformiv = nullptr;
+inline PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC glTraceReal_GetActiveSubroutineUniformName = nullptr;
+inline PFNGLGETACTIVESUBROUTINENAMEPROC glTraceReal_GetActiveSubroutineName = nullptr;
+inline PFNGLUNIFORMSUBROUTINESUIVPROC glTraceReal_UniformSubroutinesuiv = nullptr;
+inline PFNGLGETUNIFORMSUBROUTINEUIVPROC glTraceReal_GetUniformSubroutineuiv = nullptr;
+inline PFNGLGETPROGRAMSTAGEIVPROC glTraceReal_GetProgramStageiv = nullptr;
+inline PFNGLPATCHPARAMETERIPROC glTraceReal_PatchParameteri = nullptr;
+inline PFNGLPATCHPARAMETERFVPROC glTraceReal_PatchParameterfv = nullptr;
+inline PFNGLBINDTRANSFORMFEEDBACKPROC glTraceReal_BindTransformFeedback = nullptr;
+inline PFNGLDELETETRANSFORMFEEDBACKSPROC glTraceReal_DeleteTransformFeedbacks = nullptr;
+inline PFNGLGENTRANSFORMFEEDBACKSPROC glTraceReal_GenTransformFeedbacks = nullptr;
+inline PFNGLISTRANSFORMFEEDBACKPROC glTraceReal_IsTransformFeedback = nullptr;
+inline PFNGLPAUSETRANSFORMFEEDBACKPROC glTraceReal_PauseTransformFeedback = nullptr;
+inline PFNGLRESUMETRANSFORMFEEDBACKPROC glTraceReal_ResumeTransformFeedback = nullptr;
+inline PFNGLDRAWTRANSFORMFEEDBACKPROC glTraceReal_DrawTransformFeedback = nullptr;
+inline PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC glTraceReal_DrawTransformFeedbackStream = nullptr;
+inline PFNGLBEGINQUERYINDEXEDPROC glTraceReal_BeginQueryIndexed = nullptr;
+inline PFNGLENDQUERYINDEXEDPROC glTraceReal_EndQueryIndexed = nullptr;
+inline PFNGLGETQUERYINDEXEDIVPROC glTraceReal_GetQueryIndexediv = nullptr;
+
+inline void APIENTRY glTrace_CullFace(GLenum mode) {
+    GlTraceRecord traceRecord(GlFunction::CullFace);
+    traceRecord.value(mode);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_CullFace(mode);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_FrontFace(GLenum mode) {
+    GlTraceRecord traceRecord(GlFunction::FrontFace);
+    traceRecord.value(mode);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_FrontFace(mode);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Hint(GLenum target, GLenum mode) {
+    GlTraceRecord traceRecord(GlFunction::Hint);
+    traceRecord.value(target);
+    traceRecord.value(mode);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Hint(target, mode);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_LineWidth(GLfloat width) {
+    GlTraceRecord traceRecord(GlFunction::LineWidth);
+    traceRecord.value(width);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_LineWidth(width);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_PointSize(GLfloat size) {
+    GlTraceRecord traceRecord(GlFunction::PointSize);
+    traceRecord.value(size);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_PointSize(size);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_PolygonMode(GLenum face, GLenum mode) {
+    GlTraceRecord traceRecord(GlFunction::PolygonMode);
+    traceRecord.value(face);
+    traceRecord.value(mode);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_PolygonMode(face, mode);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Scissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+    GlTraceRecord traceRecord(GlFunction::Scissor);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    traceRecord.value(width);
+    traceRecord.value(height);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Scissor(x, y, width, height);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexParameterf(GLenum target, GLenum pname, GLfloat param) {
+    GlTraceRecord traceRecord(GlFunction::TexParameterf);
+    traceRecord.value(target);
+    traceRecord.value(pname);
+    traceRecord.value(param);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexParameterf(target, pname, param);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexParameterfv(GLenum target, GLenum pname, const GLfloat * params) {
+    GlTraceRecord traceRecord(GlFunction::TexParameterfv);
+    traceRecord.value(target);
+    traceRecord.value(pname);
+    traceRecord.bytes(params, params ? 4 * sizeof(GLfloat) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexParameterfv(target, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexParameteri(GLenum target, GLenum pname, GLint param) {
+    GlTraceRecord traceRecord(GlFunction::TexParameteri);
+    traceRecord.value(target);
+    traceRecord.value(pname);
+    traceRecord.value(param);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexParameteri(target, pname, param);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexParameteriv(GLenum target, GLenum pname, const GLint * params) {
+    GlTraceRecord traceRecord(GlFunction::TexParameteriv);
+    traceRecord.value(target);
+    traceRecord.value(pname);
+    traceRecord.bytes(params, params ? 4 * sizeof(GLint) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexParameteriv(target, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void * pixels) {
+    GlTraceRecord traceRecord(GlFunction::TexImage1D);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexImage1D(target, level, internalformat, width, border, format, type, pixels);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void * pixels) {
+    GlTraceRecord traceRecord(GlFunction::TexImage2D);
+    traceRecord.value(target);
+    traceRecord.value(level);
+    traceRecord.value(internalformat);
+    traceRecord.value(width);
+    traceRecord.value(height);
+    traceRecord.value(border);
+    traceRecord.value(format);
+    traceRecord.value(type);
+    traceRecord.bytes(pixels, pixels ? GlIntercept::textureBytes(width, height, format, type) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_DrawBuffer(GLenum buf) {
+    GlTraceRecord traceRecord(GlFunction::DrawBuffer);
+    traceRecord.value(buf);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_DrawBuffer(buf);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Clear(GLbitfield mask) {
+    GlTraceRecord traceRecord(GlFunction::Clear);
+    traceRecord.value(mask);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Clear(mask);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_ClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    GlTraceRecord traceRecord(GlFunction::ClearColor);
+    traceRecord.value(red);
+    traceRecord.value(green);
+    traceRecord.value(blue);
+    traceRecord.value(alpha);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_ClearColor(red, green, blue, alpha);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_ClearStencil(GLint s) {
+    GlTraceRecord traceRecord(GlFunction::ClearStencil);
+    traceRecord.value(s);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_ClearStencil(s);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_ClearDepth(GLdouble depth) {
+    GlTraceRecord traceRecord(GlFunction::ClearDepth);
+    traceRecord.value(depth);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_ClearDepth(depth);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_StencilMask(GLuint mask) {
+    GlTraceRecord traceRecord(GlFunction::StencilMask);
+    traceRecord.value(mask);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_StencilMask(mask);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_ColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+    GlTraceRecord traceRecord(GlFunction::ColorMask);
+    traceRecord.value(red);
+    traceRecord.value(green);
+    traceRecord.value(blue);
+    traceRecord.value(alpha);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_ColorMask(red, green, blue, alpha);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_DepthMask(GLboolean flag) {
+    GlTraceRecord traceRecord(GlFunction::DepthMask);
+    traceRecord.value(flag);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_DepthMask(flag);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Disable(GLenum cap) {
+    GlTraceRecord traceRecord(GlFunction::Disable);
+    traceRecord.value(cap);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Disable(cap);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Enable(GLenum cap) {
+    GlTraceRecord traceRecord(GlFunction::Enable);
+    traceRecord.value(cap);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Enable(cap);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Finish() {
+    GlTraceRecord traceRecord(GlFunction::Finish);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Finish();
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Flush() {
+    GlTraceRecord traceRecord(GlFunction::Flush);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Flush();
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_BlendFunc(GLenum sfactor, GLenum dfactor) {
+    GlTraceRecord traceRecord(GlFunction::BlendFunc);
+    traceRecord.value(sfactor);
+    traceRecord.value(dfactor);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_BlendFunc(sfactor, dfactor);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_LogicOp(GLenum opcode) {
+    GlTraceRecord traceRecord(GlFunction::LogicOp);
+    traceRecord.value(opcode);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_LogicOp(opcode);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_StencilFunc(GLenum func, GLint ref, GLuint mask) {
+    GlTraceRecord traceRecord(GlFunction::StencilFunc);
+    traceRecord.value(func);
+    traceRecord.value(ref);
+    traceRecord.value(mask);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_StencilFunc(func, ref, mask);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_StencilOp(GLenum fail, GLenum zfail, GLenum zpass) {
+    GlTraceRecord traceRecord(GlFunction::StencilOp);
+    traceRecord.value(fail);
+    traceRecord.value(zfail);
+    traceRecord.value(zpass);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_StencilOp(fail, zfail, zpass);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_DepthFunc(GLenum func) {
+    GlTraceRecord traceRecord(GlFunction::DepthFunc);
+    traceRecord.value(func);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_DepthFunc(func);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_PixelStoref(GLenum pname, GLfloat param) {
+    GlTraceRecord traceRecord(GlFunction::PixelStoref);
+    traceRecord.value(pname);
+    traceRecord.value(param);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_PixelStoref(pname, param);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_PixelStorei(GLenum pname, GLint param) {
+    GlTraceRecord traceRecord(GlFunction::PixelStorei);
+    traceRecord.value(pname);
+    traceRecord.value(param);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_PixelStorei(pname, param);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_ReadBuffer(GLenum src) {
+    GlTraceRecord traceRecord(GlFunction::ReadBuffer);
+    traceRecord.value(src);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_ReadBuffer(src);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_ReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void * pixels) {
+    GlTraceRecord traceRecord(GlFunction::ReadPixels);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_ReadPixels(x, y, width, height, format, type, pixels);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetBooleanv(GLenum pname, GLboolean * data) {
+    GlTraceRecord traceRecord(GlFunction::GetBooleanv);
+    traceRecord.value(pname);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetBooleanv(pname, data);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetDoublev(GLenum pname, GLdouble * data) {
+    GlTraceRecord traceRecord(GlFunction::GetDoublev);
+    traceRecord.value(pname);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetDoublev(pname, data);
+    traceRecord.finish(traceStart);
+}
+
+inline GLenum APIENTRY glTrace_GetError() {
+    GlTraceRecord traceRecord(GlFunction::GetError);
+    uint64_t traceStart = GlTraceRecord::now();
+    GLenum traceResult = glTraceReal_GetError();
+    traceRecord.finish(traceStart);
+    return traceResult;
+}
+
+inline void APIENTRY glTrace_GetFloatv(GLenum pname, GLfloat * data) {
+    GlTraceRecord traceRecord(GlFunction::GetFloatv);
+    traceRecord.value(pname);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetFloatv(pname, data);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetIntegerv(GLenum pname, GLint * data) {
+    GlTraceRecord traceRecord(GlFunction::GetIntegerv);
+    traceRecord.value(pname);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetIntegerv(pname, data);
+    traceRecord.finish(traceStart);
+}
+
+inline const GLubyte * APIENTRY glTrace_GetString(GLenum name) {
+    GlTraceRecord traceRecord(GlFunction::GetString);
+    traceRecord.value(name);
+    uint64_t traceStart = GlTraceRecord::now();
+    const GLubyte * traceResult = glTraceReal_GetString(name);
+    traceRecord.finish(traceStart);
+    return traceResult;
+}
+
+inline void APIENTRY glTrace_GetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void * pixels) {
+    GlTraceRecord traceRecord(GlFunction::GetTexImage);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetTexImage(target, level, format, type, pixels);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetTexParameterfv(GLenum target, GLenum pname, GLfloat * params) {
+    GlTraceRecord traceRecord(GlFunction::GetTexParameterfv);
+    traceRecord.value(target);
+    traceRecord.value(pname);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetTexParameterfv(target, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetTexParameteriv(GLenum target, GLenum pname, GLint * params) {
+    GlTraceRecord traceRecord(GlFunction::GetTexParameteriv);
+    traceRecord.value(target);
+    traceRecord.value(pname);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetTexParameteriv(target, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat * params) {
+    GlTraceRecord traceRecord(GlFunction::GetTexLevelParameterfv);
+    traceRecord.value(target);
+    traceRecord.value(level);
+    traceRecord.value(pname);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetTexLevelParameterfv(target, level, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint * params) {
+    GlTraceRecord traceRecord(GlFunction::GetTexLevelParameteriv);
+    traceRecord.value(target);
+    traceRecord.value(level);
+    traceRecord.value(pname);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetTexLevelParameteriv(target, level, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline GLboolean APIENTRY glTrace_IsEnabled(GLenum cap) {
+    GlTraceRecord traceRecord(GlFunction::IsEnabled);
+    traceRecord.value(cap);
+    uint64_t traceStart = GlTraceRecord::now();
+    GLboolean traceResult = glTraceReal_IsEnabled(cap);
+    traceRecord.finish(traceStart);
+    return traceResult;
+}
+
+inline void APIENTRY glTrace_DepthRange(GLdouble n, GLdouble f) {
+    GlTraceRecord traceRecord(GlFunction::DepthRange);
+    traceRecord.value(n);
+    traceRecord.value(f);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_DepthRange(n, f);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Viewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+    GlTraceRecord traceRecord(GlFunction::Viewport);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    traceRecord.value(width);
+    traceRecord.value(height);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Viewport(x, y, width, height);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_NewList(GLuint list, GLenum mode) {
+    GlTraceRecord traceRecord(GlFunction::NewList);
+    traceRecord.value(list);
+    traceRecord.value(mode);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_NewList(list, mode);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_EndList() {
+    GlTraceRecord traceRecord(GlFunction::EndList);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_EndList();
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_CallList(GLuint list) {
+    GlTraceRecord traceRecord(GlFunction::CallList);
+    traceRecord.value(list);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_CallList(list);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_CallLists(GLsizei n, GLenum type, const void * lists) {
+    GlTraceRecord traceRecord(GlFunction::CallLists);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_CallLists(n, type, lists);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_DeleteLists(GLuint list, GLsizei range) {
+    GlTraceRecord traceRecord(GlFunction::DeleteLists);
+    traceRecord.value(list);
+    traceRecord.value(range);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_DeleteLists(list, range);
+    traceRecord.finish(traceStart);
+}
+
+inline GLuint APIENTRY glTrace_GenLists(GLsizei range) {
+    GlTraceRecord traceRecord(GlFunction::GenLists);
+    traceRecord.value(range);
+    uint64_t traceStart = GlTraceRecord::now();
+    GLuint traceResult = glTraceReal_GenLists(range);
+    traceRecord.finish(traceStart);
+    return traceResult;
+}
+
+inline void APIENTRY glTrace_ListBase(GLuint base) {
+    GlTraceRecord traceRecord(GlFunction::ListBase);
+    traceRecord.value(base);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_ListBase(base);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Begin(GLenum mode) {
+    GlTraceRecord traceRecord(GlFunction::Begin);
+    traceRecord.value(mode);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Begin(mode);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Bitmap(GLsizei width, GLsizei height, GLfloat xorig, GLfloat yorig, GLfloat xmove, GLfloat ymove, const GLubyte * bitmap) {
+    GlTraceRecord traceRecord(GlFunction::Bitmap);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Bitmap(width, height, xorig, yorig, xmove, ymove, bitmap);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Color3b(GLbyte red, GLbyte green, GLbyte blue) {
+    GlTraceRecord traceRecord(GlFunction::Color3b);
+    traceRecord.value(red);
+    traceRecord.value(green);
+    traceRecord.value(blue);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Color3b(red, green, blue);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Color3bv(const GLbyte * v) {
+    GlTraceRecord traceRecord(GlFunction::Color3bv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Color3bv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Color3d(GLdouble red, GLdouble green, GLdouble blue) {
+    GlTraceRecord traceRecord(GlFunction::Color3d);
+    traceRecord.value(red);
+    traceRecord.value(green);
+    traceRecord.value(blue);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Color3d(red, green, blue);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Color3dv(const GLdouble * v) {
+    GlTraceRecord traceRecord(GlFunction::Color3dv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Color3dv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Color3f(GLfloat red, GLfloat green, GLfloat blue) {
+    GlTraceRecord traceRecord(GlFunction::Color3f);
+    traceRecord.value(red);
+    traceRecord.value(green);
+    traceRecord.value(blue);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Color3f(red, green, blue);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Color3fv(const GLfloat * v) {
+    GlTraceRecord traceRecord(GlFunction::Color3fv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Color3fv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Color3i(GLint red, GLint green, GLint blue) {
+    GlTraceRecord traceRecord(GlFunction::Color3i);
+    traceRecord.value(red);
+    traceRecord.value(green);
+    traceRecord.value(blue);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Color3i(red, green, blue);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Color3iv(const GLint * v) {
+    GlTraceRecord traceRecord(GlFunction::Color3iv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Color3iv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Color3s(GLshort red, GLshort green, GLshort blue) {
+    GlTraceRecord traceRecord(GlFunction::Color3s);
+    traceRecord.value(red);
+    traceRecord.value(green);
+    traceRecord.value(blue);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Color3s(red, green, blue);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Color3sv(const GLshort * v) {
+    GlTraceRecord traceRecord(GlFunction::Color3sv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Color3sv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Color3ub(GLubyte red, GLubyte green, GLubyte blue) {
+    GlTraceRecord traceRecord(GlFunction::Color3ub);
+    traceRecord.value(red);
+    traceRecord.value(green);
+    traceRecord.value(blue);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Color3ub(red, green, blue);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Color3ubv(const GLubyte * v) {
+    GlTraceRecord traceRecord(GlFunction::Color3ubv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Color3ubv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Color3ui(GLuint red, GLuint green, GLuint blue) {
+    GlTraceRecord traceRecord(GlFunction::Color3ui);
+    traceRecord.value(red);
+    traceRecord.value(green);
+    traceRecord.value(blue);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Color3ui(red, green, blue);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Color3uiv(const GLuint * v) {
+    GlTraceRecord traceRecord(GlFunction::Color3uiv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Color3uiv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Color3us(GLushort red, GLushort green, GLushort blue) {
+    GlTraceRecord traceRecord(GlFunction::Color3us);
+    traceRecord.value(red);
+    traceRecord.value(green);
+    traceRecord.value(blue);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Color3us(red, green, blue);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Color3usv(const GLushort * v) {
+    GlTraceRecord traceRecord(GlFunction::Color3usv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Color3usv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Color4b(GLbyte red, GLbyte green, GLbyte blue, GLbyte alpha) {
+    GlTraceRecord traceRecord(GlFunction::Color4b);
+    traceRecord.value(red);
+    traceRecord.value(green);
+    traceRecord.value(blue);
+    traceRecord.value(alpha);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Color4b(red, green, blue, alpha);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Color4bv(const GLbyte * v) {
+    GlTraceRecord traceRecord(GlFunction::Color4bv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Color4bv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Color4d(GLdouble red, GLdouble green, GLdouble blue, GLdouble alpha) {
+    GlTraceRecord traceRecord(GlFunction::Color4d);
+    traceRecord.value(red);
+    traceRecord.value(green);
+    traceRecord.value(blue);
+    traceRecord.value(alpha);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Color4d(red, green, blue, alpha);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Color4dv(const GLdouble * v) {
+    GlTraceRecord traceRecord(GlFunction::Color4dv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Color4dv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Color4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    GlTraceRecord traceRecord(GlFunction::Color4f);
+    traceRecord.value(red);
+    traceRecord.value(green);
+    traceRecord.value(blue);
+    traceRecord.value(alpha);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Color4f(red, green, blue, alpha);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Color4fv(const GLfloat * v) {
+    GlTraceRecord traceRecord(GlFunction::Color4fv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Color4fv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Color4i(GLint red, GLint green, GLint blue, GLint alpha) {
+    GlTraceRecord traceRecord(GlFunction::Color4i);
+    traceRecord.value(red);
+    traceRecord.value(green);
+    traceRecord.value(blue);
+    traceRecord.value(alpha);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Color4i(red, green, blue, alpha);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Color4iv(const GLint * v) {
+    GlTraceRecord traceRecord(GlFunction::Color4iv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Color4iv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Color4s(GLshort red, GLshort green, GLshort blue, GLshort alpha) {
+    GlTraceRecord traceRecord(GlFunction::Color4s);
+    traceRecord.value(red);
+    traceRecord.value(green);
+    traceRecord.value(blue);
+    traceRecord.value(alpha);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Color4s(red, green, blue, alpha);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Color4sv(const GLshort * v) {
+    GlTraceRecord traceRecord(GlFunction::Color4sv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Color4sv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Color4ub(GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha) {
+    GlTraceRecord traceRecord(GlFunction::Color4ub);
+    traceRecord.value(red);
+    traceRecord.value(green);
+    traceRecord.value(blue);
+    traceRecord.value(alpha);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Color4ub(red, green, blue, alpha);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Color4ubv(const GLubyte * v) {
+    GlTraceRecord traceRecord(GlFunction::Color4ubv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Color4ubv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Color4ui(GLuint red, GLuint green, GLuint blue, GLuint alpha) {
+    GlTraceRecord traceRecord(GlFunction::Color4ui);
+    traceRecord.value(red);
+    traceRecord.value(green);
+    traceRecord.value(blue);
+    traceRecord.value(alpha);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Color4ui(red, green, blue, alpha);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Color4uiv(const GLuint * v) {
+    GlTraceRecord traceRecord(GlFunction::Color4uiv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Color4uiv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Color4us(GLushort red, GLushort green, GLushort blue, GLushort alpha) {
+    GlTraceRecord traceRecord(GlFunction::Color4us);
+    traceRecord.value(red);
+    traceRecord.value(green);
+    traceRecord.value(blue);
+    traceRecord.value(alpha);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Color4us(red, green, blue, alpha);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Color4usv(const GLushort * v) {
+    GlTraceRecord traceRecord(GlFunction::Color4usv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Color4usv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_EdgeFlag(GLboolean flag) {
+    GlTraceRecord traceRecord(GlFunction::EdgeFlag);
+    traceRecord.value(flag);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_EdgeFlag(flag);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_EdgeFlagv(const GLboolean * flag) {
+    GlTraceRecord traceRecord(GlFunction::EdgeFlagv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_EdgeFlagv(flag);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_End() {
+    GlTraceRecord traceRecord(GlFunction::End);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_End();
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Indexd(GLdouble c) {
+    GlTraceRecord traceRecord(GlFunction::Indexd);
+    traceRecord.value(c);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Indexd(c);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Indexdv(const GLdouble * c) {
+    GlTraceRecord traceRecord(GlFunction::Indexdv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Indexdv(c);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Indexf(GLfloat c) {
+    GlTraceRecord traceRecord(GlFunction::Indexf);
+    traceRecord.value(c);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Indexf(c);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Indexfv(const GLfloat * c) {
+    GlTraceRecord traceRecord(GlFunction::Indexfv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Indexfv(c);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Indexi(GLint c) {
+    GlTraceRecord traceRecord(GlFunction::Indexi);
+    traceRecord.value(c);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Indexi(c);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Indexiv(const GLint * c) {
+    GlTraceRecord traceRecord(GlFunction::Indexiv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Indexiv(c);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Indexs(GLshort c) {
+    GlTraceRecord traceRecord(GlFunction::Indexs);
+    traceRecord.value(c);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Indexs(c);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Indexsv(const GLshort * c) {
+    GlTraceRecord traceRecord(GlFunction::Indexsv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Indexsv(c);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Normal3b(GLbyte nx, GLbyte ny, GLbyte nz) {
+    GlTraceRecord traceRecord(GlFunction::Normal3b);
+    traceRecord.value(nx);
+    traceRecord.value(ny);
+    traceRecord.value(nz);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Normal3b(nx, ny, nz);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Normal3bv(const GLbyte * v) {
+    GlTraceRecord traceRecord(GlFunction::Normal3bv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Normal3bv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Normal3d(GLdouble nx, GLdouble ny, GLdouble nz) {
+    GlTraceRecord traceRecord(GlFunction::Normal3d);
+    traceRecord.value(nx);
+    traceRecord.value(ny);
+    traceRecord.value(nz);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Normal3d(nx, ny, nz);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Normal3dv(const GLdouble * v) {
+    GlTraceRecord traceRecord(GlFunction::Normal3dv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Normal3dv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Normal3f(GLfloat nx, GLfloat ny, GLfloat nz) {
+    GlTraceRecord traceRecord(GlFunction::Normal3f);
+    traceRecord.value(nx);
+    traceRecord.value(ny);
+    traceRecord.value(nz);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Normal3f(nx, ny, nz);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Normal3fv(const GLfloat * v) {
+    GlTraceRecord traceRecord(GlFunction::Normal3fv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Normal3fv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Normal3i(GLint nx, GLint ny, GLint nz) {
+    GlTraceRecord traceRecord(GlFunction::Normal3i);
+    traceRecord.value(nx);
+    traceRecord.value(ny);
+    traceRecord.value(nz);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Normal3i(nx, ny, nz);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Normal3iv(const GLint * v) {
+    GlTraceRecord traceRecord(GlFunction::Normal3iv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Normal3iv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Normal3s(GLshort nx, GLshort ny, GLshort nz) {
+    GlTraceRecord traceRecord(GlFunction::Normal3s);
+    traceRecord.value(nx);
+    traceRecord.value(ny);
+    traceRecord.value(nz);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Normal3s(nx, ny, nz);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Normal3sv(const GLshort * v) {
+    GlTraceRecord traceRecord(GlFunction::Normal3sv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Normal3sv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_RasterPos2d(GLdouble x, GLdouble y) {
+    GlTraceRecord traceRecord(GlFunction::RasterPos2d);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_RasterPos2d(x, y);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_RasterPos2dv(const GLdouble * v) {
+    GlTraceRecord traceRecord(GlFunction::RasterPos2dv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_RasterPos2dv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_RasterPos2f(GLfloat x, GLfloat y) {
+    GlTraceRecord traceRecord(GlFunction::RasterPos2f);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_RasterPos2f(x, y);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_RasterPos2fv(const GLfloat * v) {
+    GlTraceRecord traceRecord(GlFunction::RasterPos2fv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_RasterPos2fv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_RasterPos2i(GLint x, GLint y) {
+    GlTraceRecord traceRecord(GlFunction::RasterPos2i);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_RasterPos2i(x, y);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_RasterPos2iv(const GLint * v) {
+    GlTraceRecord traceRecord(GlFunction::RasterPos2iv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_RasterPos2iv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_RasterPos2s(GLshort x, GLshort y) {
+    GlTraceRecord traceRecord(GlFunction::RasterPos2s);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_RasterPos2s(x, y);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_RasterPos2sv(const GLshort * v) {
+    GlTraceRecord traceRecord(GlFunction::RasterPos2sv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_RasterPos2sv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_RasterPos3d(GLdouble x, GLdouble y, GLdouble z) {
+    GlTraceRecord traceRecord(GlFunction::RasterPos3d);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    traceRecord.value(z);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_RasterPos3d(x, y, z);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_RasterPos3dv(const GLdouble * v) {
+    GlTraceRecord traceRecord(GlFunction::RasterPos3dv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_RasterPos3dv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_RasterPos3f(GLfloat x, GLfloat y, GLfloat z) {
+    GlTraceRecord traceRecord(GlFunction::RasterPos3f);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    traceRecord.value(z);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_RasterPos3f(x, y, z);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_RasterPos3fv(const GLfloat * v) {
+    GlTraceRecord traceRecord(GlFunction::RasterPos3fv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_RasterPos3fv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_RasterPos3i(GLint x, GLint y, GLint z) {
+    GlTraceRecord traceRecord(GlFunction::RasterPos3i);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    traceRecord.value(z);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_RasterPos3i(x, y, z);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_RasterPos3iv(const GLint * v) {
+    GlTraceRecord traceRecord(GlFunction::RasterPos3iv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_RasterPos3iv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_RasterPos3s(GLshort x, GLshort y, GLshort z) {
+    GlTraceRecord traceRecord(GlFunction::RasterPos3s);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    traceRecord.value(z);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_RasterPos3s(x, y, z);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_RasterPos3sv(const GLshort * v) {
+    GlTraceRecord traceRecord(GlFunction::RasterPos3sv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_RasterPos3sv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_RasterPos4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    GlTraceRecord traceRecord(GlFunction::RasterPos4d);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    traceRecord.value(z);
+    traceRecord.value(w);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_RasterPos4d(x, y, z, w);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_RasterPos4dv(const GLdouble * v) {
+    GlTraceRecord traceRecord(GlFunction::RasterPos4dv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_RasterPos4dv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_RasterPos4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+    GlTraceRecord traceRecord(GlFunction::RasterPos4f);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    traceRecord.value(z);
+    traceRecord.value(w);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_RasterPos4f(x, y, z, w);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_RasterPos4fv(const GLfloat * v) {
+    GlTraceRecord traceRecord(GlFunction::RasterPos4fv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_RasterPos4fv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_RasterPos4i(GLint x, GLint y, GLint z, GLint w) {
+    GlTraceRecord traceRecord(GlFunction::RasterPos4i);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    traceRecord.value(z);
+    traceRecord.value(w);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_RasterPos4i(x, y, z, w);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_RasterPos4iv(const GLint * v) {
+    GlTraceRecord traceRecord(GlFunction::RasterPos4iv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_RasterPos4iv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_RasterPos4s(GLshort x, GLshort y, GLshort z, GLshort w) {
+    GlTraceRecord traceRecord(GlFunction::RasterPos4s);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    traceRecord.value(z);
+    traceRecord.value(w);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_RasterPos4s(x, y, z, w);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_RasterPos4sv(const GLshort * v) {
+    GlTraceRecord traceRecord(GlFunction::RasterPos4sv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_RasterPos4sv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Rectd(GLdouble x1, GLdouble y1, GLdouble x2, GLdouble y2) {
+    GlTraceRecord traceRecord(GlFunction::Rectd);
+    traceRecord.value(x1);
+    traceRecord.value(y1);
+    traceRecord.value(x2);
+    traceRecord.value(y2);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Rectd(x1, y1, x2, y2);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Rectdv(const GLdouble * v1, const GLdouble * v2) {
+    GlTraceRecord traceRecord(GlFunction::Rectdv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Rectdv(v1, v2);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Rectf(GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2) {
+    GlTraceRecord traceRecord(GlFunction::Rectf);
+    traceRecord.value(x1);
+    traceRecord.value(y1);
+    traceRecord.value(x2);
+    traceRecord.value(y2);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Rectf(x1, y1, x2, y2);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Rectfv(const GLfloat * v1, const GLfloat * v2) {
+    GlTraceRecord traceRecord(GlFunction::Rectfv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Rectfv(v1, v2);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Recti(GLint x1, GLint y1, GLint x2, GLint y2) {
+    GlTraceRecord traceRecord(GlFunction::Recti);
+    traceRecord.value(x1);
+    traceRecord.value(y1);
+    traceRecord.value(x2);
+    traceRecord.value(y2);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Recti(x1, y1, x2, y2);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Rectiv(const GLint * v1, const GLint * v2) {
+    GlTraceRecord traceRecord(GlFunction::Rectiv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Rectiv(v1, v2);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Rects(GLshort x1, GLshort y1, GLshort x2, GLshort y2) {
+    GlTraceRecord traceRecord(GlFunction::Rects);
+    traceRecord.value(x1);
+    traceRecord.value(y1);
+    traceRecord.value(x2);
+    traceRecord.value(y2);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Rects(x1, y1, x2, y2);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Rectsv(const GLshort * v1, const GLshort * v2) {
+    GlTraceRecord traceRecord(GlFunction::Rectsv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Rectsv(v1, v2);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexCoord1d(GLdouble s) {
+    GlTraceRecord traceRecord(GlFunction::TexCoord1d);
+    traceRecord.value(s);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexCoord1d(s);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexCoord1dv(const GLdouble * v) {
+    GlTraceRecord traceRecord(GlFunction::TexCoord1dv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexCoord1dv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexCoord1f(GLfloat s) {
+    GlTraceRecord traceRecord(GlFunction::TexCoord1f);
+    traceRecord.value(s);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexCoord1f(s);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexCoord1fv(const GLfloat * v) {
+    GlTraceRecord traceRecord(GlFunction::TexCoord1fv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexCoord1fv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexCoord1i(GLint s) {
+    GlTraceRecord traceRecord(GlFunction::TexCoord1i);
+    traceRecord.value(s);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexCoord1i(s);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexCoord1iv(const GLint * v) {
+    GlTraceRecord traceRecord(GlFunction::TexCoord1iv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexCoord1iv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexCoord1s(GLshort s) {
+    GlTraceRecord traceRecord(GlFunction::TexCoord1s);
+    traceRecord.value(s);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexCoord1s(s);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexCoord1sv(const GLshort * v) {
+    GlTraceRecord traceRecord(GlFunction::TexCoord1sv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexCoord1sv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexCoord2d(GLdouble s, GLdouble t) {
+    GlTraceRecord traceRecord(GlFunction::TexCoord2d);
+    traceRecord.value(s);
+    traceRecord.value(t);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexCoord2d(s, t);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexCoord2dv(const GLdouble * v) {
+    GlTraceRecord traceRecord(GlFunction::TexCoord2dv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexCoord2dv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexCoord2f(GLfloat s, GLfloat t) {
+    GlTraceRecord traceRecord(GlFunction::TexCoord2f);
+    traceRecord.value(s);
+    traceRecord.value(t);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexCoord2f(s, t);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexCoord2fv(const GLfloat * v) {
+    GlTraceRecord traceRecord(GlFunction::TexCoord2fv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexCoord2fv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexCoord2i(GLint s, GLint t) {
+    GlTraceRecord traceRecord(GlFunction::TexCoord2i);
+    traceRecord.value(s);
+    traceRecord.value(t);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexCoord2i(s, t);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexCoord2iv(const GLint * v) {
+    GlTraceRecord traceRecord(GlFunction::TexCoord2iv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexCoord2iv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexCoord2s(GLshort s, GLshort t) {
+    GlTraceRecord traceRecord(GlFunction::TexCoord2s);
+    traceRecord.value(s);
+    traceRecord.value(t);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexCoord2s(s, t);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexCoord2sv(const GLshort * v) {
+    GlTraceRecord traceRecord(GlFunction::TexCoord2sv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexCoord2sv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexCoord3d(GLdouble s, GLdouble t, GLdouble r) {
+    GlTraceRecord traceRecord(GlFunction::TexCoord3d);
+    traceRecord.value(s);
+    traceRecord.value(t);
+    traceRecord.value(r);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexCoord3d(s, t, r);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexCoord3dv(const GLdouble * v) {
+    GlTraceRecord traceRecord(GlFunction::TexCoord3dv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexCoord3dv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexCoord3f(GLfloat s, GLfloat t, GLfloat r) {
+    GlTraceRecord traceRecord(GlFunction::TexCoord3f);
+    traceRecord.value(s);
+    traceRecord.value(t);
+    traceRecord.value(r);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexCoord3f(s, t, r);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexCoord3fv(const GLfloat * v) {
+    GlTraceRecord traceRecord(GlFunction::TexCoord3fv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexCoord3fv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexCoord3i(GLint s, GLint t, GLint r) {
+    GlTraceRecord traceRecord(GlFunction::TexCoord3i);
+    traceRecord.value(s);
+    traceRecord.value(t);
+    traceRecord.value(r);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexCoord3i(s, t, r);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexCoord3iv(const GLint * v) {
+    GlTraceRecord traceRecord(GlFunction::TexCoord3iv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexCoord3iv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexCoord3s(GLshort s, GLshort t, GLshort r) {
+    GlTraceRecord traceRecord(GlFunction::TexCoord3s);
+    traceRecord.value(s);
+    traceRecord.value(t);
+    traceRecord.value(r);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexCoord3s(s, t, r);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexCoord3sv(const GLshort * v) {
+    GlTraceRecord traceRecord(GlFunction::TexCoord3sv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexCoord3sv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexCoord4d(GLdouble s, GLdouble t, GLdouble r, GLdouble q) {
+    GlTraceRecord traceRecord(GlFunction::TexCoord4d);
+    traceRecord.value(s);
+    traceRecord.value(t);
+    traceRecord.value(r);
+    traceRecord.value(q);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexCoord4d(s, t, r, q);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexCoord4dv(const GLdouble * v) {
+    GlTraceRecord traceRecord(GlFunction::TexCoord4dv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexCoord4dv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexCoord4f(GLfloat s, GLfloat t, GLfloat r, GLfloat q) {
+    GlTraceRecord traceRecord(GlFunction::TexCoord4f);
+    traceRecord.value(s);
+    traceRecord.value(t);
+    traceRecord.value(r);
+    traceRecord.value(q);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexCoord4f(s, t, r, q);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexCoord4fv(const GLfloat * v) {
+    GlTraceRecord traceRecord(GlFunction::TexCoord4fv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexCoord4fv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexCoord4i(GLint s, GLint t, GLint r, GLint q) {
+    GlTraceRecord traceRecord(GlFunction::TexCoord4i);
+    traceRecord.value(s);
+    traceRecord.value(t);
+    traceRecord.value(r);
+    traceRecord.value(q);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexCoord4i(s, t, r, q);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexCoord4iv(const GLint * v) {
+    GlTraceRecord traceRecord(GlFunction::TexCoord4iv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexCoord4iv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexCoord4s(GLshort s, GLshort t, GLshort r, GLshort q) {
+    GlTraceRecord traceRecord(GlFunction::TexCoord4s);
+    traceRecord.value(s);
+    traceRecord.value(t);
+    traceRecord.value(r);
+    traceRecord.value(q);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexCoord4s(s, t, r, q);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexCoord4sv(const GLshort * v) {
+    GlTraceRecord traceRecord(GlFunction::TexCoord4sv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexCoord4sv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Vertex2d(GLdouble x, GLdouble y) {
+    GlTraceRecord traceRecord(GlFunction::Vertex2d);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Vertex2d(x, y);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Vertex2dv(const GLdouble * v) {
+    GlTraceRecord traceRecord(GlFunction::Vertex2dv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Vertex2dv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Vertex2f(GLfloat x, GLfloat y) {
+    GlTraceRecord traceRecord(GlFunction::Vertex2f);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Vertex2f(x, y);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Vertex2fv(const GLfloat * v) {
+    GlTraceRecord traceRecord(GlFunction::Vertex2fv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Vertex2fv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Vertex2i(GLint x, GLint y) {
+    GlTraceRecord traceRecord(GlFunction::Vertex2i);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Vertex2i(x, y);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Vertex2iv(const GLint * v) {
+    GlTraceRecord traceRecord(GlFunction::Vertex2iv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Vertex2iv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Vertex2s(GLshort x, GLshort y) {
+    GlTraceRecord traceRecord(GlFunction::Vertex2s);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Vertex2s(x, y);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Vertex2sv(const GLshort * v) {
+    GlTraceRecord traceRecord(GlFunction::Vertex2sv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Vertex2sv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Vertex3d(GLdouble x, GLdouble y, GLdouble z) {
+    GlTraceRecord traceRecord(GlFunction::Vertex3d);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    traceRecord.value(z);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Vertex3d(x, y, z);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Vertex3dv(const GLdouble * v) {
+    GlTraceRecord traceRecord(GlFunction::Vertex3dv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Vertex3dv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Vertex3f(GLfloat x, GLfloat y, GLfloat z) {
+    GlTraceRecord traceRecord(GlFunction::Vertex3f);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    traceRecord.value(z);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Vertex3f(x, y, z);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Vertex3fv(const GLfloat * v) {
+    GlTraceRecord traceRecord(GlFunction::Vertex3fv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Vertex3fv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Vertex3i(GLint x, GLint y, GLint z) {
+    GlTraceRecord traceRecord(GlFunction::Vertex3i);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    traceRecord.value(z);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Vertex3i(x, y, z);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Vertex3iv(const GLint * v) {
+    GlTraceRecord traceRecord(GlFunction::Vertex3iv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Vertex3iv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Vertex3s(GLshort x, GLshort y, GLshort z) {
+    GlTraceRecord traceRecord(GlFunction::Vertex3s);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    traceRecord.value(z);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Vertex3s(x, y, z);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Vertex3sv(const GLshort * v) {
+    GlTraceRecord traceRecord(GlFunction::Vertex3sv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Vertex3sv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Vertex4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    GlTraceRecord traceRecord(GlFunction::Vertex4d);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    traceRecord.value(z);
+    traceRecord.value(w);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Vertex4d(x, y, z, w);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Vertex4dv(const GLdouble * v) {
+    GlTraceRecord traceRecord(GlFunction::Vertex4dv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Vertex4dv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Vertex4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+    GlTraceRecord traceRecord(GlFunction::Vertex4f);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    traceRecord.value(z);
+    traceRecord.value(w);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Vertex4f(x, y, z, w);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Vertex4fv(const GLfloat * v) {
+    GlTraceRecord traceRecord(GlFunction::Vertex4fv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Vertex4fv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Vertex4i(GLint x, GLint y, GLint z, GLint w) {
+    GlTraceRecord traceRecord(GlFunction::Vertex4i);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    traceRecord.value(z);
+    traceRecord.value(w);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Vertex4i(x, y, z, w);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Vertex4iv(const GLint * v) {
+    GlTraceRecord traceRecord(GlFunction::Vertex4iv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Vertex4iv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Vertex4s(GLshort x, GLshort y, GLshort z, GLshort w) {
+    GlTraceRecord traceRecord(GlFunction::Vertex4s);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    traceRecord.value(z);
+    traceRecord.value(w);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Vertex4s(x, y, z, w);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Vertex4sv(const GLshort * v) {
+    GlTraceRecord traceRecord(GlFunction::Vertex4sv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Vertex4sv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_ClipPlane(GLenum plane, const GLdouble * equation) {
+    GlTraceRecord traceRecord(GlFunction::ClipPlane);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_ClipPlane(plane, equation);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_ColorMaterial(GLenum face, GLenum mode) {
+    GlTraceRecord traceRecord(GlFunction::ColorMaterial);
+    traceRecord.value(face);
+    traceRecord.value(mode);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_ColorMaterial(face, mode);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Fogf(GLenum pname, GLfloat param) {
+    GlTraceRecord traceRecord(GlFunction::Fogf);
+    traceRecord.value(pname);
+    traceRecord.value(param);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Fogf(pname, param);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Fogfv(GLenum pname, const GLfloat * params) {
+    GlTraceRecord traceRecord(GlFunction::Fogfv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Fogfv(pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Fogi(GLenum pname, GLint param) {
+    GlTraceRecord traceRecord(GlFunction::Fogi);
+    traceRecord.value(pname);
+    traceRecord.value(param);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Fogi(pname, param);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Fogiv(GLenum pname, const GLint * params) {
+    GlTraceRecord traceRecord(GlFunction::Fogiv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Fogiv(pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Lightf(GLenum light, GLenum pname, GLfloat param) {
+    GlTraceRecord traceRecord(GlFunction::Lightf);
+    traceRecord.value(light);
+    traceRecord.value(pname);
+    traceRecord.value(param);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Lightf(light, pname, param);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Lightfv(GLenum light, GLenum pname, const GLfloat * params) {
+    GlTraceRecord traceRecord(GlFunction::Lightfv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Lightfv(light, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Lighti(GLenum light, GLenum pname, GLint param) {
+    GlTraceRecord traceRecord(GlFunction::Lighti);
+    traceRecord.value(light);
+    traceRecord.value(pname);
+    traceRecord.value(param);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Lighti(light, pname, param);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Lightiv(GLenum light, GLenum pname, const GLint * params) {
+    GlTraceRecord traceRecord(GlFunction::Lightiv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Lightiv(light, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_LightModelf(GLenum pname, GLfloat param) {
+    GlTraceRecord traceRecord(GlFunction::LightModelf);
+    traceRecord.value(pname);
+    traceRecord.value(param);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_LightModelf(pname, param);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_LightModelfv(GLenum pname, const GLfloat * params) {
+    GlTraceRecord traceRecord(GlFunction::LightModelfv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_LightModelfv(pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_LightModeli(GLenum pname, GLint param) {
+    GlTraceRecord traceRecord(GlFunction::LightModeli);
+    traceRecord.value(pname);
+    traceRecord.value(param);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_LightModeli(pname, param);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_LightModeliv(GLenum pname, const GLint * params) {
+    GlTraceRecord traceRecord(GlFunction::LightModeliv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_LightModeliv(pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_LineStipple(GLint factor, GLushort pattern) {
+    GlTraceRecord traceRecord(GlFunction::LineStipple);
+    traceRecord.value(factor);
+    traceRecord.value(pattern);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_LineStipple(factor, pattern);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Materialf(GLenum face, GLenum pname, GLfloat param) {
+    GlTraceRecord traceRecord(GlFunction::Materialf);
+    traceRecord.value(face);
+    traceRecord.value(pname);
+    traceRecord.value(param);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Materialf(face, pname, param);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Materialfv(GLenum face, GLenum pname, const GLfloat * params) {
+    GlTraceRecord traceRecord(GlFunction::Materialfv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Materialfv(face, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Materiali(GLenum face, GLenum pname, GLint param) {
+    GlTraceRecord traceRecord(GlFunction::Materiali);
+    traceRecord.value(face);
+    traceRecord.value(pname);
+    traceRecord.value(param);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Materiali(face, pname, param);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Materialiv(GLenum face, GLenum pname, const GLint * params) {
+    GlTraceRecord traceRecord(GlFunction::Materialiv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Materialiv(face, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_PolygonStipple(const GLubyte * mask) {
+    GlTraceRecord traceRecord(GlFunction::PolygonStipple);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_PolygonStipple(mask);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_ShadeModel(GLenum mode) {
+    GlTraceRecord traceRecord(GlFunction::ShadeModel);
+    traceRecord.value(mode);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_ShadeModel(mode);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexEnvf(GLenum target, GLenum pname, GLfloat param) {
+    GlTraceRecord traceRecord(GlFunction::TexEnvf);
+    traceRecord.value(target);
+    traceRecord.value(pname);
+    traceRecord.value(param);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexEnvf(target, pname, param);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexEnvfv(GLenum target, GLenum pname, const GLfloat * params) {
+    GlTraceRecord traceRecord(GlFunction::TexEnvfv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexEnvfv(target, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexEnvi(GLenum target, GLenum pname, GLint param) {
+    GlTraceRecord traceRecord(GlFunction::TexEnvi);
+    traceRecord.value(target);
+    traceRecord.value(pname);
+    traceRecord.value(param);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexEnvi(target, pname, param);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexEnviv(GLenum target, GLenum pname, const GLint * params) {
+    GlTraceRecord traceRecord(GlFunction::TexEnviv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexEnviv(target, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexGend(GLenum coord, GLenum pname, GLdouble param) {
+    GlTraceRecord traceRecord(GlFunction::TexGend);
+    traceRecord.value(coord);
+    traceRecord.value(pname);
+    traceRecord.value(param);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexGend(coord, pname, param);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexGendv(GLenum coord, GLenum pname, const GLdouble * params) {
+    GlTraceRecord traceRecord(GlFunction::TexGendv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexGendv(coord, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexGenf(GLenum coord, GLenum pname, GLfloat param) {
+    GlTraceRecord traceRecord(GlFunction::TexGenf);
+    traceRecord.value(coord);
+    traceRecord.value(pname);
+    traceRecord.value(param);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexGenf(coord, pname, param);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexGenfv(GLenum coord, GLenum pname, const GLfloat * params) {
+    GlTraceRecord traceRecord(GlFunction::TexGenfv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexGenfv(coord, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexGeni(GLenum coord, GLenum pname, GLint param) {
+    GlTraceRecord traceRecord(GlFunction::TexGeni);
+    traceRecord.value(coord);
+    traceRecord.value(pname);
+    traceRecord.value(param);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexGeni(coord, pname, param);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexGeniv(GLenum coord, GLenum pname, const GLint * params) {
+    GlTraceRecord traceRecord(GlFunction::TexGeniv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexGeniv(coord, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_FeedbackBuffer(GLsizei size, GLenum type, GLfloat * buffer) {
+    GlTraceRecord traceRecord(GlFunction::FeedbackBuffer);
+    traceRecord.value(size);
+    traceRecord.value(type);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_FeedbackBuffer(size, type, buffer);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_SelectBuffer(GLsizei size, GLuint * buffer) {
+    GlTraceRecord traceRecord(GlFunction::SelectBuffer);
+    traceRecord.value(size);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_SelectBuffer(size, buffer);
+    traceRecord.finish(traceStart);
+}
+
+inline GLint APIENTRY glTrace_RenderMode(GLenum mode) {
+    GlTraceRecord traceRecord(GlFunction::RenderMode);
+    traceRecord.value(mode);
+    uint64_t traceStart = GlTraceRecord::now();
+    GLint traceResult = glTraceReal_RenderMode(mode);
+    traceRecord.finish(traceStart);
+    return traceResult;
+}
+
+inline void APIENTRY glTrace_InitNames() {
+    GlTraceRecord traceRecord(GlFunction::InitNames);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_InitNames();
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_LoadName(GLuint name) {
+    GlTraceRecord traceRecord(GlFunction::LoadName);
+    traceRecord.value(name);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_LoadName(name);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_PassThrough(GLfloat token) {
+    GlTraceRecord traceRecord(GlFunction::PassThrough);
+    traceRecord.value(token);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_PassThrough(token);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_PopName() {
+    GlTraceRecord traceRecord(GlFunction::PopName);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_PopName();
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_PushName(GLuint name) {
+    GlTraceRecord traceRecord(GlFunction::PushName);
+    traceRecord.value(name);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_PushName(name);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_ClearAccum(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    GlTraceRecord traceRecord(GlFunction::ClearAccum);
+    traceRecord.value(red);
+    traceRecord.value(green);
+    traceRecord.value(blue);
+    traceRecord.value(alpha);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_ClearAccum(red, green, blue, alpha);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_ClearIndex(GLfloat c) {
+    GlTraceRecord traceRecord(GlFunction::ClearIndex);
+    traceRecord.value(c);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_ClearIndex(c);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_IndexMask(GLuint mask) {
+    GlTraceRecord traceRecord(GlFunction::IndexMask);
+    traceRecord.value(mask);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_IndexMask(mask);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Accum(GLenum op, GLfloat value) {
+    GlTraceRecord traceRecord(GlFunction::Accum);
+    traceRecord.value(op);
+    traceRecord.value(value);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Accum(op, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_PopAttrib() {
+    GlTraceRecord traceRecord(GlFunction::PopAttrib);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_PopAttrib();
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_PushAttrib(GLbitfield mask) {
+    GlTraceRecord traceRecord(GlFunction::PushAttrib);
+    traceRecord.value(mask);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_PushAttrib(mask);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Map1d(GLenum target, GLdouble u1, GLdouble u2, GLint stride, GLint order, const GLdouble * points) {
+    GlTraceRecord traceRecord(GlFunction::Map1d);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Map1d(target, u1, u2, stride, order, points);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Map1f(GLenum target, GLfloat u1, GLfloat u2, GLint stride, GLint order, const GLfloat * points) {
+    GlTraceRecord traceRecord(GlFunction::Map1f);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Map1f(target, u1, u2, stride, order, points);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Map2d(GLenum target, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, const GLdouble * points) {
+    GlTraceRecord traceRecord(GlFunction::Map2d);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Map2d(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Map2f(GLenum target, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, const GLfloat * points) {
+    GlTraceRecord traceRecord(GlFunction::Map2f);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Map2f(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MapGrid1d(GLint un, GLdouble u1, GLdouble u2) {
+    GlTraceRecord traceRecord(GlFunction::MapGrid1d);
+    traceRecord.value(un);
+    traceRecord.value(u1);
+    traceRecord.value(u2);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MapGrid1d(un, u1, u2);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MapGrid1f(GLint un, GLfloat u1, GLfloat u2) {
+    GlTraceRecord traceRecord(GlFunction::MapGrid1f);
+    traceRecord.value(un);
+    traceRecord.value(u1);
+    traceRecord.value(u2);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MapGrid1f(un, u1, u2);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MapGrid2d(GLint un, GLdouble u1, GLdouble u2, GLint vn, GLdouble v1, GLdouble v2) {
+    GlTraceRecord traceRecord(GlFunction::MapGrid2d);
+    traceRecord.value(un);
+    traceRecord.value(u1);
+    traceRecord.value(u2);
+    traceRecord.value(vn);
+    traceRecord.value(v1);
+    traceRecord.value(v2);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MapGrid2d(un, u1, u2, vn, v1, v2);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MapGrid2f(GLint un, GLfloat u1, GLfloat u2, GLint vn, GLfloat v1, GLfloat v2) {
+    GlTraceRecord traceRecord(GlFunction::MapGrid2f);
+    traceRecord.value(un);
+    traceRecord.value(u1);
+    traceRecord.value(u2);
+    traceRecord.value(vn);
+    traceRecord.value(v1);
+    traceRecord.value(v2);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MapGrid2f(un, u1, u2, vn, v1, v2);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_EvalCoord1d(GLdouble u) {
+    GlTraceRecord traceRecord(GlFunction::EvalCoord1d);
+    traceRecord.value(u);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_EvalCoord1d(u);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_EvalCoord1dv(const GLdouble * u) {
+    GlTraceRecord traceRecord(GlFunction::EvalCoord1dv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_EvalCoord1dv(u);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_EvalCoord1f(GLfloat u) {
+    GlTraceRecord traceRecord(GlFunction::EvalCoord1f);
+    traceRecord.value(u);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_EvalCoord1f(u);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_EvalCoord1fv(const GLfloat * u) {
+    GlTraceRecord traceRecord(GlFunction::EvalCoord1fv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_EvalCoord1fv(u);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_EvalCoord2d(GLdouble u, GLdouble v) {
+    GlTraceRecord traceRecord(GlFunction::EvalCoord2d);
+    traceRecord.value(u);
+    traceRecord.value(v);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_EvalCoord2d(u, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_EvalCoord2dv(const GLdouble * u) {
+    GlTraceRecord traceRecord(GlFunction::EvalCoord2dv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_EvalCoord2dv(u);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_EvalCoord2f(GLfloat u, GLfloat v) {
+    GlTraceRecord traceRecord(GlFunction::EvalCoord2f);
+    traceRecord.value(u);
+    traceRecord.value(v);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_EvalCoord2f(u, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_EvalCoord2fv(const GLfloat * u) {
+    GlTraceRecord traceRecord(GlFunction::EvalCoord2fv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_EvalCoord2fv(u);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_EvalMesh1(GLenum mode, GLint i1, GLint i2) {
+    GlTraceRecord traceRecord(GlFunction::EvalMesh1);
+    traceRecord.value(mode);
+    traceRecord.value(i1);
+    traceRecord.value(i2);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_EvalMesh1(mode, i1, i2);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_EvalPoint1(GLint i) {
+    GlTraceRecord traceRecord(GlFunction::EvalPoint1);
+    traceRecord.value(i);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_EvalPoint1(i);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_EvalMesh2(GLenum mode, GLint i1, GLint i2, GLint j1, GLint j2) {
+    GlTraceRecord traceRecord(GlFunction::EvalMesh2);
+    traceRecord.value(mode);
+    traceRecord.value(i1);
+    traceRecord.value(i2);
+    traceRecord.value(j1);
+    traceRecord.value(j2);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_EvalMesh2(mode, i1, i2, j1, j2);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_EvalPoint2(GLint i, GLint j) {
+    GlTraceRecord traceRecord(GlFunction::EvalPoint2);
+    traceRecord.value(i);
+    traceRecord.value(j);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_EvalPoint2(i, j);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_AlphaFunc(GLenum func, GLfloat ref) {
+    GlTraceRecord traceRecord(GlFunction::AlphaFunc);
+    traceRecord.value(func);
+    traceRecord.value(ref);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_AlphaFunc(func, ref);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_PixelZoom(GLfloat xfactor, GLfloat yfactor) {
+    GlTraceRecord traceRecord(GlFunction::PixelZoom);
+    traceRecord.value(xfactor);
+    traceRecord.value(yfactor);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_PixelZoom(xfactor, yfactor);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_PixelTransferf(GLenum pname, GLfloat param) {
+    GlTraceRecord traceRecord(GlFunction::PixelTransferf);
+    traceRecord.value(pname);
+    traceRecord.value(param);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_PixelTransferf(pname, param);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_PixelTransferi(GLenum pname, GLint param) {
+    GlTraceRecord traceRecord(GlFunction::PixelTransferi);
+    traceRecord.value(pname);
+    traceRecord.value(param);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_PixelTransferi(pname, param);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_PixelMapfv(GLenum map, GLsizei mapsize, const GLfloat * values) {
+    GlTraceRecord traceRecord(GlFunction::PixelMapfv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_PixelMapfv(map, mapsize, values);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_PixelMapuiv(GLenum map, GLsizei mapsize, const GLuint * values) {
+    GlTraceRecord traceRecord(GlFunction::PixelMapuiv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_PixelMapuiv(map, mapsize, values);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_PixelMapusv(GLenum map, GLsizei mapsize, const GLushort * values) {
+    GlTraceRecord traceRecord(GlFunction::PixelMapusv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_PixelMapusv(map, mapsize, values);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_CopyPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum type) {
+    GlTraceRecord traceRecord(GlFunction::CopyPixels);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    traceRecord.value(width);
+    traceRecord.value(height);
+    traceRecord.value(type);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_CopyPixels(x, y, width, height, type);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_DrawPixels(GLsizei width, GLsizei height, GLenum format, GLenum type, const void * pixels) {
+    GlTraceRecord traceRecord(GlFunction::DrawPixels);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_DrawPixels(width, height, format, type, pixels);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetClipPlane(GLenum plane, GLdouble * equation) {
+    GlTraceRecord traceRecord(GlFunction::GetClipPlane);
+    traceRecord.value(plane);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetClipPlane(plane, equation);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetLightfv(GLenum light, GLenum pname, GLfloat * params) {
+    GlTraceRecord traceRecord(GlFunction::GetLightfv);
+    traceRecord.value(light);
+    traceRecord.value(pname);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetLightfv(light, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetLightiv(GLenum light, GLenum pname, GLint * params) {
+    GlTraceRecord traceRecord(GlFunction::GetLightiv);
+    traceRecord.value(light);
+    traceRecord.value(pname);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetLightiv(light, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetMapdv(GLenum target, GLenum query, GLdouble * v) {
+    GlTraceRecord traceRecord(GlFunction::GetMapdv);
+    traceRecord.value(target);
+    traceRecord.value(query);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetMapdv(target, query, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetMapfv(GLenum target, GLenum query, GLfloat * v) {
+    GlTraceRecord traceRecord(GlFunction::GetMapfv);
+    traceRecord.value(target);
+    traceRecord.value(query);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetMapfv(target, query, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetMapiv(GLenum target, GLenum query, GLint * v) {
+    GlTraceRecord traceRecord(GlFunction::GetMapiv);
+    traceRecord.value(target);
+    traceRecord.value(query);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetMapiv(target, query, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetMaterialfv(GLenum face, GLenum pname, GLfloat * params) {
+    GlTraceRecord traceRecord(GlFunction::GetMaterialfv);
+    traceRecord.value(face);
+    traceRecord.value(pname);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetMaterialfv(face, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetMaterialiv(GLenum face, GLenum pname, GLint * params) {
+    GlTraceRecord traceRecord(GlFunction::GetMaterialiv);
+    traceRecord.value(face);
+    traceRecord.value(pname);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetMaterialiv(face, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetPixelMapfv(GLenum map, GLfloat * values) {
+    GlTraceRecord traceRecord(GlFunction::GetPixelMapfv);
+    traceRecord.value(map);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetPixelMapfv(map, values);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetPixelMapuiv(GLenum map, GLuint * values) {
+    GlTraceRecord traceRecord(GlFunction::GetPixelMapuiv);
+    traceRecord.value(map);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetPixelMapuiv(map, values);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetPixelMapusv(GLenum map, GLushort * values) {
+    GlTraceRecord traceRecord(GlFunction::GetPixelMapusv);
+    traceRecord.value(map);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetPixelMapusv(map, values);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetPolygonStipple(GLubyte * mask) {
+    GlTraceRecord traceRecord(GlFunction::GetPolygonStipple);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetPolygonStipple(mask);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetTexEnvfv(GLenum target, GLenum pname, GLfloat * params) {
+    GlTraceRecord traceRecord(GlFunction::GetTexEnvfv);
+    traceRecord.value(target);
+    traceRecord.value(pname);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetTexEnvfv(target, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetTexEnviv(GLenum target, GLenum pname, GLint * params) {
+    GlTraceRecord traceRecord(GlFunction::GetTexEnviv);
+    traceRecord.value(target);
+    traceRecord.value(pname);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetTexEnviv(target, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetTexGendv(GLenum coord, GLenum pname, GLdouble * params) {
+    GlTraceRecord traceRecord(GlFunction::GetTexGendv);
+    traceRecord.value(coord);
+    traceRecord.value(pname);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetTexGendv(coord, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetTexGenfv(GLenum coord, GLenum pname, GLfloat * params) {
+    GlTraceRecord traceRecord(GlFunction::GetTexGenfv);
+    traceRecord.value(coord);
+    traceRecord.value(pname);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetTexGenfv(coord, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetTexGeniv(GLenum coord, GLenum pname, GLint * params) {
+    GlTraceRecord traceRecord(GlFunction::GetTexGeniv);
+    traceRecord.value(coord);
+    traceRecord.value(pname);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetTexGeniv(coord, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline GLboolean APIENTRY glTrace_IsList(GLuint list) {
+    GlTraceRecord traceRecord(GlFunction::IsList);
+    traceRecord.value(list);
+    uint64_t traceStart = GlTraceRecord::now();
+    GLboolean traceResult = glTraceReal_IsList(list);
+    traceRecord.finish(traceStart);
+    return traceResult;
+}
+
+inline void APIENTRY glTrace_Frustum(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar) {
+    GlTraceRecord traceRecord(GlFunction::Frustum);
+    traceRecord.value(left);
+    traceRecord.value(right);
+    traceRecord.value(bottom);
+    traceRecord.value(top);
+    traceRecord.value(zNear);
+    traceRecord.value(zFar);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Frustum(left, right, bottom, top, zNear, zFar);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_LoadIdentity() {
+    GlTraceRecord traceRecord(GlFunction::LoadIdentity);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_LoadIdentity();
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_LoadMatrixf(const GLfloat * m) {
+    GlTraceRecord traceRecord(GlFunction::LoadMatrixf);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_LoadMatrixf(m);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_LoadMatrixd(const GLdouble * m) {
+    GlTraceRecord traceRecord(GlFunction::LoadMatrixd);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_LoadMatrixd(m);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MatrixMode(GLenum mode) {
+    GlTraceRecord traceRecord(GlFunction::MatrixMode);
+    traceRecord.value(mode);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MatrixMode(mode);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MultMatrixf(const GLfloat * m) {
+    GlTraceRecord traceRecord(GlFunction::MultMatrixf);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MultMatrixf(m);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MultMatrixd(const GLdouble * m) {
+    GlTraceRecord traceRecord(GlFunction::MultMatrixd);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MultMatrixd(m);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Ortho(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar) {
+    GlTraceRecord traceRecord(GlFunction::Ortho);
+    traceRecord.value(left);
+    traceRecord.value(right);
+    traceRecord.value(bottom);
+    traceRecord.value(top);
+    traceRecord.value(zNear);
+    traceRecord.value(zFar);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Ortho(left, right, bottom, top, zNear, zFar);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_PopMatrix() {
+    GlTraceRecord traceRecord(GlFunction::PopMatrix);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_PopMatrix();
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_PushMatrix() {
+    GlTraceRecord traceRecord(GlFunction::PushMatrix);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_PushMatrix();
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Rotated(GLdouble angle, GLdouble x, GLdouble y, GLdouble z) {
+    GlTraceRecord traceRecord(GlFunction::Rotated);
+    traceRecord.value(angle);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    traceRecord.value(z);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Rotated(angle, x, y, z);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Rotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z) {
+    GlTraceRecord traceRecord(GlFunction::Rotatef);
+    traceRecord.value(angle);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    traceRecord.value(z);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Rotatef(angle, x, y, z);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Scaled(GLdouble x, GLdouble y, GLdouble z) {
+    GlTraceRecord traceRecord(GlFunction::Scaled);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    traceRecord.value(z);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Scaled(x, y, z);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Scalef(GLfloat x, GLfloat y, GLfloat z) {
+    GlTraceRecord traceRecord(GlFunction::Scalef);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    traceRecord.value(z);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Scalef(x, y, z);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Translated(GLdouble x, GLdouble y, GLdouble z) {
+    GlTraceRecord traceRecord(GlFunction::Translated);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    traceRecord.value(z);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Translated(x, y, z);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Translatef(GLfloat x, GLfloat y, GLfloat z) {
+    GlTraceRecord traceRecord(GlFunction::Translatef);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    traceRecord.value(z);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Translatef(x, y, z);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_DrawArrays(GLenum mode, GLint first, GLsizei count) {
+    GlTraceRecord traceRecord(GlFunction::DrawArrays);
+    traceRecord.value(mode);
+    traceRecord.value(first);
+    traceRecord.value(count);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_DrawArrays(mode, first, count);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_DrawElements(GLenum mode, GLsizei count, GLenum type, const void * indices) {
+    GlTraceRecord traceRecord(GlFunction::DrawElements);
+    traceRecord.value(mode);
+    traceRecord.value(count);
+    traceRecord.value(type);
+    traceRecord.offset(indices);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_DrawElements(mode, count, type, indices);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetPointerv(GLenum pname, void ** params) {
+    GlTraceRecord traceRecord(GlFunction::GetPointerv);
+    traceRecord.value(pname);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetPointerv(pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_PolygonOffset(GLfloat factor, GLfloat units) {
+    GlTraceRecord traceRecord(GlFunction::PolygonOffset);
+    traceRecord.value(factor);
+    traceRecord.value(units);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_PolygonOffset(factor, units);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_CopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) {
+    GlTraceRecord traceRecord(GlFunction::CopyTexImage1D);
+    traceRecord.value(target);
+    traceRecord.value(level);
+    traceRecord.value(internalformat);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    traceRecord.value(width);
+    traceRecord.value(border);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_CopyTexImage1D(target, level, internalformat, x, y, width, border);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_CopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) {
+    GlTraceRecord traceRecord(GlFunction::CopyTexImage2D);
+    traceRecord.value(target);
+    traceRecord.value(level);
+    traceRecord.value(internalformat);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    traceRecord.value(width);
+    traceRecord.value(height);
+    traceRecord.value(border);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_CopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_CopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+    GlTraceRecord traceRecord(GlFunction::CopyTexSubImage1D);
+    traceRecord.value(target);
+    traceRecord.value(level);
+    traceRecord.value(xoffset);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    traceRecord.value(width);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_CopyTexSubImage1D(target, level, xoffset, x, y, width);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_CopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    GlTraceRecord traceRecord(GlFunction::CopyTexSubImage2D);
+    traceRecord.value(target);
+    traceRecord.value(level);
+    traceRecord.value(xoffset);
+    traceRecord.value(yoffset);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    traceRecord.value(width);
+    traceRecord.value(height);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_CopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void * pixels) {
+    GlTraceRecord traceRecord(GlFunction::TexSubImage1D);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexSubImage1D(target, level, xoffset, width, format, type, pixels);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void * pixels) {
+    GlTraceRecord traceRecord(GlFunction::TexSubImage2D);
+    traceRecord.value(target);
+    traceRecord.value(level);
+    traceRecord.value(xoffset);
+    traceRecord.value(yoffset);
+    traceRecord.value(width);
+    traceRecord.value(height);
+    traceRecord.value(format);
+    traceRecord.value(type);
+    traceRecord.bytes(pixels, pixels ? GlIntercept::textureBytes(width, height, format, type) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_BindTexture(GLenum target, GLuint texture) {
+    GlTraceRecord traceRecord(GlFunction::BindTexture);
+    traceRecord.value(target);
+    traceRecord.value(texture);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_BindTexture(target, texture);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_DeleteTextures(GLsizei n, const GLuint * textures) {
+    GlTraceRecord traceRecord(GlFunction::DeleteTextures);
+    traceRecord.value(n);
+    traceRecord.names(n, textures);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_DeleteTextures(n, textures);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GenTextures(GLsizei n, GLuint * textures) {
+    GlTraceRecord traceRecord(GlFunction::GenTextures);
+    traceRecord.value(n);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GenTextures(n, textures);
+    traceRecord.names(n, textures);
+    traceRecord.finish(traceStart);
+}
+
+inline GLboolean APIENTRY glTrace_IsTexture(GLuint texture) {
+    GlTraceRecord traceRecord(GlFunction::IsTexture);
+    traceRecord.value(texture);
+    uint64_t traceStart = GlTraceRecord::now();
+    GLboolean traceResult = glTraceReal_IsTexture(texture);
+    traceRecord.finish(traceStart);
+    return traceResult;
+}
+
+inline void APIENTRY glTrace_ArrayElement(GLint i) {
+    GlTraceRecord traceRecord(GlFunction::ArrayElement);
+    traceRecord.value(i);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_ArrayElement(i);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_ColorPointer(GLint size, GLenum type, GLsizei stride, const void * pointer) {
+    GlTraceRecord traceRecord(GlFunction::ColorPointer);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_ColorPointer(size, type, stride, pointer);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_DisableClientState(GLenum array) {
+    GlTraceRecord traceRecord(GlFunction::DisableClientState);
+    traceRecord.value(array);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_DisableClientState(array);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_EdgeFlagPointer(GLsizei stride, const void * pointer) {
+    GlTraceRecord traceRecord(GlFunction::EdgeFlagPointer);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_EdgeFlagPointer(stride, pointer);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_EnableClientState(GLenum array) {
+    GlTraceRecord traceRecord(GlFunction::EnableClientState);
+    traceRecord.value(array);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_EnableClientState(array);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_IndexPointer(GLenum type, GLsizei stride, const void * pointer) {
+    GlTraceRecord traceRecord(GlFunction::IndexPointer);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_IndexPointer(type, stride, pointer);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_InterleavedArrays(GLenum format, GLsizei stride, const void * pointer) {
+    GlTraceRecord traceRecord(GlFunction::InterleavedArrays);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_InterleavedArrays(format, stride, pointer);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_NormalPointer(GLenum type, GLsizei stride, const void * pointer) {
+    GlTraceRecord traceRecord(GlFunction::NormalPointer);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_NormalPointer(type, stride, pointer);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexCoordPointer(GLint size, GLenum type, GLsizei stride, const void * pointer) {
+    GlTraceRecord traceRecord(GlFunction::TexCoordPointer);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexCoordPointer(size, type, stride, pointer);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexPointer(GLint size, GLenum type, GLsizei stride, const void * pointer) {
+    GlTraceRecord traceRecord(GlFunction::VertexPointer);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexPointer(size, type, stride, pointer);
+    traceRecord.finish(traceStart);
+}
+
+inline GLboolean APIENTRY glTrace_AreTexturesResident(GLsizei n, const GLuint * textures, GLboolean * residences) {
+    GlTraceRecord traceRecord(GlFunction::AreTexturesResident);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    GLboolean traceResult = glTraceReal_AreTexturesResident(n, textures, residences);
+    traceRecord.finish(traceStart);
+    return traceResult;
+}
+
+inline void APIENTRY glTrace_PrioritizeTextures(GLsizei n, const GLuint * textures, const GLfloat * priorities) {
+    GlTraceRecord traceRecord(GlFunction::PrioritizeTextures);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_PrioritizeTextures(n, textures, priorities);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Indexub(GLubyte c) {
+    GlTraceRecord traceRecord(GlFunction::Indexub);
+    traceRecord.value(c);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Indexub(c);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Indexubv(const GLubyte * c) {
+    GlTraceRecord traceRecord(GlFunction::Indexubv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Indexubv(c);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_PopClientAttrib() {
+    GlTraceRecord traceRecord(GlFunction::PopClientAttrib);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_PopClientAttrib();
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_PushClientAttrib(GLbitfield mask) {
+    GlTraceRecord traceRecord(GlFunction::PushClientAttrib);
+    traceRecord.value(mask);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_PushClientAttrib(mask);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_DrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void * indices) {
+    GlTraceRecord traceRecord(GlFunction::DrawRangeElements);
+    traceRecord.value(mode);
+    traceRecord.value(start);
+    traceRecord.value(end);
+    traceRecord.value(count);
+    traceRecord.value(type);
+    traceRecord.offset(indices);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_DrawRangeElements(mode, start, end, count, type, indices);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void * pixels) {
+    GlTraceRecord traceRecord(GlFunction::TexImage3D);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void * pixels) {
+    GlTraceRecord traceRecord(GlFunction::TexSubImage3D);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_CopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    GlTraceRecord traceRecord(GlFunction::CopyTexSubImage3D);
+    traceRecord.value(target);
+    traceRecord.value(level);
+    traceRecord.value(xoffset);
+    traceRecord.value(yoffset);
+    traceRecord.value(zoffset);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    traceRecord.value(width);
+    traceRecord.value(height);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_CopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_ActiveTexture(GLenum texture) {
+    GlTraceRecord traceRecord(GlFunction::ActiveTexture);
+    traceRecord.value(texture);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_ActiveTexture(texture);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_SampleCoverage(GLfloat value, GLboolean invert) {
+    GlTraceRecord traceRecord(GlFunction::SampleCoverage);
+    traceRecord.value(value);
+    traceRecord.value(invert);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_SampleCoverage(value, invert);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_CompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void * data) {
+    GlTraceRecord traceRecord(GlFunction::CompressedTexImage3D);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_CompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_CompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void * data) {
+    GlTraceRecord traceRecord(GlFunction::CompressedTexImage2D);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_CompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_CompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void * data) {
+    GlTraceRecord traceRecord(GlFunction::CompressedTexImage1D);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_CompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_CompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void * data) {
+    GlTraceRecord traceRecord(GlFunction::CompressedTexSubImage3D);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_CompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_CompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void * data) {
+    GlTraceRecord traceRecord(GlFunction::CompressedTexSubImage2D);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_CompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_CompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void * data) {
+    GlTraceRecord traceRecord(GlFunction::CompressedTexSubImage1D);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_CompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetCompressedTexImage(GLenum target, GLint level, void * img) {
+    GlTraceRecord traceRecord(GlFunction::GetCompressedTexImage);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetCompressedTexImage(target, level, img);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_ClientActiveTexture(GLenum texture) {
+    GlTraceRecord traceRecord(GlFunction::ClientActiveTexture);
+    traceRecord.value(texture);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_ClientActiveTexture(texture);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MultiTexCoord1d(GLenum target, GLdouble s) {
+    GlTraceRecord traceRecord(GlFunction::MultiTexCoord1d);
+    traceRecord.value(target);
+    traceRecord.value(s);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MultiTexCoord1d(target, s);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MultiTexCoord1dv(GLenum target, const GLdouble * v) {
+    GlTraceRecord traceRecord(GlFunction::MultiTexCoord1dv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MultiTexCoord1dv(target, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MultiTexCoord1f(GLenum target, GLfloat s) {
+    GlTraceRecord traceRecord(GlFunction::MultiTexCoord1f);
+    traceRecord.value(target);
+    traceRecord.value(s);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MultiTexCoord1f(target, s);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MultiTexCoord1fv(GLenum target, const GLfloat * v) {
+    GlTraceRecord traceRecord(GlFunction::MultiTexCoord1fv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MultiTexCoord1fv(target, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MultiTexCoord1i(GLenum target, GLint s) {
+    GlTraceRecord traceRecord(GlFunction::MultiTexCoord1i);
+    traceRecord.value(target);
+    traceRecord.value(s);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MultiTexCoord1i(target, s);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MultiTexCoord1iv(GLenum target, const GLint * v) {
+    GlTraceRecord traceRecord(GlFunction::MultiTexCoord1iv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MultiTexCoord1iv(target, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MultiTexCoord1s(GLenum target, GLshort s) {
+    GlTraceRecord traceRecord(GlFunction::MultiTexCoord1s);
+    traceRecord.value(target);
+    traceRecord.value(s);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MultiTexCoord1s(target, s);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MultiTexCoord1sv(GLenum target, const GLshort * v) {
+    GlTraceRecord traceRecord(GlFunction::MultiTexCoord1sv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MultiTexCoord1sv(target, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MultiTexCoord2d(GLenum target, GLdouble s, GLdouble t) {
+    GlTraceRecord traceRecord(GlFunction::MultiTexCoord2d);
+    traceRecord.value(target);
+    traceRecord.value(s);
+    traceRecord.value(t);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MultiTexCoord2d(target, s, t);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MultiTexCoord2dv(GLenum target, const GLdouble * v) {
+    GlTraceRecord traceRecord(GlFunction::MultiTexCoord2dv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MultiTexCoord2dv(target, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MultiTexCoord2f(GLenum target, GLfloat s, GLfloat t) {
+    GlTraceRecord traceRecord(GlFunction::MultiTexCoord2f);
+    traceRecord.value(target);
+    traceRecord.value(s);
+    traceRecord.value(t);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MultiTexCoord2f(target, s, t);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MultiTexCoord2fv(GLenum target, const GLfloat * v) {
+    GlTraceRecord traceRecord(GlFunction::MultiTexCoord2fv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MultiTexCoord2fv(target, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MultiTexCoord2i(GLenum target, GLint s, GLint t) {
+    GlTraceRecord traceRecord(GlFunction::MultiTexCoord2i);
+    traceRecord.value(target);
+    traceRecord.value(s);
+    traceRecord.value(t);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MultiTexCoord2i(target, s, t);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MultiTexCoord2iv(GLenum target, const GLint * v) {
+    GlTraceRecord traceRecord(GlFunction::MultiTexCoord2iv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MultiTexCoord2iv(target, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MultiTexCoord2s(GLenum target, GLshort s, GLshort t) {
+    GlTraceRecord traceRecord(GlFunction::MultiTexCoord2s);
+    traceRecord.value(target);
+    traceRecord.value(s);
+    traceRecord.value(t);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MultiTexCoord2s(target, s, t);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MultiTexCoord2sv(GLenum target, const GLshort * v) {
+    GlTraceRecord traceRecord(GlFunction::MultiTexCoord2sv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MultiTexCoord2sv(target, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MultiTexCoord3d(GLenum target, GLdouble s, GLdouble t, GLdouble r) {
+    GlTraceRecord traceRecord(GlFunction::MultiTexCoord3d);
+    traceRecord.value(target);
+    traceRecord.value(s);
+    traceRecord.value(t);
+    traceRecord.value(r);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MultiTexCoord3d(target, s, t, r);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MultiTexCoord3dv(GLenum target, const GLdouble * v) {
+    GlTraceRecord traceRecord(GlFunction::MultiTexCoord3dv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MultiTexCoord3dv(target, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MultiTexCoord3f(GLenum target, GLfloat s, GLfloat t, GLfloat r) {
+    GlTraceRecord traceRecord(GlFunction::MultiTexCoord3f);
+    traceRecord.value(target);
+    traceRecord.value(s);
+    traceRecord.value(t);
+    traceRecord.value(r);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MultiTexCoord3f(target, s, t, r);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MultiTexCoord3fv(GLenum target, const GLfloat * v) {
+    GlTraceRecord traceRecord(GlFunction::MultiTexCoord3fv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MultiTexCoord3fv(target, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MultiTexCoord3i(GLenum target, GLint s, GLint t, GLint r) {
+    GlTraceRecord traceRecord(GlFunction::MultiTexCoord3i);
+    traceRecord.value(target);
+    traceRecord.value(s);
+    traceRecord.value(t);
+    traceRecord.value(r);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MultiTexCoord3i(target, s, t, r);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MultiTexCoord3iv(GLenum target, const GLint * v) {
+    GlTraceRecord traceRecord(GlFunction::MultiTexCoord3iv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MultiTexCoord3iv(target, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MultiTexCoord3s(GLenum target, GLshort s, GLshort t, GLshort r) {
+    GlTraceRecord traceRecord(GlFunction::MultiTexCoord3s);
+    traceRecord.value(target);
+    traceRecord.value(s);
+    traceRecord.value(t);
+    traceRecord.value(r);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MultiTexCoord3s(target, s, t, r);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MultiTexCoord3sv(GLenum target, const GLshort * v) {
+    GlTraceRecord traceRecord(GlFunction::MultiTexCoord3sv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MultiTexCoord3sv(target, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MultiTexCoord4d(GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q) {
+    GlTraceRecord traceRecord(GlFunction::MultiTexCoord4d);
+    traceRecord.value(target);
+    traceRecord.value(s);
+    traceRecord.value(t);
+    traceRecord.value(r);
+    traceRecord.value(q);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MultiTexCoord4d(target, s, t, r, q);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MultiTexCoord4dv(GLenum target, const GLdouble * v) {
+    GlTraceRecord traceRecord(GlFunction::MultiTexCoord4dv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MultiTexCoord4dv(target, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MultiTexCoord4f(GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q) {
+    GlTraceRecord traceRecord(GlFunction::MultiTexCoord4f);
+    traceRecord.value(target);
+    traceRecord.value(s);
+    traceRecord.value(t);
+    traceRecord.value(r);
+    traceRecord.value(q);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MultiTexCoord4f(target, s, t, r, q);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MultiTexCoord4fv(GLenum target, const GLfloat * v) {
+    GlTraceRecord traceRecord(GlFunction::MultiTexCoord4fv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MultiTexCoord4fv(target, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MultiTexCoord4i(GLenum target, GLint s, GLint t, GLint r, GLint q) {
+    GlTraceRecord traceRecord(GlFunction::MultiTexCoord4i);
+    traceRecord.value(target);
+    traceRecord.value(s);
+    traceRecord.value(t);
+    traceRecord.value(r);
+    traceRecord.value(q);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MultiTexCoord4i(target, s, t, r, q);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MultiTexCoord4iv(GLenum target, const GLint * v) {
+    GlTraceRecord traceRecord(GlFunction::MultiTexCoord4iv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MultiTexCoord4iv(target, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MultiTexCoord4s(GLenum target, GLshort s, GLshort t, GLshort r, GLshort q) {
+    GlTraceRecord traceRecord(GlFunction::MultiTexCoord4s);
+    traceRecord.value(target);
+    traceRecord.value(s);
+    traceRecord.value(t);
+    traceRecord.value(r);
+    traceRecord.value(q);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MultiTexCoord4s(target, s, t, r, q);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MultiTexCoord4sv(GLenum target, const GLshort * v) {
+    GlTraceRecord traceRecord(GlFunction::MultiTexCoord4sv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MultiTexCoord4sv(target, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_LoadTransposeMatrixf(const GLfloat * m) {
+    GlTraceRecord traceRecord(GlFunction::LoadTransposeMatrixf);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_LoadTransposeMatrixf(m);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_LoadTransposeMatrixd(const GLdouble * m) {
+    GlTraceRecord traceRecord(GlFunction::LoadTransposeMatrixd);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_LoadTransposeMatrixd(m);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MultTransposeMatrixf(const GLfloat * m) {
+    GlTraceRecord traceRecord(GlFunction::MultTransposeMatrixf);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MultTransposeMatrixf(m);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MultTransposeMatrixd(const GLdouble * m) {
+    GlTraceRecord traceRecord(GlFunction::MultTransposeMatrixd);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MultTransposeMatrixd(m);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_BlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) {
+    GlTraceRecord traceRecord(GlFunction::BlendFuncSeparate);
+    traceRecord.value(sfactorRGB);
+    traceRecord.value(dfactorRGB);
+    traceRecord.value(sfactorAlpha);
+    traceRecord.value(dfactorAlpha);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_BlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MultiDrawArrays(GLenum mode, const GLint * first, const GLsizei * count, GLsizei drawcount) {
+    GlTraceRecord traceRecord(GlFunction::MultiDrawArrays);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MultiDrawArrays(mode, first, count, drawcount);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MultiDrawElements(GLenum mode, const GLsizei * count, GLenum type, const void *const* indices, GLsizei drawcount) {
+    GlTraceRecord traceRecord(GlFunction::MultiDrawElements);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MultiDrawElements(mode, count, type, indices, drawcount);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_PointParameterf(GLenum pname, GLfloat param) {
+    GlTraceRecord traceRecord(GlFunction::PointParameterf);
+    traceRecord.value(pname);
+    traceRecord.value(param);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_PointParameterf(pname, param);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_PointParameterfv(GLenum pname, const GLfloat * params) {
+    GlTraceRecord traceRecord(GlFunction::PointParameterfv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_PointParameterfv(pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_PointParameteri(GLenum pname, GLint param) {
+    GlTraceRecord traceRecord(GlFunction::PointParameteri);
+    traceRecord.value(pname);
+    traceRecord.value(param);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_PointParameteri(pname, param);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_PointParameteriv(GLenum pname, const GLint * params) {
+    GlTraceRecord traceRecord(GlFunction::PointParameteriv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_PointParameteriv(pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_FogCoordf(GLfloat coord) {
+    GlTraceRecord traceRecord(GlFunction::FogCoordf);
+    traceRecord.value(coord);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_FogCoordf(coord);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_FogCoordfv(const GLfloat * coord) {
+    GlTraceRecord traceRecord(GlFunction::FogCoordfv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_FogCoordfv(coord);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_FogCoordd(GLdouble coord) {
+    GlTraceRecord traceRecord(GlFunction::FogCoordd);
+    traceRecord.value(coord);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_FogCoordd(coord);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_FogCoorddv(const GLdouble * coord) {
+    GlTraceRecord traceRecord(GlFunction::FogCoorddv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_FogCoorddv(coord);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_FogCoordPointer(GLenum type, GLsizei stride, const void * pointer) {
+    GlTraceRecord traceRecord(GlFunction::FogCoordPointer);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_FogCoordPointer(type, stride, pointer);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_SecondaryColor3b(GLbyte red, GLbyte green, GLbyte blue) {
+    GlTraceRecord traceRecord(GlFunction::SecondaryColor3b);
+    traceRecord.value(red);
+    traceRecord.value(green);
+    traceRecord.value(blue);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_SecondaryColor3b(red, green, blue);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_SecondaryColor3bv(const GLbyte * v) {
+    GlTraceRecord traceRecord(GlFunction::SecondaryColor3bv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_SecondaryColor3bv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_SecondaryColor3d(GLdouble red, GLdouble green, GLdouble blue) {
+    GlTraceRecord traceRecord(GlFunction::SecondaryColor3d);
+    traceRecord.value(red);
+    traceRecord.value(green);
+    traceRecord.value(blue);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_SecondaryColor3d(red, green, blue);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_SecondaryColor3dv(const GLdouble * v) {
+    GlTraceRecord traceRecord(GlFunction::SecondaryColor3dv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_SecondaryColor3dv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_SecondaryColor3f(GLfloat red, GLfloat green, GLfloat blue) {
+    GlTraceRecord traceRecord(GlFunction::SecondaryColor3f);
+    traceRecord.value(red);
+    traceRecord.value(green);
+    traceRecord.value(blue);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_SecondaryColor3f(red, green, blue);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_SecondaryColor3fv(const GLfloat * v) {
+    GlTraceRecord traceRecord(GlFunction::SecondaryColor3fv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_SecondaryColor3fv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_SecondaryColor3i(GLint red, GLint green, GLint blue) {
+    GlTraceRecord traceRecord(GlFunction::SecondaryColor3i);
+    traceRecord.value(red);
+    traceRecord.value(green);
+    traceRecord.value(blue);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_SecondaryColor3i(red, green, blue);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_SecondaryColor3iv(const GLint * v) {
+    GlTraceRecord traceRecord(GlFunction::SecondaryColor3iv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_SecondaryColor3iv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_SecondaryColor3s(GLshort red, GLshort green, GLshort blue) {
+    GlTraceRecord traceRecord(GlFunction::SecondaryColor3s);
+    traceRecord.value(red);
+    traceRecord.value(green);
+    traceRecord.value(blue);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_SecondaryColor3s(red, green, blue);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_SecondaryColor3sv(const GLshort * v) {
+    GlTraceRecord traceRecord(GlFunction::SecondaryColor3sv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_SecondaryColor3sv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_SecondaryColor3ub(GLubyte red, GLubyte green, GLubyte blue) {
+    GlTraceRecord traceRecord(GlFunction::SecondaryColor3ub);
+    traceRecord.value(red);
+    traceRecord.value(green);
+    traceRecord.value(blue);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_SecondaryColor3ub(red, green, blue);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_SecondaryColor3ubv(const GLubyte * v) {
+    GlTraceRecord traceRecord(GlFunction::SecondaryColor3ubv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_SecondaryColor3ubv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_SecondaryColor3ui(GLuint red, GLuint green, GLuint blue) {
+    GlTraceRecord traceRecord(GlFunction::SecondaryColor3ui);
+    traceRecord.value(red);
+    traceRecord.value(green);
+    traceRecord.value(blue);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_SecondaryColor3ui(red, green, blue);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_SecondaryColor3uiv(const GLuint * v) {
+    GlTraceRecord traceRecord(GlFunction::SecondaryColor3uiv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_SecondaryColor3uiv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_SecondaryColor3us(GLushort red, GLushort green, GLushort blue) {
+    GlTraceRecord traceRecord(GlFunction::SecondaryColor3us);
+    traceRecord.value(red);
+    traceRecord.value(green);
+    traceRecord.value(blue);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_SecondaryColor3us(red, green, blue);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_SecondaryColor3usv(const GLushort * v) {
+    GlTraceRecord traceRecord(GlFunction::SecondaryColor3usv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_SecondaryColor3usv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_SecondaryColorPointer(GLint size, GLenum type, GLsizei stride, const void * pointer) {
+    GlTraceRecord traceRecord(GlFunction::SecondaryColorPointer);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_SecondaryColorPointer(size, type, stride, pointer);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_WindowPos2d(GLdouble x, GLdouble y) {
+    GlTraceRecord traceRecord(GlFunction::WindowPos2d);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_WindowPos2d(x, y);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_WindowPos2dv(const GLdouble * v) {
+    GlTraceRecord traceRecord(GlFunction::WindowPos2dv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_WindowPos2dv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_WindowPos2f(GLfloat x, GLfloat y) {
+    GlTraceRecord traceRecord(GlFunction::WindowPos2f);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_WindowPos2f(x, y);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_WindowPos2fv(const GLfloat * v) {
+    GlTraceRecord traceRecord(GlFunction::WindowPos2fv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_WindowPos2fv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_WindowPos2i(GLint x, GLint y) {
+    GlTraceRecord traceRecord(GlFunction::WindowPos2i);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_WindowPos2i(x, y);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_WindowPos2iv(const GLint * v) {
+    GlTraceRecord traceRecord(GlFunction::WindowPos2iv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_WindowPos2iv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_WindowPos2s(GLshort x, GLshort y) {
+    GlTraceRecord traceRecord(GlFunction::WindowPos2s);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_WindowPos2s(x, y);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_WindowPos2sv(const GLshort * v) {
+    GlTraceRecord traceRecord(GlFunction::WindowPos2sv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_WindowPos2sv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_WindowPos3d(GLdouble x, GLdouble y, GLdouble z) {
+    GlTraceRecord traceRecord(GlFunction::WindowPos3d);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    traceRecord.value(z);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_WindowPos3d(x, y, z);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_WindowPos3dv(const GLdouble * v) {
+    GlTraceRecord traceRecord(GlFunction::WindowPos3dv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_WindowPos3dv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_WindowPos3f(GLfloat x, GLfloat y, GLfloat z) {
+    GlTraceRecord traceRecord(GlFunction::WindowPos3f);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    traceRecord.value(z);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_WindowPos3f(x, y, z);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_WindowPos3fv(const GLfloat * v) {
+    GlTraceRecord traceRecord(GlFunction::WindowPos3fv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_WindowPos3fv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_WindowPos3i(GLint x, GLint y, GLint z) {
+    GlTraceRecord traceRecord(GlFunction::WindowPos3i);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    traceRecord.value(z);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_WindowPos3i(x, y, z);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_WindowPos3iv(const GLint * v) {
+    GlTraceRecord traceRecord(GlFunction::WindowPos3iv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_WindowPos3iv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_WindowPos3s(GLshort x, GLshort y, GLshort z) {
+    GlTraceRecord traceRecord(GlFunction::WindowPos3s);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    traceRecord.value(z);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_WindowPos3s(x, y, z);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_WindowPos3sv(const GLshort * v) {
+    GlTraceRecord traceRecord(GlFunction::WindowPos3sv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_WindowPos3sv(v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_BlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    GlTraceRecord traceRecord(GlFunction::BlendColor);
+    traceRecord.value(red);
+    traceRecord.value(green);
+    traceRecord.value(blue);
+    traceRecord.value(alpha);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_BlendColor(red, green, blue, alpha);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_BlendEquation(GLenum mode) {
+    GlTraceRecord traceRecord(GlFunction::BlendEquation);
+    traceRecord.value(mode);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_BlendEquation(mode);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GenQueries(GLsizei n, GLuint * ids) {
+    GlTraceRecord traceRecord(GlFunction::GenQueries);
+    traceRecord.value(n);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GenQueries(n, ids);
+    traceRecord.names(n, ids);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_DeleteQueries(GLsizei n, const GLuint * ids) {
+    GlTraceRecord traceRecord(GlFunction::DeleteQueries);
+    traceRecord.value(n);
+    traceRecord.names(n, ids);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_DeleteQueries(n, ids);
+    traceRecord.finish(traceStart);
+}
+
+inline GLboolean APIENTRY glTrace_IsQuery(GLuint id) {
+    GlTraceRecord traceRecord(GlFunction::IsQuery);
+    traceRecord.value(id);
+    uint64_t traceStart = GlTraceRecord::now();
+    GLboolean traceResult = glTraceReal_IsQuery(id);
+    traceRecord.finish(traceStart);
+    return traceResult;
+}
+
+inline void APIENTRY glTrace_BeginQuery(GLenum target, GLuint id) {
+    GlTraceRecord traceRecord(GlFunction::BeginQuery);
+    traceRecord.value(target);
+    traceRecord.value(id);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_BeginQuery(target, id);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_EndQuery(GLenum target) {
+    GlTraceRecord traceRecord(GlFunction::EndQuery);
+    traceRecord.value(target);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_EndQuery(target);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetQueryiv(GLenum target, GLenum pname, GLint * params) {
+    GlTraceRecord traceRecord(GlFunction::GetQueryiv);
+    traceRecord.value(target);
+    traceRecord.value(pname);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetQueryiv(target, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetQueryObjectiv(GLuint id, GLenum pname, GLint * params) {
+    GlTraceRecord traceRecord(GlFunction::GetQueryObjectiv);
+    traceRecord.value(id);
+    traceRecord.value(pname);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetQueryObjectiv(id, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetQueryObjectuiv(GLuint id, GLenum pname, GLuint * params) {
+    GlTraceRecord traceRecord(GlFunction::GetQueryObjectuiv);
+    traceRecord.value(id);
+    traceRecord.value(pname);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetQueryObjectuiv(id, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_BindBuffer(GLenum target, GLuint buffer) {
+    GlTraceRecord traceRecord(GlFunction::BindBuffer);
+    traceRecord.value(target);
+    traceRecord.value(buffer);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_BindBuffer(target, buffer);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_DeleteBuffers(GLsizei n, const GLuint * buffers) {
+    GlTraceRecord traceRecord(GlFunction::DeleteBuffers);
+    traceRecord.value(n);
+    traceRecord.names(n, buffers);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_DeleteBuffers(n, buffers);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GenBuffers(GLsizei n, GLuint * buffers) {
+    GlTraceRecord traceRecord(GlFunction::GenBuffers);
+    traceRecord.value(n);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GenBuffers(n, buffers);
+    traceRecord.names(n, buffers);
+    traceRecord.finish(traceStart);
+}
+
+inline GLboolean APIENTRY glTrace_IsBuffer(GLuint buffer) {
+    GlTraceRecord traceRecord(GlFunction::IsBuffer);
+    traceRecord.value(buffer);
+    uint64_t traceStart = GlTraceRecord::now();
+    GLboolean traceResult = glTraceReal_IsBuffer(buffer);
+    traceRecord.finish(traceStart);
+    return traceResult;
+}
+
+inline void APIENTRY glTrace_BufferData(GLenum target, GLsizeiptr size, const void * data, GLenum usage) {
+    GlTraceRecord traceRecord(GlFunction::BufferData);
+    traceRecord.value(target);
+    traceRecord.value(size);
+    traceRecord.bytes(data, data ? size : 0);
+    traceRecord.value(usage);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_BufferData(target, size, data, usage);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_BufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void * data) {
+    GlTraceRecord traceRecord(GlFunction::BufferSubData);
+    traceRecord.value(target);
+    traceRecord.value(offset);
+    traceRecord.value(size);
+    traceRecord.bytes(data, data ? size : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_BufferSubData(target, offset, size, data);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void * data) {
+    GlTraceRecord traceRecord(GlFunction::GetBufferSubData);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetBufferSubData(target, offset, size, data);
+    traceRecord.finish(traceStart);
+}
+
+inline void * APIENTRY glTrace_MapBuffer(GLenum target, GLenum access) {
+    GlTraceRecord traceRecord(GlFunction::MapBuffer);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    void * traceResult = glTraceReal_MapBuffer(target, access);
+    traceRecord.finish(traceStart);
+    return traceResult;
+}
+
+inline GLboolean APIENTRY glTrace_UnmapBuffer(GLenum target) {
+    GlTraceRecord traceRecord(GlFunction::UnmapBuffer);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    GLboolean traceResult = glTraceReal_UnmapBuffer(target);
+    traceRecord.finish(traceStart);
+    return traceResult;
+}
+
+inline void APIENTRY glTrace_GetBufferParameteriv(GLenum target, GLenum pname, GLint * params) {
+    GlTraceRecord traceRecord(GlFunction::GetBufferParameteriv);
+    traceRecord.value(target);
+    traceRecord.value(pname);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetBufferParameteriv(target, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetBufferPointerv(GLenum target, GLenum pname, void ** params) {
+    GlTraceRecord traceRecord(GlFunction::GetBufferPointerv);
+    traceRecord.value(target);
+    traceRecord.value(pname);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetBufferPointerv(target, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_BlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) {
+    GlTraceRecord traceRecord(GlFunction::BlendEquationSeparate);
+    traceRecord.value(modeRGB);
+    traceRecord.value(modeAlpha);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_BlendEquationSeparate(modeRGB, modeAlpha);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_DrawBuffers(GLsizei n, const GLenum * bufs) {
+    GlTraceRecord traceRecord(GlFunction::DrawBuffers);
+    traceRecord.value(n);
+    traceRecord.bytes(bufs, bufs ? n * sizeof(GLenum) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_DrawBuffers(n, bufs);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_StencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) {
+    GlTraceRecord traceRecord(GlFunction::StencilOpSeparate);
+    traceRecord.value(face);
+    traceRecord.value(sfail);
+    traceRecord.value(dpfail);
+    traceRecord.value(dppass);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_StencilOpSeparate(face, sfail, dpfail, dppass);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_StencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) {
+    GlTraceRecord traceRecord(GlFunction::StencilFuncSeparate);
+    traceRecord.value(face);
+    traceRecord.value(func);
+    traceRecord.value(ref);
+    traceRecord.value(mask);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_StencilFuncSeparate(face, func, ref, mask);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_StencilMaskSeparate(GLenum face, GLuint mask) {
+    GlTraceRecord traceRecord(GlFunction::StencilMaskSeparate);
+    traceRecord.value(face);
+    traceRecord.value(mask);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_StencilMaskSeparate(face, mask);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_AttachShader(GLuint program, GLuint shader) {
+    GlTraceRecord traceRecord(GlFunction::AttachShader);
+    traceRecord.value(program);
+    traceRecord.value(shader);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_AttachShader(program, shader);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_BindAttribLocation(GLuint program, GLuint index, const GLchar * name) {
+    GlTraceRecord traceRecord(GlFunction::BindAttribLocation);
+    traceRecord.value(program);
+    traceRecord.value(index);
+    traceRecord.string(name);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_BindAttribLocation(program, index, name);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_CompileShader(GLuint shader) {
+    GlTraceRecord traceRecord(GlFunction::CompileShader);
+    traceRecord.value(shader);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_CompileShader(shader);
+    traceRecord.finish(traceStart);
+}
+
+inline GLuint APIENTRY glTrace_CreateProgram() {
+    GlTraceRecord traceRecord(GlFunction::CreateProgram);
+    uint64_t traceStart = GlTraceRecord::now();
+    GLuint traceResult = glTraceReal_CreateProgram();
+    traceRecord.value(traceResult);
+    traceRecord.finish(traceStart);
+    return traceResult;
+}
+
+inline GLuint APIENTRY glTrace_CreateShader(GLenum type) {
+    GlTraceRecord traceRecord(GlFunction::CreateShader);
+    traceRecord.value(type);
+    uint64_t traceStart = GlTraceRecord::now();
+    GLuint traceResult = glTraceReal_CreateShader(type);
+    traceRecord.value(traceResult);
+    traceRecord.finish(traceStart);
+    return traceResult;
+}
+
+inline void APIENTRY glTrace_DeleteProgram(GLuint program) {
+    GlTraceRecord traceRecord(GlFunction::DeleteProgram);
+    traceRecord.value(program);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_DeleteProgram(program);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_DeleteShader(GLuint shader) {
+    GlTraceRecord traceRecord(GlFunction::DeleteShader);
+    traceRecord.value(shader);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_DeleteShader(shader);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_DetachShader(GLuint program, GLuint shader) {
+    GlTraceRecord traceRecord(GlFunction::DetachShader);
+    traceRecord.value(program);
+    traceRecord.value(shader);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_DetachShader(program, shader);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_DisableVertexAttribArray(GLuint index) {
+    GlTraceRecord traceRecord(GlFunction::DisableVertexAttribArray);
+    traceRecord.value(index);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_DisableVertexAttribArray(index);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_EnableVertexAttribArray(GLuint index) {
+    GlTraceRecord traceRecord(GlFunction::EnableVertexAttribArray);
+    traceRecord.value(index);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_EnableVertexAttribArray(index);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLint * size, GLenum * type, GLchar * name) {
+    GlTraceRecord traceRecord(GlFunction::GetActiveAttrib);
+    traceRecord.value(program);
+    traceRecord.value(index);
+    traceRecord.value(bufSize);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetActiveAttrib(program, index, bufSize, length, size, type, name);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLint * size, GLenum * type, GLchar * name) {
+    GlTraceRecord traceRecord(GlFunction::GetActiveUniform);
+    traceRecord.value(program);
+    traceRecord.value(index);
+    traceRecord.value(bufSize);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetActiveUniform(program, index, bufSize, length, size, type, name);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei * count, GLuint * shaders) {
+    GlTraceRecord traceRecord(GlFunction::GetAttachedShaders);
+    traceRecord.value(program);
+    traceRecord.value(maxCount);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetAttachedShaders(program, maxCount, count, shaders);
+    traceRecord.finish(traceStart);
+}
+
+inline GLint APIENTRY glTrace_GetAttribLocation(GLuint program, const GLchar * name) {
+    GlTraceRecord traceRecord(GlFunction::GetAttribLocation);
+    traceRecord.value(program);
+    traceRecord.string(name);
+    uint64_t traceStart = GlTraceRecord::now();
+    GLint traceResult = glTraceReal_GetAttribLocation(program, name);
+    traceRecord.finish(traceStart);
+    return traceResult;
+}
+
+inline void APIENTRY glTrace_GetProgramiv(GLuint program, GLenum pname, GLint * params) {
+    GlTraceRecord traceRecord(GlFunction::GetProgramiv);
+    traceRecord.value(program);
+    traceRecord.value(pname);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetProgramiv(program, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei * length, GLchar * infoLog) {
+    GlTraceRecord traceRecord(GlFunction::GetProgramInfoLog);
+    traceRecord.value(program);
+    traceRecord.value(bufSize);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetProgramInfoLog(program, bufSize, length, infoLog);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetShaderiv(GLuint shader, GLenum pname, GLint * params) {
+    GlTraceRecord traceRecord(GlFunction::GetShaderiv);
+    traceRecord.value(shader);
+    traceRecord.value(pname);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetShaderiv(shader, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei * length, GLchar * infoLog) {
+    GlTraceRecord traceRecord(GlFunction::GetShaderInfoLog);
+    traceRecord.value(shader);
+    traceRecord.value(bufSize);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetShaderInfoLog(shader, bufSize, length, infoLog);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetShaderSource(GLuint shader, GLsizei bufSize, GLsizei * length, GLchar * source) {
+    GlTraceRecord traceRecord(GlFunction::GetShaderSource);
+    traceRecord.value(shader);
+    traceRecord.value(bufSize);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetShaderSource(shader, bufSize, length, source);
+    traceRecord.finish(traceStart);
+}
+
+inline GLint APIENTRY glTrace_GetUniformLocation(GLuint program, const GLchar * name) {
+    GlTraceRecord traceRecord(GlFunction::GetUniformLocation);
+    traceRecord.value(program);
+    traceRecord.string(name);
+    uint64_t traceStart = GlTraceRecord::now();
+    GLint traceResult = glTraceReal_GetUniformLocation(program, name);
+    traceRecord.finish(traceStart);
+    return traceResult;
+}
+
+inline void APIENTRY glTrace_GetUniformfv(GLuint program, GLint location, GLfloat * params) {
+    GlTraceRecord traceRecord(GlFunction::GetUniformfv);
+    traceRecord.value(program);
+    traceRecord.value(location);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetUniformfv(program, location, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetUniformiv(GLuint program, GLint location, GLint * params) {
+    GlTraceRecord traceRecord(GlFunction::GetUniformiv);
+    traceRecord.value(program);
+    traceRecord.value(location);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetUniformiv(program, location, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetVertexAttribdv(GLuint index, GLenum pname, GLdouble * params) {
+    GlTraceRecord traceRecord(GlFunction::GetVertexAttribdv);
+    traceRecord.value(index);
+    traceRecord.value(pname);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetVertexAttribdv(index, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetVertexAttribfv(GLuint index, GLenum pname, GLfloat * params) {
+    GlTraceRecord traceRecord(GlFunction::GetVertexAttribfv);
+    traceRecord.value(index);
+    traceRecord.value(pname);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetVertexAttribfv(index, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetVertexAttribiv(GLuint index, GLenum pname, GLint * params) {
+    GlTraceRecord traceRecord(GlFunction::GetVertexAttribiv);
+    traceRecord.value(index);
+    traceRecord.value(pname);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetVertexAttribiv(index, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetVertexAttribPointerv(GLuint index, GLenum pname, void ** pointer) {
+    GlTraceRecord traceRecord(GlFunction::GetVertexAttribPointerv);
+    traceRecord.value(index);
+    traceRecord.value(pname);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetVertexAttribPointerv(index, pname, pointer);
+    traceRecord.finish(traceStart);
+}
+
+inline GLboolean APIENTRY glTrace_IsProgram(GLuint program) {
+    GlTraceRecord traceRecord(GlFunction::IsProgram);
+    traceRecord.value(program);
+    uint64_t traceStart = GlTraceRecord::now();
+    GLboolean traceResult = glTraceReal_IsProgram(program);
+    traceRecord.finish(traceStart);
+    return traceResult;
+}
+
+inline GLboolean APIENTRY glTrace_IsShader(GLuint shader) {
+    GlTraceRecord traceRecord(GlFunction::IsShader);
+    traceRecord.value(shader);
+    uint64_t traceStart = GlTraceRecord::now();
+    GLboolean traceResult = glTraceReal_IsShader(shader);
+    traceRecord.finish(traceStart);
+    return traceResult;
+}
+
+inline void APIENTRY glTrace_LinkProgram(GLuint program) {
+    GlTraceRecord traceRecord(GlFunction::LinkProgram);
+    traceRecord.value(program);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_LinkProgram(program);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_ShaderSource(GLuint shader, GLsizei count, const GLchar *const* string, const GLint * length) {
+    GlTraceRecord traceRecord(GlFunction::ShaderSource);
+    traceRecord.value(shader);
+    traceRecord.value(count);
+    traceRecord.shaderSource(count, string, length);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_ShaderSource(shader, count, string, length);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_UseProgram(GLuint program) {
+    GlTraceRecord traceRecord(GlFunction::UseProgram);
+    traceRecord.value(program);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_UseProgram(program);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Uniform1f(GLint location, GLfloat v0) {
+    GlTraceRecord traceRecord(GlFunction::Uniform1f);
+    traceRecord.value(location);
+    traceRecord.value(v0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Uniform1f(location, v0);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Uniform2f(GLint location, GLfloat v0, GLfloat v1) {
+    GlTraceRecord traceRecord(GlFunction::Uniform2f);
+    traceRecord.value(location);
+    traceRecord.value(v0);
+    traceRecord.value(v1);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Uniform2f(location, v0, v1);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Uniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+    GlTraceRecord traceRecord(GlFunction::Uniform3f);
+    traceRecord.value(location);
+    traceRecord.value(v0);
+    traceRecord.value(v1);
+    traceRecord.value(v2);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Uniform3f(location, v0, v1, v2);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Uniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+    GlTraceRecord traceRecord(GlFunction::Uniform4f);
+    traceRecord.value(location);
+    traceRecord.value(v0);
+    traceRecord.value(v1);
+    traceRecord.value(v2);
+    traceRecord.value(v3);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Uniform4f(location, v0, v1, v2, v3);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Uniform1i(GLint location, GLint v0) {
+    GlTraceRecord traceRecord(GlFunction::Uniform1i);
+    traceRecord.value(location);
+    traceRecord.value(v0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Uniform1i(location, v0);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Uniform2i(GLint location, GLint v0, GLint v1) {
+    GlTraceRecord traceRecord(GlFunction::Uniform2i);
+    traceRecord.value(location);
+    traceRecord.value(v0);
+    traceRecord.value(v1);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Uniform2i(location, v0, v1);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Uniform3i(GLint location, GLint v0, GLint v1, GLint v2) {
+    GlTraceRecord traceRecord(GlFunction::Uniform3i);
+    traceRecord.value(location);
+    traceRecord.value(v0);
+    traceRecord.value(v1);
+    traceRecord.value(v2);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Uniform3i(location, v0, v1, v2);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Uniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+    GlTraceRecord traceRecord(GlFunction::Uniform4i);
+    traceRecord.value(location);
+    traceRecord.value(v0);
+    traceRecord.value(v1);
+    traceRecord.value(v2);
+    traceRecord.value(v3);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Uniform4i(location, v0, v1, v2, v3);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Uniform1fv(GLint location, GLsizei count, const GLfloat * value) {
+    GlTraceRecord traceRecord(GlFunction::Uniform1fv);
+    traceRecord.value(location);
+    traceRecord.value(count);
+    traceRecord.bytes(value, value ? count * 1 * sizeof(GLfloat) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Uniform1fv(location, count, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Uniform2fv(GLint location, GLsizei count, const GLfloat * value) {
+    GlTraceRecord traceRecord(GlFunction::Uniform2fv);
+    traceRecord.value(location);
+    traceRecord.value(count);
+    traceRecord.bytes(value, value ? count * 2 * sizeof(GLfloat) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Uniform2fv(location, count, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Uniform3fv(GLint location, GLsizei count, const GLfloat * value) {
+    GlTraceRecord traceRecord(GlFunction::Uniform3fv);
+    traceRecord.value(location);
+    traceRecord.value(count);
+    traceRecord.bytes(value, value ? count * 3 * sizeof(GLfloat) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Uniform3fv(location, count, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Uniform4fv(GLint location, GLsizei count, const GLfloat * value) {
+    GlTraceRecord traceRecord(GlFunction::Uniform4fv);
+    traceRecord.value(location);
+    traceRecord.value(count);
+    traceRecord.bytes(value, value ? count * 4 * sizeof(GLfloat) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Uniform4fv(location, count, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Uniform1iv(GLint location, GLsizei count, const GLint * value) {
+    GlTraceRecord traceRecord(GlFunction::Uniform1iv);
+    traceRecord.value(location);
+    traceRecord.value(count);
+    traceRecord.bytes(value, value ? count * 1 * sizeof(GLint) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Uniform1iv(location, count, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Uniform2iv(GLint location, GLsizei count, const GLint * value) {
+    GlTraceRecord traceRecord(GlFunction::Uniform2iv);
+    traceRecord.value(location);
+    traceRecord.value(count);
+    traceRecord.bytes(value, value ? count * 2 * sizeof(GLint) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Uniform2iv(location, count, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Uniform3iv(GLint location, GLsizei count, const GLint * value) {
+    GlTraceRecord traceRecord(GlFunction::Uniform3iv);
+    traceRecord.value(location);
+    traceRecord.value(count);
+    traceRecord.bytes(value, value ? count * 3 * sizeof(GLint) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Uniform3iv(location, count, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Uniform4iv(GLint location, GLsizei count, const GLint * value) {
+    GlTraceRecord traceRecord(GlFunction::Uniform4iv);
+    traceRecord.value(location);
+    traceRecord.value(count);
+    traceRecord.bytes(value, value ? count * 4 * sizeof(GLint) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Uniform4iv(location, count, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_UniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    GlTraceRecord traceRecord(GlFunction::UniformMatrix2fv);
+    traceRecord.value(location);
+    traceRecord.value(count);
+    traceRecord.value(transpose);
+    traceRecord.bytes(value, value ? count * 4 * sizeof(GLfloat) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_UniformMatrix2fv(location, count, transpose, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_UniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    GlTraceRecord traceRecord(GlFunction::UniformMatrix3fv);
+    traceRecord.value(location);
+    traceRecord.value(count);
+    traceRecord.value(transpose);
+    traceRecord.bytes(value, value ? count * 9 * sizeof(GLfloat) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_UniformMatrix3fv(location, count, transpose, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_UniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    GlTraceRecord traceRecord(GlFunction::UniformMatrix4fv);
+    traceRecord.value(location);
+    traceRecord.value(count);
+    traceRecord.value(transpose);
+    traceRecord.bytes(value, value ? count * 16 * sizeof(GLfloat) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_UniformMatrix4fv(location, count, transpose, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_ValidateProgram(GLuint program) {
+    GlTraceRecord traceRecord(GlFunction::ValidateProgram);
+    traceRecord.value(program);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_ValidateProgram(program);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttrib1d(GLuint index, GLdouble x) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttrib1d);
+    traceRecord.value(index);
+    traceRecord.value(x);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttrib1d(index, x);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttrib1dv(GLuint index, const GLdouble * v) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttrib1dv);
+    traceRecord.value(index);
+    traceRecord.bytes(v, v ? 1 * sizeof(GLdouble) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttrib1dv(index, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttrib1f(GLuint index, GLfloat x) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttrib1f);
+    traceRecord.value(index);
+    traceRecord.value(x);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttrib1f(index, x);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttrib1fv(GLuint index, const GLfloat * v) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttrib1fv);
+    traceRecord.value(index);
+    traceRecord.bytes(v, v ? 1 * sizeof(GLfloat) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttrib1fv(index, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttrib1s(GLuint index, GLshort x) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttrib1s);
+    traceRecord.value(index);
+    traceRecord.value(x);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttrib1s(index, x);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttrib1sv(GLuint index, const GLshort * v) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttrib1sv);
+    traceRecord.value(index);
+    traceRecord.bytes(v, v ? 1 * sizeof(GLshort) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttrib1sv(index, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttrib2d(GLuint index, GLdouble x, GLdouble y) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttrib2d);
+    traceRecord.value(index);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttrib2d(index, x, y);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttrib2dv(GLuint index, const GLdouble * v) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttrib2dv);
+    traceRecord.value(index);
+    traceRecord.bytes(v, v ? 2 * sizeof(GLdouble) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttrib2dv(index, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttrib2f(GLuint index, GLfloat x, GLfloat y) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttrib2f);
+    traceRecord.value(index);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttrib2f(index, x, y);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttrib2fv(GLuint index, const GLfloat * v) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttrib2fv);
+    traceRecord.value(index);
+    traceRecord.bytes(v, v ? 2 * sizeof(GLfloat) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttrib2fv(index, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttrib2s(GLuint index, GLshort x, GLshort y) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttrib2s);
+    traceRecord.value(index);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttrib2s(index, x, y);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttrib2sv(GLuint index, const GLshort * v) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttrib2sv);
+    traceRecord.value(index);
+    traceRecord.bytes(v, v ? 2 * sizeof(GLshort) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttrib2sv(index, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttrib3d);
+    traceRecord.value(index);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    traceRecord.value(z);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttrib3d(index, x, y, z);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttrib3dv(GLuint index, const GLdouble * v) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttrib3dv);
+    traceRecord.value(index);
+    traceRecord.bytes(v, v ? 3 * sizeof(GLdouble) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttrib3dv(index, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttrib3f);
+    traceRecord.value(index);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    traceRecord.value(z);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttrib3f(index, x, y, z);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttrib3fv(GLuint index, const GLfloat * v) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttrib3fv);
+    traceRecord.value(index);
+    traceRecord.bytes(v, v ? 3 * sizeof(GLfloat) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttrib3fv(index, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttrib3s);
+    traceRecord.value(index);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    traceRecord.value(z);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttrib3s(index, x, y, z);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttrib3sv(GLuint index, const GLshort * v) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttrib3sv);
+    traceRecord.value(index);
+    traceRecord.bytes(v, v ? 3 * sizeof(GLshort) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttrib3sv(index, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttrib4Nbv(GLuint index, const GLbyte * v) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttrib4Nbv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttrib4Nbv(index, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttrib4Niv(GLuint index, const GLint * v) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttrib4Niv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttrib4Niv(index, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttrib4Nsv(GLuint index, const GLshort * v) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttrib4Nsv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttrib4Nsv(index, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttrib4Nub);
+    traceRecord.value(index);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    traceRecord.value(z);
+    traceRecord.value(w);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttrib4Nub(index, x, y, z, w);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttrib4Nubv(GLuint index, const GLubyte * v) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttrib4Nubv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttrib4Nubv(index, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttrib4Nuiv(GLuint index, const GLuint * v) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttrib4Nuiv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttrib4Nuiv(index, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttrib4Nusv(GLuint index, const GLushort * v) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttrib4Nusv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttrib4Nusv(index, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttrib4bv(GLuint index, const GLbyte * v) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttrib4bv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttrib4bv(index, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttrib4d);
+    traceRecord.value(index);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    traceRecord.value(z);
+    traceRecord.value(w);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttrib4d(index, x, y, z, w);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttrib4dv(GLuint index, const GLdouble * v) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttrib4dv);
+    traceRecord.value(index);
+    traceRecord.bytes(v, v ? 4 * sizeof(GLdouble) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttrib4dv(index, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttrib4f);
+    traceRecord.value(index);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    traceRecord.value(z);
+    traceRecord.value(w);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttrib4f(index, x, y, z, w);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttrib4fv(GLuint index, const GLfloat * v) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttrib4fv);
+    traceRecord.value(index);
+    traceRecord.bytes(v, v ? 4 * sizeof(GLfloat) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttrib4fv(index, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttrib4iv(GLuint index, const GLint * v) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttrib4iv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttrib4iv(index, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttrib4s);
+    traceRecord.value(index);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    traceRecord.value(z);
+    traceRecord.value(w);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttrib4s(index, x, y, z, w);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttrib4sv(GLuint index, const GLshort * v) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttrib4sv);
+    traceRecord.value(index);
+    traceRecord.bytes(v, v ? 4 * sizeof(GLshort) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttrib4sv(index, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttrib4ubv(GLuint index, const GLubyte * v) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttrib4ubv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttrib4ubv(index, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttrib4uiv(GLuint index, const GLuint * v) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttrib4uiv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttrib4uiv(index, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttrib4usv(GLuint index, const GLushort * v) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttrib4usv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttrib4usv(index, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void * pointer) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttribPointer);
+    traceRecord.value(index);
+    traceRecord.value(size);
+    traceRecord.value(type);
+    traceRecord.value(normalized);
+    traceRecord.value(stride);
+    traceRecord.offset(pointer);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttribPointer(index, size, type, normalized, stride, pointer);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_UniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    GlTraceRecord traceRecord(GlFunction::UniformMatrix2x3fv);
+    traceRecord.value(location);
+    traceRecord.value(count);
+    traceRecord.value(transpose);
+    traceRecord.bytes(value, value ? count * 6 * sizeof(GLfloat) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_UniformMatrix2x3fv(location, count, transpose, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_UniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    GlTraceRecord traceRecord(GlFunction::UniformMatrix3x2fv);
+    traceRecord.value(location);
+    traceRecord.value(count);
+    traceRecord.value(transpose);
+    traceRecord.bytes(value, value ? count * 6 * sizeof(GLfloat) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_UniformMatrix3x2fv(location, count, transpose, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_UniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    GlTraceRecord traceRecord(GlFunction::UniformMatrix2x4fv);
+    traceRecord.value(location);
+    traceRecord.value(count);
+    traceRecord.value(transpose);
+    traceRecord.bytes(value, value ? count * 8 * sizeof(GLfloat) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_UniformMatrix2x4fv(location, count, transpose, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_UniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    GlTraceRecord traceRecord(GlFunction::UniformMatrix4x2fv);
+    traceRecord.value(location);
+    traceRecord.value(count);
+    traceRecord.value(transpose);
+    traceRecord.bytes(value, value ? count * 8 * sizeof(GLfloat) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_UniformMatrix4x2fv(location, count, transpose, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_UniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    GlTraceRecord traceRecord(GlFunction::UniformMatrix3x4fv);
+    traceRecord.value(location);
+    traceRecord.value(count);
+    traceRecord.value(transpose);
+    traceRecord.bytes(value, value ? count * 12 * sizeof(GLfloat) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_UniformMatrix3x4fv(location, count, transpose, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_UniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value) {
+    GlTraceRecord traceRecord(GlFunction::UniformMatrix4x3fv);
+    traceRecord.value(location);
+    traceRecord.value(count);
+    traceRecord.value(transpose);
+    traceRecord.bytes(value, value ? count * 12 * sizeof(GLfloat) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_UniformMatrix4x3fv(location, count, transpose, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_ColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+    GlTraceRecord traceRecord(GlFunction::ColorMaski);
+    traceRecord.value(index);
+    traceRecord.value(r);
+    traceRecord.value(g);
+    traceRecord.value(b);
+    traceRecord.value(a);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_ColorMaski(index, r, g, b, a);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetBooleani_v(GLenum target, GLuint index, GLboolean * data) {
+    GlTraceRecord traceRecord(GlFunction::GetBooleani_v);
+    traceRecord.value(target);
+    traceRecord.value(index);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetBooleani_v(target, index, data);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetIntegeri_v(GLenum target, GLuint index, GLint * data) {
+    GlTraceRecord traceRecord(GlFunction::GetIntegeri_v);
+    traceRecord.value(target);
+    traceRecord.value(index);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetIntegeri_v(target, index, data);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Enablei(GLenum target, GLuint index) {
+    GlTraceRecord traceRecord(GlFunction::Enablei);
+    traceRecord.value(target);
+    traceRecord.value(index);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Enablei(target, index);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Disablei(GLenum target, GLuint index) {
+    GlTraceRecord traceRecord(GlFunction::Disablei);
+    traceRecord.value(target);
+    traceRecord.value(index);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Disablei(target, index);
+    traceRecord.finish(traceStart);
+}
+
+inline GLboolean APIENTRY glTrace_IsEnabledi(GLenum target, GLuint index) {
+    GlTraceRecord traceRecord(GlFunction::IsEnabledi);
+    traceRecord.value(target);
+    traceRecord.value(index);
+    uint64_t traceStart = GlTraceRecord::now();
+    GLboolean traceResult = glTraceReal_IsEnabledi(target, index);
+    traceRecord.finish(traceStart);
+    return traceResult;
+}
+
+inline void APIENTRY glTrace_BeginTransformFeedback(GLenum primitiveMode) {
+    GlTraceRecord traceRecord(GlFunction::BeginTransformFeedback);
+    traceRecord.value(primitiveMode);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_BeginTransformFeedback(primitiveMode);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_EndTransformFeedback() {
+    GlTraceRecord traceRecord(GlFunction::EndTransformFeedback);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_EndTransformFeedback();
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_BindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    GlTraceRecord traceRecord(GlFunction::BindBufferRange);
+    traceRecord.value(target);
+    traceRecord.value(index);
+    traceRecord.value(buffer);
+    traceRecord.value(offset);
+    traceRecord.value(size);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_BindBufferRange(target, index, buffer, offset, size);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_BindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+    GlTraceRecord traceRecord(GlFunction::BindBufferBase);
+    traceRecord.value(target);
+    traceRecord.value(index);
+    traceRecord.value(buffer);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_BindBufferBase(target, index, buffer);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const* varyings, GLenum bufferMode) {
+    GlTraceRecord traceRecord(GlFunction::TransformFeedbackVaryings);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TransformFeedbackVaryings(program, count, varyings, bufferMode);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLsizei * size, GLenum * type, GLchar * name) {
+    GlTraceRecord traceRecord(GlFunction::GetTransformFeedbackVarying);
+    traceRecord.value(program);
+    traceRecord.value(index);
+    traceRecord.value(bufSize);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_ClampColor(GLenum target, GLenum clamp) {
+    GlTraceRecord traceRecord(GlFunction::ClampColor);
+    traceRecord.value(target);
+    traceRecord.value(clamp);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_ClampColor(target, clamp);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_BeginConditionalRender(GLuint id, GLenum mode) {
+    GlTraceRecord traceRecord(GlFunction::BeginConditionalRender);
+    traceRecord.value(id);
+    traceRecord.value(mode);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_BeginConditionalRender(id, mode);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_EndConditionalRender() {
+    GlTraceRecord traceRecord(GlFunction::EndConditionalRender);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_EndConditionalRender();
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void * pointer) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttribIPointer);
+    traceRecord.value(index);
+    traceRecord.value(size);
+    traceRecord.value(type);
+    traceRecord.value(stride);
+    traceRecord.offset(pointer);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttribIPointer(index, size, type, stride, pointer);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetVertexAttribIiv(GLuint index, GLenum pname, GLint * params) {
+    GlTraceRecord traceRecord(GlFunction::GetVertexAttribIiv);
+    traceRecord.value(index);
+    traceRecord.value(pname);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetVertexAttribIiv(index, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetVertexAttribIuiv(GLuint index, GLenum pname, GLuint * params) {
+    GlTraceRecord traceRecord(GlFunction::GetVertexAttribIuiv);
+    traceRecord.value(index);
+    traceRecord.value(pname);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetVertexAttribIuiv(index, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttribI1i(GLuint index, GLint x) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttribI1i);
+    traceRecord.value(index);
+    traceRecord.value(x);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttribI1i(index, x);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttribI2i(GLuint index, GLint x, GLint y) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttribI2i);
+    traceRecord.value(index);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttribI2i(index, x, y);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttribI3i(GLuint index, GLint x, GLint y, GLint z) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttribI3i);
+    traceRecord.value(index);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    traceRecord.value(z);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttribI3i(index, x, y, z);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttribI4i);
+    traceRecord.value(index);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    traceRecord.value(z);
+    traceRecord.value(w);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttribI4i(index, x, y, z, w);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttribI1ui(GLuint index, GLuint x) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttribI1ui);
+    traceRecord.value(index);
+    traceRecord.value(x);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttribI1ui(index, x);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttribI2ui(GLuint index, GLuint x, GLuint y) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttribI2ui);
+    traceRecord.value(index);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttribI2ui(index, x, y);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttribI3ui);
+    traceRecord.value(index);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    traceRecord.value(z);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttribI3ui(index, x, y, z);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttribI4ui);
+    traceRecord.value(index);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    traceRecord.value(z);
+    traceRecord.value(w);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttribI4ui(index, x, y, z, w);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttribI1iv(GLuint index, const GLint * v) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttribI1iv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttribI1iv(index, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttribI2iv(GLuint index, const GLint * v) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttribI2iv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttribI2iv(index, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttribI3iv(GLuint index, const GLint * v) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttribI3iv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttribI3iv(index, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttribI4iv(GLuint index, const GLint * v) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttribI4iv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttribI4iv(index, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttribI1uiv(GLuint index, const GLuint * v) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttribI1uiv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttribI1uiv(index, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttribI2uiv(GLuint index, const GLuint * v) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttribI2uiv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttribI2uiv(index, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttribI3uiv(GLuint index, const GLuint * v) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttribI3uiv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttribI3uiv(index, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttribI4uiv(GLuint index, const GLuint * v) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttribI4uiv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttribI4uiv(index, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttribI4bv(GLuint index, const GLbyte * v) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttribI4bv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttribI4bv(index, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttribI4sv(GLuint index, const GLshort * v) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttribI4sv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttribI4sv(index, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttribI4ubv(GLuint index, const GLubyte * v) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttribI4ubv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttribI4ubv(index, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttribI4usv(GLuint index, const GLushort * v) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttribI4usv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttribI4usv(index, v);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetUniformuiv(GLuint program, GLint location, GLuint * params) {
+    GlTraceRecord traceRecord(GlFunction::GetUniformuiv);
+    traceRecord.value(program);
+    traceRecord.value(location);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetUniformuiv(program, location, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_BindFragDataLocation(GLuint program, GLuint color, const GLchar * name) {
+    GlTraceRecord traceRecord(GlFunction::BindFragDataLocation);
+    traceRecord.value(program);
+    traceRecord.value(color);
+    traceRecord.string(name);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_BindFragDataLocation(program, color, name);
+    traceRecord.finish(traceStart);
+}
+
+inline GLint APIENTRY glTrace_GetFragDataLocation(GLuint program, const GLchar * name) {
+    GlTraceRecord traceRecord(GlFunction::GetFragDataLocation);
+    traceRecord.value(program);
+    traceRecord.string(name);
+    uint64_t traceStart = GlTraceRecord::now();
+    GLint traceResult = glTraceReal_GetFragDataLocation(program, name);
+    traceRecord.finish(traceStart);
+    return traceResult;
+}
+
+inline void APIENTRY glTrace_Uniform1ui(GLint location, GLuint v0) {
+    GlTraceRecord traceRecord(GlFunction::Uniform1ui);
+    traceRecord.value(location);
+    traceRecord.value(v0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Uniform1ui(location, v0);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Uniform2ui(GLint location, GLuint v0, GLuint v1) {
+    GlTraceRecord traceRecord(GlFunction::Uniform2ui);
+    traceRecord.value(location);
+    traceRecord.value(v0);
+    traceRecord.value(v1);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Uniform2ui(location, v0, v1);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Uniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) {
+    GlTraceRecord traceRecord(GlFunction::Uniform3ui);
+    traceRecord.value(location);
+    traceRecord.value(v0);
+    traceRecord.value(v1);
+    traceRecord.value(v2);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Uniform3ui(location, v0, v1, v2);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Uniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+    GlTraceRecord traceRecord(GlFunction::Uniform4ui);
+    traceRecord.value(location);
+    traceRecord.value(v0);
+    traceRecord.value(v1);
+    traceRecord.value(v2);
+    traceRecord.value(v3);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Uniform4ui(location, v0, v1, v2, v3);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Uniform1uiv(GLint location, GLsizei count, const GLuint * value) {
+    GlTraceRecord traceRecord(GlFunction::Uniform1uiv);
+    traceRecord.value(location);
+    traceRecord.value(count);
+    traceRecord.bytes(value, value ? count * 1 * sizeof(GLuint) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Uniform1uiv(location, count, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Uniform2uiv(GLint location, GLsizei count, const GLuint * value) {
+    GlTraceRecord traceRecord(GlFunction::Uniform2uiv);
+    traceRecord.value(location);
+    traceRecord.value(count);
+    traceRecord.bytes(value, value ? count * 2 * sizeof(GLuint) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Uniform2uiv(location, count, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Uniform3uiv(GLint location, GLsizei count, const GLuint * value) {
+    GlTraceRecord traceRecord(GlFunction::Uniform3uiv);
+    traceRecord.value(location);
+    traceRecord.value(count);
+    traceRecord.bytes(value, value ? count * 3 * sizeof(GLuint) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Uniform3uiv(location, count, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Uniform4uiv(GLint location, GLsizei count, const GLuint * value) {
+    GlTraceRecord traceRecord(GlFunction::Uniform4uiv);
+    traceRecord.value(location);
+    traceRecord.value(count);
+    traceRecord.bytes(value, value ? count * 4 * sizeof(GLuint) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Uniform4uiv(location, count, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexParameterIiv(GLenum target, GLenum pname, const GLint * params) {
+    GlTraceRecord traceRecord(GlFunction::TexParameterIiv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexParameterIiv(target, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexParameterIuiv(GLenum target, GLenum pname, const GLuint * params) {
+    GlTraceRecord traceRecord(GlFunction::TexParameterIuiv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexParameterIuiv(target, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetTexParameterIiv(GLenum target, GLenum pname, GLint * params) {
+    GlTraceRecord traceRecord(GlFunction::GetTexParameterIiv);
+    traceRecord.value(target);
+    traceRecord.value(pname);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetTexParameterIiv(target, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetTexParameterIuiv(GLenum target, GLenum pname, GLuint * params) {
+    GlTraceRecord traceRecord(GlFunction::GetTexParameterIuiv);
+    traceRecord.value(target);
+    traceRecord.value(pname);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetTexParameterIuiv(target, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_ClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint * value) {
+    GlTraceRecord traceRecord(GlFunction::ClearBufferiv);
+    traceRecord.value(buffer);
+    traceRecord.value(drawbuffer);
+    traceRecord.bytes(value, value ? 4 * sizeof(GLint) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_ClearBufferiv(buffer, drawbuffer, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_ClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint * value) {
+    GlTraceRecord traceRecord(GlFunction::ClearBufferuiv);
+    traceRecord.value(buffer);
+    traceRecord.value(drawbuffer);
+    traceRecord.bytes(value, value ? 4 * sizeof(GLuint) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_ClearBufferuiv(buffer, drawbuffer, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_ClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat * value) {
+    GlTraceRecord traceRecord(GlFunction::ClearBufferfv);
+    traceRecord.value(buffer);
+    traceRecord.value(drawbuffer);
+    traceRecord.bytes(value, value ? 4 * sizeof(GLfloat) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_ClearBufferfv(buffer, drawbuffer, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_ClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+    GlTraceRecord traceRecord(GlFunction::ClearBufferfi);
+    traceRecord.value(buffer);
+    traceRecord.value(drawbuffer);
+    traceRecord.value(depth);
+    traceRecord.value(stencil);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_ClearBufferfi(buffer, drawbuffer, depth, stencil);
+    traceRecord.finish(traceStart);
+}
+
+inline const GLubyte * APIENTRY glTrace_GetStringi(GLenum name, GLuint index) {
+    GlTraceRecord traceRecord(GlFunction::GetStringi);
+    traceRecord.value(name);
+    traceRecord.value(index);
+    uint64_t traceStart = GlTraceRecord::now();
+    const GLubyte * traceResult = glTraceReal_GetStringi(name, index);
+    traceRecord.finish(traceStart);
+    return traceResult;
+}
+
+inline GLboolean APIENTRY glTrace_IsRenderbuffer(GLuint renderbuffer) {
+    GlTraceRecord traceRecord(GlFunction::IsRenderbuffer);
+    traceRecord.value(renderbuffer);
+    uint64_t traceStart = GlTraceRecord::now();
+    GLboolean traceResult = glTraceReal_IsRenderbuffer(renderbuffer);
+    traceRecord.finish(traceStart);
+    return traceResult;
+}
+
+inline void APIENTRY glTrace_BindRenderbuffer(GLenum target, GLuint renderbuffer) {
+    GlTraceRecord traceRecord(GlFunction::BindRenderbuffer);
+    traceRecord.value(target);
+    traceRecord.value(renderbuffer);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_BindRenderbuffer(target, renderbuffer);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_DeleteRenderbuffers(GLsizei n, const GLuint * renderbuffers) {
+    GlTraceRecord traceRecord(GlFunction::DeleteRenderbuffers);
+    traceRecord.value(n);
+    traceRecord.names(n, renderbuffers);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_DeleteRenderbuffers(n, renderbuffers);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GenRenderbuffers(GLsizei n, GLuint * renderbuffers) {
+    GlTraceRecord traceRecord(GlFunction::GenRenderbuffers);
+    traceRecord.value(n);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GenRenderbuffers(n, renderbuffers);
+    traceRecord.names(n, renderbuffers);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_RenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
+    GlTraceRecord traceRecord(GlFunction::RenderbufferStorage);
+    traceRecord.value(target);
+    traceRecord.value(internalformat);
+    traceRecord.value(width);
+    traceRecord.value(height);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_RenderbufferStorage(target, internalformat, width, height);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetRenderbufferParameteriv(GLenum target, GLenum pname, GLint * params) {
+    GlTraceRecord traceRecord(GlFunction::GetRenderbufferParameteriv);
+    traceRecord.value(target);
+    traceRecord.value(pname);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetRenderbufferParameteriv(target, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline GLboolean APIENTRY glTrace_IsFramebuffer(GLuint framebuffer) {
+    GlTraceRecord traceRecord(GlFunction::IsFramebuffer);
+    traceRecord.value(framebuffer);
+    uint64_t traceStart = GlTraceRecord::now();
+    GLboolean traceResult = glTraceReal_IsFramebuffer(framebuffer);
+    traceRecord.finish(traceStart);
+    return traceResult;
+}
+
+inline void APIENTRY glTrace_BindFramebuffer(GLenum target, GLuint framebuffer) {
+    GlTraceRecord traceRecord(GlFunction::BindFramebuffer);
+    traceRecord.value(target);
+    traceRecord.value(framebuffer);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_BindFramebuffer(target, framebuffer);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_DeleteFramebuffers(GLsizei n, const GLuint * framebuffers) {
+    GlTraceRecord traceRecord(GlFunction::DeleteFramebuffers);
+    traceRecord.value(n);
+    traceRecord.names(n, framebuffers);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_DeleteFramebuffers(n, framebuffers);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GenFramebuffers(GLsizei n, GLuint * framebuffers) {
+    GlTraceRecord traceRecord(GlFunction::GenFramebuffers);
+    traceRecord.value(n);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GenFramebuffers(n, framebuffers);
+    traceRecord.names(n, framebuffers);
+    traceRecord.finish(traceStart);
+}
+
+inline GLenum APIENTRY glTrace_CheckFramebufferStatus(GLenum target) {
+    GlTraceRecord traceRecord(GlFunction::CheckFramebufferStatus);
+    traceRecord.value(target);
+    uint64_t traceStart = GlTraceRecord::now();
+    GLenum traceResult = glTraceReal_CheckFramebufferStatus(target);
+    traceRecord.finish(traceStart);
+    return traceResult;
+}
+
+inline void APIENTRY glTrace_FramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+    GlTraceRecord traceRecord(GlFunction::FramebufferTexture1D);
+    traceRecord.value(target);
+    traceRecord.value(attachment);
+    traceRecord.value(textarget);
+    traceRecord.value(texture);
+    traceRecord.value(level);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_FramebufferTexture1D(target, attachment, textarget, texture, level);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_FramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+    GlTraceRecord traceRecord(GlFunction::FramebufferTexture2D);
+    traceRecord.value(target);
+    traceRecord.value(attachment);
+    traceRecord.value(textarget);
+    traceRecord.value(texture);
+    traceRecord.value(level);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_FramebufferTexture2D(target, attachment, textarget, texture, level);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_FramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) {
+    GlTraceRecord traceRecord(GlFunction::FramebufferTexture3D);
+    traceRecord.value(target);
+    traceRecord.value(attachment);
+    traceRecord.value(textarget);
+    traceRecord.value(texture);
+    traceRecord.value(level);
+    traceRecord.value(zoffset);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_FramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_FramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+    GlTraceRecord traceRecord(GlFunction::FramebufferRenderbuffer);
+    traceRecord.value(target);
+    traceRecord.value(attachment);
+    traceRecord.value(renderbuffertarget);
+    traceRecord.value(renderbuffer);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_FramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint * params) {
+    GlTraceRecord traceRecord(GlFunction::GetFramebufferAttachmentParameteriv);
+    traceRecord.value(target);
+    traceRecord.value(attachment);
+    traceRecord.value(pname);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetFramebufferAttachmentParameteriv(target, attachment, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GenerateMipmap(GLenum target) {
+    GlTraceRecord traceRecord(GlFunction::GenerateMipmap);
+    traceRecord.value(target);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GenerateMipmap(target);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_BlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+    GlTraceRecord traceRecord(GlFunction::BlitFramebuffer);
+    traceRecord.value(srcX0);
+    traceRecord.value(srcY0);
+    traceRecord.value(srcX1);
+    traceRecord.value(srcY1);
+    traceRecord.value(dstX0);
+    traceRecord.value(dstY0);
+    traceRecord.value(dstX1);
+    traceRecord.value(dstY1);
+    traceRecord.value(mask);
+    traceRecord.value(filter);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_BlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_RenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+    GlTraceRecord traceRecord(GlFunction::RenderbufferStorageMultisample);
+    traceRecord.value(target);
+    traceRecord.value(samples);
+    traceRecord.value(internalformat);
+    traceRecord.value(width);
+    traceRecord.value(height);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_RenderbufferStorageMultisample(target, samples, internalformat, width, height);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_FramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+    GlTraceRecord traceRecord(GlFunction::FramebufferTextureLayer);
+    traceRecord.value(target);
+    traceRecord.value(attachment);
+    traceRecord.value(texture);
+    traceRecord.value(level);
+    traceRecord.value(layer);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_FramebufferTextureLayer(target, attachment, texture, level, layer);
+    traceRecord.finish(traceStart);
+}
+
+inline void * APIENTRY glTrace_MapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+    GlTraceRecord traceRecord(GlFunction::MapBufferRange);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    void * traceResult = glTraceReal_MapBufferRange(target, offset, length, access);
+    traceRecord.finish(traceStart);
+    return traceResult;
+}
+
+inline void APIENTRY glTrace_FlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) {
+    GlTraceRecord traceRecord(GlFunction::FlushMappedBufferRange);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_FlushMappedBufferRange(target, offset, length);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_BindVertexArray(GLuint array) {
+    GlTraceRecord traceRecord(GlFunction::BindVertexArray);
+    traceRecord.value(array);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_BindVertexArray(array);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_DeleteVertexArrays(GLsizei n, const GLuint * arrays) {
+    GlTraceRecord traceRecord(GlFunction::DeleteVertexArrays);
+    traceRecord.value(n);
+    traceRecord.names(n, arrays);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_DeleteVertexArrays(n, arrays);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GenVertexArrays(GLsizei n, GLuint * arrays) {
+    GlTraceRecord traceRecord(GlFunction::GenVertexArrays);
+    traceRecord.value(n);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GenVertexArrays(n, arrays);
+    traceRecord.names(n, arrays);
+    traceRecord.finish(traceStart);
+}
+
+inline GLboolean APIENTRY glTrace_IsVertexArray(GLuint array) {
+    GlTraceRecord traceRecord(GlFunction::IsVertexArray);
+    traceRecord.value(array);
+    uint64_t traceStart = GlTraceRecord::now();
+    GLboolean traceResult = glTraceReal_IsVertexArray(array);
+    traceRecord.finish(traceStart);
+    return traceResult;
+}
+
+inline void APIENTRY glTrace_DrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) {
+    GlTraceRecord traceRecord(GlFunction::DrawArraysInstanced);
+    traceRecord.value(mode);
+    traceRecord.value(first);
+    traceRecord.value(count);
+    traceRecord.value(instancecount);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_DrawArraysInstanced(mode, first, count, instancecount);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_DrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void * indices, GLsizei instancecount) {
+    GlTraceRecord traceRecord(GlFunction::DrawElementsInstanced);
+    traceRecord.value(mode);
+    traceRecord.value(count);
+    traceRecord.value(type);
+    traceRecord.offset(indices);
+    traceRecord.value(instancecount);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_DrawElementsInstanced(mode, count, type, indices, instancecount);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexBuffer(GLenum target, GLenum internalformat, GLuint buffer) {
+    GlTraceRecord traceRecord(GlFunction::TexBuffer);
+    traceRecord.value(target);
+    traceRecord.value(internalformat);
+    traceRecord.value(buffer);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexBuffer(target, internalformat, buffer);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_PrimitiveRestartIndex(GLuint index) {
+    GlTraceRecord traceRecord(GlFunction::PrimitiveRestartIndex);
+    traceRecord.value(index);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_PrimitiveRestartIndex(index);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_CopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+    GlTraceRecord traceRecord(GlFunction::CopyBufferSubData);
+    traceRecord.value(readTarget);
+    traceRecord.value(writeTarget);
+    traceRecord.value(readOffset);
+    traceRecord.value(writeOffset);
+    traceRecord.value(size);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_CopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const* uniformNames, GLuint * uniformIndices) {
+    GlTraceRecord traceRecord(GlFunction::GetUniformIndices);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint * uniformIndices, GLenum pname, GLint * params) {
+    GlTraceRecord traceRecord(GlFunction::GetActiveUniformsiv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei * length, GLchar * uniformName) {
+    GlTraceRecord traceRecord(GlFunction::GetActiveUniformName);
+    traceRecord.value(program);
+    traceRecord.value(uniformIndex);
+    traceRecord.value(bufSize);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
+    traceRecord.finish(traceStart);
+}
+
+inline GLuint APIENTRY glTrace_GetUniformBlockIndex(GLuint program, const GLchar * uniformBlockName) {
+    GlTraceRecord traceRecord(GlFunction::GetUniformBlockIndex);
+    traceRecord.value(program);
+    traceRecord.string(uniformBlockName);
+    uint64_t traceStart = GlTraceRecord::now();
+    GLuint traceResult = glTraceReal_GetUniformBlockIndex(program, uniformBlockName);
+    traceRecord.finish(traceStart);
+    return traceResult;
+}
+
+inline void APIENTRY glTrace_GetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint * params) {
+    GlTraceRecord traceRecord(GlFunction::GetActiveUniformBlockiv);
+    traceRecord.value(program);
+    traceRecord.value(uniformBlockIndex);
+    traceRecord.value(pname);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei * length, GLchar * uniformBlockName) {
+    GlTraceRecord traceRecord(GlFunction::GetActiveUniformBlockName);
+    traceRecord.value(program);
+    traceRecord.value(uniformBlockIndex);
+    traceRecord.value(bufSize);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_UniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) {
+    GlTraceRecord traceRecord(GlFunction::UniformBlockBinding);
+    traceRecord.value(program);
+    traceRecord.value(uniformBlockIndex);
+    traceRecord.value(uniformBlockBinding);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_UniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_DrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void * indices, GLint basevertex) {
+    GlTraceRecord traceRecord(GlFunction::DrawElementsBaseVertex);
+    traceRecord.value(mode);
+    traceRecord.value(count);
+    traceRecord.value(type);
+    traceRecord.offset(indices);
+    traceRecord.value(basevertex);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_DrawElementsBaseVertex(mode, count, type, indices, basevertex);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_DrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void * indices, GLint basevertex) {
+    GlTraceRecord traceRecord(GlFunction::DrawRangeElementsBaseVertex);
+    traceRecord.value(mode);
+    traceRecord.value(start);
+    traceRecord.value(end);
+    traceRecord.value(count);
+    traceRecord.value(type);
+    traceRecord.offset(indices);
+    traceRecord.value(basevertex);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_DrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_DrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void * indices, GLsizei instancecount, GLint basevertex) {
+    GlTraceRecord traceRecord(GlFunction::DrawElementsInstancedBaseVertex);
+    traceRecord.value(mode);
+    traceRecord.value(count);
+    traceRecord.value(type);
+    traceRecord.offset(indices);
+    traceRecord.value(instancecount);
+    traceRecord.value(basevertex);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_DrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MultiDrawElementsBaseVertex(GLenum mode, const GLsizei * count, GLenum type, const void *const* indices, GLsizei drawcount, const GLint * basevertex) {
+    GlTraceRecord traceRecord(GlFunction::MultiDrawElementsBaseVertex);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_ProvokingVertex(GLenum mode) {
+    GlTraceRecord traceRecord(GlFunction::ProvokingVertex);
+    traceRecord.value(mode);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_ProvokingVertex(mode);
+    traceRecord.finish(traceStart);
+}
+
+inline GLsync APIENTRY glTrace_FenceSync(GLenum condition, GLbitfield flags) {
+    GlTraceRecord traceRecord(GlFunction::FenceSync);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    GLsync traceResult = glTraceReal_FenceSync(condition, flags);
+    traceRecord.finish(traceStart);
+    return traceResult;
+}
+
+inline GLboolean APIENTRY glTrace_IsSync(GLsync sync) {
+    GlTraceRecord traceRecord(GlFunction::IsSync);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    GLboolean traceResult = glTraceReal_IsSync(sync);
+    traceRecord.finish(traceStart);
+    return traceResult;
+}
+
+inline void APIENTRY glTrace_DeleteSync(GLsync sync) {
+    GlTraceRecord traceRecord(GlFunction::DeleteSync);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_DeleteSync(sync);
+    traceRecord.finish(traceStart);
+}
+
+inline GLenum APIENTRY glTrace_ClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+    GlTraceRecord traceRecord(GlFunction::ClientWaitSync);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    GLenum traceResult = glTraceReal_ClientWaitSync(sync, flags, timeout);
+    traceRecord.finish(traceStart);
+    return traceResult;
+}
+
+inline void APIENTRY glTrace_WaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+    GlTraceRecord traceRecord(GlFunction::WaitSync);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_WaitSync(sync, flags, timeout);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetInteger64v(GLenum pname, GLint64 * data) {
+    GlTraceRecord traceRecord(GlFunction::GetInteger64v);
+    traceRecord.value(pname);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetInteger64v(pname, data);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetSynciv(GLsync sync, GLenum pname, GLsizei count, GLsizei * length, GLint * values) {
+    GlTraceRecord traceRecord(GlFunction::GetSynciv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetSynciv(sync, pname, count, length, values);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetInteger64i_v(GLenum target, GLuint index, GLint64 * data) {
+    GlTraceRecord traceRecord(GlFunction::GetInteger64i_v);
+    traceRecord.value(target);
+    traceRecord.value(index);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetInteger64i_v(target, index, data);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetBufferParameteri64v(GLenum target, GLenum pname, GLint64 * params) {
+    GlTraceRecord traceRecord(GlFunction::GetBufferParameteri64v);
+    traceRecord.value(target);
+    traceRecord.value(pname);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetBufferParameteri64v(target, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_FramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) {
+    GlTraceRecord traceRecord(GlFunction::FramebufferTexture);
+    traceRecord.value(target);
+    traceRecord.value(attachment);
+    traceRecord.value(texture);
+    traceRecord.value(level);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_FramebufferTexture(target, attachment, texture, level);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+    GlTraceRecord traceRecord(GlFunction::TexImage2DMultisample);
+    traceRecord.value(target);
+    traceRecord.value(samples);
+    traceRecord.value(internalformat);
+    traceRecord.value(width);
+    traceRecord.value(height);
+    traceRecord.value(fixedsamplelocations);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+    GlTraceRecord traceRecord(GlFunction::TexImage3DMultisample);
+    traceRecord.value(target);
+    traceRecord.value(samples);
+    traceRecord.value(internalformat);
+    traceRecord.value(width);
+    traceRecord.value(height);
+    traceRecord.value(depth);
+    traceRecord.value(fixedsamplelocations);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetMultisamplefv(GLenum pname, GLuint index, GLfloat * val) {
+    GlTraceRecord traceRecord(GlFunction::GetMultisamplefv);
+    traceRecord.value(pname);
+    traceRecord.value(index);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetMultisamplefv(pname, index, val);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_SampleMaski(GLuint maskNumber, GLbitfield mask) {
+    GlTraceRecord traceRecord(GlFunction::SampleMaski);
+    traceRecord.value(maskNumber);
+    traceRecord.value(mask);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_SampleMaski(maskNumber, mask);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_BindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar * name) {
+    GlTraceRecord traceRecord(GlFunction::BindFragDataLocationIndexed);
+    traceRecord.value(program);
+    traceRecord.value(colorNumber);
+    traceRecord.value(index);
+    traceRecord.string(name);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_BindFragDataLocationIndexed(program, colorNumber, index, name);
+    traceRecord.finish(traceStart);
+}
+
+inline GLint APIENTRY glTrace_GetFragDataIndex(GLuint program, const GLchar * name) {
+    GlTraceRecord traceRecord(GlFunction::GetFragDataIndex);
+    traceRecord.value(program);
+    traceRecord.string(name);
+    uint64_t traceStart = GlTraceRecord::now();
+    GLint traceResult = glTraceReal_GetFragDataIndex(program, name);
+    traceRecord.finish(traceStart);
+    return traceResult;
+}
+
+inline void APIENTRY glTrace_GenSamplers(GLsizei count, GLuint * samplers) {
+    GlTraceRecord traceRecord(GlFunction::GenSamplers);
+    traceRecord.value(count);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GenSamplers(count, samplers);
+    traceRecord.names(count, samplers);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_DeleteSamplers(GLsizei count, const GLuint * samplers) {
+    GlTraceRecord traceRecord(GlFunction::DeleteSamplers);
+    traceRecord.value(count);
+    traceRecord.names(count, samplers);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_DeleteSamplers(count, samplers);
+    traceRecord.finish(traceStart);
+}
+
+inline GLboolean APIENTRY glTrace_IsSampler(GLuint sampler) {
+    GlTraceRecord traceRecord(GlFunction::IsSampler);
+    traceRecord.value(sampler);
+    uint64_t traceStart = GlTraceRecord::now();
+    GLboolean traceResult = glTraceReal_IsSampler(sampler);
+    traceRecord.finish(traceStart);
+    return traceResult;
+}
+
+inline void APIENTRY glTrace_BindSampler(GLuint unit, GLuint sampler) {
+    GlTraceRecord traceRecord(GlFunction::BindSampler);
+    traceRecord.value(unit);
+    traceRecord.value(sampler);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_BindSampler(unit, sampler);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_SamplerParameteri(GLuint sampler, GLenum pname, GLint param) {
+    GlTraceRecord traceRecord(GlFunction::SamplerParameteri);
+    traceRecord.value(sampler);
+    traceRecord.value(pname);
+    traceRecord.value(param);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_SamplerParameteri(sampler, pname, param);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_SamplerParameteriv(GLuint sampler, GLenum pname, const GLint * param) {
+    GlTraceRecord traceRecord(GlFunction::SamplerParameteriv);
+    traceRecord.value(sampler);
+    traceRecord.value(pname);
+    traceRecord.bytes(param, param ? 4 * sizeof(GLint) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_SamplerParameteriv(sampler, pname, param);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_SamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) {
+    GlTraceRecord traceRecord(GlFunction::SamplerParameterf);
+    traceRecord.value(sampler);
+    traceRecord.value(pname);
+    traceRecord.value(param);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_SamplerParameterf(sampler, pname, param);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_SamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat * param) {
+    GlTraceRecord traceRecord(GlFunction::SamplerParameterfv);
+    traceRecord.value(sampler);
+    traceRecord.value(pname);
+    traceRecord.bytes(param, param ? 4 * sizeof(GLfloat) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_SamplerParameterfv(sampler, pname, param);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_SamplerParameterIiv(GLuint sampler, GLenum pname, const GLint * param) {
+    GlTraceRecord traceRecord(GlFunction::SamplerParameterIiv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_SamplerParameterIiv(sampler, pname, param);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_SamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint * param) {
+    GlTraceRecord traceRecord(GlFunction::SamplerParameterIuiv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_SamplerParameterIuiv(sampler, pname, param);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetSamplerParameteriv(GLuint sampler, GLenum pname, GLint * params) {
+    GlTraceRecord traceRecord(GlFunction::GetSamplerParameteriv);
+    traceRecord.value(sampler);
+    traceRecord.value(pname);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetSamplerParameteriv(sampler, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint * params) {
+    GlTraceRecord traceRecord(GlFunction::GetSamplerParameterIiv);
+    traceRecord.value(sampler);
+    traceRecord.value(pname);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetSamplerParameterIiv(sampler, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat * params) {
+    GlTraceRecord traceRecord(GlFunction::GetSamplerParameterfv);
+    traceRecord.value(sampler);
+    traceRecord.value(pname);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetSamplerParameterfv(sampler, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint * params) {
+    GlTraceRecord traceRecord(GlFunction::GetSamplerParameterIuiv);
+    traceRecord.value(sampler);
+    traceRecord.value(pname);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetSamplerParameterIuiv(sampler, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_QueryCounter(GLuint id, GLenum target) {
+    GlTraceRecord traceRecord(GlFunction::QueryCounter);
+    traceRecord.value(id);
+    traceRecord.value(target);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_QueryCounter(id, target);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetQueryObjecti64v(GLuint id, GLenum pname, GLint64 * params) {
+    GlTraceRecord traceRecord(GlFunction::GetQueryObjecti64v);
+    traceRecord.value(id);
+    traceRecord.value(pname);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetQueryObjecti64v(id, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 * params) {
+    GlTraceRecord traceRecord(GlFunction::GetQueryObjectui64v);
+    traceRecord.value(id);
+    traceRecord.value(pname);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetQueryObjectui64v(id, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttribDivisor(GLuint index, GLuint divisor) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttribDivisor);
+    traceRecord.value(index);
+    traceRecord.value(divisor);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttribDivisor(index, divisor);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttribP1ui);
+    traceRecord.value(index);
+    traceRecord.value(type);
+    traceRecord.value(normalized);
+    traceRecord.value(value);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttribP1ui(index, type, normalized, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint * value) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttribP1uiv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttribP1uiv(index, type, normalized, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttribP2ui);
+    traceRecord.value(index);
+    traceRecord.value(type);
+    traceRecord.value(normalized);
+    traceRecord.value(value);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttribP2ui(index, type, normalized, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint * value) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttribP2uiv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttribP2uiv(index, type, normalized, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttribP3ui);
+    traceRecord.value(index);
+    traceRecord.value(type);
+    traceRecord.value(normalized);
+    traceRecord.value(value);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttribP3ui(index, type, normalized, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint * value) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttribP3uiv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttribP3uiv(index, type, normalized, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttribP4ui);
+    traceRecord.value(index);
+    traceRecord.value(type);
+    traceRecord.value(normalized);
+    traceRecord.value(value);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttribP4ui(index, type, normalized, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint * value) {
+    GlTraceRecord traceRecord(GlFunction::VertexAttribP4uiv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexAttribP4uiv(index, type, normalized, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexP2ui(GLenum type, GLuint value) {
+    GlTraceRecord traceRecord(GlFunction::VertexP2ui);
+    traceRecord.value(type);
+    traceRecord.value(value);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexP2ui(type, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexP2uiv(GLenum type, const GLuint * value) {
+    GlTraceRecord traceRecord(GlFunction::VertexP2uiv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexP2uiv(type, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexP3ui(GLenum type, GLuint value) {
+    GlTraceRecord traceRecord(GlFunction::VertexP3ui);
+    traceRecord.value(type);
+    traceRecord.value(value);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexP3ui(type, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexP3uiv(GLenum type, const GLuint * value) {
+    GlTraceRecord traceRecord(GlFunction::VertexP3uiv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexP3uiv(type, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexP4ui(GLenum type, GLuint value) {
+    GlTraceRecord traceRecord(GlFunction::VertexP4ui);
+    traceRecord.value(type);
+    traceRecord.value(value);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexP4ui(type, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_VertexP4uiv(GLenum type, const GLuint * value) {
+    GlTraceRecord traceRecord(GlFunction::VertexP4uiv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_VertexP4uiv(type, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexCoordP1ui(GLenum type, GLuint coords) {
+    GlTraceRecord traceRecord(GlFunction::TexCoordP1ui);
+    traceRecord.value(type);
+    traceRecord.value(coords);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexCoordP1ui(type, coords);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexCoordP1uiv(GLenum type, const GLuint * coords) {
+    GlTraceRecord traceRecord(GlFunction::TexCoordP1uiv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexCoordP1uiv(type, coords);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexCoordP2ui(GLenum type, GLuint coords) {
+    GlTraceRecord traceRecord(GlFunction::TexCoordP2ui);
+    traceRecord.value(type);
+    traceRecord.value(coords);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexCoordP2ui(type, coords);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexCoordP2uiv(GLenum type, const GLuint * coords) {
+    GlTraceRecord traceRecord(GlFunction::TexCoordP2uiv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexCoordP2uiv(type, coords);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexCoordP3ui(GLenum type, GLuint coords) {
+    GlTraceRecord traceRecord(GlFunction::TexCoordP3ui);
+    traceRecord.value(type);
+    traceRecord.value(coords);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexCoordP3ui(type, coords);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexCoordP3uiv(GLenum type, const GLuint * coords) {
+    GlTraceRecord traceRecord(GlFunction::TexCoordP3uiv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexCoordP3uiv(type, coords);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexCoordP4ui(GLenum type, GLuint coords) {
+    GlTraceRecord traceRecord(GlFunction::TexCoordP4ui);
+    traceRecord.value(type);
+    traceRecord.value(coords);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexCoordP4ui(type, coords);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_TexCoordP4uiv(GLenum type, const GLuint * coords) {
+    GlTraceRecord traceRecord(GlFunction::TexCoordP4uiv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_TexCoordP4uiv(type, coords);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords) {
+    GlTraceRecord traceRecord(GlFunction::MultiTexCoordP1ui);
+    traceRecord.value(texture);
+    traceRecord.value(type);
+    traceRecord.value(coords);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MultiTexCoordP1ui(texture, type, coords);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint * coords) {
+    GlTraceRecord traceRecord(GlFunction::MultiTexCoordP1uiv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MultiTexCoordP1uiv(texture, type, coords);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords) {
+    GlTraceRecord traceRecord(GlFunction::MultiTexCoordP2ui);
+    traceRecord.value(texture);
+    traceRecord.value(type);
+    traceRecord.value(coords);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MultiTexCoordP2ui(texture, type, coords);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint * coords) {
+    GlTraceRecord traceRecord(GlFunction::MultiTexCoordP2uiv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MultiTexCoordP2uiv(texture, type, coords);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords) {
+    GlTraceRecord traceRecord(GlFunction::MultiTexCoordP3ui);
+    traceRecord.value(texture);
+    traceRecord.value(type);
+    traceRecord.value(coords);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MultiTexCoordP3ui(texture, type, coords);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint * coords) {
+    GlTraceRecord traceRecord(GlFunction::MultiTexCoordP3uiv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MultiTexCoordP3uiv(texture, type, coords);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords) {
+    GlTraceRecord traceRecord(GlFunction::MultiTexCoordP4ui);
+    traceRecord.value(texture);
+    traceRecord.value(type);
+    traceRecord.value(coords);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MultiTexCoordP4ui(texture, type, coords);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint * coords) {
+    GlTraceRecord traceRecord(GlFunction::MultiTexCoordP4uiv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MultiTexCoordP4uiv(texture, type, coords);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_NormalP3ui(GLenum type, GLuint coords) {
+    GlTraceRecord traceRecord(GlFunction::NormalP3ui);
+    traceRecord.value(type);
+    traceRecord.value(coords);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_NormalP3ui(type, coords);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_NormalP3uiv(GLenum type, const GLuint * coords) {
+    GlTraceRecord traceRecord(GlFunction::NormalP3uiv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_NormalP3uiv(type, coords);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_ColorP3ui(GLenum type, GLuint color) {
+    GlTraceRecord traceRecord(GlFunction::ColorP3ui);
+    traceRecord.value(type);
+    traceRecord.value(color);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_ColorP3ui(type, color);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_ColorP3uiv(GLenum type, const GLuint * color) {
+    GlTraceRecord traceRecord(GlFunction::ColorP3uiv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_ColorP3uiv(type, color);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_ColorP4ui(GLenum type, GLuint color) {
+    GlTraceRecord traceRecord(GlFunction::ColorP4ui);
+    traceRecord.value(type);
+    traceRecord.value(color);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_ColorP4ui(type, color);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_ColorP4uiv(GLenum type, const GLuint * color) {
+    GlTraceRecord traceRecord(GlFunction::ColorP4uiv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_ColorP4uiv(type, color);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_SecondaryColorP3ui(GLenum type, GLuint color) {
+    GlTraceRecord traceRecord(GlFunction::SecondaryColorP3ui);
+    traceRecord.value(type);
+    traceRecord.value(color);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_SecondaryColorP3ui(type, color);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_SecondaryColorP3uiv(GLenum type, const GLuint * color) {
+    GlTraceRecord traceRecord(GlFunction::SecondaryColorP3uiv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_SecondaryColorP3uiv(type, color);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_MinSampleShading(GLfloat value) {
+    GlTraceRecord traceRecord(GlFunction::MinSampleShading);
+    traceRecord.value(value);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_MinSampleShading(value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_BlendEquationi(GLuint buf, GLenum mode) {
+    GlTraceRecord traceRecord(GlFunction::BlendEquationi);
+    traceRecord.value(buf);
+    traceRecord.value(mode);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_BlendEquationi(buf, mode);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_BlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum modeAlpha) {
+    GlTraceRecord traceRecord(GlFunction::BlendEquationSeparatei);
+    traceRecord.value(buf);
+    traceRecord.value(modeRGB);
+    traceRecord.value(modeAlpha);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_BlendEquationSeparatei(buf, modeRGB, modeAlpha);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_BlendFunci(GLuint buf, GLenum src, GLenum dst) {
+    GlTraceRecord traceRecord(GlFunction::BlendFunci);
+    traceRecord.value(buf);
+    traceRecord.value(src);
+    traceRecord.value(dst);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_BlendFunci(buf, src, dst);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_BlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha) {
+    GlTraceRecord traceRecord(GlFunction::BlendFuncSeparatei);
+    traceRecord.value(buf);
+    traceRecord.value(srcRGB);
+    traceRecord.value(dstRGB);
+    traceRecord.value(srcAlpha);
+    traceRecord.value(dstAlpha);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_BlendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_DrawArraysIndirect(GLenum mode, const void * indirect) {
+    GlTraceRecord traceRecord(GlFunction::DrawArraysIndirect);
+    traceRecord.value(mode);
+    traceRecord.offset(indirect);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_DrawArraysIndirect(mode, indirect);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_DrawElementsIndirect(GLenum mode, GLenum type, const void * indirect) {
+    GlTraceRecord traceRecord(GlFunction::DrawElementsIndirect);
+    traceRecord.value(mode);
+    traceRecord.value(type);
+    traceRecord.offset(indirect);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_DrawElementsIndirect(mode, type, indirect);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Uniform1d(GLint location, GLdouble x) {
+    GlTraceRecord traceRecord(GlFunction::Uniform1d);
+    traceRecord.value(location);
+    traceRecord.value(x);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Uniform1d(location, x);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Uniform2d(GLint location, GLdouble x, GLdouble y) {
+    GlTraceRecord traceRecord(GlFunction::Uniform2d);
+    traceRecord.value(location);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Uniform2d(location, x, y);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Uniform3d(GLint location, GLdouble x, GLdouble y, GLdouble z) {
+    GlTraceRecord traceRecord(GlFunction::Uniform3d);
+    traceRecord.value(location);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    traceRecord.value(z);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Uniform3d(location, x, y, z);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Uniform4d(GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    GlTraceRecord traceRecord(GlFunction::Uniform4d);
+    traceRecord.value(location);
+    traceRecord.value(x);
+    traceRecord.value(y);
+    traceRecord.value(z);
+    traceRecord.value(w);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Uniform4d(location, x, y, z, w);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Uniform1dv(GLint location, GLsizei count, const GLdouble * value) {
+    GlTraceRecord traceRecord(GlFunction::Uniform1dv);
+    traceRecord.value(location);
+    traceRecord.value(count);
+    traceRecord.bytes(value, value ? count * 1 * sizeof(GLdouble) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Uniform1dv(location, count, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Uniform2dv(GLint location, GLsizei count, const GLdouble * value) {
+    GlTraceRecord traceRecord(GlFunction::Uniform2dv);
+    traceRecord.value(location);
+    traceRecord.value(count);
+    traceRecord.bytes(value, value ? count * 2 * sizeof(GLdouble) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Uniform2dv(location, count, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Uniform3dv(GLint location, GLsizei count, const GLdouble * value) {
+    GlTraceRecord traceRecord(GlFunction::Uniform3dv);
+    traceRecord.value(location);
+    traceRecord.value(count);
+    traceRecord.bytes(value, value ? count * 3 * sizeof(GLdouble) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Uniform3dv(location, count, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_Uniform4dv(GLint location, GLsizei count, const GLdouble * value) {
+    GlTraceRecord traceRecord(GlFunction::Uniform4dv);
+    traceRecord.value(location);
+    traceRecord.value(count);
+    traceRecord.bytes(value, value ? count * 4 * sizeof(GLdouble) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_Uniform4dv(location, count, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_UniformMatrix2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    GlTraceRecord traceRecord(GlFunction::UniformMatrix2dv);
+    traceRecord.value(location);
+    traceRecord.value(count);
+    traceRecord.value(transpose);
+    traceRecord.bytes(value, value ? count * 4 * sizeof(GLdouble) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_UniformMatrix2dv(location, count, transpose, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_UniformMatrix3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    GlTraceRecord traceRecord(GlFunction::UniformMatrix3dv);
+    traceRecord.value(location);
+    traceRecord.value(count);
+    traceRecord.value(transpose);
+    traceRecord.bytes(value, value ? count * 9 * sizeof(GLdouble) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_UniformMatrix3dv(location, count, transpose, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_UniformMatrix4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    GlTraceRecord traceRecord(GlFunction::UniformMatrix4dv);
+    traceRecord.value(location);
+    traceRecord.value(count);
+    traceRecord.value(transpose);
+    traceRecord.bytes(value, value ? count * 16 * sizeof(GLdouble) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_UniformMatrix4dv(location, count, transpose, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_UniformMatrix2x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    GlTraceRecord traceRecord(GlFunction::UniformMatrix2x3dv);
+    traceRecord.value(location);
+    traceRecord.value(count);
+    traceRecord.value(transpose);
+    traceRecord.bytes(value, value ? count * 6 * sizeof(GLdouble) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_UniformMatrix2x3dv(location, count, transpose, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_UniformMatrix2x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    GlTraceRecord traceRecord(GlFunction::UniformMatrix2x4dv);
+    traceRecord.value(location);
+    traceRecord.value(count);
+    traceRecord.value(transpose);
+    traceRecord.bytes(value, value ? count * 8 * sizeof(GLdouble) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_UniformMatrix2x4dv(location, count, transpose, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_UniformMatrix3x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    GlTraceRecord traceRecord(GlFunction::UniformMatrix3x2dv);
+    traceRecord.value(location);
+    traceRecord.value(count);
+    traceRecord.value(transpose);
+    traceRecord.bytes(value, value ? count * 6 * sizeof(GLdouble) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_UniformMatrix3x2dv(location, count, transpose, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_UniformMatrix3x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    GlTraceRecord traceRecord(GlFunction::UniformMatrix3x4dv);
+    traceRecord.value(location);
+    traceRecord.value(count);
+    traceRecord.value(transpose);
+    traceRecord.bytes(value, value ? count * 12 * sizeof(GLdouble) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_UniformMatrix3x4dv(location, count, transpose, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_UniformMatrix4x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    GlTraceRecord traceRecord(GlFunction::UniformMatrix4x2dv);
+    traceRecord.value(location);
+    traceRecord.value(count);
+    traceRecord.value(transpose);
+    traceRecord.bytes(value, value ? count * 8 * sizeof(GLdouble) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_UniformMatrix4x2dv(location, count, transpose, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_UniformMatrix4x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble * value) {
+    GlTraceRecord traceRecord(GlFunction::UniformMatrix4x3dv);
+    traceRecord.value(location);
+    traceRecord.value(count);
+    traceRecord.value(transpose);
+    traceRecord.bytes(value, value ? count * 12 * sizeof(GLdouble) : 0);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_UniformMatrix4x3dv(location, count, transpose, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetUniformdv(GLuint program, GLint location, GLdouble * params) {
+    GlTraceRecord traceRecord(GlFunction::GetUniformdv);
+    traceRecord.value(program);
+    traceRecord.value(location);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetUniformdv(program, location, params);
+    traceRecord.finish(traceStart);
+}
+
+inline GLint APIENTRY glTrace_GetSubroutineUniformLocation(GLuint program, GLenum shadertype, const GLchar * name) {
+    GlTraceRecord traceRecord(GlFunction::GetSubroutineUniformLocation);
+    traceRecord.value(program);
+    traceRecord.value(shadertype);
+    traceRecord.string(name);
+    uint64_t traceStart = GlTraceRecord::now();
+    GLint traceResult = glTraceReal_GetSubroutineUniformLocation(program, shadertype, name);
+    traceRecord.finish(traceStart);
+    return traceResult;
+}
+
+inline GLuint APIENTRY glTrace_GetSubroutineIndex(GLuint program, GLenum shadertype, const GLchar * name) {
+    GlTraceRecord traceRecord(GlFunction::GetSubroutineIndex);
+    traceRecord.value(program);
+    traceRecord.value(shadertype);
+    traceRecord.string(name);
+    uint64_t traceStart = GlTraceRecord::now();
+    GLuint traceResult = glTraceReal_GetSubroutineIndex(program, shadertype, name);
+    traceRecord.finish(traceStart);
+    return traceResult;
+}
+
+inline void APIENTRY glTrace_GetActiveSubroutineUniformiv(GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint * values) {
+    GlTraceRecord traceRecord(GlFunction::GetActiveSubroutineUniformiv);
+    traceRecord.value(program);
+    traceRecord.value(shadertype);
+    traceRecord.value(index);
+    traceRecord.value(pname);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetActiveSubroutineUniformiv(program, shadertype, index, pname, values);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetActiveSubroutineUniformName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei * length, GLchar * name) {
+    GlTraceRecord traceRecord(GlFunction::GetActiveSubroutineUniformName);
+    traceRecord.value(program);
+    traceRecord.value(shadertype);
+    traceRecord.value(index);
+    traceRecord.value(bufSize);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetActiveSubroutineUniformName(program, shadertype, index, bufSize, length, name);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetActiveSubroutineName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei * length, GLchar * name) {
+    GlTraceRecord traceRecord(GlFunction::GetActiveSubroutineName);
+    traceRecord.value(program);
+    traceRecord.value(shadertype);
+    traceRecord.value(index);
+    traceRecord.value(bufSize);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetActiveSubroutineName(program, shadertype, index, bufSize, length, name);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_UniformSubroutinesuiv(GLenum shadertype, GLsizei count, const GLuint * indices) {
+    GlTraceRecord traceRecord(GlFunction::UniformSubroutinesuiv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_UniformSubroutinesuiv(shadertype, count, indices);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetUniformSubroutineuiv(GLenum shadertype, GLint location, GLuint * params) {
+    GlTraceRecord traceRecord(GlFunction::GetUniformSubroutineuiv);
+    traceRecord.value(shadertype);
+    traceRecord.value(location);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetUniformSubroutineuiv(shadertype, location, params);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetProgramStageiv(GLuint program, GLenum shadertype, GLenum pname, GLint * values) {
+    GlTraceRecord traceRecord(GlFunction::GetProgramStageiv);
+    traceRecord.value(program);
+    traceRecord.value(shadertype);
+    traceRecord.value(pname);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetProgramStageiv(program, shadertype, pname, values);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_PatchParameteri(GLenum pname, GLint value) {
+    GlTraceRecord traceRecord(GlFunction::PatchParameteri);
+    traceRecord.value(pname);
+    traceRecord.value(value);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_PatchParameteri(pname, value);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_PatchParameterfv(GLenum pname, const GLfloat * values) {
+    GlTraceRecord traceRecord(GlFunction::PatchParameterfv);
+    traceRecord.unsupported();
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_PatchParameterfv(pname, values);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_BindTransformFeedback(GLenum target, GLuint id) {
+    GlTraceRecord traceRecord(GlFunction::BindTransformFeedback);
+    traceRecord.value(target);
+    traceRecord.value(id);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_BindTransformFeedback(target, id);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_DeleteTransformFeedbacks(GLsizei n, const GLuint * ids) {
+    GlTraceRecord traceRecord(GlFunction::DeleteTransformFeedbacks);
+    traceRecord.value(n);
+    traceRecord.names(n, ids);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_DeleteTransformFeedbacks(n, ids);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GenTransformFeedbacks(GLsizei n, GLuint * ids) {
+    GlTraceRecord traceRecord(GlFunction::GenTransformFeedbacks);
+    traceRecord.value(n);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GenTransformFeedbacks(n, ids);
+    traceRecord.names(n, ids);
+    traceRecord.finish(traceStart);
+}
+
+inline GLboolean APIENTRY glTrace_IsTransformFeedback(GLuint id) {
+    GlTraceRecord traceRecord(GlFunction::IsTransformFeedback);
+    traceRecord.value(id);
+    uint64_t traceStart = GlTraceRecord::now();
+    GLboolean traceResult = glTraceReal_IsTransformFeedback(id);
+    traceRecord.finish(traceStart);
+    return traceResult;
+}
+
+inline void APIENTRY glTrace_PauseTransformFeedback() {
+    GlTraceRecord traceRecord(GlFunction::PauseTransformFeedback);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_PauseTransformFeedback();
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_ResumeTransformFeedback() {
+    GlTraceRecord traceRecord(GlFunction::ResumeTransformFeedback);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_ResumeTransformFeedback();
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_DrawTransformFeedback(GLenum mode, GLuint id) {
+    GlTraceRecord traceRecord(GlFunction::DrawTransformFeedback);
+    traceRecord.value(mode);
+    traceRecord.value(id);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_DrawTransformFeedback(mode, id);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_DrawTransformFeedbackStream(GLenum mode, GLuint id, GLuint stream) {
+    GlTraceRecord traceRecord(GlFunction::DrawTransformFeedbackStream);
+    traceRecord.value(mode);
+    traceRecord.value(id);
+    traceRecord.value(stream);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_DrawTransformFeedbackStream(mode, id, stream);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_BeginQueryIndexed(GLenum target, GLuint index, GLuint id) {
+    GlTraceRecord traceRecord(GlFunction::BeginQueryIndexed);
+    traceRecord.value(target);
+    traceRecord.value(index);
+    traceRecord.value(id);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_BeginQueryIndexed(target, index, id);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_EndQueryIndexed(GLenum target, GLuint index) {
+    GlTraceRecord traceRecord(GlFunction::EndQueryIndexed);
+    traceRecord.value(target);
+    traceRecord.value(index);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_EndQueryIndexed(target, index);
+    traceRecord.finish(traceStart);
+}
+
+inline void APIENTRY glTrace_GetQueryIndexediv(GLenum target, GLuint index, GLenum pname, GLint * params) {
+    GlTraceRecord traceRecord(GlFunction::GetQueryIndexediv);
+    traceRecord.value(target);
+    traceRecord.value(index);
+    traceRecord.value(pname);
+    uint64_t traceStart = GlTraceRecord::now();
+    glTraceReal_GetQueryIndexediv(target, index, pname, params);
+    traceRecord.finish(traceStart);
+}
+
+// Troca cada ponteiro carregado pela versão medida; os nulos (fora do contexto) ficam
+inline void glTraceInstallFunctions() {
+    if (glad_glCullFace) { glTraceReal_CullFace = glad_glCullFace; glad_glCullFace = glTrace_CullFace; }
+    if (glad_glFrontFace) { glTraceReal_FrontFace = glad_glFrontFace; glad_glFrontFace = glTrace_FrontFace; }
+    if (glad_glHint) { glTraceReal_Hint = glad_glHint; glad_glHint = glTrace_Hint; }
+    if (glad_glLineWidth) { glTraceReal_LineWidth = glad_glLineWidth; glad_glLineWidth = glTrace_LineWidth; }
+    if (glad_glPointSize) { glTraceReal_PointSize = glad_glPointSize; glad_glPointSize = glTrace_PointSize; }
+    if (glad_glPolygonMode) { glTraceReal_PolygonMode = glad_glPolygonMode; glad_glPolygonMode = glTrace_PolygonMode; }
+    if (glad_glScissor) { glTraceReal_Scissor = glad_glScissor; glad_glScissor = glTrace_Scissor; }
+    if (glad_glTexParameterf) { glTraceReal_TexParameterf = glad_glTexParameterf; glad_glTexParameterf = glTrace_TexParameterf; }
+    if (glad_glTexParameterfv) { glTraceReal_TexParameterfv = glad_glTexParameterfv; glad_glTexParameterfv = glTrace_TexParameterfv; }
+    if (glad_glTexParameteri) { glTraceReal_TexParameteri = glad_glTexParameteri; glad_glTexParameteri = glTrace_TexParameteri; }
+    if (glad_glTexParameteriv) { glTraceReal_TexParameteriv = glad_glTexParameteriv; glad_glTexParameteriv = glTrace_TexParameteriv; }
+    if (glad_glTexImage1D) { glTraceReal_TexImage1D = glad_glTexImage1D; glad_glTexImage1D = glTrace_TexImage1D; }
+    if (glad_glTexImage2D) { glTraceReal_TexImage2D = glad_glTexImage2D; glad_glTexImage2D = glTrace_TexImage2D; }
+    if (glad_glDrawBuffer) { glTraceReal_DrawBuffer = glad_glDrawBuffer; glad_glDrawBuffer = glTrace_DrawBuffer; }
+    if (glad_glClear) { glTraceReal_Clear = glad_glClear; glad_glClear = glTrace_Clear; }
+    if (glad_glClearColor) { glTraceReal_ClearColor = glad_glClearColor; glad_glClearColor = glTrace_ClearColor; }
+    if (glad_glClearStencil) { glTraceReal_ClearStencil = glad_glClearStencil; glad_glClearStencil = glTrace_ClearStencil; }
+    if (glad_glClearDepth) { glTraceReal_ClearDepth = glad_glClearDepth; glad_glClearDepth = glTrace_ClearDepth; }
+    if (glad_glStencilMask) { glTraceReal_StencilMask = glad_glStencilMask; glad_glStencilMask = glTrace_StencilMask; }
+    if (glad_glColorMask) { glTraceReal_ColorMask = glad_glColorMask; glad_glColorMask = glTrace_ColorMask; }
+    if (glad_glDepthMask) { glTraceReal_DepthMask = glad_glDepthMask; glad_glDepthMask = glTrace_DepthMask; }
+    if (glad_glDisable) { glTraceReal_Disable = glad_glDisable; glad_glDisable = glTrace_Disable; }
+    if (glad_glEnable) { glTraceReal_Enable = glad_glEnable; glad_glEnable = glTrace_Enable; }
+    if (glad_glFinish) { glTraceReal_Finish = glad_glFinish; glad_glFinish = glTrace_Finish; }
+    if (glad_glFlush) { glTraceReal_Flush = glad_glFlush; glad_glFlush = glTrace_Flush; }
+    if (glad_glBlendFunc) { glTraceReal_BlendFunc = glad_glBlendFunc; glad_glBlendFunc = glTrace_BlendFunc; }
+    if (glad_glLogicOp) { glTraceReal_LogicOp = glad_glLogicOp; glad_glLogicOp = glTrace_LogicOp; }
+    if (glad_glStencilFunc) { glTraceReal_StencilFunc = glad_glStencilFunc; glad_glStencilFunc = glTrace_StencilFunc; }
+    if (glad_glStencilOp) { glTraceReal_StencilOp = glad_glStencilOp; glad_glStencilOp = glTrace_StencilOp; }
+    if (glad_glDepthFunc) { glTraceReal_DepthFunc = glad_glDepthFunc; glad_glDepthFunc = glTrace_DepthFunc; }
+    if (glad_glPixelStoref) { glTraceReal_PixelStoref = glad_glPixelStoref; glad_glPixelStoref = glTrace_PixelStoref; }
+    if (glad_glPixelStorei) { glTraceReal_PixelStorei = glad_glPixelStorei; glad_glPixelStorei = glTrace_PixelStorei; }
+    if (glad_glReadBuffer) { glTraceReal_ReadBuffer = glad_glReadBuffer; glad_glReadBuffer = glTrace_ReadBuffer; }
+    if (glad_glReadPixels) { glTraceReal_ReadPixels = glad_glReadPixels; glad_glReadPixels = glTrace_ReadPixels; }
+    if (glad_glGetBooleanv) { glTraceReal_GetBooleanv = glad_glGetBooleanv; glad_glGetBooleanv = glTrace_GetBooleanv; }
+    if (glad_glGetDoublev) { glTraceReal_GetDoublev = glad_glGetDoublev; glad_glGetDoublev = glTrace_GetDoublev; }
+    if (glad_glGetError) { glTraceReal_GetError = glad_glGetError; glad_glGetError = glTrace_GetError; }
+    if (glad_glGetFloatv) { glTraceReal_GetFloatv = glad_glGetFloatv; glad_glGetFloatv = glTrace_GetFloatv; }
+    if (glad_glGetIntegerv) { glTraceReal_GetIntegerv = glad_glGetIntegerv; glad_glGetIntegerv = glTrace_GetIntegerv; }
+    if (glad_glGetString) { glTraceReal_GetString = glad_glGetString; glad_glGetString = glTrace_GetString; }
+    if (glad_glGetTexImage) { glTraceReal_GetTexImage = glad_glGetTexImage; glad_glGetTexImage = glTrace_GetTexImage; }
+    if (glad_glGetTexParameterfv) { glTraceReal_GetTexParameterfv = glad_glGetTexParameterfv; glad_glGetTexParameterfv = glTrace_GetTexParameterfv; }
+    if (glad_glGetTexParameteriv) { glTraceReal_GetTexParameteriv = glad_glGetTexParameteriv; glad_glGetTexParameteriv = glTrace_GetTexParameteriv; }
+    if (glad_glGetTexLevelParameterfv) { glTraceReal_GetTexLevelParameterfv = glad_glGetTexLevelParameterfv; glad_glGetTexLevelParameterfv = glTrace_GetTexLevelParameterfv; }
+    if (glad_glGetTexLevelParameteriv) { glTraceReal_GetTexLevelParameteriv = glad_glGetTexLevelParameteriv; glad_glGetTexLevelParameteriv = glTrace_GetTexLevelParameteriv; }
+    if (glad_glIsEnabled) { glTraceReal_IsEnabled = glad_glIsEnabled; glad_glIsEnabled = glTrace_IsEnabled; }
+    if (glad_glDepthRange) { glTraceReal_DepthRange = glad_glDepthRange; glad_glDepthRange = glTrace_DepthRange; }
+    if (glad_glViewport) { glTraceReal_Viewport = glad_glViewport; glad_glViewport = glTrace_Viewport; }
+    if (glad_glNewList) { glTraceReal_NewList = glad_glNewList; glad_glNewList = glTrace_NewList; }
+    if (glad_glEndList) { glTraceReal_EndList = glad_glEndList; glad_glEndList = glTrace_EndList; }
+    if (glad_glCallList) { glTraceReal_CallList = glad_glCallList; glad_glCallList = glTrace_CallList; }
+    if (glad_glCallLists) { glTraceReal_CallLists = glad_glCallLists; glad_glCallLists = glTrace_CallLists; }
+    if (glad_glDeleteLists) { glTraceReal_DeleteLists = glad_glDeleteLists; glad_glDeleteLists = glTrace_DeleteLists; }
+    if (glad_glGenLists) { glTraceReal_GenLists = glad_glGenLists; glad_glGenLists = glTrace_GenLists; }
+    if (glad_glListBase) { glTraceReal_ListBase = glad_glListBase; glad_glListBase = glTrace_ListBase; }
+    if (glad_glBegin) { glTraceReal_Begin = glad_glBegin; glad_glBegin = glTrace_Begin; }
+    if (glad_glBitmap) { glTraceReal_Bitmap = glad_glBitmap; glad_glBitmap = glTrace_Bitmap; }
+    if (glad_glColor3b) { glTraceReal_Color3b = glad_glColor3b; glad_glColor3b = glTrace_Color3b; }
+    if (glad_glColor3bv) { glTraceReal_Color3bv = glad_glColor3bv; glad_glColor3bv = glTrace_Color3bv; }
+    if (glad_glColor3d) { glTraceReal_Color3d = glad_glColor3d; glad_glColor3d = glTrace_Color3d; }
+    if (glad_glColor3dv) { glTraceReal_Color3dv = glad_glColor3dv; glad_glColor3dv = glTrace_Color3dv; }
+    if (glad_glColor3f) { glTraceReal_Color3f = glad_glColor3f; glad_glColor3f = glTrace_Color3f; }
+    if (glad_glColor3fv) { glTraceReal_Color3fv = glad_glColor3fv; glad_glColor3fv = glTrace_Color3fv; }
+    if (glad_glColor3i) { glTraceReal_Color3i = glad_glColor3i; glad_glColor3i = glTrace_Color3i; }
+    if (glad_glColor3iv) { glTraceReal_Color3iv = glad_glColor3iv; glad_glColor3iv = glTrace_Color3iv; }
+    if (glad_glColor3s) { glTraceReal_Color3s = glad_glColor3s; glad_glColor3s = glTrace_Color3s; }
+    if (glad_glColor3sv) { glTraceReal_Color3sv = glad_glColor3sv; glad_glColor3sv = glTrace_Color3sv; }
+    if (glad_glColor3ub) { glTraceReal_Color3ub = glad_glColor3ub; glad_glColor3ub = glTrace_Color3ub; }
+    if (glad_glColor3ubv) { glTraceReal_Color3ubv = glad_glColor3ubv; glad_glColor3ubv = glTrace_Color3ubv; }
+    if (glad_glColor3ui) { glTraceReal_Color3ui = glad_glColor3ui; glad_glColor3ui = glTrace_Color3ui; }
+    if (glad_glColor3uiv) { glTraceReal_Color3uiv = glad_glColor3uiv; glad_glColor3uiv = glTrace_Color3uiv; }
+    if (glad_glColor3us) { glTraceReal_Color3us = glad_glColor3us; glad_glColor3us = glTrace_Color3us; }
+    if (glad_glColor3usv) { glTraceReal_Color3usv = glad_glColor3usv; glad_glColor3usv = glTrace_Color3usv; }
+    if (glad_glColor4b) { glTraceReal_Color4b = glad_glColor4b; glad_glColor4b = glTrace_Color4b; }
+    if (glad_glColor4bv) { glTraceReal_Color4bv = glad_glColor4bv; glad_glColor4bv = glTrace_Color4bv; }
+    if (glad_glColor4d) { glTraceReal_Color4d = glad_glColor4d; glad_glColor4d = glTrace_Color4d; }
+    if (glad_glColor4dv) { glTraceReal_Color4dv = glad_glColor4dv; glad_glColor4dv = glTrace_Color4dv; }
+    if (glad_glColor4f) { glTraceReal_Color4f = glad_glColor4f; glad_glColor4f = glTrace_Color4f; }
+    if (glad_glColor4fv) { glTraceReal_Color4fv = glad_glColor4fv; glad_glColor4fv = glTrace_Color4fv; }
+    if (glad_glColor4i) { glTraceReal_Color4i = glad_glColor4i; glad_glColor4i = glTrace_Color4i; }
+    if (glad_glColor4iv) { glTraceReal_Color4iv = glad_glColor4iv; glad_glColor4iv = glTrace_Color4iv; }
+    if (glad_glColor4s) { glTraceReal_Color4s = glad_glColor4s; glad_glColor4s = glTrace_Color4s; }
+    if (glad_glColor4sv) { glTraceReal_Color4sv = glad_glColor4sv; glad_glColor4sv = glTrace_Color4sv; }
+    if (glad_glColor4ub) { glTraceReal_Color4ub = glad_glColor4ub; glad_glColor4ub = glTrace_Color4ub; }
+    if (glad_glColor4ubv) { glTraceReal_Color4ubv = glad_glColor4ubv; glad_glColor4ubv = glTrace_Color4ubv; }
+    if (glad_glColor4ui) { glTraceReal_Color4ui = glad_glColor4ui; glad_glColor4ui = glTrace_Color4ui; }
+    if (glad_glColor4uiv) { glTraceReal_Color4uiv = glad_glColor4uiv; glad_glColor4uiv = glTrace_Color4uiv; }
+    if (glad_glColor4us) { glTraceReal_Color4us = glad_glColor4us; glad_glColor4us = glTrace_Color4us; }
+    if (glad_glColor4usv) { glTraceReal_Color4usv = glad_glColor4usv; glad_glColor4usv = glTrace_Color4usv; }
+    if (glad_glEdgeFlag) { glTraceReal_EdgeFlag = glad_glEdgeFlag; glad_glEdgeFlag = glTrace_EdgeFlag; }
+    if (glad_glEdgeFlagv) { glTraceReal_EdgeFlagv = glad_glEdgeFlagv; glad_glEdgeFlagv = glTrace_EdgeFlagv; }
+    if (glad_glEnd) { glTraceReal_End = glad_glEnd; glad_glEnd = glTrace_End; }
+    if (glad_glIndexd) { glTraceReal_Indexd = glad_glIndexd; glad_glIndexd = glTrace_Indexd; }
+    if (glad_glIndexdv) { glTraceReal_Indexdv = glad_glIndexdv; glad_glIndexdv = glTrace_Indexdv; }
+    if (glad_glIndexf) { glTraceReal_Indexf = glad_glIndexf; glad_glIndexf = glTrace_Indexf; }
+    if (glad_glIndexfv) { glTraceReal_Indexfv = glad_glIndexfv; glad_glIndexfv = glTrace_Indexfv; }
+    if (glad_glIndexi) { glTraceReal_Indexi = glad_glIndexi; glad_glIndexi = glTrace_Indexi; }
+    if (glad_glIndexiv) { glTraceReal_Indexiv = glad_glIndexiv; glad_glIndexiv = glTrace_Indexiv; }
+    if (glad_glIndexs) { glTraceReal_Indexs = glad_glIndexs; glad_glIndexs = glTrace_Indexs; }
+    if (glad_glIndexsv) { glTraceReal_Indexsv = glad_glIndexsv; glad_glIndexsv = glTrace_Indexsv; }
+    if (glad_glNormal3b) { glTraceReal_Normal3b = glad_glNormal3b; glad_glNormal3b = glTrace_Normal3b; }
+    if (glad_glNormal3bv) { glTraceReal_Normal3bv = glad_glNormal3bv; glad_glNormal3bv = glTrace_Normal3bv; }
+    if (glad_glNormal3d) { glTraceReal_Normal3d = glad_glNormal3d; glad_glNormal3d = glTrace_Normal3d; }
+    if (glad_glNormal3dv) { glTraceReal_Normal3dv = glad_glNormal3dv; glad_glNormal3dv = glTrace_Normal3dv; }
+    if (glad_glNormal3f) { glTraceReal_Normal3f = glad_glNormal3f; glad_glNormal3f = glTrace_Normal3f; }
+    if (glad_glNormal3fv) { glTraceReal_Normal3fv = glad_glNormal3fv; glad_glNormal3fv = glTrace_Normal3fv; }
+    if (glad_glNormal3i) { glTraceReal_Normal3i = glad_glNormal3i; glad_glNormal3i = glTrace_Normal3i; }
+    if (glad_glNormal3iv) { glTraceReal_Normal3iv = glad_glNormal3iv; glad_glNormal3iv = glTrace_Normal3iv; }
+    if (glad_glNormal3s) { glTraceReal_Normal3s = glad_glNormal3s; glad_glNormal3s = glTrace_Normal3s; }
+    if (glad_glNormal3sv) { glTraceReal_Normal3sv = glad_glNormal3sv; glad_glNormal3sv = glTrace_Normal3sv; }
+    if (glad_glRasterPos2d) { glTraceReal_RasterPos2d = glad_glRasterPos2d; glad_glRasterPos2d = glTrace_RasterPos2d; }
+    if (glad_glRasterPos2dv) { glTraceReal_RasterPos2dv = glad_glRasterPos2dv; glad_glRasterPos2dv = glTrace_RasterPos2dv; }
+    if (glad_glRasterPos2f) { glTraceReal_RasterPos2f = glad_glRasterPos2f; glad_glRasterPos2f = glTrace_RasterPos2f; }
+    if (glad_glRasterPos2fv) { glTraceReal_RasterPos2fv = glad_glRasterPos2fv; glad_glRasterPos2fv = glTrace_RasterPos2fv; }
+    if (glad_glRasterPos2i) { glTraceReal_RasterPos2i = glad_glRasterPos2i; glad_glRasterPos2i = glTrace_RasterPos2i; }
+    if (glad_glRasterPos2iv) { glTraceReal_RasterPos2iv = glad_glRasterPos2iv; glad_glRasterPos2iv = glTrace_RasterPos2iv; }
+    if (glad_glRasterPos2s) { glTraceReal_RasterPos2s = glad_glRasterPos2s; glad_glRasterPos2s = glTrace_RasterPos2s; }
+    if (glad_glRasterPos2sv) { glTraceReal_RasterPos2sv = glad_glRasterPos2sv; glad_glRasterPos2sv = glTrace_RasterPos2sv; }
+    if (glad_glRasterPos3d) { glTraceReal_RasterPos3d = glad_glRasterPos3d; glad_glRasterPos3d = glTrace_RasterPos3d; }
+    if (glad_glRasterPos3dv) { glTraceReal_RasterPos3dv = glad_glRasterPos3dv; glad_glRasterPos3dv = glTrace_RasterPos3dv; }
+    if (glad_glRasterPos3f) { glTraceReal_RasterPos3f = glad_glRasterPos3f; glad_glRasterPos3f = glTrace_RasterPos3f; }
+    if (glad_glRasterPos3fv) { glTraceReal_RasterPos3fv = glad_glRasterPos3fv; glad_glRasterPos3fv = glTrace_RasterPos3fv; }
+    if (glad_glRasterPos3i) { glTraceReal_RasterPos3i = glad_glRasterPos3i; glad_glRasterPos3i = glTrace_RasterPos3i; }
+    if (glad_glRasterPos3iv) { glTraceReal_RasterPos3iv = glad_glRasterPos3iv; glad_glRasterPos3iv = glTrace_RasterPos3iv; }
+    if (glad_glRasterPos3s) { glTraceReal_RasterPos3s = glad_glRasterPos3s; glad_glRasterPos3s = glTrace_RasterPos3s; }
+    if (glad_glRasterPos3sv) { glTraceReal_RasterPos3sv = glad_glRasterPos3sv; glad_glRasterPos3sv = glTrace_RasterPos3sv; }
+    if (glad_glRasterPos4d) { glTraceReal_RasterPos4d = glad_glRasterPos4d; glad_glRasterPos4d = glTrace_RasterPos4d; }
+    if (glad_glRasterPos4dv) { glTraceReal_RasterPos4dv = glad_glRasterPos4dv; glad_glRasterPos4dv = glTrace_RasterPos4dv; }
+    if (glad_glRasterPos4f) { glTraceReal_RasterPos4f = glad_glRasterPos4f; glad_glRasterPos4f = glTrace_RasterPos4f; }
+    if (glad_glRasterPos4fv) { glTraceReal_RasterPos4fv = glad_glRasterPos4fv; glad_glRasterPos4fv = glTrace_RasterPos4fv; }
+    if (glad_glRasterPos4i) { glTraceReal_RasterPos4i = glad_glRasterPos4i; glad_glRasterPos4i = glTrace_RasterPos4i; }
+    if (glad_glRasterPos4iv) { glTraceReal_RasterPos4iv = glad_glRasterPos4iv; glad_glRasterPos4iv = glTrace_RasterPos4iv; }
+    if (glad_glRasterPos4s) { glTraceReal_RasterPos4s = glad_glRasterPos4s; glad_glRasterPos4s = glTrace_RasterPos4s; }
+    if (glad_glRasterPos4sv) { glTraceReal_RasterPos4sv = glad_glRasterPos4sv; glad_glRasterPos4sv = glTrace_RasterPos4sv; }
+    if (glad_glRectd) { glTraceReal_Rectd = glad_glRectd; glad_glRectd = glTrace_Rectd; }
+    if (glad_glRectdv) { glTraceReal_Rectdv = glad_glRectdv; glad_glRectdv = glTrace_Rectdv; }
+    if (glad_glRectf) { glTraceReal_Rectf = glad_glRectf; glad_glRectf = glTrace_Rectf; }
+    if (glad_glRectfv) { glTraceReal_Rectfv = glad_glRectfv; glad_glRectfv = glTrace_Rectfv; }
+    if (glad_glRecti) { glTraceReal_Recti = glad_glRecti; glad_glRecti = glTrace_Recti; }
+    if (glad_glRectiv) { glTraceReal_Rectiv = glad_glRectiv; glad_glRectiv = glTrace_Rectiv; }
+    if (glad_glRects) { glTraceReal_Rects = glad_glRects; glad_glRects = glTrace_Rects; }
+    if (glad_glRectsv) { glTraceReal_Rectsv = glad_glRectsv; glad_glRectsv = glTrace_Rectsv; }
+    if (glad_glTexCoord1d) { glTraceReal_TexCoord1d = glad_glTexCoord1d; glad_glTexCoord1d = glTrace_TexCoord1d; }
+    if (glad_glTexCoord1dv) { glTraceReal_TexCoord1dv = glad_glTexCoord1dv; glad_glTexCoord1dv = glTrace_TexCoord1dv; }
+    if (glad_glTexCoord1f) { glTraceReal_TexCoord1f = glad_glTexCoord1f; glad_glTexCoord1f = glTrace_TexCoord1f; }
+    if (glad_glTexCoord1fv) { glTraceReal_TexCoord1fv = glad_glTexCoord1fv; glad_glTexCoord1fv = glTrace_TexCoord1fv; }
+    if (glad_glTexCoord1i) { glTraceReal_TexCoord1i = glad_glTexCoord1i; glad_glTexCoord1i = glTrace_TexCoord1i; }
+    if (glad_glTexCoord1iv) { glTraceReal_TexCoord1iv = glad_glTexCoord1iv; glad_glTexCoord1iv = glTrace_TexCoord1iv; }
+    if (glad_glTexCoord1s) { glTraceReal_TexCoord1s = glad_glTexCoord1s; glad_glTexCoord1s = glTrace_TexCoord1s; }
+    if (glad_glTexCoord1sv) { glTraceReal_TexCoord1sv = glad_glTexCoord1sv; glad_glTexCoord1sv = glTrace_TexCoord1sv; }
+    if (glad_glTexCoord2d) { glTraceReal_TexCoord2d = glad_glTexCoord2d; glad_glTexCoord2d = glTrace_TexCoord2d; }
+    if (glad_glTexCoord2dv) { glTraceReal_TexCoord2dv = glad_glTexCoord2dv; glad_glTexCoord2dv = glTrace_TexCoord2dv; }
+    if (glad_glTexCoord2f) { glTraceReal_TexCoord2f = glad_glTexCoord2f; glad_glTexCoord2f = glTrace_TexCoord2f; }
+    if (glad_glTexCoord2fv) { glTraceReal_TexCoord2fv = glad_glTexCoord2fv; glad_glTexCoord2fv = glTrace_TexCoord2fv; }
+    if (glad_glTexCoord2i) { glTraceReal_TexCoord2i = glad_glTexCoord2i; glad_glTexCoord2i = glTrace_TexCoord2i; }
+    if (glad_glTexCoord2iv) { glTraceReal_TexCoord2iv = glad_glTexCoord2iv; glad_glTexCoord2iv = glTrace_TexCoord2iv; }
+    if (glad_glTexCoord2s) { glTraceReal_TexCoord2s = glad_glTexCoord2s; glad_glTexCoord2s = glTrace_TexCoord2s; }
+    if (glad_glTexCoord2sv) { glTraceReal_TexCoord2sv = glad_glTexCoord2sv; glad_glTexCoord2sv = glTrace_TexCoord2sv; }
+    if (glad_glTexCoord3d) { glTraceReal_TexCoord3d = glad_glTexCoord3d; glad_glTexCoord3d = glTrace_TexCoord3d; }
+    if (glad_glTexCoord3dv) { glTraceReal_TexCoord3dv = glad_glTexCoord3dv; glad_glTexCoord3dv = glTrace_TexCoord3dv; }
+    if (glad_glTexCoord3f) { glTraceReal_TexCoord3f = glad_glTexCoord3f; glad_glTexCoord3f = glTrace_TexCoord3f; }
+    if (glad_glTexCoord3fv) { glTraceReal_TexCoord3fv = glad_glTexCoord3fv; glad_glTexCoord3fv = glTrace_TexCoord3fv; }
+    if (glad_glTexCoord3i) { glTraceReal_TexCoord3i = glad_glTexCoord3i; glad_glTexCoord3i = glTrace_TexCoord3i; }
+    if (glad_glTexCoord3iv) { glTraceReal_TexCoord3iv = glad_glTexCoord3iv; glad_glTexCoord3iv = glTrace_TexCoord3iv; }
+    if (glad_glTexCoord3s) { glTraceReal_TexCoord3s = glad_glTexCoord3s; glad_glTexCoord3s = glTrace_TexCoord3s; }
+    if (glad_glTexCoord3sv) { glTraceReal_TexCoord3sv = glad_glTexCoord3sv; glad_glTexCoord3sv = glTrace_TexCoord3sv; }
+    if (glad_glTexCoord4d) { glTraceReal_TexCoord4d = glad_glTexCoord4d; glad_glTexCoord4d = glTrace_TexCoord4d; }
+    if (glad_glTexCoord4dv) { glTraceReal_TexCoord4dv = glad_glTexCoord4dv; glad_glTexCoord4dv = glTrace_TexCoord4dv; }
+    if (glad_glTexCoord4f) { glTraceReal_TexCoord4f = glad_glTexCoord4f; glad_glTexCoord4f = glTrace_TexCoord4f; }
+    if (glad_glTexCoord4fv) { glTraceReal_TexCoord4fv = glad_glTexCoord4fv; glad_glTexCoord4fv = glTrace_TexCoord4fv; }
+    if (glad_glTexCoord4i) { glTraceReal_TexCoord4i = glad_glTexCoord4i; glad_glTexCoord4i = glTrace_TexCoord4i; }
+    if (glad_glTexCoord4iv) { glTraceReal_TexCoord4iv = glad_glTexCoord4iv; glad_glTexCoord4iv = glTrace_TexCoord4iv; }
+    if (glad_glTexCoord4s) { glTraceReal_TexCoord4s = glad_glTexCoord4s; glad_glTexCoord4s = glTrace_TexCoord4s; }
+    if (glad_glTexCoord4sv) { glTraceReal_TexCoord4sv = glad_glTexCoord4sv; glad_glTexCoord4sv = glTrace_TexCoord4sv; }
+    if (glad_glVertex2d) { glTraceReal_Vertex2d = glad_glVertex2d; glad_glVertex2d = glTrace_Vertex2d; }
+    if (glad_glVertex2dv) { glTraceReal_Vertex2dv = glad_glVertex2dv; glad_glVertex2dv = glTrace_Vertex2dv; }
+    if (glad_glVertex2f) { glTraceReal_Vertex2f = glad_glVertex2f; glad_glVertex2f = glTrace_Vertex2f; }
+    if (glad_glVertex2fv) { glTraceReal_Vertex2fv = glad_glVertex2fv; glad_glVertex2fv = glTrace_Vertex2fv; }
+    if (glad_glVertex2i) { glTraceReal_Vertex2i = glad_glVertex2i; glad_glVertex2i = glTrace_Vertex2i; }
+    if (glad_glVertex2iv) { glTraceReal_Vertex2iv = glad_glVertex2iv; glad_glVertex2iv = glTrace_Vertex2iv; }
+    if (glad_glVertex2s) { glTraceReal_Vertex2s = glad_glVertex2s; glad_glVertex2s = glTrace_Vertex2s; }
+    if (glad_glVertex2sv) { glTraceReal_Vertex2sv = glad_glVertex2sv; glad_glVertex2sv = glTrace_Vertex2sv; }
+    if (glad_glVertex3d) { glTraceReal_Vertex3d = glad_glVertex3d; glad_glVertex3d = glTrace_Vertex3d; }
+    if (glad_glVertex3dv) { glTraceReal_Vertex3dv = glad_glVertex3dv; glad_glVertex3dv = glTrace_Vertex3dv; }
+    if (glad_glVertex3f) { glTraceReal_Vertex3f = glad_glVertex3f; glad_glVertex3f = glTrace_Vertex3f; }
+    if (glad_glVertex3fv) { glTraceReal_Vertex3fv = glad_glVertex3fv; glad_glVertex3fv = glTrace_Vertex3fv; }
+    if (glad_glVertex3i) { glTraceReal_Vertex3i = glad_glVertex3i; glad_glVertex3i = glTrace_Vertex3i; }
+    if (glad_glVertex3iv) { glTraceReal_Vertex3iv = glad_glVertex3iv; glad_glVertex3iv = glTrace_Vertex3iv; }
+    if (glad_glVertex3s) { glTraceReal_Vertex3s = glad_glVertex3s; glad_glVertex3s = glTrace_Vertex3s; }
+    if (glad_glVertex3sv) { glTraceReal_Vertex3sv = glad_glVertex3sv; glad_glVertex3sv = glTrace_Vertex3sv; }
+    if (glad_glVertex4d) { glTraceReal_Vertex4d = glad_glVertex4d; glad_glVertex4d = glTrace_Vertex4d; }
+    if (glad_glVertex4dv) { glTraceReal_Vertex4dv = glad_glVertex4dv; glad_glVertex4dv = glTrace_Vertex4dv; }
+    if (glad_glVertex4f) { glTraceReal_Vertex4f = glad_glVertex4f; glad_glVertex4f = glTrace_Vertex4f; }
+    if (glad_glVertex4fv) { glTraceReal_Vertex4fv = glad_glVertex4fv; glad_glVertex4fv = glTrace_Vertex4fv; }
+    if (glad_glVertex4i) { glTraceReal_Vertex4i = glad_glVertex4i; glad_glVertex4i = glTrace_Vertex4i; }
+    if (glad_glVertex4iv) { glTraceReal_Vertex4iv = glad_glVertex4iv; glad_glVertex4iv = glTrace_Vertex4iv; }
+    if (glad_glVertex4s) { glTraceReal_Vertex4s = glad_glVertex4s; glad_glVertex4s = glTrace_Vertex4s; }
+    if (glad_glVertex4sv) { glTraceReal_Vertex4sv = glad_glVertex4sv; glad_glVertex4sv = glTrace_Vertex4sv; }
+    if (glad_glClipPlane) { glTraceReal_ClipPlane = glad_glClipPlane; glad_glClipPlane = glTrace_ClipPlane; }
+    if (glad_glColorMaterial) { glTraceReal_ColorMaterial = glad_glColorMaterial; glad_glColorMaterial = glTrace_ColorMaterial; }
+    if (glad_glFogf) { glTraceReal_Fogf = glad_glFogf; glad_glFogf = glTrace_Fogf; }
+    if (glad_glFogfv) { glTraceReal_Fogfv = glad_glFogfv; glad_glFogfv = glTrace_Fogfv; }
+    if (glad_glFogi) { glTraceReal_Fogi = glad_glFogi; glad_glFogi = glTrace_Fogi; }
+    if (glad_glFogiv) { glTraceReal_Fogiv = glad_glFogiv; glad_glFogiv = glTrace_Fogiv; }
+    if (glad_glLightf) { glTraceReal_Lightf = glad_glLightf; glad_glLightf = glTrace_Lightf; }
+    if (glad_glLightfv) { glTraceReal_Lightfv = glad_glLightfv; glad_glLightfv = glTrace_Lightfv; }
+    if (glad_glLighti) { glTraceReal_Lighti = glad_glLighti; glad_glLighti = glTrace_Lighti; }
+    if (glad_glLightiv) { glTraceReal_Lightiv = glad_glLightiv; glad_glLightiv = glTrace_Lightiv; }
+    if (glad_glLightModelf) { glTraceReal_LightModelf = glad_glLightModelf; glad_glLightModelf = glTrace_LightModelf; }
+    if (glad_glLightModelfv) { glTraceReal_LightModelfv = glad_glLightModelfv; glad_glLightModelfv = glTrace_LightModelfv; }
+    if (glad_glLightModeli) { glTraceReal_LightModeli = glad_glLightModeli; glad_glLightModeli = glTrace_LightModeli; }
+    if (glad_glLightModeliv) { glTraceReal_LightModeliv = glad_glLightModeliv; glad_glLightModeliv = glTrace_LightModeliv; }
+    if (glad_glLineStipple) { glTraceReal_LineStipple = glad_glLineStipple; glad_glLineStipple = glTrace_LineStipple; }
+    if (glad_glMaterialf) { glTraceReal_Materialf = glad_glMaterialf; glad_glMaterialf = glTrace_Materialf; }
+    if (glad_glMaterialfv) { glTraceReal_Materialfv = glad_glMaterialfv; glad_glMaterialfv = glTrace_Materialfv; }
+    if (glad_glMateriali) { glTraceReal_Materiali = glad_glMateriali; glad_glMateriali = glTrace_Materiali; }
+    if (glad_glMaterialiv) { glTraceReal_Materialiv = glad_glMaterialiv; glad_glMaterialiv = glTrace_Materialiv; }
+    if (glad_glPolygonStipple) { glTraceReal_PolygonStipple = glad_glPolygonStipple; glad_glPolygonStipple = glTrace_PolygonStipple; }
+    if (glad_glShadeModel) { glTraceReal_ShadeModel = glad_glShadeModel; glad_glShadeModel = glTrace_ShadeModel; }
+    if (glad_glTexEnvf) { glTraceReal_TexEnvf = glad_glTexEnvf; glad_glTexEnvf = glTrace_TexEnvf; }
+    if (glad_glTexEnvfv) { glTraceReal_TexEnvfv = glad_glTexEnvfv; glad_glTexEnvfv = glTrace_TexEnvfv; }
+    if (glad_glTexEnvi) { glTraceReal_TexEnvi = glad_glTexEnvi; glad_glTexEnvi = glTrace_TexEnvi; }
+    if (glad_glTexEnviv) { glTraceReal_TexEnviv = glad_glTexEnviv; glad_glTexEnviv = glTrace_TexEnviv; }
+    if (glad_glTexGend) { glTraceReal_TexGend = glad_glTexGend; glad_glTexGend = glTrace_TexGend; }
+    if (glad_glTexGendv) { glTraceReal_TexGendv = glad_glTexGendv; glad_glTexGendv = glTrace_TexGendv; }
+    if (glad_glTexGenf) { glTraceReal_TexGenf = glad_glTexGenf; glad_glTexGenf = glTrace_TexGenf; }
+    if (glad_glTexGenfv) { glTraceReal_TexGenfv = glad_glTexGenfv; glad_glTexGenfv = glTrace_TexGenfv; }
+    if (glad_glTexGeni) { glTraceReal_TexGeni = glad_glTexGeni; glad_glTexGeni = glTrace_TexGeni; }
+    if (glad_glTexGeniv) { glTraceReal_TexGeniv = glad_glTexGeniv; glad_glTexGeniv = glTrace_TexGeniv; }
+    if (glad_glFeedbackBuffer) { glTraceReal_FeedbackBuffer = glad_glFeedbackBuffer; glad_glFeedbackBuffer = glTrace_FeedbackBuffer; }
+    if (glad_glSelectBuffer) { glTraceReal_SelectBuffer = glad_glSelectBuffer; glad_glSelectBuffer = glTrace_SelectBuffer; }
+    if (glad_glRenderMode) { glTraceReal_RenderMode = glad_glRenderMode; glad_glRenderMode = glTrace_RenderMode; }
+    if (glad_glInitNames) { glTraceReal_InitNames = glad_glInitNames; glad_glInitNames = glTrace_InitNames; }
+    if (glad_glLoadName) { glTraceReal_LoadName = glad_glLoadName; glad_glLoadName = glTrace_LoadName; }
+    if (glad_glPassThrough) { glTraceReal_PassThrough = glad_glPassThrough; glad_glPassThrough = glTrace_PassThrough; }
+    if (glad_glPopName) { glTraceReal_PopName = glad_glPopName; glad_glPopName = glTrace_PopName; }
+    if (glad_glPushName) { glTraceReal_PushName = glad_glPushName; glad_glPushName = glTrace_PushName; }
+    if (glad_glClearAccum) { glTraceReal_ClearAccum = glad_glClearAccum; glad_glClearAccum = glTrace_ClearAccum; }
+    if (glad_glClearIndex) { glTraceReal_ClearIndex = glad_glClearIndex; glad_glClearIndex = glTrace_ClearIndex; }
+    if (glad_glIndexMask) { glTraceReal_IndexMask = glad_glIndexMask; glad_glIndexMask = glTrace_IndexMask; }
+    if (glad_glAccum) { glTraceReal_Accum = glad_glAccum; glad_glAccum = glTrace_Accum; }
+    if (glad_glPopAttrib) { glTraceReal_PopAttrib = glad_glPopAttrib; glad_glPopAttrib = glTrace_PopAttrib; }
+    if (glad_glPushAttrib) { glTraceReal_PushAttrib = glad_glPushAttrib; glad_glPushAttrib = glTrace_PushAttrib; }
+    if (glad_glMap1d) { glTraceReal_Map1d = glad_glMap1d; glad_glMap1d = glTrace_Map1d; }
+    if (glad_glMap1f) { glTraceReal_Map1f = glad_glMap1f; glad_glMap1f = glTrace_Map1f; }
+    if (glad_glMap2d) { glTraceReal_Map2d = glad_glMap2d; glad_glMap2d = glTrace_Map2d; }
+    if (glad_glMap2f) { glTraceReal_Map2f = glad_glMap2f; glad_glMap2f = glTrace_Map2f; }
+    if (glad_glMapGrid1d) { glTraceReal_MapGrid1d = glad_glMapGrid1d; glad_glMapGrid1d = glTrace_MapGrid1d; }
+    if (glad_glMapGrid1f) { glTraceReal_MapGrid1f = glad_glMapGrid1f; glad_glMapGrid1f = glTrace_MapGrid1f; }
+    if (glad_glMapGrid2d) { glTraceReal_MapGrid2d = glad_glMapGrid2d; glad_glMapGrid2d = glTrace_MapGrid2d; }
+    if (glad_glMapGrid2f) { glTraceReal_MapGrid2f = glad_glMapGrid2f; glad_glMapGrid2f = glTrace_MapGrid2f; }
+    if (glad_glEvalCoord1d) { glTraceReal_EvalCoord1d = glad_glEvalCoord1d; glad_glEvalCoord1d = glTrace_EvalCoord1d; }
+    if (glad_glEvalCoord1dv) { glTraceReal_EvalCoord1dv = glad_glEvalCoord1dv; glad_glEvalCoord1dv = glTrace_EvalCoord1dv; }
+    if (glad_glEvalCoord1f) { glTraceReal_EvalCoord1f = glad_glEvalCoord1f; glad_glEvalCoord1f = glTrace_EvalCoord1f; }
+    if (glad_glEvalCoord1fv) { glTraceReal_EvalCoord1fv = glad_glEvalCoord1fv; glad_glEvalCoord1fv = glTrace_EvalCoord1fv; }
+    if (glad_glEvalCoord2d) { glTraceReal_EvalCoord2d = glad_glEvalCoord2d; glad_glEvalCoord2d = glTrace_EvalCoord2d; }
+    if (glad_glEvalCoord2dv) { glTraceReal_EvalCoord2dv = glad_glEvalCoord2dv; glad_glEvalCoord2dv = glTrace_EvalCoord2dv; }
+    if (glad_glEvalCoord2f) { glTraceReal_EvalCoord2f = glad_glEvalCoord2f; glad_glEvalCoord2f = glTrace_EvalCoord2f; }
+    if (glad_glEvalCoord2fv) { glTraceReal_EvalCoord2fv = glad_glEvalCoord2fv; glad_glEvalCoord2fv = glTrace_EvalCoord2fv; }
+    if (glad_glEvalMesh1) { glTraceReal_EvalMesh1 = glad_glEvalMesh1; glad_glEvalMesh1 = glTrace_EvalMesh1; }
+    if (glad_glEvalPoint1) { glTraceReal_EvalPoint1 = glad_glEvalPoint1; glad_glEvalPoint1 = glTrace_EvalPoint1; }
+    if (glad_glEvalMesh2) { glTraceReal_EvalMesh2 = glad_glEvalMesh2; glad_glEvalMesh2 = glTrace_EvalMesh2; }
+    if (glad_glEvalPoint2) { glTraceReal_EvalPoint2 = glad_glEvalPoint2; glad_glEvalPoint2 = glTrace_EvalPoint2; }
+    if (glad_glAlphaFunc) { glTraceReal_AlphaFunc = glad_glAlphaFunc; glad_glAlphaFunc = glTrace_AlphaFunc; }
+    if (glad_glPixelZoom) { glTraceReal_PixelZoom = glad_glPixelZoom; glad_glPixelZoom = glTrace_PixelZoom; }
+    if (glad_glPixelTransferf) { glTraceReal_PixelTransferf = glad_glPixelTransferf; glad_glPixelTransferf = glTrace_PixelTransferf; }
+    if (glad_glPixelTransferi) { glTraceReal_PixelTransferi = glad_glPixelTransferi; glad_glPixelTransferi = glTrace_PixelTransferi; }
+    if (glad_glPixelMapfv) { glTraceReal_PixelMapfv = glad_glPixelMapfv; glad_glPixelMapfv = glTrace_PixelMapfv; }
+    if (glad_glPixelMapuiv) { glTraceReal_PixelMapuiv = glad_glPixelMapuiv; glad_glPixelMapuiv = glTrace_PixelMapuiv; }
+    if (glad_glPixelMapusv) { glTraceReal_PixelMapusv = glad_glPixelMapusv; glad_glPixelMapusv = glTrace_PixelMapusv; }
+    if (glad_glCopyPixels) { glTraceReal_CopyPixels = glad_glCopyPixels; glad_glCopyPixels = glTrace_CopyPixels; }
+    if (glad_glDrawPixels) { glTraceReal_DrawPixels = glad_glDrawPixels; glad_glDrawPixels = glTrace_DrawPixels; }
+    if (glad_glGetClipPlane) { glTraceReal_GetClipPlane = glad_glGetClipPlane; glad_glGetClipPlane = glTrace_GetClipPlane; }
+    if (glad_glGetLightfv) { glTraceReal_GetLightfv = glad_glGetLightfv; glad_glGetLightfv = glTrace_GetLightfv; }
+    if (glad_glGetLightiv) { glTraceReal_GetLightiv = glad_glGetLightiv; glad_glGetLightiv = glTrace_GetLightiv; }
+    if (glad_glGetMapdv) { glTraceReal_GetMapdv = glad_glGetMapdv; glad_glGetMapdv = glTrace_GetMapdv; }
+    if (glad_glGetMapfv) { glTraceReal_GetMapfv = glad_glGetMapfv; glad_glGetMapfv = glTrace_GetMapfv; }
+    if (glad_glGetMapiv) { glTraceReal_GetMapiv = glad_glGetMapiv; glad_glGetMapiv = glTrace_GetMapiv; }
+    if (glad_glGetMaterialfv) { glTraceReal_GetMaterialfv = glad_glGetMaterialfv; glad_glGetMaterialfv = glTrace_GetMaterialfv; }
+    if (glad_glGetMaterialiv) { glTraceReal_GetMaterialiv = glad_glGetMaterialiv; glad_glGetMaterialiv = glTrace_GetMaterialiv; }
+    if (glad_glGetPixelMapfv) { glTraceReal_GetPixelMapfv = glad_glGetPixelMapfv; glad_glGetPixelMapfv = glTrace_GetPixelMapfv; }
+    if (glad_glGetPixelMapuiv) { glTraceReal_GetPixelMapuiv = glad_glGetPixelMapuiv; glad_glGetPixelMapuiv = glTrace_GetPixelMapuiv; }
+    if (glad_glGetPixelMapusv) { glTraceReal_GetPixelMapusv = glad_glGetPixelMapusv; glad_glGetPixelMapusv = glTrace_GetPixelMapusv; }
+    if (glad_glGetPolygonStipple) { glTraceReal_GetPolygonStipple = glad_glGetPolygonStipple; glad_glGetPolygonStipple = glTrace_GetPolygonStipple; }
+    if (glad_glGetTexEnvfv) { glTraceReal_GetTexEnvfv = glad_glGetTexEnvfv; glad_glGetTexEnvfv = glTrace_GetTexEnvfv; }
+    if (glad_glGetTexEnviv) { glTraceReal_GetTexEnviv = glad_glGetTexEnviv; glad_glGetTexEnviv = glTrace_GetTexEnviv; }
+    if (glad_glGetTexGendv) { glTraceReal_GetTexGendv = glad_glGetTexGendv; glad_glGetTexGendv = glTrace_GetTexGendv; }
+    if (glad_glGetTexGenfv) { glTraceReal_GetTexGenfv = glad_glGetTexGenfv; glad_glGetTexGenfv = glTrace_GetTexGenfv; }
+    if (glad_glGetTexGeniv) { glTraceReal_GetTexGeniv = glad_glGetTexGeniv; glad_glGetTexGeniv = glTrace_GetTexGeniv; }
+    if (glad_glIsList) { glTraceReal_IsList = glad_glIsList; glad_glIsList = glTrace_IsList; }
+    if (glad_glFrustum) { glTraceReal_Frustum = glad_glFrustum; glad_glFrustum = glTrace_Frustum; }
+    if (glad_glLoadIdentity) { glTraceReal_LoadIdentity = glad_glLoadIdentity; glad_glLoadIdentity = glTrace_LoadIdentity; }
+    if (glad_glLoadMatrixf) { glTraceReal_LoadMatrixf = glad_glLoadMatrixf; glad_glLoadMatrixf = glTrace_LoadMatrixf; }
+    if (glad_glLoadMatrixd) { glTraceReal_LoadMatrixd = glad_glLoadMatrixd; glad_glLoadMatrixd = glTrace_LoadMatrixd; }
+    if (glad_glMatrixMode) { glTraceReal_MatrixMode = glad_glMatrixMode; glad_glMatrixMode = glTrace_MatrixMode; }
+    if (glad_glMultMatrixf) { glTraceReal_MultMatrixf = glad_glMultMatrixf; glad_glMultMatrixf = glTrace_MultMatrixf; }
+    if (glad_glMultMatrixd) { glTraceReal_MultMatrixd = glad_glMultMatrixd; glad_glMultMatrixd = glTrace_MultMatrixd; }
+    if (glad_glOrtho) { glTraceReal_Ortho = glad_glOrtho; glad_glOrtho = glTrace_Ortho; }
+    if (glad_glPopMatrix) { glTraceReal_PopMatrix = glad_glPopMatrix; glad_glPopMatrix = glTrace_PopMatrix; }
+    if (glad_glPushMatrix) { glTraceReal_PushMatrix = glad_glPushMatrix; glad_glPushMatrix = glTrace_PushMatrix; }
+    if (glad_glRotated) { glTraceReal_Rotated = glad_glRotated; glad_glRotated = glTrace_Rotated; }
+    if (glad_glRotatef) { glTraceReal_Rotatef = glad_glRotatef; glad_glRotatef = glTrace_Rotatef; }
+    if (glad_glScaled) { glTraceReal_Scaled = glad_glScaled; glad_glScaled = glTrace_Scaled; }
+    if (glad_glScalef) { glTraceReal_Scalef = glad_glScalef; glad_glScalef = glTrace_Scalef; }
+    if (glad_glTranslated) { glTraceReal_Translated = glad_glTranslated; glad_glTranslated = glTrace_Translated; }
+    if (glad_glTranslatef) { glTraceReal_Translatef = glad_glTranslatef; glad_glTranslatef = glTrace_Translatef; }
+    if (glad_glDrawArrays) { glTraceReal_DrawArrays = glad_glDrawArrays; glad_glDrawArrays = glTrace_DrawArrays; }
+    if (glad_glDrawElements) { glTraceReal_DrawElements = glad_glDrawElements; glad_glDrawElements = glTrace_DrawElements; }
+    if (glad_glGetPointerv) { glTraceReal_GetPointerv = glad_glGetPointerv; glad_glGetPointerv = glTrace_GetPointerv; }
+    if (glad_glPolygonOffset) { glTraceReal_PolygonOffset = glad_glPolygonOffset; glad_glPolygonOffset = glTrace_PolygonOffset; }
+    if (glad_glCopyTexImage1D) { glTraceReal_CopyTexImage1D = glad_glCopyTexImage1D; glad_glCopyTexImage1D = glTrace_CopyTexImage1D; }
+    if (glad_glCopyTexImage2D) { glTraceReal_CopyTexImage2D = glad_glCopyTexImage2D; glad_glCopyTexImage2D = glTrace_CopyTexImage2D; }
+    if (glad_glCopyTexSubImage1D) { glTraceReal_CopyTexSubImage1D = glad_glCopyTexSubImage1D; glad_glCopyTexSubImage1D = glTrace_CopyTexSubImage1D; }
+    if (glad_glCopyTexSubImage2D) { glTraceReal_CopyTexSubImage2D = glad_glCopyTexSubImage2D; glad_glCopyTexSubImage2D = glTrace_CopyTexSubImage2D; }
+    if (glad_glTexSubImage1D) { glTraceReal_TexSubImage1D = glad_glTexSubImage1D; glad_glTexSubImage1D = glTrace_TexSubImage1D; }
+    if (glad_glTexSubImage2D) { glTraceReal_TexSubImage2D = glad_glTexSubImage2D; glad_glTexSubImage2D = glTrace_TexSubImage2D; }
+    if (glad_glBindTexture) { glTraceReal_BindTexture = glad_glBindTexture; glad_glBindTexture = glTrace_BindTexture; }
+    if (glad_glDeleteTextures) { glTraceReal_DeleteTextures = glad_glDeleteTextures; glad_glDeleteTextures = glTrace_DeleteTextures; }
+    if (glad_glGenTextures) { glTraceReal_GenTextures = glad_glGenTextures; glad_glGenTextures = glTrace_GenTextures; }
+    if (glad_glIsTexture) { glTraceReal_IsTexture = glad_glIsTexture; glad_glIsTexture = glTrace_IsTexture; }
+    if (glad_glArrayElement) { glTraceReal_ArrayElement = glad_glArrayElement; glad_glArrayElement = glTrace_ArrayElement; }
+    if (glad_glColorPointer) { glTraceReal_ColorPointer = glad_glColorPointer; glad_glColorPointer = glTrace_ColorPointer; }
+    if (glad_glDisableClientState) { glTraceReal_DisableClientState = glad_glDisableClientState; glad_glDisableClientState = glTrace_DisableClientState; }
+    if (glad_glEdgeFlagPointer) { glTraceReal_EdgeFlagPointer = glad_glEdgeFlagPointer; glad_glEdgeFlagPointer = glTrace_EdgeFlagPointer; }
+    if (glad_glEnableClientState) { glTraceReal_EnableClientState = glad_glEnableClientState; glad_glEnableClientState = glTrace_EnableClientState; }
+    if (glad_glIndexPointer) { glTraceReal_IndexPointer = glad_glIndexPointer; glad_glIndexPointer = glTrace_IndexPointer; }
+    if (glad_glInterleavedArrays) { glTraceReal_InterleavedArrays = glad_glInterleavedArrays; glad_glInterleavedArrays = glTrace_InterleavedArrays; }
+    if (glad_glNormalPointer) { glTraceReal_NormalPointer = glad_glNormalPointer; glad_glNormalPointer = glTrace_NormalPointer; }
+    if (glad_glTexCoordPointer) { glTraceReal_TexCoordPointer = glad_glTexCoordPointer; glad_glTexCoordPointer = glTrace_TexCoordPointer; }
+    if (glad_glVertexPointer) { glTraceReal_VertexPointer = glad_glVertexPointer; glad_glVertexPointer = glTrace_VertexPointer; }
+    if (glad_glAreTexturesResident) { glTraceReal_AreTexturesResident = glad_glAreTexturesResident; glad_glAreTexturesResident = glTrace_AreTexturesResident; }
+    if (glad_glPrioritizeTextures) { glTraceReal_PrioritizeTextures = glad_glPrioritizeTextures; glad_glPrioritizeTextures = glTrace_PrioritizeTextures; }
+    if (glad_glIndexub) { glTraceReal_Indexub = glad_glIndexub; glad_glIndexub = glTrace_Indexub; }
+    if (glad_glIndexubv) { glTraceReal_Indexubv = glad_glIndexubv; glad_glIndexubv = glTrace_Indexubv; }
+    if (glad_glPopClientAttrib) { glTraceReal_PopClientAttrib = glad_glPopClientAttrib; glad_glPopClientAttrib = glTrace_PopClientAttrib; }
+    if (glad_glPushClientAttrib) { glTraceReal_PushClientAttrib = glad_glPushClientAttrib; glad_glPushClientAttrib = glTrace_PushClientAttrib; }
+    if (glad_glDrawRangeElements) { glTraceReal_DrawRangeElements = glad_glDrawRangeElements; glad_glDrawRangeElements = glTrace_DrawRangeElements; }
+    if (glad_glTexImage3D) { glTraceReal_TexImage3D = glad_glTexImage3D; glad_glTexImage3D = glTrace_TexImage3D; }
+    if (glad_glTexSubImage3D) { glTraceReal_TexSubImage3D = glad_glTexSubImage3D; glad_glTexSubImage3D = glTrace_TexSubImage3D; }
+    if (glad_glCopyTexSubImage3D) { glTraceReal_CopyTexSubImage3D = glad_glCopyTexSubImage3D; glad_glCopyTexSubImage3D = glTrace_CopyTexSubImage3D; }
+    if (glad_glActiveTexture) { glTraceReal_ActiveTexture = glad_glActiveTexture; glad_glActiveTexture = glTrace_ActiveTexture; }
+    if (glad_glSampleCoverage) { glTraceReal_SampleCoverage = glad_glSampleCoverage; glad_glSampleCoverage = glTrace_SampleCoverage; }
+    if (glad_glCompressedTexImage3D) { glTraceReal_CompressedTexImage3D = glad_glCompressedTexImage3D; glad_glCompressedTexImage3D = glTrace_CompressedTexImage3D; }
+    if (glad_glCompressedTexImage2D) { glTraceReal_CompressedTexImage2D = glad_glCompressedTexImage2D; glad_glCompressedTexImage2D = glTrace_CompressedTexImage2D; }
+    if (glad_glCompressedTexImage1D) { glTraceReal_CompressedTexImage1D = glad_glCompressedTexImage1D; glad_glCompressedTexImage1D = glTrace_CompressedTexImage1D; }
+    if (glad_glCompressedTexSubImage3D) { glTraceReal_CompressedTexSubImage3D = glad_glCompressedTexSubImage3D; glad_glCompressedTexSubImage3D = glTrace_CompressedTexSubImage3D; }
+    if (glad_glCompressedTexSubImage2D) { glTraceReal_CompressedTexSubImage2D = glad_glCompressedTexSubImage2D; glad_glCompressedTexSubImage2D = glTrace_CompressedTexSubImage2D; }
+    if (glad_glCompressedTexSubImage1D) { glTraceReal_CompressedTexSubImage1D = glad_glCompressedTexSubImage1D; glad_glCompressedTexSubImage1D = glTrace_CompressedTexSubImage1D; }
+    if (glad_glGetCompressedTexImage) { glTraceReal_GetCompressedTexImage = glad_glGetCompressedTexImage; glad_glGetCompressedTexImage = glTrace_GetCompressedTexImage; }
+    if (glad_glClientActiveTexture) { glTraceReal_ClientActiveTexture = glad_glClientActiveTexture; glad_glClientActiveTexture = glTrace_ClientActiveTexture; }
+    if (glad_glMultiTexCoord1d) { glTraceReal_MultiTexCoord1d = glad_glMultiTexCoord1d; glad_glMultiTexCoord1d = glTrace_MultiTexCoord1d; }
+    if (glad_glMultiTexCoord1dv) { glTraceReal_MultiTexCoord1dv = glad_glMultiTexCoord1dv; glad_glMultiTexCoord1dv = glTrace_MultiTexCoord1dv; }
+    if (glad_glMultiTexCoord1f) { glTraceReal_MultiTexCoord1f = glad_glMultiTexCoord1f; glad_glMultiTexCoord1f = glTrace_MultiTexCoord1f; }
+    if (glad_glMultiTexCoord1fv) { glTraceReal_MultiTexCoord1fv = glad_glMultiTexCoord1fv; glad_glMultiTexCoord1fv = glTrace_MultiTexCoord1fv; }
+    if (glad_glMultiTexCoord1i) { glTraceReal_MultiTexCoord1i = glad_glMultiTexCoord1i; glad_glMultiTexCoord1i = glTrace_MultiTexCoord1i; }
+    if (glad_glMultiTexCoord1iv) { glTraceReal_MultiTexCoord1iv = glad_glMultiTexCoord1iv; glad_glMultiTexCoord1iv = glTrace_MultiTexCoord1iv; }
+    if (glad_glMultiTexCoord1s) { glTraceReal_MultiTexCoord1s = glad_glMultiTexCoord1s; glad_glMultiTexCoord1s = glTrace_MultiTexCoord1s; }
+    if (glad_glMultiTexCoord1sv) { glTraceReal_MultiTexCoord1sv = glad_glMultiTexCoord1sv; glad_glMultiTexCoord1sv = glTrace_MultiTexCoord1sv; }
+    if (glad_glMultiTexCoord2d) { glTraceReal_MultiTexCoord2d = glad_glMultiTexCoord2d; glad_glMultiTexCoord2d = glTrace_MultiTexCoord2d; }
+    if (glad_glMultiTexCoord2dv) { glTraceReal_MultiTexCoord2dv = glad_glMultiTexCoord2dv; glad_glMultiTexCoord2dv = glTrace_MultiTexCoord2dv; }
+    if (glad_glMultiTexCoord2f) { glTraceReal_MultiTexCoord2f = glad_glMultiTexCoord2f; glad_glMultiTexCoord2f = glTrace_MultiTexCoord2f; }
+    if (glad_glMultiTexCoord2fv) { glTraceReal_MultiTexCoord2fv = glad_glMultiTexCoord2fv; glad_glMultiTexCoord2fv = glTrace_MultiTexCoord2fv; }
+    if (glad_glMultiTexCoord2i) { glTraceReal_MultiTexCoord2i = glad_glMultiTexCoord2i; glad_glMultiTexCoord2i = glTrace_MultiTexCoord2i; }
+    if (glad_glMultiTexCoord2iv) { glTraceReal_MultiTexCoord2iv = glad_glMultiTexCoord2iv; glad_glMultiTexCoord2iv = glTrace_MultiTexCoord2iv; }
+    if (glad_glMultiTexCoord2s) { glTraceReal_MultiTexCoord2s = glad_glMultiTexCoord2s; glad_glMultiTexCoord2s = glTrace_MultiTexCoord2s; }
+    if (glad_glMultiTexCoord2sv) { glTraceReal_MultiTexCoord2sv = glad_glMultiTexCoord2sv; glad_glMultiTexCoord2sv = glTrace_MultiTexCoord2sv; }
+    if (glad_glMultiTexCoord3d) { glTraceReal_MultiTexCoord3d = glad_glMultiTexCoord3d; glad_glMultiTexCoord3d = glTrace_MultiTexCoord3d; }
+    if (glad_glMultiTexCoord3dv) { glTraceReal_MultiTexCoord3dv = glad_glMultiTexCoord3dv; glad_glMultiTexCoord3dv = glTrace_MultiTexCoord3dv; }
+    if (glad_glMultiTexCoord3f) { glTraceReal_MultiTexCoord3f = glad_glMultiTexCoord3f; glad_glMultiTexCoord3f = glTrace_MultiTexCoord3f; }
+    if (glad_glMultiTexCoord3fv) { glTraceReal_MultiTexCoord3fv = glad_glMultiTexCoord3fv; glad_glMultiTexCoord3fv = glTrace_MultiTexCoord3fv; }
+    if (glad_glMultiTexCoord3i) { glTraceReal_MultiTexCoord3i = glad_glMultiTexCoord3i; glad_glMultiTexCoord3i = glTrace_MultiTexCoord3i; }
+    if (glad_glMultiTexCoord3iv) { glTraceReal_MultiTexCoord3iv = glad_glMultiTexCoord3iv; glad_glMultiTexCoord3iv = glTrace_MultiTexCoord3iv; }
+    if (glad_glMultiTexCoord3s) { glTraceReal_MultiTexCoord3s = glad_glMultiTexCoord3s; glad_glMultiTexCoord3s = glTrace_MultiTexCoord3s; }
+    if (glad_glMultiTexCoord3sv) { glTraceReal_MultiTexCoord3sv = glad_glMultiTexCoord3sv; glad_glMultiTexCoord3sv = glTrace_MultiTexCoord3sv; }
+    if (glad_glMultiTexCoord4d) { glTraceReal_MultiTexCoord4d = glad_glMultiTexCoord4d; glad_glMultiTexCoord4d = glTrace_MultiTexCoord4d; }
+    if (glad_glMultiTexCoord4dv) { glTraceReal_MultiTexCoord4dv = glad_glMultiTexCoord4dv; glad_glMultiTexCoord4dv = glTrace_MultiTexCoord4dv; }
+    if (glad_glMultiTexCoord4f) { glTraceReal_MultiTexCoord4f = glad_glMultiTexCoord4f; glad_glMultiTexCoord4f = glTrace_MultiTexCoord4f; }
+    if (glad_glMultiTexCoord4fv) { glTraceReal_MultiTexCoord4fv = glad_glMultiTexCoord4fv; glad_glMultiTexCoord4fv = glTrace_MultiTexCoord4fv; }
+    if (glad_glMultiTexCoord4i) { glTraceReal_MultiTexCoord4i = glad_glMultiTexCoord4i; glad_glMultiTexCoord4i = glTrace_MultiTexCoord4i; }
+    if (glad_glMultiTexCoord4iv) { glTraceReal_MultiTexCoord4iv = glad_glMultiTexCoord4iv; glad_glMultiTexCoord4iv = glTrace_MultiTexCoord4iv; }
+    if (glad_glMultiTexCoord4s) { glTraceReal_MultiTexCoord4s = glad_glMultiTexCoord4s; glad_glMultiTexCoord4s = glTrace_MultiTexCoord4s; }
+    if (glad_glMultiTexCoord4sv) { glTraceReal_MultiTexCoord4sv = glad_glMultiTexCoord4sv; glad_glMultiTexCoord4sv = glTrace_MultiTexCoord4sv; }
+    if (glad_glLoadTransposeMatrixf) { glTraceReal_LoadTransposeMatrixf = glad_glLoadTransposeMatrixf; glad_glLoadTransposeMatrixf = glTrace_LoadTransposeMatrixf; }
+    if (glad_glLoadTransposeMatrixd) { glTraceReal_LoadTransposeMatrixd = glad_glLoadTransposeMatrixd; glad_glLoadTransposeMatrixd = glTrace_LoadTransposeMatrixd; }
+    if (glad_glMultTransposeMatrixf) { glTraceReal_MultTransposeMatrixf = glad_glMultTransposeMatrixf; glad_glMultTransposeMatrixf = glTrace_MultTransposeMatrixf; }
+    if (glad_glMultTransposeMatrixd) { glTraceReal_MultTransposeMatrixd = glad_glMultTransposeMatrixd; glad_glMultTransposeMatrixd = glTrace_MultTransposeMatrixd; }
+    if (glad_glBlendFuncSeparate) { glTraceReal_BlendFuncSeparate = glad_glBlendFuncSeparate; glad_glBlendFuncSeparate = glTrace_BlendFuncSeparate; }
+    if (glad_glMultiDrawArrays) { glTraceReal_MultiDrawArrays = glad_glMultiDrawArrays; glad_glMultiDrawArrays = glTrace_MultiDrawArrays; }
+    if (glad_glMultiDrawElements) { glTraceReal_MultiDrawElements = glad_glMultiDrawElements; glad_glMultiDrawElements = glTrace_MultiDrawElements; }
+    if (glad_glPointParameterf) { glTraceReal_PointParameterf = glad_glPointParameterf; glad_glPointParameterf = glTrace_PointParameterf; }
+    if (glad_glPointParameterfv) { glTraceReal_PointParameterfv = glad_glPointParameterfv; glad_glPointParameterfv = glTrace_PointParameterfv; }
+    if (glad_glPointParameteri) { glTraceReal_PointParameteri = glad_glPointParameteri; glad_glPointParameteri = glTrace_PointParameteri; }
+    if (glad_glPointParameteriv) { glTraceReal_PointParameteriv = glad_glPointParameteriv; glad_glPointParameteriv = glTrace_PointParameteriv; }
+    if (glad_glFogCoordf) { glTraceReal_FogCoordf = glad_glFogCoordf; glad_glFogCoordf = glTrace_FogCoordf; }
+    if (glad_glFogCoordfv) { glTraceReal_FogCoordfv = glad_glFogCoordfv; glad_glFogCoordfv = glTrace_FogCoordfv; }
+    if (glad_glFogCoordd) { glTraceReal_FogCoordd = glad_glFogCoordd; glad_glFogCoordd = glTrace_FogCoordd; }
+    if (glad_glFogCoorddv) { glTraceReal_FogCoorddv = glad_glFogCoorddv; glad_glFogCoorddv = glTrace_FogCoorddv; }
+    if (glad_glFogCoordPointer) { glTraceReal_FogCoordPointer = glad_glFogCoordPointer; glad_glFogCoordPointer = glTrace_FogCoordPointer; }
+    if (glad_glSecondaryColor3b) { glTraceReal_SecondaryColor3b = glad_glSecondaryColor3b; glad_glSecondaryColor3b = glTrace_SecondaryColor3b; }
+    if (glad_glSecondaryColor3bv) { glTraceReal_SecondaryColor3bv = glad_glSecondaryColor3bv; glad_glSecondaryColor3bv = glTrace_SecondaryColor3bv; }
+    if (glad_glSecondaryColor3d) { glTraceReal_SecondaryColor3d = glad_glSecondaryColor3d; glad_glSecondaryColor3d = glTrace_SecondaryColor3d; }
+    if (glad_glSecondaryColor3dv) { glTraceReal_SecondaryColor3dv = glad_glSecondaryColor3dv; glad_glSecondaryColor3dv = glTrace_SecondaryColor3dv; }
+    if (glad_glSecondaryColor3f) { glTraceReal_SecondaryColor3f = glad_glSecondaryColor3f; glad_glSecondaryColor3f = glTrace_SecondaryColor3f; }
+    if (glad_glSecondaryColor3fv) { glTraceReal_SecondaryColor3fv = glad_glSecondaryColor3fv; glad_glSecondaryColor3fv = glTrace_SecondaryColor3fv; }
+    if (glad_glSecondaryColor3i) { glTraceReal_SecondaryColor3i = glad_glSecondaryColor3i; glad_glSecondaryColor3i = glTrace_SecondaryColor3i; }
+    if (glad_glSecondaryColor3iv) { glTraceReal_SecondaryColor3iv = glad_glSecondaryColor3iv; glad_glSecondaryColor3iv = glTrace_SecondaryColor3iv; }
+    if (glad_glSecondaryColor3s) { glTraceReal_SecondaryColor3s = glad_glSecondaryColor3s; glad_glSecondaryColor3s = glTrace_SecondaryColor3s; }
+    if (glad_glSecondaryColor3sv) { glTraceReal_SecondaryColor3sv = glad_glSecondaryColor3sv; glad_glSecondaryColor3sv = glTrace_SecondaryColor3sv; }
+    if (glad_glSecondaryColor3ub) { glTraceReal_SecondaryColor3ub = glad_glSecondaryColor3ub; glad_glSecondaryColor3ub = glTrace_SecondaryColor3ub; }
+    if (glad_glSecondaryColor3ubv) { glTraceReal_SecondaryColor3ubv = glad_glSecondaryColor3ubv; glad_glSecondaryColor3ubv = glTrace_SecondaryColor3ubv; }
+    if (glad_glSecondaryColor3ui) { glTraceReal_SecondaryColor3ui = glad_glSecondaryColor3ui; glad_glSecondaryColor3ui = glTrace_SecondaryColor3ui; }
+    if (glad_glSecondaryColor3uiv) { glTraceReal_SecondaryColor3uiv = glad_glSecondaryColor3uiv; glad_glSecondaryColor3uiv = glTrace_SecondaryColor3uiv; }
+    if (glad_glSecondaryColor3us) { glTraceReal_SecondaryColor3us = glad_glSecondaryColor3us; glad_glSecondaryColor3us = glTrace_SecondaryColor3us; }
+    if (glad_glSecondaryColor3usv) { glTraceReal_SecondaryColor3usv = glad_glSecondaryColor3usv; glad_glSecondaryColor3usv = glTrace_SecondaryColor3usv; }
+    if (glad_glSecondaryColorPointer) { glTraceReal_SecondaryColorPointer = glad_glSecondaryColorPointer; glad_glSecondaryColorPointer = glTrace_SecondaryColorPointer; }
+    if (glad_glWindowPos2d) { glTraceReal_WindowPos2d = glad_glWindowPos2d; glad_glWindowPos2d = glTrace_WindowPos2d; }
+    if (glad_glWindowPos2dv) { glTraceReal_WindowPos2dv = glad_glWindowPos2dv; glad_glWindowPos2dv = glTrace_WindowPos2dv; }
+    if (glad_glWindowPos2f) { glTraceReal_WindowPos2f = glad_glWindowPos2f; glad_glWindowPos2f = glTrace_WindowPos2f; }
+    if (glad_glWindowPos2fv) { glTraceReal_WindowPos2fv = glad_glWindowPos2fv; glad_glWindowPos2fv = glTrace_WindowPos2fv; }
+    if (glad_glWindowPos2i) { glTraceReal_WindowPos2i = glad_glWindowPos2i; glad_glWindowPos2i = glTrace_WindowPos2i; }
+    if (glad_glWindowPos2iv) { glTraceReal_WindowPos2iv = glad_glWindowPos2iv; glad_glWindowPos2iv = glTrace_WindowPos2iv; }
+    if (glad_glWindowPos2s) { glTraceReal_WindowPos2s = glad_glWindowPos2s; glad_glWindowPos2s = glTrace_WindowPos2s; }
+    if (glad_glWindowPos2sv) { glTraceReal_WindowPos2sv = glad_glWindowPos2sv; glad_glWindowPos2sv = glTrace_WindowPos2sv; }
+    if (glad_glWindowPos3d) { glTraceReal_WindowPos3d = glad_glWindowPos3d; glad_glWindowPos3d = glTrace_WindowPos3d; }
+    if (glad_glWindowPos3dv) { glTraceReal_WindowPos3dv = glad_glWindowPos3dv; glad_glWindowPos3dv = glTrace_WindowPos3dv; }
+    if (glad_glWindowPos3f) { glTraceReal_WindowPos3f = glad_glWindowPos3f; glad_glWindowPos3f = glTrace_WindowPos3f; }
+    if (glad_glWindowPos3fv) { glTraceReal_WindowPos3fv = glad_glWindowPos3fv; glad_glWindowPos3fv = glTrace_WindowPos3fv; }
+    if (glad_glWindowPos3i) { glTraceReal_WindowPos3i = glad_glWindowPos3i; glad_glWindowPos3i = glTrace_WindowPos3i; }
+    if (glad_glWindowPos3iv) { glTraceReal_WindowPos3iv = glad_glWindowPos3iv; glad_glWindowPos3iv = glTrace_WindowPos3iv; }
+    if (glad_glWindowPos3s) { glTraceReal_WindowPos3s = glad_glWindowPos3s; glad_glWindowPos3s = glTrace_WindowPos3s; }
+    if (glad_glWindowPos3sv) { glTraceReal_WindowPos3sv = glad_glWindowPos3sv; glad_glWindowPos3sv = glTrace_WindowPos3sv; }
+    if (glad_glBlendColor) { glTraceReal_BlendColor = glad_glBlendColor; glad_glBlendColor = glTrace_BlendColor; }
+    if (glad_glBlendEquation) { glTraceReal_BlendEquation = glad_glBlendEquation; glad_glBlendEquation = glTrace_BlendEquation; }
+    if (glad_glGenQueries) { glTraceReal_GenQueries = glad_glGenQueries; glad_glGenQueries = glTrace_GenQueries; }
+    if (glad_glDeleteQueries) { glTraceReal_DeleteQueries = glad_glDeleteQueries; glad_glDeleteQueries = glTrace_DeleteQueries; }
+    if (glad_glIsQuery) { glTraceReal_IsQuery = glad_glIsQuery; glad_glIsQuery = glTrace_IsQuery; }
+    if (glad_glBeginQuery) { glTraceReal_BeginQuery = glad_glBeginQuery; glad_glBeginQuery = glTrace_BeginQuery; }
+    if (glad_glEndQuery) { glTraceReal_EndQuery = glad_glEndQuery; glad_glEndQuery = glTrace_EndQuery; }
+    if (glad_glGetQueryiv) { glTraceReal_GetQueryiv = glad_glGetQueryiv; glad_glGetQueryiv = glTrace_GetQueryiv; }
+    if (glad_glGetQueryObjectiv) { glTraceReal_GetQueryObjectiv = glad_glGetQueryObjectiv; glad_glGetQueryObjectiv = glTrace_GetQueryObjectiv; }
+    if (glad_glGetQueryObjectuiv) { glTraceReal_GetQueryObjectuiv = glad_glGetQueryObjectuiv; glad_glGetQueryObjectuiv = glTrace_GetQueryObjectuiv; }
+    if (glad_glBindBuffer) { glTraceReal_BindBuffer = glad_glBindBuffer; glad_glBindBuffer = glTrace_BindBuffer; }
+    if (glad_glDeleteBuffers) { glTraceReal_DeleteBuffers = glad_glDeleteBuffers; glad_glDeleteBuffers = glTrace_DeleteBuffers; }
+    if (glad_glGenBuffers) { glTraceReal_GenBuffers = glad_glGenBuffers; glad_glGenBuffers = glTrace_GenBuffers; }
+    if (glad_glIsBuffer) { glTraceReal_IsBuffer = glad_glIsBuffer; glad_glIsBuffer = glTrace_IsBuffer; }
+    if (glad_glBufferData) { glTraceReal_BufferData = glad_glBufferData; glad_glBufferData = glTrace_BufferData; }
+    if (glad_glBufferSubData) { glTraceReal_BufferSubData = glad_glBufferSubData; glad_glBufferSubData = glTrace_BufferSubData; }
+    if (glad_glGetBufferSubData) { glTraceReal_GetBufferSubData = glad_glGetBufferSubData; glad_glGetBufferSubData = glTrace_GetBufferSubData; }
+    if (glad_glMapBuffer) { glTraceReal_MapBuffer = glad_glMapBuffer; glad_glMapBuffer = glTrace_MapBuffer; }
+    if (glad_glUnmapBuffer) { glTraceReal_UnmapBuffer = glad_glUnmapBuffer; glad_glUnmapBuffer = glTrace_UnmapBuffer; }
+    if (glad_glGetBufferParameteriv) { glTraceReal_GetBufferParameteriv = glad_glGetBufferParameteriv; glad_glGetBufferParameteriv = glTrace_GetBufferParameteriv; }
+    if (glad_glGetBufferPointerv) { glTraceReal_GetBufferPointerv = glad_glGetBufferPointerv; glad_glGetBufferPointerv = glTrace_GetBufferPointerv; }
+    if (glad_glBlendEquationSeparate) { glTraceReal_BlendEquationSeparate = glad_glBlendEquationSeparate; glad_glBlendEquationSeparate = glTrace_BlendEquationSeparate; }
+    if (glad_glDrawBuffers) { glTraceReal_DrawBuffers = glad_glDrawBuffers; glad_glDrawBuffers = glTrace_DrawBuffers; }
+    if (glad_glStencilOpSeparate) { glTraceReal_StencilOpSeparate = glad_glStencilOpSeparate; glad_glStencilOpSeparate = glTrace_StencilOpSeparate; }
+    if (glad_glStencilFuncSeparate) { glTraceReal_StencilFuncSeparate = glad_glStencilFuncSeparate; glad_glStencilFuncSeparate = glTrace_StencilFuncSeparate; }
+    if (glad_glStencilMaskSeparate) { glTraceReal_StencilMaskSeparate = glad_glStencilMaskSeparate; glad_glStencilMaskSeparate = glTrace_StencilMaskSeparate; }
+    if (glad_glAttachShader) { glTraceReal_AttachShader = glad_glAttachShader; glad_glAttachShader = glTrace_AttachShader; }
+    if (glad_glBindAttribLocation) { glTraceReal_BindAttribLocation = glad_glBindAttribLocation; glad_glBindAttribLocation = glTrace_BindAttribLocation; }
+    if (glad_glCompileShader) { glTraceReal_CompileShader = glad_glCompileShader; glad_glCompileShader = glTrace_CompileShader; }
+    if (glad_glCreateProgram) { glTraceReal_CreateProgram = glad_glCreateProgram; glad_glCreateProgram = glTrace_CreateProgram; }
+    if (glad_glCreateShader) { glTraceReal_CreateShader = glad_glCreateShader; glad_glCreateShader = glTrace_CreateShader; }
+    if (glad_glDeleteProgram) { glTraceReal_DeleteProgram = glad_glDeleteProgram; glad_glDeleteProgram = glTrace_DeleteProgram; }
+    if (glad_glDeleteShader) { glTraceReal_DeleteShader = glad_glDeleteShader; glad_glDeleteShader = glTrace_DeleteShader; }
+    if (glad_glDetachShader) { glTraceReal_DetachShader = glad_glDetachShader; glad_glDetachShader = glTrace_DetachShader; }
+    if (glad_glDisableVertexAttribArray) { glTraceReal_DisableVertexAttribArray = glad_glDisableVertexAttribArray; glad_glDisableVertexAttribArray = glTrace_DisableVertexAttribArray; }
+    if (glad_glEnableVertexAttribArray) { glTraceReal_EnableVertexAttribArray = glad_glEnableVertexAttribArray; glad_glEnableVertexAttribArray = glTrace_EnableVertexAttribArray; }
+    if (glad_glGetActiveAttrib) { glTraceReal_GetActiveAttrib = glad_glGetActiveAttrib; glad_glGetActiveAttrib = glTrace_GetActiveAttrib; }
+    if (glad_glGetActiveUniform) { glTraceReal_GetActiveUniform = glad_glGetActiveUniform; glad_glGetActiveUniform = glTrace_GetActiveUniform; }
+    if (glad_glGetAttachedShaders) { glTraceReal_GetAttachedShaders = glad_glGetAttachedShaders; glad_glGetAttachedShaders = glTrace_GetAttachedShaders; }
+    if (glad_glGetAttribLocation) { glTraceReal_GetAttribLocation = glad_glGetAttribLocation; glad_glGetAttribLocation = glTrace_GetAttribLocation; }
+    if (glad_glGetProgramiv) { glTraceReal_GetProgramiv = glad_glGetProgramiv; glad_glGetProgramiv = glTrace_GetProgramiv; }
+    if (glad_glGetProgramInfoLog) { glTraceReal_GetProgramInfoLog = glad_glGetProgramInfoLog; glad_glGetProgramInfoLog = glTrace_GetProgramInfoLog; }
+    if (glad_glGetShaderiv) { glTraceReal_GetShaderiv = glad_glGetShaderiv; glad_glGetShaderiv = glTrace_GetShaderiv; }
+    if (glad_glGetShaderInfoLog) { glTraceReal_GetShaderInfoLog = glad_glGetShaderInfoLog; glad_glGetShaderInfoLog = glTrace_GetShaderInfoLog; }
+    if (glad_glGetShaderSource) { glTraceReal_GetShaderSource = glad_glGetShaderSource; glad_glGetShaderSource = glTrace_GetShaderSource; }
+    if (glad_glGetUniformLocation) { glTraceReal_GetUniformLocation = glad_glGetUniformLocation; glad_glGetUniformLocation = glTrace_GetUniformLocation; }
+    if (glad_glGetUniformfv) { glTraceReal_GetUniformfv = glad_glGetUniformfv; glad_glGetUniformfv = glTrace_GetUniformfv; }
+    if (glad_glGetUniformiv) { glTraceReal_GetUniformiv = glad_glGetUniformiv; glad_glGetUniformiv = glTrace_GetUniformiv; }
+    if (glad_glGetVertexAttribdv) { glTraceReal_GetVertexAttribdv = glad_glGetVertexAttribdv; glad_glGetVertexAttribdv = glTrace_GetVertexAttribdv; }
+    if (glad_glGetVertexAttribfv) { glTraceReal_GetVertexAttribfv = glad_glGetVertexAttribfv; glad_glGetVertexAttribfv = glTrace_GetVertexAttribfv; }
+    if (glad_glGetVertexAttribiv) { glTraceReal_GetVertexAttribiv = glad_glGetVertexAttribiv; glad_glGetVertexAttribiv = glTrace_GetVertexAttribiv; }
+    if (glad_glGetVertexAttribPointerv) { glTraceReal_GetVertexAttribPointerv = glad_glGetVertexAttribPointerv; glad_glGetVertexAttribPointerv = glTrace_GetVertexAttribPointerv; }
+    if (glad_glIsProgram) { glTraceReal_IsProgram = glad_glIsProgram; glad_glIsProgram = glTrace_IsProgram; }
+    if (glad_glIsShader) { glTraceReal_IsShader = glad_glIsShader; glad_glIsShader = glTrace_IsShader; }
+    if (glad_glLinkProgram) { glTraceReal_LinkProgram = glad_glLinkProgram; glad_glLinkProgram = glTrace_LinkProgram; }
+    if (glad_glShaderSource) { glTraceReal_ShaderSource = glad_glShaderSource; glad_glShaderSource = glTrace_ShaderSource; }
+    if (glad_glUseProgram) { glTraceReal_UseProgram = glad_glUseProgram; glad_glUseProgram = glTrace_UseProgram; }
+    if (glad_glUniform1f) { glTraceReal_Uniform1f = glad_glUniform1f; glad_glUniform1f = glTrace_Uniform1f; }
+    if (glad_glUniform2f) { glTraceReal_Uniform2f = glad_glUniform2f; glad_glUniform2f = glTrace_Uniform2f; }
+    if (glad_glUniform3f) { glTraceReal_Uniform3f = glad_glUniform3f; glad_glUniform3f = glTrace_Uniform3f; }
+    if (glad_glUniform4f) { glTraceReal_Uniform4f = glad_glUniform4f; glad_glUniform4f = glTrace_Uniform4f; }
+    if (glad_glUniform1i) { glTraceReal_Uniform1i = glad_glUniform1i; glad_glUniform1i = glTrace_Uniform1i; }
+    if (glad_glUniform2i) { glTraceReal_Uniform2i = glad_glUniform2i; glad_glUniform2i = glTrace_Uniform2i; }
+    if (glad_glUniform3i) { glTraceReal_Uniform3i = glad_glUniform3i; glad_glUniform3i = glTrace_Uniform3i; }
+    if (glad_glUniform4i) { glTraceReal_Uniform4i = glad_glUniform4i; glad_glUniform4i = glTrace_Uniform4i; }
+    if (glad_glUniform1fv) { glTraceReal_Uniform1fv = glad_glUniform1fv; glad_glUniform1fv = glTrace_Uniform1fv; }
+    if (glad_glUniform2fv) { glTraceReal_Uniform2fv = glad_glUniform2fv; glad_glUniform2fv = glTrace_Uniform2fv; }
+    if (glad_glUniform3fv) { glTraceReal_Uniform3fv = glad_glUniform3fv; glad_glUniform3fv = glTrace_Uniform3fv; }
+    if (glad_glUniform4fv) { glTraceReal_Uniform4fv = glad_glUniform4fv; glad_glUniform4fv = glTrace_Uniform4fv; }
+    if (glad_glUniform1iv) { glTraceReal_Uniform1iv = glad_glUniform1iv; glad_glUniform1iv = glTrace_Uniform1iv; }
+    if (glad_glUniform2iv) { glTraceReal_Uniform2iv = glad_glUniform2iv; glad_glUniform2iv = glTrace_Uniform2iv; }
+    if (glad_glUniform3iv) { glTraceReal_Uniform3iv = glad_glUniform3iv; glad_glUniform3iv = glTrace_Uniform3iv; }
+    if (glad_glUniform4iv) { glTraceReal_Uniform4iv = glad_glUniform4iv; glad_glUniform4iv = glTrace_Uniform4iv; }
+    if (glad_glUniformMatrix2fv) { glTraceReal_UniformMatrix2fv = glad_glUniformMatrix2fv; glad_glUniformMatrix2fv = glTrace_UniformMatrix2fv; }
+    if (glad_glUniformMatrix3fv) { glTraceReal_UniformMatrix3fv = glad_glUniformMatrix3fv; glad_glUniformMatrix3fv = glTrace_UniformMatrix3fv; }
+    if (glad_glUniformMatrix4fv) { glTraceReal_UniformMatrix4fv = glad_glUniformMatrix4fv; glad_glUniformMatrix4fv = glTrace_UniformMatrix4fv; }
+    if (glad_glValidateProgram) { glTraceReal_ValidateProgram = glad_glValidateProgram; glad_glValidateProgram = glTrace_ValidateProgram; }
+    if (glad_glVertexAttrib1d) { glTraceReal_VertexAttrib1d = glad_glVertexAttrib1d; glad_glVertexAttrib1d = glTrace_VertexAttrib1d; }
+    if (glad_glVertexAttrib1dv) { glTraceReal_VertexAttrib1dv = glad_glVertexAttrib1dv; glad_glVertexAttrib1dv = glTrace_VertexAttrib1dv; }
+    if (glad_glVertexAttrib1f) { glTraceReal_VertexAttrib1f = glad_glVertexAttrib1f; glad_glVertexAttrib1f = glTrace_VertexAttrib1f; }
+    if (glad_glVertexAttrib1fv) { glTraceReal_VertexAttrib1fv = glad_glVertexAttrib1fv; glad_glVertexAttrib1fv = glTrace_VertexAttrib1fv; }
+    if (glad_glVertexAttrib1s) { glTraceReal_VertexAttrib1s = glad_glVertexAttrib1s; glad_glVertexAttrib1s = glTrace_VertexAttrib1s; }
+    if (glad_glVertexAttrib1sv) { glTraceReal_VertexAttrib1sv = glad_glVertexAttrib1sv; glad_glVertexAttrib1sv = glTrace_VertexAttrib1sv; }
+    if (glad_glVertexAttrib2d) { glTraceReal_VertexAttrib2d = glad_glVertexAttrib2d; glad_glVertexAttrib2d = glTrace_VertexAttrib2d; }
+    if (glad_glVertexAttrib2dv) { glTraceReal_VertexAttrib2dv = glad_glVertexAttrib2dv; glad_glVertexAttrib2dv = glTrace_VertexAttrib2dv; }
+    if (glad_glVertexAttrib2f) { glTraceReal_VertexAttrib2f = glad_glVertexAttrib2f; glad_glVertexAttrib2f = glTrace_VertexAttrib2f; }
+    if (glad_glVertexAttrib2fv) { glTraceReal_VertexAttrib2fv = glad_glVertexAttrib2fv; glad_glVertexAttrib2fv = glTrace_VertexAttrib2fv; }
+    if (glad_glVertexAttrib2s) { glTraceReal_VertexAttrib2s = glad_glVertexAttrib2s; glad_glVertexAttrib2s = glTrace_VertexAttrib2s; }
+    if (glad_glVertexAttrib2sv) { glTraceReal_VertexAttrib2sv = glad_glVertexAttrib2sv; glad_glVertexAttrib2sv = glTrace_VertexAttrib2sv; }
+    if (glad_glVertexAttrib3d) { glTraceReal_VertexAttrib3d = glad_glVertexAttrib3d; glad_glVertexAttrib3d = glTrace_VertexAttrib3d; }
+    if (glad_glVertexAttrib3dv) { glTraceReal_VertexAttrib3dv = glad_glVertexAttrib3dv; glad_glVertexAttrib3dv = glTrace_VertexAttrib3dv; }
+    if (glad_glVertexAttrib3f) { glTraceReal_VertexAttrib3f = glad_glVertexAttrib3f; glad_glVertexAttrib3f = glTrace_VertexAttrib3f; }
+    if (glad_glVertexAttrib3fv) { glTraceReal_VertexAttrib3fv = glad_glVertexAttrib3fv; glad_glVertexAttrib3fv = glTrace_VertexAttrib3fv; }
+    if (glad_glVertexAttrib3s) { glTraceReal_VertexAttrib3s = glad_glVertexAttrib3s; glad_glVertexAttrib3s = glTrace_VertexAttrib3s; }
+    if (glad_glVertexAttrib3sv) { glTraceReal_VertexAttrib3sv = glad_glVertexAttrib3sv; glad_glVertexAttrib3sv = glTrace_VertexAttrib3sv; }
+    if (glad_glVertexAttrib4Nbv) { glTraceReal_VertexAttrib4Nbv = glad_glVertexAttrib4Nbv; glad_glVertexAttrib4Nbv = glTrace_VertexAttrib4Nbv; }
+    if (glad_glVertexAttrib4Niv) { glTraceReal_VertexAttrib4Niv = glad_glVertexAttrib4Niv; glad_glVertexAttrib4Niv = glTrace_VertexAttrib4Niv; }
+    if (glad_glVertexAttrib4Nsv) { glTraceReal_VertexAttrib4Nsv = glad_glVertexAttrib4Nsv; glad_glVertexAttrib4Nsv = glTrace_VertexAttrib4Nsv; }
+    if (glad_glVertexAttrib4Nub) { glTraceReal_VertexAttrib4Nub = glad_glVertexAttrib4Nub; glad_glVertexAttrib4Nub = glTrace_VertexAttrib4Nub; }
+    if (glad_glVertexAttrib4Nubv) { glTraceReal_VertexAttrib4Nubv = glad_glVertexAttrib4Nubv; glad_glVertexAttrib4Nubv = glTrace_VertexAttrib4Nubv; }
+    if (glad_glVertexAttrib4Nuiv) { glTraceReal_VertexAttrib4Nuiv = glad_glVertexAttrib4Nuiv; glad_glVertexAttrib4Nuiv = glTrace_VertexAttrib4Nuiv; }
+    if (glad_glVertexAttrib4Nusv) { glTraceReal_VertexAttrib4Nusv = glad_glVertexAttrib4Nusv; glad_glVertexAttrib4Nusv = glTrace_VertexAttrib4Nusv; }
+    if (glad_glVertexAttrib4bv) { glTraceReal_VertexAttrib4bv = glad_glVertexAttrib4bv; glad_glVertexAttrib4bv = glTrace_VertexAttrib4bv; }
+    if (glad_glVertexAttrib4d) { glTraceReal_VertexAttrib4d = glad_glVertexAttrib4d; glad_glVertexAttrib4d = glTrace_VertexAttrib4d; }
+    if (glad_glVertexAttrib4dv) { glTraceReal_VertexAttrib4dv = glad_glVertexAttrib4dv; glad_glVertexAttrib4dv = glTrace_VertexAttrib4dv; }
+    if (glad_glVertexAttrib4f) { glTraceReal_VertexAttrib4f = glad_glVertexAttrib4f; glad_glVertexAttrib4f = glTrace_VertexAttrib4f; }
+    if (glad_glVertexAttrib4fv) { glTraceReal_VertexAttrib4fv = glad_glVertexAttrib4fv; glad_glVertexAttrib4fv = glTrace_VertexAttrib4fv; }
+    if (glad_glVertexAttrib4iv) { glTraceReal_VertexAttrib4iv = glad_glVertexAttrib4iv; glad_glVertexAttrib4iv = glTrace_VertexAttrib4iv; }
+    if (glad_glVertexAttrib4s) { glTraceReal_VertexAttrib4s = glad_glVertexAttrib4s; glad_glVertexAttrib4s = glTrace_VertexAttrib4s; }
+    if (glad_glVertexAttrib4sv) { glTraceReal_VertexAttrib4sv = glad_glVertexAttrib4sv; glad_glVertexAttrib4sv = glTrace_VertexAttrib4sv; }
+    if (glad_glVertexAttrib4ubv) { glTraceReal_VertexAttrib4ubv = glad_glVertexAttrib4ubv; glad_glVertexAttrib4ubv = glTrace_VertexAttrib4ubv; }
+    if (glad_glVertexAttrib4uiv) { glTraceReal_VertexAttrib4uiv = glad_glVertexAttrib4uiv; glad_glVertexAttrib4uiv = glTrace_VertexAttrib4uiv; }
+    if (glad_glVertexAttrib4usv) { glTraceReal_VertexAttrib4usv = glad_glVertexAttrib4usv; glad_glVertexAttrib4usv = glTrace_VertexAttrib4usv; }
+    if (glad_glVertexAttribPointer) { glTraceReal_VertexAttribPointer = glad_glVertexAttribPointer; glad_glVertexAttribPointer = glTrace_VertexAttribPointer; }
+    if (glad_glUniformMatrix2x3fv) { glTraceReal_UniformMatrix2x3fv = glad_glUniformMatrix2x3fv; glad_glUniformMatrix2x3fv = glTrace_UniformMatrix2x3fv; }
+    if (glad_glUniformMatrix3x2fv) { glTraceReal_UniformMatrix3x2fv = glad_glUniformMatrix3x2fv; glad_glUniformMatrix3x2fv = glTrace_UniformMatrix3x2fv; }
+    if (glad_glUniformMatrix2x4fv) { glTraceReal_UniformMatrix2x4fv = glad_glUniformMatrix2x4fv; glad_glUniformMatrix2x4fv = glTrace_UniformMatrix2x4fv; }
+    if (glad_glUniformMatrix4x2fv) { glTraceReal_UniformMatrix4x2fv = glad_glUniformMatrix4x2fv; glad_glUniformMatrix4x2fv = glTrace_UniformMatrix4x2fv; }
+    if (glad_glUniformMatrix3x4fv) { glTraceReal_UniformMatrix3x4fv = glad_glUniformMatrix3x4fv; glad_glUniformMatrix3x4fv = glTrace_UniformMatrix3x4fv; }
+    if (glad_glUniformMatrix4x3fv) { glTraceReal_UniformMatrix4x3fv = glad_glUniformMatrix4x3fv; glad_glUniformMatrix4x3fv = glTrace_UniformMatrix4x3fv; }
+    if (glad_glColorMaski) { glTraceReal_ColorMaski = glad_glColorMaski; glad_glColorMaski = glTrace_ColorMaski; }
+    if (glad_glGetBooleani_v) { glTraceReal_GetBooleani_v = glad_glGetBooleani_v; glad_glGetBooleani_v = glTrace_GetBooleani_v; }
+    if (glad_glGetIntegeri_v) { glTraceReal_GetIntegeri_v = glad_glGetIntegeri_v; glad_glGetIntegeri_v = glTrace_GetIntegeri_v; }
+    if (glad_glEnablei) { glTraceReal_Enablei = glad_glEnablei; glad_glEnablei = glTrace_Enablei; }
+    if (glad_glDisablei) { glTraceReal_Disablei = glad_glDisablei; glad_glDisablei = glTrace_Disablei; }
+    if (glad_glIsEnabledi) { glTraceReal_IsEnabledi = glad_glIsEnabledi; glad_glIsEnabledi = glTrace_IsEnabledi; }
+    if (glad_glBeginTransformFeedback) { glTraceReal_BeginTransformFeedback = glad_glBeginTransformFeedback; glad_glBeginTransformFeedback = glTrace_BeginTransformFeedback; }
+    if (glad_glEndTransformFeedback) { glTraceReal_EndTransformFeedback = glad_glEndTransformFeedback; glad_glEndTransformFeedback = glTrace_EndTransformFeedback; }
+    if (glad_glBindBufferRange) { glTraceReal_BindBufferRange = glad_glBindBufferRange; glad_glBindBufferRange = glTrace_BindBufferRange; }
+    if (glad_glBindBufferBase) { glTraceReal_BindBufferBase = glad_glBindBufferBase; glad_glBindBufferBase = glTrace_BindBufferBase; }
+    if (glad_glTransformFeedbackVaryings) { glTraceReal_TransformFeedbackVaryings = glad_glTransformFeedbackVaryings; glad_glTransformFeedbackVaryings = glTrace_TransformFeedbackVaryings; }
+    if (glad_glGetTransformFeedbackVarying) { glTraceReal_GetTransformFeedbackVarying = glad_glGetTransformFeedbackVarying; glad_glGetTransformFeedbackVarying = glTrace_GetTransformFeedbackVarying; }
+    if (glad_glClampColor) { glTraceReal_ClampColor = glad_glClampColor; glad_glClampColor = glTrace_ClampColor; }
+    if (glad_glBeginConditionalRender) { glTraceReal_BeginConditionalRender = glad_glBeginConditionalRender; glad_glBeginConditionalRender = glTrace_BeginConditionalRender; }
+    if (glad_glEndConditionalRender) { glTraceReal_EndConditionalRender = glad_glEndConditionalRender; glad_glEndConditionalRender = glTrace_EndConditionalRender; }
+    if (glad_glVertexAttribIPointer) { glTraceReal_VertexAttribIPointer = glad_glVertexAttribIPointer; glad_glVertexAttribIPointer = glTrace_VertexAttribIPointer; }
+    if (glad_glGetVertexAttribIiv) { glTraceReal_GetVertexAttribIiv = glad_glGetVertexAttribIiv; glad_glGetVertexAttribIiv = glTrace_GetVertexAttribIiv; }
+    if (glad_glGetVertexAttribIuiv) { glTraceReal_GetVertexAttribIuiv = glad_glGetVertexAttribIuiv; glad_glGetVertexAttribIuiv = glTrace_GetVertexAttribIuiv; }
+    if (glad_glVertexAttribI1i) { glTraceReal_VertexAttribI1i = glad_glVertexAttribI1i; glad_glVertexAttribI1i = glTrace_VertexAttribI1i; }
+    if (glad_glVertexAttribI2i) { glTraceReal_VertexAttribI2i = glad_glVertexAttribI2i; glad_glVertexAttribI2i = glTrace_VertexAttribI2i; }
+    if (glad_glVertexAttribI3i) { glTraceReal_VertexAttribI3i = glad_glVertexAttribI3i; glad_glVertexAttribI3i = glTrace_VertexAttribI3i; }
+    if (glad_glVertexAttribI4i) { glTraceReal_VertexAttribI4i = glad_glVertexAttribI4i; glad_glVertexAttribI4i = glTrace_VertexAttribI4i; }
+    if (glad_glVertexAttribI1ui) { glTraceReal_VertexAttribI1ui = glad_glVertexAttribI1ui; glad_glVertexAttribI1ui = glTrace_VertexAttribI1ui; }
+    if (glad_glVertexAttribI2ui) { glTraceReal_VertexAttribI2ui = glad_glVertexAttribI2ui; glad_glVertexAttribI2ui = glTrace_VertexAttribI2ui; }
+    if (glad_glVertexAttribI3ui) { glTraceReal_VertexAttribI3ui = glad_glVertexAttribI3ui; glad_glVertexAttribI3ui = glTrace_VertexAttribI3ui; }
+    if (glad_glVertexAttribI4ui) { glTraceReal_VertexAttribI4ui = glad_glVertexAttribI4ui; glad_glVertexAttribI4ui = glTrace_VertexAttribI4ui; }
+    if (glad_glVertexAttribI1iv) { glTraceReal_VertexAttribI1iv = glad_glVertexAttribI1iv; glad_glVertexAttribI1iv = glTrace_VertexAttribI1iv; }
+    if (glad_glVertexAttribI2iv) { glTraceReal_VertexAttribI2iv = glad_glVertexAttribI2iv; glad_glVertexAttribI2iv = glTrace_VertexAttribI2iv; }
+    if (glad_glVertexAttribI3iv) { glTraceReal_VertexAttribI3iv = glad_glVertexAttribI3iv; glad_glVertexAttribI3iv = glTrace_VertexAttribI3iv; }
+    if (glad_glVertexAttribI4iv) { glTraceReal_VertexAttribI4iv = glad_glVertexAttribI4iv; glad_glVertexAttribI4iv = glTrace_VertexAttribI4iv; }
+    if (glad_glVertexAttribI1uiv) { glTraceReal_VertexAttribI1uiv = glad_glVertexAttribI1uiv; glad_glVertexAttribI1uiv = glTrace_VertexAttribI1uiv; }
+    if (glad_glVertexAttribI2uiv) { glTraceReal_VertexAttribI2uiv = glad_glVertexAttribI2uiv; glad_glVertexAttribI2uiv = glTrace_VertexAttribI2uiv; }
+    if (glad_glVertexAttribI3uiv) { glTraceReal_VertexAttribI3uiv = glad_glVertexAttribI3uiv; glad_glVertexAttribI3uiv = glTrace_VertexAttribI3uiv; }
+    if (glad_glVertexAttribI4uiv) { glTraceReal_VertexAttribI4uiv = glad_glVertexAttribI4uiv; glad_glVertexAttribI4uiv = glTrace_VertexAttribI4uiv; }
+    if (glad_glVertexAttribI4bv) { glTraceReal_VertexAttribI4bv = glad_glVertexAttribI4bv; glad_glVertexAttribI4bv = glTrace_VertexAttribI4bv; }
+    if (glad_glVertexAttribI4sv) { glTraceReal_VertexAttribI4sv = glad_glVertexAttribI4sv; glad_glVertexAttribI4sv = glTrace_VertexAttribI4sv; }
+    if (glad_glVertexAttribI4ubv) { glTraceReal_VertexAttribI4ubv = glad_glVertexAttribI4ubv; glad_glVertexAttribI4ubv = glTrace_VertexAttribI4ubv; }
+    if (glad_glVertexAttribI4usv) { glTraceReal_VertexAttribI4usv = glad_glVertexAttribI4usv; glad_glVertexAttribI4usv = glTrace_VertexAttribI4usv; }
+    if (glad_glGetUniformuiv) { glTraceReal_GetUniformuiv = glad_glGetUniformuiv; glad_glGetUniformuiv = glTrace_GetUniformuiv; }
+    if (glad_glBindFragDataLocation) { glTraceReal_BindFragDataLocation = glad_glBindFragDataLocation; glad_glBindFragDataLocation = glTrace_BindFragDataLocation; }
+    if (glad_glGetFragDataLocation) { glTraceReal_GetFragDataLocation = glad_glGetFragDataLocation; glad_glGetFragDataLocation = glTrace_GetFragDataLocation; }
+    if (glad_glUniform1ui) { glTraceReal_Uniform1ui = glad_glUniform1ui; glad_glUniform1ui = glTrace_Uniform1ui; }
+    if (glad_glUniform2ui) { glTraceReal_Uniform2ui = glad_glUniform2ui; glad_glUniform2ui = glTrace_Uniform2ui; }
+    if (glad_glUniform3ui) { glTraceReal_Uniform3ui = glad_glUniform3ui; glad_glUniform3ui = glTrace_Uniform3ui; }
+    if (glad_glUniform4ui) { glTraceReal_Uniform4ui = glad_glUniform4ui; glad_glUniform4ui = glTrace_Uniform4ui; }
+    if (glad_glUniform1uiv) { glTraceReal_Uniform1uiv = glad_glUniform1uiv; glad_glUniform1uiv = glTrace_Uniform1uiv; }
+    if (glad_glUniform2uiv) { glTraceReal_Uniform2uiv = glad_glUniform2uiv; glad_glUniform2uiv = glTrace_Uniform2uiv; }
+    if (glad_glUniform3uiv) { glTraceReal_Uniform3uiv = glad_glUniform3uiv; glad_glUniform3uiv = glTrace_Uniform3uiv; }
+    if (glad_glUniform4uiv) { glTraceReal_Uniform4uiv = glad_glUniform4uiv; glad_glUniform4uiv = glTrace_Uniform4uiv; }
+    if (glad_glTexParameterIiv) { glTraceReal_TexParameterIiv = glad_glTexParameterIiv; glad_glTexParameterIiv = glTrace_TexParameterIiv; }
+    if (glad_glTexParameterIuiv) { glTraceReal_TexParameterIuiv = glad_glTexParameterIuiv; glad_glTexParameterIuiv = glTrace_TexParameterIuiv; }
+    if (glad_glGetTexParameterIiv) { glTraceReal_GetTexParameterIiv = glad_glGetTexParameterIiv; glad_glGetTexParameterIiv = glTrace_GetTexParameterIiv; }
+    if (glad_glGetTexParameterIuiv) { glTraceReal_GetTexParameterIuiv = glad_glGetTexParameterIuiv; glad_glGetTexParameterIuiv = glTrace_GetTexParameterIuiv; }
+    if (glad_glClearBufferiv) { glTraceReal_ClearBufferiv = glad_glClearBufferiv; glad_glClearBufferiv = glTrace_ClearBufferiv; }
+    if (glad_glClearBufferuiv) { glTraceReal_ClearBufferuiv = glad_glClearBufferuiv; glad_glClearBufferuiv = glTrace_ClearBufferuiv; }
+    if (glad_glClearBufferfv) { glTraceReal_ClearBufferfv = glad_glClearBufferfv; glad_glClearBufferfv = glTrace_ClearBufferfv; }
+    if (glad_glClearBufferfi) { glTraceReal_ClearBufferfi = glad_glClearBufferfi; glad_glClearBufferfi = glTrace_ClearBufferfi; }
+    if (glad_glGetStringi) { glTraceReal_GetStringi = glad_glGetStringi; glad_glGetStringi = glTrace_GetStringi; }
+    if (glad_glIsRenderbuffer) { glTraceReal_IsRenderbuffer = glad_glIsRenderbuffer; glad_glIsRenderbuffer = glTrace_IsRenderbuffer; }
+    if (glad_glBindRenderbuffer) { glTraceReal_BindRenderbuffer = glad_glBindRenderbuffer; glad_glBindRenderbuffer = glTrace_BindRenderbuffer; }
+    if (glad_glDeleteRenderbuffers) { glTraceReal_DeleteRenderbuffers = glad_glDeleteRenderbuffers; glad_glDeleteRenderbuffers = glTrace_DeleteRenderbuffers; }
+    if (glad_glGenRenderbuffers) { glTraceReal_GenRenderbuffers = glad_glGenRenderbuffers; glad_glGenRenderbuffers = glTrace_GenRenderbuffers; }
+    if (glad_glRenderbufferStorage) { glTraceReal_RenderbufferStorage = glad_glRenderbufferStorage; glad_glRenderbufferStorage = glTrace_RenderbufferStorage; }
+    if (glad_glGetRenderbufferParameteriv) { glTraceReal_GetRenderbufferParameteriv = glad_glGetRenderbufferParameteriv; glad_glGetRenderbufferParameteriv = glTrace_GetRenderbufferParameteriv; }
+    if (glad_glIsFramebuffer) { glTraceReal_IsFramebuffer = glad_glIsFramebuffer; glad_glIsFramebuffer = glTrace_IsFramebuffer; }
+    if (glad_glBindFramebuffer) { glTraceReal_BindFramebuffer = glad_glBindFramebuffer; glad_glBindFramebuffer = glTrace_BindFramebuffer; }
+    if (glad_glDeleteFramebuffers) { glTraceReal_DeleteFramebuffers = glad_glDeleteFramebuffers; glad_glDeleteFramebuffers = glTrace_DeleteFramebuffers; }
+    if (glad_glGenFramebuffers) { glTraceReal_GenFramebuffers = glad_glGenFramebuffers; glad_glGenFramebuffers = glTrace_GenFramebuffers; }
+    if (glad_glCheckFramebufferStatus) { glTraceReal_CheckFramebufferStatus = glad_glCheckFramebufferStatus; glad_glCheckFramebufferStatus = glTrace_CheckFramebufferStatus; }
+    if (glad_glFramebufferTexture1D) { glTraceReal_FramebufferTexture1D = glad_glFramebufferTexture1D; glad_glFramebufferTexture1D = glTrace_FramebufferTexture1D; }
+    if (glad_glFramebufferTexture2D) { glTraceReal_FramebufferTexture2D = glad_glFramebufferTexture2D; glad_glFramebufferTexture2D = glTrace_FramebufferTexture2D; }
+    if (glad_glFramebufferTexture3D) { glTraceReal_FramebufferTexture3D = glad_glFramebufferTexture3D; glad_glFramebufferTexture3D = glTrace_FramebufferTexture3D; }
+    if (glad_glFramebufferRenderbuffer) { glTraceReal_FramebufferRenderbuffer = glad_glFramebufferRenderbuffer; glad_glFramebufferRenderbuffer = glTrace_FramebufferRenderbuffer; }
+    if (glad_glGetFramebufferAttachmentParameteriv) { glTraceReal_GetFramebufferAttachmentParameteriv = glad_glGetFramebufferAttachmentParameteriv; glad_glGetFramebufferAttachmentParameteriv = glTrace_GetFramebufferAttachmentParameteriv; }
+    if (glad_glGenerateMipmap) { glTraceReal_GenerateMipmap = glad_glGenerateMipmap; glad_glGenerateMipmap = glTrace_GenerateMipmap; }
+    if (glad_glBlitFramebuffer) { glTraceReal_BlitFramebuffer = glad_glBlitFramebuffer; glad_glBlitFramebuffer = glTrace_BlitFramebuffer; }
+    if (glad_glRenderbufferStorageMultisample) { glTraceReal_RenderbufferStorageMultisample = glad_glRenderbufferStorageMultisample; glad_glRenderbufferStorageMultisample = glTrace_RenderbufferStorageMultisample; }
+    if (glad_glFramebufferTextureLayer) { glTraceReal_FramebufferTextureLayer = glad_glFramebufferTextureLayer; glad_glFramebufferTextureLayer = glTrace_FramebufferTextureLayer; }
+    if (glad_glMapBufferRange) { glTraceReal_MapBufferRange = glad_glMapBufferRange; glad_glMapBufferRange = glTrace_MapBufferRange; }
+    if (glad_glFlushMappedBufferRange) { glTraceReal_FlushMappedBufferRange = glad_glFlushMappedBufferRange; glad_glFlushMappedBufferRange = glTrace_FlushMappedBufferRange; }
+    if (glad_glBindVertexArray) { glTraceReal_BindVertexArray = glad_glBindVertexArray; glad_glBindVertexArray = glTrace_BindVertexArray; }
+    if (glad_glDeleteVertexArrays) { glTraceReal_DeleteVertexArrays = glad_glDeleteVertexArrays; glad_glDeleteVertexArrays = glTrace_DeleteVertexArrays; }
+    if (glad_glGenVertexArrays) { glTraceReal_GenVertexArrays = glad_glGenVertexArrays; glad_glGenVertexArrays = glTrace_GenVertexArrays; }
+    if (glad_glIsVertexArray) { glTraceReal_IsVertexArray = glad_glIsVertexArray; glad_glIsVertexArray = glTrace_IsVertexArray; }
+    if (glad_glDrawArraysInstanced) { glTraceReal_DrawArraysInstanced = glad_glDrawArraysInstanced; glad_glDrawArraysInstanced = glTrace_DrawArraysInstanced; }
+    if (glad_glDrawElementsInstanced) { glTraceReal_DrawElementsInstanced = glad_glDrawElementsInstanced; glad_glDrawElementsInstanced = glTrace_DrawElementsInstanced; }
+    if (glad_glTexBuffer) { glTraceReal_TexBuffer = glad_glTexBuffer; glad_glTexBuffer = glTrace_TexBuffer; }
+    if (glad_glPrimitiveRestartIndex) { glTraceReal_PrimitiveRestartIndex = glad_glPrimitiveRestartIndex; glad_glPrimitiveRestartIndex = glTrace_PrimitiveRestartIndex; }
+    if (glad_glCopyBufferSubData) { glTraceReal_CopyBufferSubData = glad_glCopyBufferSubData; glad_glCopyBufferSubData = glTrace_CopyBufferSubData; }
+    if (glad_glGetUniformIndices) { glTraceReal_GetUniformIndices = glad_glGetUniformIndices; glad_glGetUniformIndices = glTrace_GetUniformIndices; }
+    if (glad_glGetActiveUniformsiv) { glTraceReal_GetActiveUniformsiv = glad_glGetActiveUniformsiv; glad_glGetActiveUniformsiv = glTrace_GetActiveUniformsiv; }
+    if (glad_glGetActiveUniformName) { glTraceReal_GetActiveUniformName = glad_glGetActiveUniformName; glad_glGetActiveUniformName = glTrace_GetActiveUniformName; }
+    if (glad_glGetUniformBlockIndex) { glTraceReal_GetUniformBlockIndex = glad_glGetUniformBlockIndex; glad_glGetUniformBlockIndex = glTrace_GetUniformBlockIndex; }
+    if (glad_glGetActiveUniformBlockiv) { glTraceReal_GetActiveUniformBlockiv = glad_glGetActiveUniformBlockiv; glad_glGetActiveUniformBlockiv = glTrace_GetActiveUniformBlockiv; }
+    if (glad_glGetActiveUniformBlockName) { glTraceReal_GetActiveUniformBlockName = glad_glGetActiveUniformBlockName; glad_glGetActiveUniformBlockName = glTrace_GetActiveUniformBlockName; }
+    if (glad_glUniformBlockBinding) { glTraceReal_UniformBlockBinding = glad_glUniformBlockBinding; glad_glUniformBlockBinding = glTrace_UniformBlockBinding; }
+    if (glad_glDrawElementsBaseVertex) { glTraceReal_DrawElementsBaseVertex = glad_glDrawElementsBaseVertex; glad_glDrawElementsBaseVertex = glTrace_DrawElementsBaseVertex; }
+    if (glad_glDrawRangeElementsBaseVertex) { glTraceReal_DrawRangeElementsBaseVertex = glad_glDrawRangeElementsBaseVertex; glad_glDrawRangeElementsBaseVertex = glTrace_DrawRangeElementsBaseVertex; }
+    if (glad_glDrawElementsInstancedBaseVertex) { glTraceReal_DrawElementsInstancedBaseVertex = glad_glDrawElementsInstancedBaseVertex; glad_glDrawElementsInstancedBaseVertex = glTrace_DrawElementsInstancedBaseVertex; }
+    if (glad_glMultiDrawElementsBaseVertex) { glTraceReal_MultiDrawElementsBaseVertex = glad_glMultiDrawElementsBaseVertex; glad_glMultiDrawElementsBaseVertex = glTrace_MultiDrawElementsBaseVertex; }
+    if (glad_glProvokingVertex) { glTraceReal_ProvokingVertex = glad_glProvokingVertex; glad_glProvokingVertex = glTrace_ProvokingVertex; }
+    if (glad_glFenceSync) { glTraceReal_FenceSync = glad_glFenceSync; glad_glFenceSync = glTrace_FenceSync; }
+    if (glad_glIsSync) { glTraceReal_IsSync = glad_glIsSync; glad_glIsSync = glTrace_IsSync; }
+    if (glad_glDeleteSync) { glTraceReal_DeleteSync = glad_glDeleteSync; glad_glDeleteSync = glTrace_DeleteSync; }
+    if (glad_glClientWaitSync) { glTraceReal_ClientWaitSync = glad_glClientWaitSync; glad_glClientWaitSync = glTrace_ClientWaitSync; }
+    if (glad_glWaitSync) { glTraceReal_WaitSync = glad_glWaitSync; glad_glWaitSync = glTrace_WaitSync; }
+    if (glad_glGetInteger64v) { glTraceReal_GetInteger64v = glad_glGetInteger64v; glad_glGetInteger64v = glTrace_GetInteger64v; }
+    if (glad_glGetSynciv) { glTraceReal_GetSynciv = glad_glGetSynciv; glad_glGetSynciv = glTrace_GetSynciv; }
+    if (glad_glGetInteger64i_v) { glTraceReal_GetInteger64i_v = glad_glGetInteger64i_v; glad_glGetInteger64i_v = glTrace_GetInteger64i_v; }
+    if (glad_glGetBufferParameteri64v) { glTraceReal_GetBufferParameteri64v = glad_glGetBufferParameteri64v; glad_glGetBufferParameteri64v = glTrace_GetBufferParameteri64v; }
+    if (glad_glFramebufferTexture) { glTraceReal_FramebufferTexture = glad_glFramebufferTexture; glad_glFramebufferTexture = glTrace_FramebufferTexture; }
+    if (glad_glTexImage2DMultisample) { glTraceReal_TexImage2DMultisample = glad_glTexImage2DMultisample; glad_glTexImage2DMultisample = glTrace_TexImage2DMultisample; }
+    if (glad_glTexImage3DMultisample) { glTraceReal_TexImage3DMultisample = glad_glTexImage3DMultisample; glad_glTexImage3DMultisample = glTrace_TexImage3DMultisample; }
+    if (glad_glGetMultisamplefv) { glTraceReal_GetMultisamplefv = glad_glGetMultisamplefv; glad_glGetMultisamplefv = glTrace_GetMultisamplefv; }
+    if (glad_glSampleMaski) { glTraceReal_SampleMaski = glad_glSampleMaski; glad_glSampleMaski = glTrace_SampleMaski; }
+    if (glad_glBindFragDataLocationIndexed) { glTraceReal_BindFragDataLocationIndexed = glad_glBindFragDataLocationIndexed; glad_glBindFragDataLocationIndexed = glTrace_BindFragDataLocationIndexed; }
+    if (glad_glGetFragDataIndex) { glTraceReal_GetFragDataIndex = glad_glGetFragDataIndex; glad_glGetFragDataIndex = glTrace_GetFragDataIndex; }
+    if (glad_glGenSamplers) { glTraceReal_GenSamplers = glad_glGenSamplers; glad_glGenSamplers = glTrace_GenSamplers; }
+    if (glad_glDeleteSamplers) { glTraceReal_DeleteSamplers = glad_glDeleteSamplers; glad_glDeleteSamplers = glTrace_DeleteSamplers; }
+    if (glad_glIsSampler) { glTraceReal_IsSampler = glad_glIsSampler; glad_glIsSampler = glTrace_IsSampler; }
+    if (glad_glBindSampler) { glTraceReal_BindSampler = glad_glBindSampler; glad_glBindSampler = glTrace_BindSampler; }
+    if (glad_glSamplerParameteri) { glTraceReal_SamplerParameteri = glad_glSamplerParameteri; glad_glSamplerParameteri = glTrace_SamplerParameteri; }
+    if (glad_glSamplerParameteriv) { glTraceReal_SamplerParameteriv = glad_glSamplerParameteriv; glad_glSamplerParameteriv = glTrace_SamplerParameteriv; }
+    if (glad_glSamplerParameterf) { glTraceReal_SamplerParameterf = glad_glSamplerParameterf; glad_glSamplerParameterf = glTrace_SamplerParameterf; }
+    if (glad_glSamplerParameterfv) { glTraceReal_SamplerParameterfv = glad_glSamplerParameterfv; glad_glSamplerParameterfv = glTrace_SamplerParameterfv; }
+    if (glad_glSamplerParameterIiv) { glTraceReal_SamplerParameterIiv = glad_glSamplerParameterIiv; glad_glSamplerParameterIiv = glTrace_SamplerParameterIiv; }
+    if (glad_glSamplerParameterIuiv) { glTraceReal_SamplerParameterIuiv = glad_glSamplerParameterIuiv; glad_glSamplerParameterIuiv = glTrace_SamplerParameterIuiv; }
+    if (glad_glGetSamplerParameteriv) { glTraceReal_GetSamplerParameteriv = glad_glGetSamplerParameteriv; glad_glGetSamplerParameteriv = glTrace_GetSamplerParameteriv; }
+    if (glad_glGetSamplerParameterIiv) { glTraceReal_GetSamplerParameterIiv = glad_glGetSamplerParameterIiv; glad_glGetSamplerParameterIiv = glTrace_GetSamplerParameterIiv; }
+    if (glad_glGetSamplerParameterfv) { glTraceReal_GetSamplerParameterfv = glad_glGetSamplerParameterfv; glad_glGetSamplerParameterfv = glTrace_GetSamplerParameterfv; }
+    if (glad_glGetSamplerParameterIuiv) { glTraceReal_GetSamplerParameterIuiv = glad_glGetSamplerParameterIuiv; glad_glGetSamplerParameterIuiv = glTrace_GetSamplerParameterIuiv; }
+    if (glad_glQueryCounter) { glTraceReal_QueryCounter = glad_glQueryCounter; glad_glQueryCounter = glTrace_QueryCounter; }
+    if (glad_glGetQueryObjecti64v) { glTraceReal_GetQueryObjecti64v = glad_glGetQueryObjecti64v; glad_glGetQueryObjecti64v = glTrace_GetQueryObjecti64v; }
+    if (glad_glGetQueryObjectui64v) { glTraceReal_GetQueryObjectui64v = glad_glGetQueryObjectui64v; glad_glGetQueryObjectui64v = glTrace_GetQueryObjectui64v; }
+    if (glad_glVertexAttribDivisor) { glTraceReal_VertexAttribDivisor = glad_glVertexAttribDivisor; glad_glVertexAttribDivisor = glTrace_VertexAttribDivisor; }
+    if (glad_glVertexAttribP1ui) { glTraceReal_VertexAttribP1ui = glad_glVertexAttribP1ui; glad_glVertexAttribP1ui = glTrace_VertexAttribP1ui; }
+    if (glad_glVertexAttribP1uiv) { glTraceReal_VertexAttribP1uiv = glad_glVertexAttribP1uiv; glad_glVertexAttribP1uiv = glTrace_VertexAttribP1uiv; }
+    if (glad_glVertexAttribP2ui) { glTraceReal_VertexAttribP2ui = glad_glVertexAttribP2ui; glad_glVertexAttribP2ui = glTrace_VertexAttribP2ui; }
+    if (glad_glVertexAttribP2uiv) { glTraceReal_VertexAttribP2uiv = glad_glVertexAttribP2uiv; glad_glVertexAttribP2uiv = glTrace_VertexAttribP2uiv; }
+    if (glad_glVertexAttribP3ui) { glTraceReal_VertexAttribP3ui = glad_glVertexAttribP3ui; glad_glVertexAttribP3ui = glTrace_VertexAttribP3ui; }
+    if (glad_glVertexAttribP3uiv) { glTraceReal_VertexAttribP3uiv = glad_glVertexAttribP3uiv; glad_glVertexAttribP3uiv = glTrace_VertexAttribP3uiv; }
+    if (glad_glVertexAttribP4ui) { glTraceReal_VertexAttribP4ui = glad_glVertexAttribP4ui; glad_glVertexAttribP4ui = glTrace_VertexAttribP4ui; }
+    if (glad_glVertexAttribP4uiv) { glTraceReal_VertexAttribP4uiv = glad_glVertexAttribP4uiv; glad_glVertexAttribP4uiv = glTrace_VertexAttribP4uiv; }
+    if (glad_glVertexP2ui) { glTraceReal_VertexP2ui = glad_glVertexP2ui; glad_glVertexP2ui = glTrace_VertexP2ui; }
+    if (glad_glVertexP2uiv) { glTraceReal_VertexP2uiv = glad_glVertexP2uiv; glad_glVertexP2uiv = glTrace_VertexP2uiv; }
+    if (glad_glVertexP3ui) { glTraceReal_VertexP3ui = glad_glVertexP3ui; glad_glVertexP3ui = glTrace_VertexP3ui; }
+    if (glad_glVertexP3uiv) { glTraceReal_VertexP3uiv = glad_glVertexP3uiv; glad_glVertexP3uiv = glTrace_VertexP3uiv; }
+    if (glad_glVertexP4ui) { glTraceReal_VertexP4ui = glad_glVertexP4ui; glad_glVertexP4ui = glTrace_VertexP4ui; }
+    if (glad_glVertexP4uiv) { glTraceReal_VertexP4uiv = glad_glVertexP4uiv; glad_glVertexP4uiv = glTrace_VertexP4uiv; }
+    if (glad_glTexCoordP1ui) { glTraceReal_TexCoordP1ui = glad_glTexCoordP1ui; glad_glTexCoordP1ui = glTrace_TexCoordP1ui; }
+    if (glad_glTexCoordP1uiv) { glTraceReal_TexCoordP1uiv = glad_glTexCoordP1uiv; glad_glTexCoordP1uiv = glTrace_TexCoordP1uiv; }
+    if (glad_glTexCoordP2ui) { glTraceReal_TexCoordP2ui = glad_glTexCoordP2ui; glad_glTexCoordP2ui = glTrace_TexCoordP2ui; }
+    if (glad_glTexCoordP2uiv) { glTraceReal_TexCoordP2uiv = glad_glTexCoordP2uiv; glad_glTexCoordP2uiv = glTrace_TexCoordP2uiv; }
+    if (glad_glTexCoordP3ui) { glTraceReal_TexCoordP3ui = glad_glTexCoordP3ui; glad_glTexCoordP3ui = glTrace_TexCoordP3ui; }
+    if (glad_glTexCoordP3uiv) { glTraceReal_TexCoordP3uiv = glad_glTexCoordP3uiv; glad_glTexCoordP3uiv = glTrace_TexCoordP3uiv; }
+    if (glad_glTexCoordP4ui) { glTraceReal_TexCoordP4ui = glad_glTexCoordP4ui; glad_glTexCoordP4ui = glTrace_TexCoordP4ui; }
+    if (glad_glTexCoordP4uiv) { glTraceReal_TexCoordP4uiv = glad_glTexCoordP4uiv; glad_glTexCoordP4uiv = glTrace_TexCoordP4uiv; }
+    if (glad_glMultiTexCoordP1ui) { glTraceReal_MultiTexCoordP1ui = glad_glMultiTexCoordP1ui; glad_glMultiTexCoordP1ui = glTrace_MultiTexCoordP1ui; }
+    if (glad_glMultiTexCoordP1uiv) { glTraceReal_MultiTexCoordP1uiv = glad_glMultiTexCoordP1uiv; glad_glMultiTexCoordP1uiv = glTrace_MultiTexCoordP1uiv; }
+    if (glad_glMultiTexCoordP2ui) { glTraceReal_MultiTexCoordP2ui = glad_glMultiTexCoordP2ui; glad_glMultiTexCoordP2ui = glTrace_MultiTexCoordP2ui; }
+    if (glad_glMultiTexCoordP2uiv) { glTraceReal_MultiTexCoordP2uiv = glad_glMultiTexCoordP2uiv; glad_glMultiTexCoordP2uiv = glTrace_MultiTexCoordP2uiv; }
+    if (glad_glMultiTexCoordP3ui) { glTraceReal_MultiTexCoordP3ui = glad_glMultiTexCoordP3ui; glad_glMultiTexCoordP3ui = glTrace_MultiTexCoordP3ui; }
+    if (glad_glMultiTexCoordP3uiv) { glTraceReal_MultiTexCoordP3uiv = glad_glMultiTexCoordP3uiv; glad_glMultiTexCoordP3uiv = glTrace_MultiTexCoordP3uiv; }
+    if (glad_glMultiTexCoordP4ui) { glTraceReal_MultiTexCoordP4ui = glad_glMultiTexCoordP4ui; glad_glMultiTexCoordP4ui = glTrace_MultiTexCoordP4ui; }
+    if (glad_glMultiTexCoordP4uiv) { glTraceReal_MultiTexCoordP4uiv = glad_glMultiTexCoordP4uiv; glad_glMultiTexCoordP4uiv = glTrace_MultiTexCoordP4uiv; }
+    if (glad_glNormalP3ui) { glTraceReal_NormalP3ui = glad_glNormalP3ui; glad_glNormalP3ui = glTrace_NormalP3ui; }
+    if (glad_glNormalP3uiv) { glTraceReal_NormalP3uiv = glad_glNormalP3uiv; glad_glNormalP3uiv = glTrace_NormalP3uiv; }
+    if (glad_glColorP3ui) { glTraceReal_ColorP3ui = glad_glColorP3ui; glad_glColorP3ui = glTrace_ColorP3ui; }
+    if (glad_glColorP3uiv) { glTraceReal_ColorP3uiv = glad_glColorP3uiv; glad_glColorP3uiv = glTrace_ColorP3uiv; }
+    if (glad_glColorP4ui) { glTraceReal_ColorP4ui = glad_glColorP4ui; glad_glColorP4ui = glTrace_ColorP4ui; }
+    if (glad_glColorP4uiv) { glTraceReal_ColorP4uiv = glad_glColorP4uiv; glad_glColorP4uiv = glTrace_ColorP4uiv; }
+    if (glad_glSecondaryColorP3ui) { glTraceReal_SecondaryColorP3ui = glad_glSecondaryColorP3ui; glad_glSecondaryColorP3ui = glTrace_SecondaryColorP3ui; }
+    if (glad_glSecondaryColorP3uiv) { glTraceReal_SecondaryColorP3uiv = glad_glSecondaryColorP3uiv; glad_glSecondaryColorP3uiv = glTrace_SecondaryColorP3uiv; }
+    if (glad_glMinSampleShading) { glTraceReal_MinSampleShading = glad_glMinSampleShading; glad_glMinSampleShading = glTrace_MinSampleShading; }
+    if (glad_glBlendEquationi) { glTraceReal_BlendEquationi = glad_glBlendEquationi; glad_glBlendEquationi = glTrace_BlendEquationi; }
+    if (glad_glBlendEquationSeparatei) { glTraceReal_BlendEquationSeparatei = glad_glBlendEquationSeparatei; glad_glBlendEquationSeparatei = glTrace_BlendEquationSeparatei; }
+    if (glad_glBlendFunci) { glTraceReal_BlendFunci = glad_glBlendFunci; glad_glBlendFunci = glTrace_BlendFunci; }
+    if (glad_glBlendFuncSeparatei) { glTraceReal_BlendFuncSeparatei = glad_glBlendFuncSeparatei; glad_glBlendFuncSeparatei = glTrace_BlendFuncSeparatei; }
+    if (glad_glDrawArraysIndirect) { glTraceReal_DrawArraysIndirect = glad_glDrawArraysIndirect; glad_glDrawArraysIndirect = glTrace_DrawArraysIndirect; }
+    if (glad_glDrawElementsIndirect) { glTraceReal_DrawElementsIndirect = glad_glDrawElementsIndirect; glad_glDrawElementsIndirect = glTrace_DrawElementsIndirect; }
+    if (glad_glUniform1d) { glTraceReal_Uniform1d = glad_glUniform1d; glad_glUniform1d = glTrace_Uniform1d; }
+    if (glad_glUniform2d) { glTraceReal_Uniform2d = glad_glUniform2d; glad_glUniform2d = glTrace_Uniform2d; }
+    if (glad_glUniform3d) { glTraceReal_Uniform3d = glad_glUniform3d; glad_glUniform3d = glTrace_Uniform3d; }
+    if (glad_glUniform4d) { glTraceReal_Uniform4d = glad_glUniform4d; glad_glUniform4d = glTrace_Uniform4d; }
+    if (glad_glUniform1dv) { glTraceReal_Uniform1dv = glad_glUniform1dv; glad_glUniform1dv = glTrace_Uniform1dv; }
+    if (glad_glUniform2dv) { glTraceReal_Uniform2dv = glad_glUniform2dv; glad_glUniform2dv = glTrace_Uniform2dv; }
+    if (glad_glUniform3dv) { glTraceReal_Uniform3dv = glad_glUniform3dv; glad_glUniform3dv = glTrace_Uniform3dv; }
+    if (glad_glUniform4dv) { glTraceReal_Uniform4dv = glad_glUniform4dv; glad_glUniform4dv = glTrace_Uniform4dv; }
+    if (glad_glUniformMatrix2dv) { glTraceReal_UniformMatrix2dv = glad_glUniformMatrix2dv; glad_glUniformMatrix2dv = glTrace_UniformMatrix2dv; }
+    if (glad_glUniformMatrix3dv) { glTraceReal_UniformMatrix3dv = glad_glUniformMatrix3dv; glad_glUniformMatrix3dv = glTrace_UniformMatrix3dv; }
+    if (glad_glUniformMatrix4dv) { glTraceReal_UniformMatrix4dv = glad_glUniformMatrix4dv; glad_glUniformMatrix4dv = glTrace_UniformMatrix4dv; }
+    if (glad_glUniformMatrix2x3dv) { glTraceReal_UniformMatrix2x3dv = glad_glUniformMatrix2x3dv; glad_glUniformMatrix2x3dv = glTrace_UniformMatrix2x3dv; }
+    if (glad_glUniformMatrix2x4dv) { glTraceReal_UniformMatrix2x4dv = glad_glUniformMatrix2x4dv; glad_glUniformMatrix2x4dv = glTrace_UniformMatrix2x4dv; }
+    if (glad_glUniformMatrix3x2dv) { glTraceReal_UniformMatrix3x2dv = glad_glUniformMatrix3x2dv; glad_glUniformMatrix3x2dv = glTrace_UniformMatrix3x2dv; }
+    if (glad_glUniformMatrix3x4dv) { glTraceReal_UniformMatrix3x4dv = glad_glUniformMatrix3x4dv; glad_glUniformMatrix3x4dv = glTrace_UniformMatrix3x4dv; }
+    if (glad_glUniformMatrix4x2dv) { glTraceReal_UniformMatrix4x2dv = glad_glUniformMatrix4x2dv; glad_glUniformMatrix4x2dv = glTrace_UniformMatrix4x2dv; }
+    if (glad_glUniformMatrix4x3dv) { glTraceReal_UniformMatrix4x3dv = glad_glUniformMatrix4x3dv; glad_glUniformMatrix4x3dv = glTrace_UniformMatrix4x3dv; }
+    if (glad_glGetUniformdv) { glTraceReal_GetUniformdv = glad_glGetUniformdv; glad_glGetUniformdv = glTrace_GetUniformdv; }
+    if (glad_glGetSubroutineUniformLocation) { glTraceReal_GetSubroutineUniformLocation = glad_glGetSubroutineUniformLocation; glad_glGetSubroutineUniformLocation = glTrace_GetSubroutineUniformLocation; }
+    if (glad_glGetSubroutineIndex) { glTraceReal_GetSubroutineIndex = glad_glGetSubroutineIndex; glad_glGetSubroutineIndex = glTrace_GetSubroutineIndex; }
+    if (glad_glGetActiveSubroutineUniformiv) { glTraceReal_GetActiveSubroutineUniformiv = glad_glGetActiveSubroutineUniformiv; glad_glGetActiveSubroutineUniformiv = glTrace_GetActiveSubroutineUniformiv; }
+    if (glad_glGetActiveSubroutineUniformName) { glTraceReal_GetActiveSubroutineUniformName = glad_glGetActiveSubroutineUniformName; glad_glGetActiveSubroutineUniformName = glTrace_GetActiveSubroutineUniformName; }
+    if (glad_glGetActiveSubroutineName) { glTraceReal_GetActiveSubroutineName = glad_glGetActiveSubroutineName; glad_glGetActiveSubroutineName = glTrace_GetActiveSubroutineName; }
+    if (glad_glUniformSubroutinesuiv) { glTraceReal_UniformSubroutinesuiv = glad_glUniformSubroutinesuiv; glad_glUniformSubroutinesuiv = glTrace_UniformSubroutinesuiv; }
+    if (glad_glGetUniformSubroutineuiv) { glTraceReal_GetUniformSubroutineuiv = glad_glGetUniformSubroutineuiv; glad_glGetUniformSubroutineuiv = glTrace_GetUniformSubroutineuiv; }
+    if (glad_glGetProgramStageiv) { glTraceReal_GetProgramStageiv = glad_glGetProgramStageiv; glad_glGetProgramStageiv = glTrace_GetProgramStageiv; }
+    if (glad_glPatchParameteri) { glTraceReal_PatchParameteri = glad_glPatchParameteri; glad_glPatchParameteri = glTrace_PatchParameteri; }
+    if (glad_glPatchParameterfv) { glTraceReal_PatchParameterfv = glad_glPatchParameterfv; glad_glPatchParameterfv = glTrace_PatchParameterfv; }
+    if (glad_glBindTransformFeedback) { glTraceReal_BindTransformFeedback = glad_glBindTransformFeedback; glad_glBindTransformFeedback = glTrace_BindTransformFeedback; }
+    if (glad_glDeleteTransformFeedbacks) { glTraceReal_DeleteTransformFeedbacks = glad_glDeleteTransformFeedbacks; glad_glDeleteTransformFeedbacks = glTrace_DeleteTransformFeedbacks; }
+    if (glad_glGenTransformFeedbacks) { glTraceReal_GenTransformFeedbacks = glad_glGenTransformFeedbacks; glad_glGenTransformFeedbacks = glTrace_GenTransformFeedbacks; }
+    if (glad_glIsTransformFeedback) { glTraceReal_IsTransformFeedback = glad_glIsTransformFeedback; glad_glIsTransformFeedback = glTrace_IsTransformFeedback; }
+    if (glad_glPauseTransformFeedback) { glTraceReal_PauseTransformFeedback = glad_glPauseTransformFeedback; glad_glPauseTransformFeedback = glTrace_PauseTransformFeedback; }
+    if (glad_glResumeTransformFeedback) { glTraceReal_ResumeTransformFeedback = glad_glResumeTransformFeedback; glad_glResumeTransformFeedback = glTrace_ResumeTransformFeedback; }
+    if (glad_glDrawTransformFeedback) { glTraceReal_DrawTransformFeedback = glad_glDrawTransformFeedback; glad_glDrawTransformFeedback = glTrace_DrawTransformFeedback; }
+    if (glad_glDrawTransformFeedbackStream) { glTraceReal_DrawTransformFeedbackStream = glad_glDrawTransformFeedbackStream; glad_glDrawTransformFeedbackStream = glTrace_DrawTransformFeedbackStream; }
+    if (glad_glBeginQueryIndexed) { glTraceReal_BeginQueryIndexed = glad_glBeginQueryIndexed; glad_glBeginQueryIndexed = glTrace_BeginQueryIndexed; }
+    if (glad_glEndQueryIndexed) { glTraceReal_EndQueryIndexed = glad_glEndQueryIndexed; glad_glEndQueryIndexed = glTrace_EndQueryIndexed; }
+    if (glad_glGetQueryIndexediv) { glTraceReal_GetQueryIndexediv = glad_glGetQueryIndexediv; glad_glGetQueryIndexediv = glTrace_GetQueryIndexediv; }
+}
+
+// Executa uma chamada gravada; false se a função não é suportada pelo replay
+inline bool glTraceReplay(uint16_t function, GlTraceReader& reader) {
+    switch (function) {
+    case GlFunction::CullFace: {
+        GLenum mode = reader.value<GLenum>();
+        glCullFace(mode);
+        return true;
+    }
+    case GlFunction::FrontFace: {
+        GLenum mode = reader.value<GLenum>();
+        glFrontFace(mode);
+        return true;
+    }
+    case GlFunction::Hint: {
+        GLenum target = reader.value<GLenum>();
+        GLenum mode = reader.value<GLenum>();
+        glHint(target, mode);
+        return true;
+    }
+    case GlFunction::LineWidth: {
+        GLfloat width = reader.value<GLfloat>();
+        glLineWidth(width);
+        return true;
+    }
+    case GlFunction::PointSize: {
+        GLfloat size = reader.value<GLfloat>();
+        glPointSize(size);
+        return true;
+    }
+    case GlFunction::PolygonMode: {
+        GLenum face = reader.value<GLenum>();
+        GLenum mode = reader.value<GLenum>();
+        glPolygonMode(face, mode);
+        return true;
+    }
+    case GlFunction::Scissor: {
+        GLint x = reader.value<GLint>();
+        GLint y = reader.value<GLint>();
+        GLsizei width = reader.value<GLsizei>();
+        GLsizei height = reader.value<GLsizei>();
+        glScissor(x, y, width, height);
+        return true;
+    }
+    case GlFunction::TexParameterf: {
+        GLenum target = reader.value<GLenum>();
+        GLenum pname = reader.value<GLenum>();
+        GLfloat param = reader.value<GLfloat>();
+        glTexParameterf(target, pname, param);
+        return true;
+    }
+    case GlFunction::TexParameterfv: {
+        GLenum target = reader.value<GLenum>();
+        GLenum pname = reader.value<GLenum>();
+        const GLfloat * params = static_cast<const GLfloat *>(reader.bytes());
+        glTexParameterfv(target, pname, params);
+        return true;
+    }
+    case GlFunction::TexParameteri: {
+        GLenum target = reader.value<GLenum>();
+        GLenum pname = reader.value<GLenum>();
+        GLint param = reader.value<GLint>();
+        glTexParameteri(target, pname, param);
+        return true;
+    }
+    case GlFunction::TexParameteriv: {
+        GLenum target = reader.value<GLenum>();
+        GLenum pname = reader.value<GLenum>();
+        const GLint * params = static_cast<const GLint *>(reader.bytes());
+        glTexParameteriv(target, pname, params);
+        return true;
+    }
+    case GlFunction::TexImage2D: {
+        GLenum target = reader.value<GLenum>();
+        GLint level = reader.value<GLint>();
+        GLint internalformat = reader.value<GLint>();
+        GLsizei width = reader.value<GLsizei>();
+        GLsizei height = reader.value<GLsizei>();
+        GLint border = reader.value<GLint>();
+        GLenum format = reader.value<GLenum>();
+        GLenum type = reader.value<GLenum>();
+        const void * pixels = static_cast<const void *>(reader.bytes());
+        glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+        return true;
+    }
+    case GlFunction::DrawBuffer: {
+        GLenum buf = reader.value<GLenum>();
+        glDrawBuffer(buf);
+        return true;
+    }
+    case GlFunction::Clear: {
+        GLbitfield mask = reader.value<GLbitfield>();
+        glClear(mask);
+        return true;
+    }
+    case GlFunction::ClearColor: {
+        GLfloat red = reader.value<GLfloat>();
+        GLfloat green = reader.value<GLfloat>();
+        GLfloat blue = reader.value<GLfloat>();
+        GLfloat alpha = reader.value<GLfloat>();
+        glClearColor(red, green, blue, alpha);
+        return true;
+    }
+    case GlFunction::ClearStencil: {
+        GLint s = reader.value<GLint>();
+        glClearStencil(s);
+        return true;
+    }
+    case GlFunction::ClearDepth: {
+        GLdouble depth = reader.value<GLdouble>();
+        glClearDepth(depth);
+        return true;
+    }
+    case GlFunction::StencilMask: {
+        GLuint mask = reader.value<GLuint>();
+        glStencilMask(mask);
+        return true;
+    }
+    case GlFunction::ColorMask: {
+        GLboolean red = reader.value<GLboolean>();
+        GLboolean green = reader.value<GLboolean>();
+        GLboolean blue = reader.value<GLboolean>();
+        GLboolean alpha = reader.value<GLboolean>();
+        glColorMask(red, green, blue, alpha);
+        return true;
+    }
+    case GlFunction::DepthMask: {
+        GLboolean flag = reader.value<GLboolean>();
+        glDepthMask(flag);
+        return true;
+    }
+    case GlFunction::Disable: {
+        GLenum cap = reader.value<GLenum>();
+        glDisable(cap);
+        return true;
+    }
+    case GlFunction::Enable: {
+        GLenum cap = reader.value<GLenum>();
+        glEnable(cap);
+        return true;
+    }
+    case GlFunction::Finish: {
+        glFinish();
+        return true;
+    }
+    case GlFunction::Flush: {
+        glFlush();
+        return true;
+    }
+    case GlFunction::BlendFunc: {
+        GLenum sfactor = reader.value<GLenum>();
+        GLenum dfactor = reader.value<GLenum>();
+        glBlendFunc(sfactor, dfactor);
+        return true;
+    }
+    case GlFunction::LogicOp: {
+        GLenum opcode = reader.value<GLenum>();
+        glLogicOp(opcode);
+        return true;
+    }
+    case GlFunction::StencilFunc: {
+        GLenum func = reader.value<GLenum>();
+        GLint ref = reader.value<GLint>();
+        GLuint mask = reader.value<GLuint>();
+        glStencilFunc(func, ref, mask);
+        return true;
+    }
+    case GlFunction::StencilOp: {
+        GLenum fail = reader.value<GLenum>();
+        GLenum zfail = reader.value<GLenum>();
+        GLenum zpass = reader.value<GLenum>();
+        glStencilOp(fail, zfail, zpass);
+        return true;
+    }
+    case GlFunction::DepthFunc: {
+        GLenum func = reader.value<GLenum>();
+        glDepthFunc(func);
+        return true;
+    }
+    case GlFunction::PixelStoref: {
+        GLenum pname = reader.value<GLenum>();
+        GLfloat param = reader.value<GLfloat>();
+        glPixelStoref(pname, param);
+        return true;
+    }
+    case GlFunction::PixelStorei: {
+        GLenum pname = reader.value<GLenum>();
+        GLint param = reader.value<GLint>();
+        glPixelStorei(pname, param);
+        return true;
+    }
+    case GlFunction::ReadBuffer: {
+        GLenum src = reader.value<GLenum>();
+        glReadBuffer(src);
+        return true;
+    }
+    case GlFunction::GetBooleanv: {
+        GLenum pname = reader.value<GLenum>();
+        GLboolean * data = static_cast<GLboolean *>(reader.scratch());
+        glGetBooleanv(pname, data);
+        return true;
+    }
+    case GlFunction::GetDoublev: {
+        GLenum pname = reader.value<GLenum>();
+        GLdouble * data = static_cast<GLdouble *>(reader.scratch());
+        glGetDoublev(pname, data);
+        return true;
+    }
+    case GlFunction::GetError: {
+        glGetError();
+        return true;
+    }
+    case GlFunction::GetFloatv: {
+        GLenum pname = reader.value<GLenum>();
+        GLfloat * data = static_cast<GLfloat *>(reader.scratch());
+        glGetFloatv(pname, data);
+        return true;
+    }
+    case GlFunction::GetIntegerv: {
+        GLenum pname = reader.value<GLenum>();
+        GLint * data = static_cast<GLint *>(reader.scratch());
+        glGetIntegerv(pname, data);
+        return true;
+    }
+    case GlFunction::GetString: {
+        GLenum name = reader.value<GLenum>();
+        glGetString(name);
+        return true;
+    }
+    case GlFunction::GetTexParameterfv: {
+        GLenum target = reader.value<GLenum>();
+        GLenum pname = reader.value<GLenum>();
+        GLfloat * params = static_cast<GLfloat *>(reader.scratch());
+        glGetTexParameterfv(target, pname, params);
+        return true;
+    }
+    case GlFunction::GetTexParameteriv: {
+        GLenum target = reader.value<GLenum>();
+        GLenum pname = reader.value<GLenum>();
+        GLint * params = static_cast<GLint *>(reader.scratch());
+        glGetTexParameteriv(target, pname, params);
+        return true;
+    }
+    case GlFunction::GetTexLevelParameterfv: {
+        GLenum target = reader.value<GLenum>();
+        GLint level = reader.value<GLint>();
+        GLenum pname = reader.value<GLenum>();
+        GLfloat * params = static_cast<GLfloat *>(reader.scratch());
+        glGetTexLevelParameterfv(target, level, pname, params);
+        return true;
+    }
+    case GlFunction::GetTexLevelParameteriv: {
+        GLenum target = reader.value<GLenum>();
+        GLint level = reader.value<GLint>();
+        GLenum pname = reader.value<GLenum>();
+        GLint * params = static_cast<GLint *>(reader.scratch());
+        glGetTexLevelParameteriv(target, level, pname, params);
+        return true;
+    }
+    case GlFunction::IsEnabled: {
+        GLenum cap = reader.value<GLenum>();
+        glIsEnabled(cap);
+        return true;
+    }
+    case GlFunction::DepthRange: {
+        GLdouble n = reader.value<GLdouble>();
+        GLdouble f = reader.value<GLdouble>();
+        glDepthRange(n, f);
+        return true;
+    }
+    case GlFunction::Viewport: {
+        GLint x = reader.value<GLint>();
+        GLint y = reader.value<GLint>();
+        GLsizei width = reader.value<GLsizei>();
+        GLsizei height = reader.value<GLsizei>();
+        glViewport(x, y, width, height);
+        return true;
+    }
+    case GlFunction::NewList: {
+        GLuint list = reader.value<GLuint>();
+        GLenum mode = reader.value<GLenum>();
+        glNewList(list, mode);
+        return true;
+    }
+    case GlFunction::EndList: {
+        glEndList();
+        return true;
+    }
+    case GlFunction::CallList: {
+        GLuint list = reader.value<GLuint>();
+        glCallList(list);
+        return true;
+    }
+    case GlFunction::DeleteLists: {
+        GLuint list = reader.value<GLuint>();
+        GLsizei range = reader.value<GLsizei>();
+        glDeleteLists(list, range);
+        return true;
+    }
+    case GlFunction::GenLists: {
+        GLsizei range = reader.value<GLsizei>();
+        glGenLists(range);
+        return true;
+    }
+    case GlFunction::ListBase: {
+        GLuint base = reader.value<GLuint>();
+        glListBase(base);
+        return true;
+    }
+    case GlFunction::Begin: {
+        GLenum mode = reader.value<GLenum>();
+        glBegin(mode);
+        return true;
+    }
+    case GlFunction::Color3b: {
+        GLbyte red = reader.value<GLbyte>();
+        GLbyte green = reader.value<GLbyte>();
+        GLbyte blue = reader.value<GLbyte>();
+        glColor3b(red, green, blue);
+        return true;
+    }
+    case GlFunction::Color3d: {
+        GLdouble red = reader.value<GLdouble>();
+        GLdouble green = reader.value<GLdouble>();
+        GLdouble blue = reader.value<GLdouble>();
+        glColor3d(red, green, blue);
+        return true;
+    }
+    case GlFunction::Color3f: {
+        GLfloat red = reader.value<GLfloat>();
+        GLfloat green = reader.value<GLfloat>();
+        GLfloat blue = reader.value<GLfloat>();
+        glColor3f(red, green, blue);
+        return true;
+    }
+    case GlFunction::Color3i: {
+        GLint red = reader.value<GLint>();
+        GLint green = reader.value<GLint>();
+        GLint blue = reader.value<GLint>();
+        glColor3i(red, green, blue);
+        return true;
+    }
+    case GlFunction::Color3s: {
+        GLshort red = reader.value<GLshort>();
+        GLshort green = reader.value<GLshort>();
+        GLshort blue = reader.value<GLshort>();
+        glColor3s(red, green, blue);
+        return true;
+    }
+    case GlFunction::Color3ub: {
+        GLubyte red = reader.value<GLubyte>();
+        GLubyte green = reader.value<GLubyte>();
+        GLubyte blue = reader.value<GLubyte>();
+        glColor3ub(red, green, blue);
+        return true;
+    }
+    case GlFunction::Color3ui: {
+        GLuint red = reader.value<GLuint>();
+        GLuint green = reader.value<GLuint>();
+        GLuint blue = reader.value<GLuint>();
+        glColor3ui(red, green, blue);
+        return true;
+    }
+    case GlFunction::Color3us: {
+        GLushort red = reader.value<GLushort>();
+        GLushort green = reader.value<GLushort>();
+        GLushort blue = reader.value<GLushort>();
+        glColor3us(red, green, blue);
+        return true;
+    }
+    case GlFunction::Color4b: {
+        GLbyte red = reader.value<GLbyte>();
+        GLbyte green = reader.value<GLbyte>();
+        GLbyte blue = reader.value<GLbyte>();
+        GLbyte alpha = reader.value<GLbyte>();
+        glColor4b(red, green, blue, alpha);
+        return true;
+    }
+    case GlFunction::Color4d: {
+        GLdouble red = reader.value<GLdouble>();
+        GLdouble green = reader.value<GLdouble>();
+        GLdouble blue = reader.value<GLdouble>();
+        GLdouble alpha = reader.value<GLdouble>();
+        glColor4d(red, green, blue, alpha);
+        return true;
+    }
+    case GlFunction::Color4f: {
+        GLfloat red = reader.value<GLfloat>();
+        GLfloat green = reader.value<GLfloat>();
+        GLfloat blue = reader.value<GLfloat>();
+        GLfloat alpha = reader.value<GLfloat>();
+        glColor4f(red, green, blue, alpha);
+        return true;
+    }
+    case GlFunction::Color4i: {
+        GLint red = reader.value<GLint>();
+        GLint green = reader.value<GLint>();
+        GLint blue = reader.value<GLint>();
+        GLint alpha = reader.value<GLint>();
+        glColor4i(red, green, blue, alpha);
+        return true;
+    }
+    case GlFunction::Color4s: {
+        GLshort red = reader.value<GLshort>();
+        GLshort green = reader.value<GLshort>();
+        GLshort blue = reader.value<GLshort>();
+        GLshort alpha = reader.value<GLshort>();
+        glColor4s(red, green, blue, alpha);
+        return true;
+    }
+    case GlFunction::Color4ub: {
+        GLubyte red = reader.value<GLubyte>();
+        GLubyte green = reader.value<GLubyte>();
+        GLubyte blue = reader.value<GLubyte>();
+        GLubyte alpha = reader.value<GLubyte>();
+        glColor4ub(red, green, blue, alpha);
+        return true;
+    }
+    case GlFunction::Color4ui: {
+        GLuint red = reader.value<GLuint>();
+        GLuint green = reader.value<GLuint>();
+        GLuint blue = reader.value<GLuint>();
+        GLuint alpha = reader.value<GLuint>();
+        glColor4ui(red, green, blue, alpha);
+        return true;
+    }
+    case GlFunction::Color4us: {
+        GLushort red = reader.value<GLushort>();
+        GLushort green = reader.value<GLushort>();
+        GLushort blue = reader.value<GLushort>();
+        GLushort alpha = reader.value<GLushort>();
+        glColor4us(red, green, blue, alpha);
+        return true;
+    }
+    case GlFunction::EdgeFlag: {
+        GLboolean flag = reader.value<GLboolean>();
+        glEdgeFlag(flag);
+        return true;
+    }
+    case GlFunction::End: {
+        glEnd();
+        return true;
+    }
+    case GlFunction::Indexd: {
+        GLdouble c = reader.value<GLdouble>();
+        glIndexd(c);
+        return true;
+    }
+    case GlFunction::Indexf: {
+        GLfloat c = reader.value<GLfloat>();
+        glIndexf(c);
+        return true;
+    }
+    case GlFunction::Indexi: {
+        GLint c = reader.value<GLint>();
+        glIndexi(c);
+        return true;
+    }
+    case GlFunction::Indexs: {
+        GLshort c = reader.value<GLshort>();
+        glIndexs(c);
+        return true;
+    }
+    case GlFunction::Normal3b: {
+        GLbyte nx = reader.value<GLbyte>();
+        GLbyte ny = reader.value<GLbyte>();
+        GLbyte nz = reader.value<GLbyte>();
+        glNormal3b(nx, ny, nz);
+        return true;
+    }
+    case GlFunction::Normal3d: {
+        GLdouble nx = reader.value<GLdouble>();
+        GLdouble ny = reader.value<GLdouble>();
+        GLdouble nz = reader.value<GLdouble>();
+        glNormal3d(nx, ny, nz);
+        return true;
+    }
+    case GlFunction::Normal3f: {
+        GLfloat nx = reader.value<GLfloat>();
+        GLfloat ny = reader.value<GLfloat>();
+        GLfloat nz = reader.value<GLfloat>();
+        glNormal3f(nx, ny, nz);
+        return true;
+    }
+    case GlFunction::Normal3i: {
+        GLint nx = reader.value<GLint>();
+        GLint ny = reader.value<GLint>();
+        GLint nz = reader.value<GLint>();
+        glNormal3i(nx, ny, nz);
+        return true;
+    }
+    case GlFunction::Normal3s: {
+        GLshort nx = reader.value<GLshort>();
+        GLshort ny = reader.value<GLshort>();
+        GLshort nz = reader.value<GLshort>();
+        glNormal3s(nx, ny, nz);
+        return true;
+    }
+    case GlFunction::RasterPos2d: {
+        GLdouble x = reader.value<GLdouble>();
+        GLdouble y = reader.value<GLdouble>();
+        glRasterPos2d(x, y);
+        return true;
+    }
+    case GlFunction::RasterPos2f: {
+        GLfloat x = reader.value<GLfloat>();
+        GLfloat y = reader.value<GLfloat>();
+        glRasterPos2f(x, y);
+        return true;
+    }
+    case GlFunction::RasterPos2i: {
+        GLint x = reader.value<GLint>();
+        GLint y = reader.value<GLint>();
+        glRasterPos2i(x, y);
+        return true;
+    }
+    case GlFunction::RasterPos2s: {
+        GLshort x = reader.value<GLshort>();
+        GLshort y = reader.value<GLshort>();
+        glRasterPos2s(x, y);
+        return true;
+    }
+    case GlFunction::RasterPos3d: {
+        GLdouble x = reader.value<GLdouble>();
+        GLdouble y = reader.value<GLdouble>();
+        GLdouble z = reader.value<GLdouble>();
+        glRasterPos3d(x, y, z);
+        return true;
+    }
+    case GlFunction::RasterPos3f: {
+        GLfloat x = reader.value<GLfloat>();
+        GLfloat y = reader.value<GLfloat>();
+        GLfloat z = reader.value<GLfloat>();
+        glRasterPos3f(x, y, z);
+        return true;
+    }
+    case GlFunction::RasterPos3i: {
+        GLint x = reader.value<GLint>();
+        GLint y = reader.value<GLint>();
+        GLint z = reader.value<GLint>();
+        glRasterPos3i(x, y, z);
+        return true;
+    }
+    case GlFunction::RasterPos3s: {
+        GLshort x = reader.value<GLshort>();
+        GLshort y = reader.value<GLshort>();
+        GLshort z = reader.value<GLshort>();
+        glRasterPos3s(x, y, z);
+        return true;
+    }
+    case GlFunction::RasterPos4d: {
+        GLdouble x = reader.value<GLdouble>();
+        GLdouble y = reader.value<GLdouble>();
+        GLdouble z = reader.value<GLdouble>();
+        GLdouble w = reader.value<GLdouble>();
+        glRasterPos4d(x, y, z, w);
+        return true;
+    }
+    case GlFunction::RasterPos4f: {
+        GLfloat x = reader.value<GLfloat>();
+        GLfloat y = reader.value<GLfloat>();
+        GLfloat z = reader.value<GLfloat>();
+        GLfloat w = reader.value<GLfloat>();
+        glRasterPos4f(x, y, z, w);
+        return true;
+    }
+    case GlFunction::RasterPos4i: {
+        GLint x = reader.value<GLint>();
+        GLint y = reader.value<GLint>();
+        GLint z = reader.value<GLint>();
+        GLint w = reader.value<GLint>();
+        glRasterPos4i(x, y, z, w);
+        return true;
+    }
+    case GlFunction::RasterPos4s: {
+        GLshort x = reader.value<GLshort>();
+        GLshort y = reader.value<GLshort>();
+        GLshort z = reader.value<GLshort>();
+        GLshort w = reader.value<GLshort>();
+        glRasterPos4s(x, y, z, w);
+        return true;
+    }
+    case GlFunction::Rectd: {
+        GLdouble x1 = reader.value<GLdouble>();
+        GLdouble y1 = reader.value<GLdouble>();
+        GLdouble x2 = reader.value<GLdouble>();
+        GLdouble y2 = reader.value<GLdouble>();
+        glRectd(x1, y1, x2, y2);
+        return true;
+    }
+    case GlFunction::Rectf: {
+        GLfloat x1 = reader.value<GLfloat>();
+        GLfloat y1 = reader.value<GLfloat>();
+        GLfloat x2 = reader.value<GLfloat>();
+        GLfloat y2 = reader.value<GLfloat>();
+        glRectf(x1, y1, x2, y2);
+        return true;
+    }
+    case GlFunction::Recti: {
+        GLint x1 = reader.value<GLint>();
+        GLint y1 = reader.value<GLint>();
+        GLint x2 = reader.value<GLint>();
+        GLint y2 = reader.value<GLint>();
+        glRecti(x1, y1, x2, y2);
+        return true;
+    }
+    case GlFunction::Rects: {
+        GLshort x1 = reader.value<GLshort>();
+        GLshort y1 = reader.value<GLshort>();
+        GLshort x2 = reader.value<GLshort>();
+        GLshort y2 = reader.value<GLshort>();
+        glRects(x1, y1, x2, y2);
+        return true;
+    }
+    case GlFunction::TexCoord1d: {
+        GLdouble s = reader.value<GLdouble>();
+        glTexCoord1d(s);
+        return true;
+    }
+    case GlFunction::TexCoord1f: {
+        GLfloat s = reader.value<GLfloat>();
+        glTexCoord1f(s);
+        return true;
+    }
+    case GlFunction::TexCoord1i: {
+        GLint s = reader.value<GLint>();
+        glTexCoord1i(s);
+        return true;
+    }
+    case GlFunction::TexCoord1s: {
+        GLshort s = reader.value<GLshort>();
+        glTexCoord1s(s);
+        return true;
+    }
+    case GlFunction::TexCoord2d: {
+        GLdouble s = reader.value<GLdouble>();
+        GLdouble t = reader.value<GLdouble>();
+        glTexCoord2d(s, t);
+        return true;
+    }
+    case GlFunction::TexCoord2f: {
+        GLfloat s = reader.value<GLfloat>();
+        GLfloat t = reader.value<GLfloat>();
+        glTexCoord2f(s, t);
+        return true;
+    }
+    case GlFunction::TexCoord2i: {
+        GLint s = reader.value<GLint>();
+        GLint t = reader.value<GLint>();
+        glTexCoord2i(s, t);
+        return true;
+    }
+    case GlFunction::TexCoord2s: {
+        GLshort s = reader.value<GLshort>();
+        GLshort t = reader.value<GLshort>();
+        glTexCoord2s(s, t);
+        return true;
+    }
+    case GlFunction::TexCoord3d: {
+        GLdouble s = reader.value<GLdouble>();
+        GLdouble t = reader.value<GLdouble>();
+        GLdouble r = reader.value<GLdouble>();
+        glTexCoord3d(s, t, r);
+        return true;
+    }
+    case GlFunction::TexCoord3f: {
+        GLfloat s = reader.value<GLfloat>();
+        GLfloat t = reader.value<GLfloat>();
+        GLfloat r = reader.value<GLfloat>();
+        glTexCoord3f(s, t, r);
+        return true;
+    }
+    case GlFunction::TexCoord3i: {
+        GLint s = reader.value<GLint>();
+        GLint t = reader.value<GLint>();
+        GLint r = reader.value<GLint>();
+        glTexCoord3i(s, t, r);
+        return true;
+    }
+    case GlFunction::TexCoord3s: {
+        GLshort s = reader.value<GLshort>();
+        GLshort t = reader.value<GLshort>();
+        GLshort r = reader.value<GLshort>();
+        glTexCoord3s(s, t, r);
+        return true;
+    }
+    case GlFunction::TexCoord4d: {
+        GLdouble s = reader.value<GLdouble>();
+        GLdouble t = reader.value<GLdouble>();
+        GLdouble r = reader.value<GLdouble>();
+        GLdouble q = reader.value<GLdouble>();
+        glTexCoord4d(s, t, r, q);
+        return true;
+    }
+    case GlFunction::TexCoord4f: {
+        GLfloat s = reader.value<GLfloat>();
+        GLfloat t = reader.value<GLfloat>();
+        GLfloat r = reader.value<GLfloat>();
+        GLfloat q = reader.value<GLfloat>();
+        glTexCoord4f(s, t, r, q);
+        return true;
+    }
+    case GlFunction::TexCoord4i: {
+        GLint s = reader.value<GLint>();
+        GLint t = reader.value<GLint>();
+        GLint r = reader.value<GLint>();
+        GLint q = reader.value<GLint>();
+        glTexCoord4i(s, t, r, q);
+        return true;
+    }
+    case GlFunction::TexCoord4s: {
+        GLshort s = reader.value<GLshort>();
+        GLshort t = reader.value<GLshort>();
+        GLshort r = reader.value<GLshort>();
+        GLshort q = reader.value<GLshort>();
+        glTexCoord4s(s, t, r, q);
+        return true;
+    }
+    case GlFunction::Vertex2d: {
+        GLdouble x = reader.value<GLdouble>();
+        GLdouble y = reader.value<GLdouble>();
+        glVertex2d(x, y);
+        return true;
+    }
+    case GlFunction::Vertex2f: {
+        GLfloat x = reader.value<GLfloat>();
+        GLfloat y = reader.value<GLfloat>();
+        glVertex2f(x, y);
+        return true;
+    }
+    case GlFunction::Vertex2i: {
+        GLint x = reader.value<GLint>();
+        GLint y = reader.value<GLint>();
+        glVertex2i(x, y);
+        return true;
+    }
+    case GlFunction::Vertex2s: {
+        GLshort x = reader.value<GLshort>();
+        GLshort y = reader.value<GLshort>();
+        glVertex2s(x, y);
+        return true;
+    }
+    case GlFunction::Vertex3d: {
+        GLdouble x = reader.value<GLdouble>();
+        GLdouble y = reader.value<GLdouble>();
+        GLdouble z = reader.value<GLdouble>();
+        glVertex3d(x, y, z);
+        return true;
+    }
+    case GlFunction::Vertex3f: {
+        GLfloat x = reader.value<GLfloat>();
+        GLfloat y = reader.value<GLfloat>();
+        GLfloat z = reader.value<GLfloat>();
+        glVertex3f(x, y, z);
+        return true;
+    }
+    case GlFunction::Vertex3i: {
+        GLint x = reader.value<GLint>();
+        GLint y = reader.value<GLint>();
+        GLint z = reader.value<GLint>();
+        glVertex3i(x, y, z);
+        return true;
+    }
+    case GlFunction::Vertex3s: {
+        GLshort x = reader.value<GLshort>();
+        GLshort y = reader.value<GLshort>();
+        GLshort z = reader.value<GLshort>();
+        glVertex3s(x, y, z);
+        return true;
+    }
+    case GlFunction::Vertex4d: {
+        GLdouble x = reader.value<GLdouble>();
+        GLdouble y = reader.value<GLdouble>();
+        GLdouble z = reader.value<GLdouble>();
+        GLdouble w = reader.value<GLdouble>();
+        glVertex4d(x, y, z, w);
+        return true;
+    }
+    case GlFunction::Vertex4f: {
+        GLfloat x = reader.value<GLfloat>();
+        GLfloat y = reader.value<GLfloat>();
+        GLfloat z = reader.value<GLfloat>();
+        GLfloat w = reader.value<GLfloat>();
+        glVertex4f(x, y, z, w);
+        return true;
+    }
+    case GlFunction::Vertex4i: {
+        GLint x = reader.value<GLint>();
+        GLint y = reader.value<GLint>();
+        GLint z = reader.value<GLint>();
+        GLint w = reader.value<GLint>();
+        glVertex4i(x, y, z, w);
+        return true;
+    }
+    case GlFunction::Vertex4s: {
+        GLshort x = reader.value<GLshort>();
+        GLshort y = reader.value<GLshort>();
+        GLshort z = reader.value<GLshort>();
+        GLshort w = reader.value<GLshort>();
+        glVertex4s(x, y, z, w);
+        return true;
+    }
+    case GlFunction::ColorMaterial: {
+        GLenum face = reader.value<GLenum>();
+        GLenum mode = reader.value<GLenum>();
+        glColorMaterial(face, mode);
+        return true;
+    }
+    case GlFunction::Fogf: {
+        GLenum pname = reader.value<GLenum>();
+        GLfloat param = reader.value<GLfloat>();
+        glFogf(pname, param);
+        return true;
+    }
+    case GlFunction::Fogi: {
+        GLenum pname = reader.value<GLenum>();
+        GLint param = reader.value<GLint>();
+        glFogi(pname, param);
+        return true;
+    }
+    case GlFunction::Lightf: {
+        GLenum light = reader.value<GLenum>();
+        GLenum pname = reader.value<GLenum>();
+        GLfloat param = reader.value<GLfloat>();
+        glLightf(light, pname, param);
+        return true;
+    }
+    case GlFunction::Lighti: {
+        GLenum light = reader.value<GLenum>();
+        GLenum pname = reader.value<GLenum>();
+        GLint param = reader.value<GLint>();
+        glLighti(light, pname, param);
+        return true;
+    }
+    case GlFunction::LightModelf: {
+        GLenum pname = reader.value<GLenum>();
+        GLfloat param = reader.value<GLfloat>();
+        glLightModelf(pname, param);
+        return true;
+    }
+    case GlFunction::LightModeli: {
+        GLenum pname = reader.value<GLenum>();
+        GLint param = reader.value<GLint>();
+        glLightModeli(pname, param);
+        return true;
+    }
+    case GlFunction::LineStipple: {
+        GLint factor = reader.value<GLint>();
+        GLushort pattern = reader.value<GLushort>();
+        glLineStipple(factor, pattern);
+        return true;
+    }
+    case GlFunction::Materialf: {
+        GLenum face = reader.value<GLenum>();
+        GLenum pname = reader.value<GLenum>();
+        GLfloat param = reader.value<GLfloat>();
+        glMaterialf(face, pname, param);
+        return true;
+    }
+    case GlFunction::Materiali: {
+        GLenum face = reader.value<GLenum>();
+        GLenum pname = reader.value<GLenum>();
+        GLint param = reader.value<GLint>();
+        glMateriali(face, pname, param);
+        return true;
+    }
+    case GlFunction::ShadeModel: {
+        GLenum mode = reader.value<GLenum>();
+        glShadeModel(mode);
+        return true;
+    }
+    case GlFunction::TexEnvf: {
+        GLenum target = reader.value<GLenum>();
+        GLenum pname = reader.value<GLenum>();
+        GLfloat param = reader.value<GLfloat>();
+        glTexEnvf(target, pname, param);
+        return true;
+    }
+    case GlFunction::TexEnvi: {
+        GLenum target = reader.value<GLenum>();
+        GLenum pname = reader.value<GLenum>();
+        GLint param = reader.value<GLint>();
+        glTexEnvi(target, pname, param);
+        return true;
+    }
+    case GlFunction::TexGend: {
+        GLenum coord = reader.value<GLenum>();
+        GLenum pname = reader.value<GLenum>();
+        GLdouble param = reader.value<GLdouble>();
+        glTexGend(coord, pname, param);
+        return true;
+    }
+    case GlFunction::TexGenf: {
+        GLenum coord = reader.value<GLenum>();
+        GLenum pname = reader.value<GLenum>();
+        GLfloat param = reader.value<GLfloat>();
+        glTexGenf(coord, pname, param);
+        return true;
+    }
+    case GlFunction::TexGeni: {
+        GLenum coord = reader.value<GLenum>();
+        GLenum pname = reader.value<GLenum>();
+        GLint param = reader.value<GLint>();
+        glTexGeni(coord, pname, param);
+        return true;
+    }
+    case GlFunction::FeedbackBuffer: {
+        GLsizei size = reader.value<GLsizei>();
+        GLenum type = reader.value<GLenum>();
+        GLfloat * buffer = static_cast<GLfloat *>(reader.scratch());
+        glFeedbackBuffer(size, type, buffer);
+        return true;
+    }
+    case GlFunction::SelectBuffer: {
+        GLsizei size = reader.value<GLsizei>();
+        GLuint * buffer = static_cast<GLuint *>(reader.scratch());
+        glSelectBuffer(size, buffer);
+        return true;
+    }
+    case GlFunction::RenderMode: {
+        GLenum mode = reader.value<GLenum>();
+        glRenderMode(mode);
+        return true;
+    }
+    case GlFunction::InitNames: {
+        glInitNames();
+        return true;
+    }
+    case GlFunction::LoadName: {
+        GLuint name = reader.value<GLuint>();
+        glLoadName(name);
+        return true;
+    }
+    case GlFunction::PassThrough: {
+        GLfloat token = reader.value<GLfloat>();
+        glPassThrough(token);
+        return true;
+    }
+    case GlFunction::PopName: {
+        glPopName();
+        return true;
+    }
+    case GlFunction::PushName: {
+        GLuint name = reader.value<GLuint>();
+        glPushName(name);
+        return true;
+    }
+    case GlFunction::ClearAccum: {
+        GLfloat red = reader.value<GLfloat>();
+        GLfloat green = reader.value<GLfloat>();
+        GLfloat blue = reader.value<GLfloat>();
+        GLfloat alpha = reader.value<GLfloat>();
+        glClearAccum(red, green, blue, alpha);
+        return true;
+    }
+    case GlFunction::ClearIndex: {
+        GLfloat c = reader.value<GLfloat>();
+        glClearIndex(c);
+        return true;
+    }
+    case GlFunction::IndexMask: {
+        GLuint mask = reader.value<GLuint>();
+        glIndexMask(mask);
+        return true;
+    }
+    case GlFunction::Accum: {
+        GLenum op = reader.value<GLenum>();
+        GLfloat value = reader.value<GLfloat>();
+        glAccum(op, value);
+        return true;
+    }
+    case GlFunction::PopAttrib: {
+        glPopAttrib();
+        return true;
+    }
+    case GlFunction::PushAttrib: {
+        GLbitfield mask = reader.value<GLbitfield>();
+        glPushAttrib(mask);
+        return true;
+    }
+    case GlFunction::MapGrid1d: {
+        GLint un = reader.value<GLint>();
+        GLdouble u1 = reader.value<GLdouble>();
+        GLdouble u2 = reader.value<GLdouble>();
+        glMapGrid1d(un, u1, u2);
+        return true;
+    }
+    case GlFunction::MapGrid1f: {
+        GLint un = reader.value<GLint>();
+        GLfloat u1 = reader.value<GLfloat>();
+        GLfloat u2 = reader.value<GLfloat>();
+        glMapGrid1f(un, u1, u2);
+        return true;
+    }
+    case GlFunction::MapGrid2d: {
+        GLint un = reader.value<GLint>();
+        GLdouble u1 = reader.value<GLdouble>();
+        GLdouble u2 = reader.value<GLdouble>();
+        GLint vn = reader.value<GLint>();
+        GLdouble v1 = reader.value<GLdouble>();
+        GLdouble v2 = reader.value<GLdouble>();
+        glMapGrid2d(un, u1, u2, vn, v1, v2);
+        return true;
+    }
+    case GlFunction::MapGrid2f: {
+        GLint un = reader.value<GLint>();
+        GLfloat u1 = reader.value<GLfloat>();
+        GLfloat u2 = reader.value<GLfloat>();
+        GLint vn = reader.value<GLint>();
+        GLfloat v1 = reader.value<GLfloat>();
+        GLfloat v2 = reader.value<GLfloat>();
+        glMapGrid2f(un, u1, u2, vn, v1, v2);
+        return true;
+    }
+    case GlFunction::EvalCoord1d: {
+        GLdouble u = reader.value<GLdouble>();
+        glEvalCoord1d(u);
+        return true;
+    }
+    case GlFunction::EvalCoord1f: {
+        GLfloat u = reader.value<GLfloat>();
+        glEvalCoord1f(u);
+        return true;
+    }
+    case GlFunction::EvalCoord2d: {
+        GLdouble u = reader.value<GLdouble>();
+        GLdouble v = reader.value<GLdouble>();
+        glEvalCoord2d(u, v);
+        return true;
+    }
+    case GlFunction::EvalCoord2f: {
+        GLfloat u = reader.value<GLfloat>();
+        GLfloat v = reader.value<GLfloat>();
+        glEvalCoord2f(u, v);
+        return true;
+    }
+    case GlFunction::EvalMesh1: {
+        GLenum mode = reader.value<GLenum>();
+        GLint i1 = reader.value<GLint>();
+        GLint i2 = reader.value<GLint>();
+        glEvalMesh1(mode, i1, i2);
+        return true;
+    }
+    case GlFunction::EvalPoint1: {
+        GLint i = reader.value<GLint>();
+        glEvalPoint1(i);
+        return true;
+    }
+    case GlFunction::EvalMesh2: {
+        GLenum mode = reader.value<GLenum>();
+        GLint i1 = reader.value<GLint>();
+        GLint i2 = reader.value<GLint>();
+        GLint j1 = reader.value<GLint>();
+        GLint j2 = reader.value<GLint>();
+        glEvalMesh2(mode, i1, i2, j1, j2);
+        return true;
+    }
+    case GlFunction::EvalPoint2: {
+        GLint i = reader.value<GLint>();
+        GLint j = reader.value<GLint>();
+        glEvalPoint2(i, j);
+        return true;
+    }
+    case GlFunction::AlphaFunc: {
+        GLenum func = reader.value<GLenum>();
+        GLfloat ref = reader.value<GLfloat>();
+        glAlphaFunc(func, ref);
+        return true;
+    }
+    case GlFunction::PixelZoom: {
+        GLfloat xfactor = reader.value<GLfloat>();
+        GLfloat yfactor = reader.value<GLfloat>();
+        glPixelZoom(xfactor, yfactor);
+        return true;
+    }
+    case GlFunction::PixelTransferf: {
+        GLenum pname = reader.value<GLenum>();
+        GLfloat param = reader.value<GLfloat>();
+        glPixelTransferf(pname, param);
+        return true;
+    }
+    case GlFunction::PixelTransferi: {
+        GLenum pname = reader.value<GLenum>();
+        GLint param = reader.value<GLint>();
+        glPixelTransferi(pname, param);
+        return true;
+    }
+    case GlFunction::CopyPixels: {
+        GLint x = reader.value<GLint>();
+        GLint y = reader.value<GLint>();
+        GLsizei width = reader.value<GLsizei>();
+        GLsizei height = reader.value<GLsizei>();
+        GLenum type = reader.value<GLenum>();
+        glCopyPixels(x, y, width, height, type);
+        return true;
+    }
+    case GlFunction::GetClipPlane: {
+        GLenum plane = reader.value<GLenum>();
+        GLdouble * equation = static_cast<GLdouble *>(reader.scratch());
+        glGetClipPlane(plane, equation);
+        return true;
+    }
+    case GlFunction::GetLightfv: {
+        GLenum light = reader.value<GLenum>();
+        GLenum pname = reader.value<GLenum>();
+        GLfloat * params = static_cast<GLfloat *>(reader.scratch());
+        glGetLightfv(light, pname, params);
+        return true;
+    }
+    case GlFunction::GetLightiv: {
+        GLenum light = reader.value<GLenum>();
+        GLenum pname = reader.value<GLenum>();
+        GLint * params = static_cast<GLint *>(reader.scratch());
+        glGetLightiv(light, pname, params);
+        return true;
+    }
+    case GlFunction::GetMapdv: {
+        GLenum target = reader.value<GLenum>();
+        GLenum query = reader.value<GLenum>();
+        GLdouble * v = static_cast<GLdouble *>(reader.scratch());
+        glGetMapdv(target, query, v);
+        return true;
+    }
+    case GlFunction::GetMapfv: {
+        GLenum target = reader.value<GLenum>();
+        GLenum query = reader.value<GLenum>();
+        GLfloat * v = static_cast<GLfloat *>(reader.scratch());
+        glGetMapfv(target, query, v);
+        return true;
+    }
+    case GlFunction::GetMapiv: {
+        GLenum target = reader.value<GLenum>();
+        GLenum query = reader.value<GLenum>();
+        GLint * v = static_cast<GLint *>(reader.scratch());
+        glGetMapiv(target, query, v);
+        return true;
+    }
+    case GlFunction::GetMaterialfv: {
+        GLenum face = reader.value<GLenum>();
+        GLenum pname = reader.value<GLenum>();
+        GLfloat * params = static_cast<GLfloat *>(reader.scratch());
+        glGetMaterialfv(face, pname, params);
+        return true;
+    }
+    case GlFunction::GetMaterialiv: {
+        GLenum face = reader.value<GLenum>();
+        GLenum pname = reader.value<GLenum>();
+        GLint * params = static_cast<GLint *>(reader.scratch());
+        glGetMaterialiv(face, pname, params);
+        return true;
+    }
+    case GlFunction::GetPixelMapfv: {
+        GLenum map = reader.value<GLenum>();
+        GLfloat * values = static_cast<GLfloat *>(reader.scratch());
+        glGetPixelMapfv(map, values);
+        return true;
+    }
+    case GlFunction::GetPixelMapuiv: {
+        GLenum map = reader.value<GLenum>();
+        GLuint * values = static_cast<GLuint *>(reader.scratch());
+        glGetPixelMapuiv(map, values);
+        return true;
+    }
+    case GlFunction::GetPixelMapusv: {
+        GLenum map = reader.value<GLenum>();
+        GLushort * values = static_cast<GLushort *>(reader.scratch());
+        glGetPixelMapusv(map, values);
+        return true;
+    }
+    case GlFunction::GetPolygonStipple: {
+        GLubyte * mask = static_cast<GLubyte *>(reader.scratch());
+        glGetPolygonStipple(mask);
+        return true;
+    }
+    case GlFunction::GetTexEnvfv: {
+        GLenum target = reader.value<GLenum>();
+        GLenum pname = reader.value<GLenum>();
+        GLfloat * params = static_cast<GLfloat *>(reader.scratch());
+        glGetTexEnvfv(target, pname, params);
+        return true;
+    }
+    case GlFunction::GetTexEnviv: {
+        GLenum target = reader.value<GLenum>();
+        GLenum pname = reader.value<GLenum>();
+        GLint * params = static_cast<GLint *>(reader.scratch());
+        glGetTexEnviv(target, pname, params);
+        return true;
+    }
+    case GlFunction::GetTexGendv: {
+        GLenum coord = reader.value<GLenum>();
+        GLenum pname = reader.value<GLenum>();
+        GLdouble * params = static_cast<GLdouble *>(reader.scratch());
+        glGetTexGendv(coord, pname, params);
+        return true;
+    }
+    case GlFunction::GetTexGenfv: {
+        GLenum coord = reader.value<GLenum>();
+        GLenum pname = reader.value<GLenum>();
+        GLfloat * params = static_cast<GLfloat *>(reader.scratch());
+        glGetTexGenfv(coord, pname, params);
+        return true;
+    }
+    case GlFunction::GetTexGeniv: {
+        GLenum coord = reader.value<GLenum>();
+        GLenum pname = reader.value<GLenum>();
+        GLint * params = static_cast<GLint *>(reader.scratch());
+        glGetTexGeniv(coord, pname, params);
+        return true;
+    }
+    case GlFunction::IsList: {
+        GLuint list = reader.value<GLuint>();
+        glIsList(list);
+        return true;
+    }
+    case GlFunction::Frustum: {
+        GLdouble left = reader.value<GLdouble>();
+        GLdouble right = reader.value<GLdouble>();
+        GLdouble bottom = reader.value<GLdouble>();
+        GLdouble top = reader.value<GLdouble>();
+        GLdouble zNear = reader.value<GLdouble>();
+        GLdouble zFar = reader.value<GLdouble>();
+        glFrustum(left, right, bottom, top, zNear, zFar);
+        return true;
+    }
+    case GlFunction::LoadIdentity: {
+        glLoadIdentity();
+        return true;
+    }
+    case GlFunction::MatrixMode: {
+        GLenum mode = reader.value<GLenum>();
+        glMatrixMode(mode);
+        return true;
+    }
+    case GlFunction::Ortho: {
+        GLdouble left = reader.value<GLdouble>();
+        GLdouble right = reader.value<GLdouble>();
+        GLdouble bottom = reader.value<GLdouble>();
+        GLdouble top = reader.value<GLdouble>();
+        GLdouble zNear = reader.value<GLdouble>();
+        GLdouble zFar = reader.value<GLdouble>();
+        glOrtho(left, right, bottom, top, zNear, zFar);
+        return true;
+    }
+    case GlFunction::PopMatrix: {
+        glPopMatrix();
+        return true;
+    }
+    case GlFunction::PushMatrix: {
+        glPushMatrix();
+        return true;
+    }
+    case GlFunction::Rotated: {
+        GLdouble angle = reader.value<GLdouble>();
+        GLdouble x = reader.value<GLdouble>();
+        GLdouble y = reader.value<GLdouble>();
+        GLdouble z = reader.value<GLdouble>();
+        glRotated(angle, x, y, z);
+        return true;
+    }
+    case GlFunction::Rotatef: {
+        GLfloat angle = reader.value<GLfloat>();
+        GLfloat x = reader.value<GLfloat>();
+        GLfloat y = reader.value<GLfloat>();
+        GLfloat z = reader.value<GLfloat>();
+        glRotatef(angle, x, y, z);
+        return true;
+    }
+    case GlFunction::Scaled: {
+        GLdouble x = reader.value<GLdouble>();
+        GLdouble y = reader.value<GLdouble>();
+        GLdouble z = reader.value<GLdouble>();
+        glScaled(x, y, z);
+        return true;
+    }
+    case GlFunction::Scalef: {
+        GLfloat x = reader.value<GLfloat>();
+        GLfloat y = reader.value<GLfloat>();
+        GLfloat z = reader.value<GLfloat>();
+        glScalef(x, y, z);
+        return true;
+    }
+    case GlFunction::Translated: {
+        GLdouble x = reader.value<GLdouble>();
+        GLdouble y = reader.value<GLdouble>();
+        GLdouble z = reader.value<GLdouble>();
+        glTranslated(x, y, z);
+        return true;
+    }
+    case GlFunction::Translatef: {
+        GLfloat x = reader.value<GLfloat>();
+        GLfloat y = reader.value<GLfloat>();
+        GLfloat z = reader.value<GLfloat>();
+        glTranslatef(x, y, z);
+        return true;
+    }
+    case GlFunction::DrawArrays: {
+        GLenum mode = reader.value<GLenum>();
+        GLint first = reader.value<GLint>();
+        GLsizei count = reader.value<GLsizei>();
+        glDrawArrays(mode, first, count);
+        return true;
+    }
+    case GlFunction::DrawElements: {
+        GLenum mode = reader.value<GLenum>();
+        GLsizei count = reader.value<GLsizei>();
+        GLenum type = reader.value<GLenum>();
+        const void * indices = reader.offset();
+        glDrawElements(mode, count, type, indices);
+        return true;
+    }
+    case GlFunction::GetPointerv: {
+        GLenum pname = reader.value<GLenum>();
+        void ** params = static_cast<void **>(reader.scratch());
+        glGetPointerv(pname, params);
+        return true;
+    }
+    case GlFunction::PolygonOffset: {
+        GLfloat factor = reader.value<GLfloat>();
+        GLfloat units = reader.value<GLfloat>();
+        glPolygonOffset(factor, units);
+        return true;
+    }
+    case GlFunction::CopyTexImage1D: {
+        GLenum target = reader.value<GLenum>();
+        GLint level = reader.value<GLint>();
+        GLenum internalformat = reader.value<GLenum>();
+        GLint x = reader.value<GLint>();
+        GLint y = reader.value<GLint>();
+        GLsizei width = reader.value<GLsizei>();
+        GLint border = reader.value<GLint>();
+        glCopyTexImage1D(target, level, internalformat, x, y, width, border);
+        return true;
+    }
+    case GlFunction::CopyTexImage2D: {
+        GLenum target = reader.value<GLenum>();
+        GLint level = reader.value<GLint>();
+        GLenum internalformat = reader.value<GLenum>();
+        GLint x = reader.value<GLint>();
+        GLint y = reader.value<GLint>();
+        GLsizei width = reader.value<GLsizei>();
+        GLsizei height = reader.value<GLsizei>();
+        GLint border = reader.value<GLint>();
+        glCopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+        return true;
+    }
+    case GlFunction::CopyTexSubImage1D: {
+        GLenum target = reader.value<GLenum>();
+        GLint level = reader.value<GLint>();
+        GLint xoffset = reader.value<GLint>();
+        GLint x = reader.value<GLint>();
+        GLint y = reader.value<GLint>();
+        GLsizei width = reader.value<GLsizei>();
+        glCopyTexSubImage1D(target, level, xoffset, x, y, width);
+        return true;
+    }
+    case GlFunction::CopyTexSubImage2D: {
+        GLenum target = reader.value<GLenum>();
+        GLint level = reader.value<GLint>();
+        GLint xoffset = reader.value<GLint>();
+        GLint yoffset = reader.value<GLint>();
+        GLint x = reader.value<GLint>();
+        GLint y = reader.value<GLint>();
+        GLsizei width = reader.value<GLsizei>();
+        GLsizei height = reader.value<GLsizei>();
+        glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+        return true;
+    }
+    case GlFunction::TexSubImage2D: {
+        GLenum target = reader.value<GLenum>();
+        GLint level = reader.value<GLint>();
+        GLint xoffset = reader.value<GLint>();
+        GLint yoffset = reader.value<GLint>();
+        GLsizei width = reader.value<GLsizei>();
+        GLsizei height = reader.value<GLsizei>();
+        GLenum format = reader.value<GLenum>();
+        GLenum type = reader.value<GLenum>();
+        const void * pixels = static_cast<const void *>(reader.bytes());
+        glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+        return true;
+    }
+    case GlFunction::BindTexture: {
+        GLenum target = reader.value<GLenum>();
+        GLuint texture = reader.name(GlObject::Texture, reader.value<GLuint>());
+        glBindTexture(target, texture);
+        return true;
+    }
+    case GlFunction::DeleteTextures: {
+        GLsizei n = reader.value<GLsizei>();
+        const GLuint * textures = reader.names(GlObject::Texture, n);
+        glDeleteTextures(n, textures);
+        return true;
+    }
+    case GlFunction::GenTextures: {
+        GLsizei n = reader.value<GLsizei>();
+        GLuint * textures = static_cast<GLuint *>(reader.scratch());
+        glGenTextures(n, textures);
+        reader.mapNames(GlObject::Texture, n, textures);
+        return true;
+    }
+    case GlFunction::IsTexture: {
+        GLuint texture = reader.name(GlObject::Texture, reader.value<GLuint>());
+        glIsTexture(texture);
+        return true;
+    }
+    case GlFunction::ArrayElement: {
+        GLint i = reader.value<GLint>();
+        glArrayElement(i);
+        return true;
+    }
+    case GlFunction::DisableClientState: {
+        GLenum array = reader.value<GLenum>();
+        glDisableClientState(array);
+        return true;
+    }
+    case GlFunction::EnableClientState: {
+        GLenum array = reader.value<GLenum>();
+        glEnableClientState(array);
+        return true;
+    }
+    case GlFunction::Indexub: {
+        GLubyte c = reader.value<GLubyte>();
+        glIndexub(c);
+        return true;
+    }
+    case GlFunction::PopClientAttrib: {
+        glPopClientAttrib();
+        return true;
+    }
+    case GlFunction::PushClientAttrib: {
+        GLbitfield mask = reader.value<GLbitfield>();
+        glPushClientAttrib(mask);
+        return true;
+    }
+    case GlFunction::DrawRangeElements: {
+        GLenum mode = reader.value<GLenum>();
+        GLuint start = reader.value<GLuint>();
+        GLuint end = reader.value<GLuint>();
+        GLsizei count = reader.value<GLsizei>();
+        GLenum type = reader.value<GLenum>();
+        const void * indices = reader.offset();
+        glDrawRangeElements(mode, start, end, count, type, indices);
+        return true;
+    }
+    case GlFunction::CopyTexSubImage3D: {
+        GLenum target = reader.value<GLenum>();
+        GLint level = reader.value<GLint>();
+        GLint xoffset = reader.value<GLint>();
+        GLint yoffset = reader.value<GLint>();
+        GLint zoffset = reader.value<GLint>();
+        GLint x = reader.value<GLint>();
+        GLint y = reader.value<GLint>();
+        GLsizei width = reader.value<GLsizei>();
+        GLsizei height = reader.value<GLsizei>();
+        glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+        return true;
+    }
+    case GlFunction::ActiveTexture: {
+        GLenum texture = reader.value<GLenum>();
+        glActiveTexture(texture);
+        return true;
+    }
+    case GlFunction::SampleCoverage: {
+        GLfloat value = reader.value<GLfloat>();
+        GLboolean invert = reader.value<GLboolean>();
+        glSampleCoverage(value, invert);
+        return true;
+    }
+    case GlFunction::ClientActiveTexture: {
+        GLenum texture = reader.value<GLenum>();
+        glClientActiveTexture(texture);
+        return true;
+    }
+    case GlFunction::MultiTexCoord1d: {
+        GLenum target = reader.value<GLenum>();
+        GLdouble s = reader.value<GLdouble>();
+        glMultiTexCoord1d(target, s);
+        return true;
+    }
+    case GlFunction::MultiTexCoord1f: {
+        GLenum target = reader.value<GLenum>();
+        GLfloat s = reader.value<GLfloat>();
+        glMultiTexCoord1f(target, s);
+        return true;
+    }
+    case GlFunction::MultiTexCoord1i: {
+        GLenum target = reader.value<GLenum>();
+        GLint s = reader.value<GLint>();
+        glMultiTexCoord1i(target, s);
+        return true;
+    }
+    case GlFunction::MultiTexCoord1s: {
+        GLenum target = reader.value<GLenum>();
+        GLshort s = reader.value<GLshort>();
+        glMultiTexCoord1s(target, s);
+        return true;
+    }
+    case GlFunction::MultiTexCoord2d: {
+        GLenum target = reader.value<GLenum>();
+        GLdouble s = reader.value<GLdouble>();
+        GLdouble t = reader.value<GLdouble>();
+        glMultiTexCoord2d(target, s, t);
+        return true;
+    }
+    case GlFunction::MultiTexCoord2f: {
+        GLenum target = reader.value<GLenum>();
+        GLfloat s = reader.value<GLfloat>();
+        GLfloat t = reader.value<GLfloat>();
+        glMultiTexCoord2f(target, s, t);
+        return true;
+    }
+    case GlFunction::MultiTexCoord2i: {
+        GLenum target = reader.value<GLenum>();
+        GLint s = reader.value<GLint>();
+        GLint t = reader.value<GLint>();
+        glMultiTexCoord2i(target, s, t);
+        return true;
+    }
+    case GlFunction::MultiTexCoord2s: {
+        GLenum target = reader.value<GLenum>();
+        GLshort s = reader.value<GLshort>();
+        GLshort t = reader.value<GLshort>();
+        glMultiTexCoord2s(target, s, t);
+        return true;
+    }
+    case GlFunction::MultiTexCoord3d: {
+        GLenum target = reader.value<GLenum>();
+        GLdouble s = reader.value<GLdouble>();
+        GLdouble t = reader.value<GLdouble>();
+        GLdouble r = reader.value<GLdouble>();
+        glMultiTexCoord3d(target, s, t, r);
+        return true;
+    }
+    case GlFunction::MultiTexCoord3f: {
+        GLenum target = reader.value<GLenum>();
+        GLfloat s = reader.value<GLfloat>();
+        GLfloat t = reader.value<GLfloat>();
+        GLfloat r = reader.value<GLfloat>();
+        glMultiTexCoord3f(target, s, t, r);
+        return true;
+    }
+    case GlFunction::MultiTexCoord3i: {
+        GLenum target = reader.value<GLenum>();
+        GLint s = reader.value<GLint>();
+        GLint t = reader.value<GLint>();
+        GLint r = reader.value<GLint>();
+        glMultiTexCoord3i(target, s, t, r);
+        return true;
+    }
+    case GlFunction::MultiTexCoord3s: {
+        GLenum target = reader.value<GLenum>();
+        GLshort s = reader.value<GLshort>();
+        GLshort t = reader.value<GLshort>();
+        GLshort r = reader.value<GLshort>();
+        glMultiTexCoord3s(target, s, t, r);
+        return true;
+    }
+    case GlFunction::MultiTexCoord4d: {
+        GLenum target = reader.value<GLenum>();
+        GLdouble s = reader.value<GLdouble>();
+        GLdouble t = reader.value<GLdouble>();
+        GLdouble r = reader.value<GLdouble>();
+        GLdouble q = reader.value<GLdouble>();
+        glMultiTexCoord4d(target, s, t, r, q);
+        return true;
+    }
+    case GlFunction::MultiTexCoord4f: {
+        GLenum target = reader.value<GLenum>();
+        GLfloat s = reader.value<GLfloat>();
+        GLfloat t = reader.value<GLfloat>();
+        GLfloat r = reader.value<GLfloat>();
+        GLfloat q = reader.value<GLfloat>();
+        glMultiTexCoord4f(target, s, t, r, q);
+        return true;
+    }
+    case GlFunction::MultiTexCoord4i: {
+        GLenum target = reader.value<GLenum>();
+        GLint s = reader.value<GLint>();
+        GLint t = reader.value<GLint>();
+        GLint r = reader.value<GLint>();
+        GLint q = reader.value<GLint>();
+        glMultiTexCoord4i(target, s, t, r, q);
+        return true;
+    }
+    case GlFunction::MultiTexCoord4s: {
+        GLenum target = reader.value<GLenum>();
+        GLshort s = reader.value<GLshort>();
+        GLshort t = reader.value<GLshort>();
+        GLshort r = reader.value<GLshort>();
+        GLshort q = reader.value<GLshort>();
+        glMultiTexCoord4s(target, s, t, r, q);
+        return true;
+    }
+    case GlFunction::BlendFuncSeparate: {
+        GLenum sfactorRGB = reader.value<GLenum>();
+        GLenum dfactorRGB = reader.value<GLenum>();
+        GLenum sfactorAlpha = reader.value<GLenum>();
+        GLenum dfactorAlpha = reader.value<GLenum>();
+        glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+        return true;
+    }
+    case GlFunction::PointParameterf: {
+        GLenum pname = reader.value<GLenum>();
+        GLfloat param = reader.value<GLfloat>();
+        glPointParameterf(pname, param);
+        return true;
+    }
+    case GlFunction::PointParameteri: {
+        GLenum pname = reader.value<GLenum>();
+        GLint param = reader.value<GLint>();
+        glPointParameteri(pname, param);
+        return true;
+    }
+    case GlFunction::FogCoordf: {
+        GLfloat coord = reader.value<GLfloat>();
+        glFogCoordf(coord);
+        return true;
+    }
+    case GlFunction::FogCoordd: {
+        GLdouble coord = reader.value<GLdouble>();
+        glFogCoordd(coord);
+        return true;
+    }
+    case GlFunction::SecondaryColor3b: {
+        GLbyte red = reader.value<GLbyte>();
+        GLbyte green = reader.value<GLbyte>();
+        GLbyte blue = reader.value<GLbyte>();
+        glSecondaryColor3b(red, green, blue);
+        return true;
+    }
+    case GlFunction::SecondaryColor3d: {
+        GLdouble red = reader.value<GLdouble>();
+        GLdouble green = reader.value<GLdouble>();
+        GLdouble blue = reader.value<GLdouble>();
+        glSecondaryColor3d(red, green, blue);
+        return true;
+    }
+    case GlFunction::SecondaryColor3f: {
+        GLfloat red = reader.value<GLfloat>();
+        GLfloat green = reader.value<GLfloat>();
+        GLfloat blue = reader.value<GLfloat>();
+        glSecondaryColor3f(red, green, blue);
+        return true;
+    }
+    case GlFunction::SecondaryColor3i: {
+        GLint red = reader.value<GLint>();
+        GLint green = reader.value<GLint>();
+        GLint blue = reader.value<GLint>();
+        glSecondaryColor3i(red, green, blue);
+        return true;
+    }
+    case GlFunction::SecondaryColor3s: {
+        GLshort red = reader.value<GLshort>();
+        GLshort green = reader.value<GLshort>();
+        GLshort blue = reader.value<GLshort>();
+        glSecondaryColor3s(red, green, blue);
+        return true;
+    }
+    case GlFunction::SecondaryColor3ub: {
+        GLubyte red = reader.value<GLubyte>();
+        GLubyte green = reader.value<GLubyte>();
+        GLubyte blue = reader.value<GLubyte>();
+        glSecondaryColor3ub(red, green, blue);
+        return true;
+    }
+    case GlFunction::SecondaryColor3ui: {
+        GLuint red = reader.value<GLuint>();
+        GLuint green = reader.value<GLuint>();
+        GLuint blue = reader.value<GLuint>();
+        glSecondaryColor3ui(red, green, blue);
+        return true;
+    }
+    case GlFunction::SecondaryColor3us: {
+        GLushort red = reader.value<GLushort>();
+        GLushort green = reader.value<GLushort>();
+        GLushort blue = reader.value<GLushort>();
+        glSecondaryColor3us(red, green, blue);
+        return true;
+    }
+    case GlFunction::WindowPos2d: {
+        GLdouble x = reader.value<GLdouble>();
+        GLdouble y = reader.value<GLdouble>();
+        glWindowPos2d(x, y);
+        return true;
+    }
+    case GlFunction::WindowPos2f: {
+        GLfloat x = reader.value<GLfloat>();
+        GLfloat y = reader.value<GLfloat>();
+        glWindowPos2f(x, y);
+        return true;
+    }
+    case GlFunction::WindowPos2i: {
+        GLint x = reader.value<GLint>();
+        GLint y = reader.value<GLint>();
+        glWindowPos2i(x, y);
+        return true;
+    }
+    case GlFunction::WindowPos2s: {
+        GLshort x = reader.value<GLshort>();
+        GLshort y = reader.value<GLshort>();
+        glWindowPos2s(x, y);
+        return true;
+    }
+    case GlFunction::WindowPos3d: {
+        GLdouble x = reader.value<GLdouble>();
+        GLdouble y = reader.value<GLdouble>();
+        GLdouble z = reader.value<GLdouble>();
+        glWindowPos3d(x, y, z);
+        return true;
+    }
+    case GlFunction::WindowPos3f: {
+        GLfloat x = reader.value<GLfloat>();
+        GLfloat y = reader.value<GLfloat>();
+        GLfloat z = reader.value<GLfloat>();
+        glWindowPos3f(x, y, z);
+        return true;
+    }
+    case GlFunction::WindowPos3i: {
+        GLint x = reader.value<GLint>();
+        GLint y = reader.value<GLint>();
+        GLint z = reader.value<GLint>();
+        glWindowPos3i(x, y, z);
+        return true;
+    }
+    case GlFunction::WindowPos3s: {
+        GLshort x = reader.value<GLshort>();
+        GLshort y = reader.value<GLshort>();
+        GLshort z = reader.value<GLshort>();
+        glWindowPos3s(x, y, z);
+        return true;
+    }
+    case GlFunction::BlendColor: {
+        GLfloat red = reader.value<GLfloat>();
+        GLfloat green = reader.value<GLfloat>();
+        GLfloat blue = reader.value<GLfloat>();
+        GLfloat alpha = reader.value<GLfloat>();
+        glBlendColor(red, green, blue, alpha);
+        return true;
+    }
+    case GlFunction::BlendEquation: {
+        GLenum mode = reader.value<GLenum>();
+        glBlendEquation(mode);
+        return true;
+    }
+    case GlFunction::GenQueries: {
+        GLsizei n = reader.value<GLsizei>();
+        GLuint * ids = static_cast<GLuint *>(reader.scratch());
+        glGenQueries(n, ids);
+        reader.mapNames(GlObject::Query, n, ids);
+        return true;
+    }
+    case GlFunction::DeleteQueries: {
+        GLsizei n = reader.value<GLsizei>();
+        const GLuint * ids = reader.names(GlObject::Query, n);
+        glDeleteQueries(n, ids);
+        return true;
+    }
+    case GlFunction::IsQuery: {
+        GLuint id = reader.name(GlObject::Query, reader.value<GLuint>());
+        glIsQuery(id);
+        return true;
+    }
+    case GlFunction::BeginQuery: {
+        GLenum target = reader.value<GLenum>();
+        GLuint id = reader.name(GlObject::Query, reader.value<GLuint>());
+        glBeginQuery(target, id);
+        return true;
+    }
+    case GlFunction::EndQuery: {
+        GLenum target = reader.value<GLenum>();
+        glEndQuery(target);
+        return true;
+    }
+    case GlFunction::GetQueryiv: {
+        GLenum target = reader.value<GLenum>();
+        GLenum pname = reader.value<GLenum>();
+        GLint * params = static_cast<GLint *>(reader.scratch());
+        glGetQueryiv(target, pname, params);
+        return true;
+    }
+    case GlFunction::GetQueryObjectiv: {
+        GLuint id = reader.name(GlObject::Query, reader.value<GLuint>());
+        GLenum pname = reader.value<GLenum>();
+        GLint * params = static_cast<GLint *>(reader.scratch());
+        glGetQueryObjectiv(id, pname, params);
+        return true;
+    }
+    case GlFunction::GetQueryObjectuiv: {
+        GLuint id = reader.name(GlObject::Query, reader.value<GLuint>());
+        GLenum pname = reader.value<GLenum>();
+        GLuint * params = static_cast<GLuint *>(reader.scratch());
+        glGetQueryObjectuiv(id, pname, params);
+        return true;
+    }
+    case GlFunction::BindBuffer: {
+        GLenum target = reader.value<GLenum>();
+        GLuint buffer = reader.name(GlObject::Buffer, reader.value<GLuint>());
+        glBindBuffer(target, buffer);
+        return true;
+    }
+    case GlFunction::DeleteBuffers: {
+        GLsizei n = reader.value<GLsizei>();
+        const GLuint * buffers = reader.names(GlObject::Buffer, n);
+        glDeleteBuffers(n, buffers);
+        return true;
+    }
+    case GlFunction::GenBuffers: {
+        GLsizei n = reader.value<GLsizei>();
+        GLuint * buffers = static_cast<GLuint *>(reader.scratch());
+        glGenBuffers(n, buffers);
+        reader.mapNames(GlObject::Buffer, n, buffers);
+        return true;
+    }
+    case GlFunction::IsBuffer: {
+        GLuint buffer = reader.name(GlObject::Buffer, reader.value<GLuint>());
+        glIsBuffer(buffer);
+        return true;
+    }
+    case GlFunction::BufferData: {
+        GLenum target = reader.value<GLenum>();
+        GLsizeiptr size = reader.value<GLsizeiptr>();
+        const void * data = static_cast<const void *>(reader.bytes());
+        GLenum usage = reader.value<GLenum>();
+        glBufferData(target, size, data, usage);
+        return true;
+    }
+    case GlFunction::BufferSubData: {
+        GLenum target = reader.value<GLenum>();
+        GLintptr offset = reader.value<GLintptr>();
+        GLsizeiptr size = reader.value<GLsizeiptr>();
+        const void * data = static_cast<const void *>(reader.bytes());
+        glBufferSubData(target, offset, size, data);
+        return true;
+    }
+    case GlFunction::GetBufferParameteriv: {
+        GLenum target = reader.value<GLenum>();
+        GLenum pname = reader.value<GLenum>();
+        GLint * params = static_cast<GLint *>(reader.scratch());
+        glGetBufferParameteriv(target, pname, params);
+        return true;
+    }
+    case GlFunction::GetBufferPointerv: {
+        GLenum target = reader.value<GLenum>();
+        GLenum pname = reader.value<GLenum>();
+        void ** params = static_cast<void **>(reader.scratch());
+        glGetBufferPointerv(target, pname, params);
+        return true;
+    }
+    case GlFunction::BlendEquationSeparate: {
+        GLenum modeRGB = reader.value<GLenum>();
+        GLenum modeAlpha = reader.value<GLenum>();
+        glBlendEquationSeparate(modeRGB, modeAlpha);
+        return true;
+    }
+    case GlFunction::DrawBuffers: {
+        GLsizei n = reader.value<GLsizei>();
+        const GLenum * bufs = static_cast<const GLenum *>(reader.bytes());
+        glDrawBuffers(n, bufs);
+        return true;
+    }
+    case GlFunction::StencilOpSeparate: {
+        GLenum face = reader.value<GLenum>();
+        GLenum sfail = reader.value<GLenum>();
+        GLenum dpfail = reader.value<GLenum>();
+        GLenum dppass = reader.value<GLenum>();
+        glStencilOpSeparate(face, sfail, dpfail, dppass);
+        return true;
+    }
+    case GlFunction::StencilFuncSeparate: {
+        GLenum face = reader.value<GLenum>();
+        GLenum func = reader.value<GLenum>();
+        GLint ref = reader.value<GLint>();
+        GLuint mask = reader.value<GLuint>();
+        glStencilFuncSeparate(face, func, ref, mask);
+        return true;
+    }
+    case GlFunction::StencilMaskSeparate: {
+        GLenum face = reader.value<GLenum>();
+        GLuint mask = reader.value<GLuint>();
+        glStencilMaskSeparate(face, mask);
+        return true;
+    }
+    case GlFunction::AttachShader: {
+        GLuint program = reader.name(GlObject::Program, reader.value<GLuint>());
+        GLuint shader = reader.name(GlObject::Shader, reader.value<GLuint>());
+        glAttachShader(program, shader);
+        return true;
+    }
+    case GlFunction::BindAttribLocation: {
+        GLuint program = reader.name(GlObject::Program, reader.value<GLuint>());
+        GLuint index = reader.value<GLuint>();
+        const GLchar * name = reader.string();
+        glBindAttribLocation(program, index, name);
+        return true;
+    }
+    case GlFunction::CompileShader: {
+        GLuint shader = reader.name(GlObject::Shader, reader.value<GLuint>());
+        glCompileShader(shader);
+        return true;
+    }
+    case GlFunction::CreateProgram: {
+        GLuint result = glCreateProgram();
+        reader.mapName(GlObject::Program, reader.value<GLuint>(), result);
+        return true;
+    }
+    case GlFunction::CreateShader: {
+        GLenum type = reader.value<GLenum>();
+        GLuint result = glCreateShader(type);
+        reader.mapName(GlObject::Shader, reader.value<GLuint>(), result);
+        return true;
+    }
+    case GlFunction::DeleteProgram: {
+        GLuint program = reader.name(GlObject::Program, reader.value<GLuint>());
+        glDeleteProgram(program);
+        return true;
+    }
+    case GlFunction::DeleteShader: {
+        GLuint shader = reader.name(GlObject::Shader, reader.value<GLuint>());
+        glDeleteShader(shader);
+        return true;
+    }
+    case GlFunction::DetachShader: {
+        GLuint program = reader.name(GlObject::Program, reader.value<GLuint>());
+        GLuint shader = reader.name(GlObject::Shader, reader.value<GLuint>());
+        glDetachShader(program, shader);
+        return true;
+    }
+    case GlFunction::DisableVertexAttribArray: {
+        GLuint index = reader.value<GLuint>();
+        glDisableVertexAttribArray(index);
+        return true;
+    }
+    case GlFunction::EnableVertexAttribArray: {
+        GLuint index = reader.value<GLuint>();
+        glEnableVertexAttribArray(index);
+        return true;
+    }
+    case GlFunction::GetActiveAttrib: {
+        GLuint program = reader.name(GlObject::Program, reader.value<GLuint>());
+        GLuint index = reader.value<GLuint>();
+        GLsizei bufSize = reader.value<GLsizei>();
+        GLsizei * length = static_cast<GLsizei *>(reader.scratch());
+        GLint * size = static_cast<GLint *>(reader.scratch());
+        GLenum * type = static_cast<GLenum *>(reader.scratch());
+        GLchar * name = static_cast<GLchar *>(reader.scratch());
+        glGetActiveAttrib(program, index, bufSize, length, size, type, name);
+        return true;
+    }
+    case GlFunction::GetActiveUniform: {
+        GLuint program = reader.name(GlObject::Program, reader.value<GLuint>());
+        GLuint index = reader.value<GLuint>();
+        GLsizei bufSize = reader.value<GLsizei>();
+        GLsizei * length = static_cast<GLsizei *>(reader.scratch());
+        GLint * size = static_cast<GLint *>(reader.scratch());
+        GLenum * type = static_cast<GLenum *>(reader.scratch());
+        GLchar * name = static_cast<GLchar *>(reader.scratch());
+        glGetActiveUniform(program, index, bufSize, length, size, type, name);
+        return true;
+    }
+    case GlFunction::GetAttachedShaders: {
+        GLuint program = reader.name(GlObject::Program, reader.value<GLuint>());
+        GLsizei maxCount = reader.value<GLsizei>();
+        GLsizei * count = static_cast<GLsizei *>(reader.scratch());
+        GLuint * shaders = static_cast<GLuint *>(reader.scratch());
+        glGetAttachedShaders(program, maxCount, count, shaders);
+        return true;
+    }
+    case GlFunction::GetAttribLocation: {
+        GLuint program = reader.name(GlObject::Program, reader.value<GLuint>());
+        const GLchar * name = reader.string();
+        glGetAttribLocation(program, name);
+        return true;
+    }
+    case GlFunction::GetProgramiv: {
+        GLuint program = reader.name(GlObject::Program, reader.value<GLuint>());
+        GLenum pname = reader.value<GLenum>();
+        GLint * params = static_cast<GLint *>(reader.scratch());
+        glGetProgramiv(program, pname, params);
+        return true;
+    }
+    case GlFunction::GetProgramInfoLog: {
+        GLuint program = reader.name(GlObject::Program, reader.value<GLuint>());
+        GLsizei bufSize = reader.value<GLsizei>();
+        GLsizei * length = static_cast<GLsizei *>(reader.scratch());
+        GLchar * infoLog = static_cast<GLchar *>(reader.scratch());
+        glGetProgramInfoLog(program, bufSize, length, infoLog);
+        return true;
+    }
+    case GlFunction::GetShaderiv: {
+        GLuint shader = reader.name(GlObject::Shader, reader.value<GLuint>());
+        GLenum pname = reader.value<GLenum>();
+        GLint * params = static_cast<GLint *>(reader.scratch());
+        glGetShaderiv(shader, pname, params);
+        return true;
+    }
+    case GlFunction::GetShaderInfoLog: {
+        GLuint shader = reader.name(GlObject::Shader, reader.value<GLuint>());
+        GLsizei bufSize = reader.value<GLsizei>();
+        GLsizei * length = static_cast<GLsizei *>(reader.scratch());
+        GLchar * infoLog = static_cast<GLchar *>(reader.scratch());
+        glGetShaderInfoLog(shader, bufSize, length, infoLog);
+        return true;
+    }
+    case GlFunction::GetShaderSource: {
+        GLuint shader = reader.name(GlObject::Shader, reader.value<GLuint>());
+        GLsizei bufSize = reader.value<GLsizei>();
+        GLsizei * length = static_cast<GLsizei *>(reader.scratch());
+        GLchar * source = static_cast<GLchar *>(reader.scratch());
+        glGetShaderSource(shader, bufSize, length, source);
+        return true;
+    }
+    case GlFunction::GetUniformLocation: {
+        GLuint program = reader.name(GlObject::Program, reader.value<GLuint>());
+        const GLchar * name = reader.string();
+        glGetUniformLocation(program, name);
+        return true;
+    }
+    case GlFunction::GetUniformfv: {
+        GLuint program = reader.name(GlObject::Program, reader.value<GLuint>());
+        GLint location = reader.value<GLint>();
+        GLfloat * params = static_cast<GLfloat *>(reader.scratch());
+        glGetUniformfv(program, location, params);
+        return true;
+    }
+    case GlFunction::GetUniformiv: {
+        GLuint program = reader.name(GlObject::Program, reader.value<GLuint>());
+        GLint location = reader.value<GLint>();
+        GLint * params = static_cast<GLint *>(reader.scratch());
+        glGetUniformiv(program, location, params);
+        return true;
+    }
+    case GlFunction::GetVertexAttribdv: {
+        GLuint index = reader.value<GLuint>();
+        GLenum pname = reader.value<GLenum>();
+        GLdouble * params = static_cast<GLdouble *>(reader.scratch());
+        glGetVertexAttribdv(index, pname, params);
+        return true;
+    }
+    case GlFunction::GetVertexAttribfv: {
+        GLuint index = reader.value<GLuint>();
+        GLenum pname = reader.value<GLenum>();
+        GLfloat * params = static_cast<GLfloat *>(reader.scratch());
+        glGetVertexAttribfv(index, pname, params);
+        return true;
+    }
+    case GlFunction::GetVertexAttribiv: {
+        GLuint index = reader.value<GLuint>();
+        GLenum pname = reader.value<GLenum>();
+        GLint * params = static_cast<GLint *>(reader.scratch());
+        glGetVertexAttribiv(index, pname, params);
+        return true;
+    }
+    case GlFunction::GetVertexAttribPointerv: {
+        GLuint index = reader.value<GLuint>();
+        GLenum pname = reader.value<GLenum>();
+        void ** pointer = static_cast<void **>(reader.scratch());
+        glGetVertexAttribPointerv(index, pname, pointer);
+        return true;
+    }
+    case GlFunction::IsProgram: {
+        GLuint program = reader.name(GlObject::Program, reader.value<GLuint>());
+        glIsProgram(program);
+        return true;
+    }
+    case GlFunction::IsShader: {
+        GLuint shader = reader.name(GlObject::Shader, reader.value<GLuint>());
+        glIsShader(shader);
+        return true;
+    }
+    case GlFunction::LinkProgram: {
+        GLuint program = reader.name(GlObject::Program, reader.value<GLuint>());
+        glLinkProgram(program);
+        return true;
+    }
+    case GlFunction::ShaderSource: {
+        GLuint shader = reader.name(GlObject::Shader, reader.value<GLuint>());
+        GLsizei count = reader.value<GLsizei>();
+        const GLchar *const* string = reader.shaderSource(count);
+        const GLint * length = reader.shaderSourceLengths();
+        glShaderSource(shader, count, string, length);
+        return true;
+    }
+    case GlFunction::UseProgram: {
+        GLuint program = reader.name(GlObject::Program, reader.value<GLuint>());
+        glUseProgram(program);
+        return true;
+    }
+    case GlFunction::Uniform1f: {
+        GLint location = reader.value<GLint>();
+        GLfloat v0 = reader.value<GLfloat>();
+        glUniform1f(location, v0);
+        return true;
+    }
+    case GlFunction::Uniform2f: {
+        GLint location = reader.value<GLint>();
+        GLfloat v0 = reader.value<GLfloat>();
+        GLfloat v1 = reader.value<GLfloat>();
+        glUniform2f(location, v0, v1);
+        return true;
+    }
+    case GlFunction::Uniform3f: {
+        GLint location = reader.value<GLint>();
+        GLfloat v0 = reader.value<GLfloat>();
+        GLfloat v1 = reader.value<GLfloat>();
+        GLfloat v2 = reader.value<GLfloat>();
+        glUniform3f(location, v0, v1, v2);
+        return true;
+    }
+    case GlFunction::Uniform4f: {
+        GLint location = reader.value<GLint>();
+        GLfloat v0 = reader.value<GLfloat>();
+        GLfloat v1 = reader.value<GLfloat>();
+        GLfloat v2 = reader.value<GLfloat>();
+        GLfloat v3 = reader.value<GLfloat>();
+        glUniform4f(location, v0, v1, v2, v3);
+        return true;
+    }
+    case GlFunction::Uniform1i: {
+        GLint location = reader.value<GLint>();
+        GLint v0 = reader.value<GLint>();
+        glUniform1i(location, v0);
+        return true;
+    }
+    case GlFunction::Uniform2i: {
+        GLint location = reader.value<GLint>();
+        GLint v0 = reader.value<GLint>();
+        GLint v1 = reader.value<GLint>();
+        glUniform2i(location, v0, v1);
+        return true;
+    }
+    case GlFunction::Uniform3i: {
+        GLint location = reader.value<GLint>();
+        GLint v0 = reader.value<GLint>();
+        GLint v1 = reader.value<GLint>();
+        GLint v2 = reader.value<GLint>();
+        glUniform3i(location, v0, v1, v2);
+        return true;
+    }
+    case GlFunction::Uniform4i: {
+        GLint location = reader.value<GLint>();
+        GLint v0 = reader.value<GLint>();
+        GLint v1 = reader.value<GLint>();
+        GLint v2 = reader.value<GLint>();
+        GLint v3 = reader.value<GLint>();
+        glUniform4i(location, v0, v1, v2, v3);
+        return true;
+    }
+    case GlFunction::Uniform1fv: {
+        GLint location = reader.value<GLint>();
+        GLsizei count = reader.value<GLsizei>();
+        const GLfloat * value = static_cast<const GLfloat *>(reader.bytes());
+        glUniform1fv(location, count, value);
+        return true;
+    }
+    case GlFunction::Uniform2fv: {
+        GLint location = reader.value<GLint>();
+        GLsizei count = reader.value<GLsizei>();
+        const GLfloat * value = static_cast<const GLfloat *>(reader.bytes());
+        glUniform2fv(location, count, value);
+        return true;
+    }
+    case GlFunction::Uniform3fv: {
+        GLint location = reader.value<GLint>();
+        GLsizei count = reader.value<GLsizei>();
+        const GLfloat * value = static_cast<const GLfloat *>(reader.bytes());
+        glUniform3fv(location, count, value);
+        return true;
+    }
+    case GlFunction::Uniform4fv: {
+        GLint location = reader.value<GLint>();
+        GLsizei count = reader.value<GLsizei>();
+        const GLfloat * value = static_cast<const GLfloat *>(reader.bytes());
+        glUniform4fv(location, count, value);
+        return true;
+    }
+    case GlFunction::Uniform1iv: {
+        GLint location = reader.value<GLint>();
+        GLsizei count = reader.value<GLsizei>();
+        const GLint * value = static_cast<const GLint *>(reader.bytes());
+        glUniform1iv(location, count, value);
+        return true;
+    }
+    case GlFunction::Uniform2iv: {
+        GLint location = reader.value<GLint>();
+        GLsizei count = reader.value<GLsizei>();
+        const GLint * value = static_cast<const GLint *>(reader.bytes());
+        glUniform2iv(location, count, value);
+        return true;
+    }
+    case GlFunction::Uniform3iv: {
+        GLint location = reader.value<GLint>();
+        GLsizei count = reader.value<GLsizei>();
+        const GLint * value = static_cast<const GLint *>(reader.bytes());
+        glUniform3iv(location, count, value);
+        return true;
+    }
+    case GlFunction::Uniform4iv: {
+        GLint location = reader.value<GLint>();
+        GLsizei count = reader.value<GLsizei>();
+        const GLint * value = static_cast<const GLint *>(reader.bytes());
+        glUniform4iv(location, count, value);
+        return true;
+    }
+    case GlFunction::UniformMatrix2fv: {
+        GLint location = reader.value<GLint>();
+        GLsizei count = reader.value<GLsizei>();
+        GLboolean transpose = reader.value<GLboolean>();
+        const GLfloat * value = static_cast<const GLfloat *>(reader.bytes());
+        glUniformMatrix2fv(location, count, transpose, value);
+        return true;
+    }
+    case GlFunction::UniformMatrix3fv: {
+        GLint location = reader.value<GLint>();
+        GLsizei count = reader.value<GLsizei>();
+        GLboolean transpose = reader.value<GLboolean>();
+        const GLfloat * value = static_cast<const GLfloat *>(reader.bytes());
+        glUniformMatrix3fv(location, count, transpose, value);
+        return true;
+    }
+    case GlFunction::UniformMatrix4fv: {
+        GLint location = reader.value<GLint>();
+        GLsizei count = reader.value<GLsizei>();
+        GLboolean transpose = reader.value<GLboolean>();
+        const GLfloat * value = static_cast<const GLfloat *>(reader.bytes());
+        glUniformMatrix4fv(location, count, transpose, value);
+        return true;
+    }
+    case GlFunction::ValidateProgram: {
+        GLuint program = reader.name(GlObject::Program, reader.value<GLuint>());
+        glValidateProgram(program);
+        return true;
+    }
+    case GlFunction::VertexAttrib1d: {
+        GLuint index = reader.value<GLuint>();
+        GLdouble x = reader.value<GLdouble>();
+        glVertexAttrib1d(index, x);
+        return true;
+    }
+    case GlFunction::VertexAttrib1dv: {
+        GLuint index = reader.value<GLuint>();
+        const GLdouble * v = static_cast<const GLdouble *>(reader.bytes());
+        glVertexAttrib1dv(index, v);
+        return true;
+    }
+    case GlFunction::VertexAttrib1f: {
+        GLuint index = reader.value<GLuint>();
+        GLfloat x = reader.value<GLfloat>();
+        glVertexAttrib1f(index, x);
+        return true;
+    }
+    case GlFunction::VertexAttrib1fv: {
+        GLuint index = reader.value<GLuint>();
+        const GLfloat * v = static_cast<const GLfloat *>(reader.bytes());
+        glVertexAttrib1fv(index, v);
+        return true;
+    }
+    case GlFunction::VertexAttrib1s: {
+        GLuint index = reader.value<GLuint>();
+        GLshort x = reader.value<GLshort>();
+        glVertexAttrib1s(index, x);
+        return true;
+    }
+    case GlFunction::VertexAttrib1sv: {
+        GLuint index = reader.value<GLuint>();
+        const GLshort * v = static_cast<const GLshort *>(reader.bytes());
+        glVertexAttrib1sv(index, v);
+        return true;
+    }
+    case GlFunction::VertexAttrib2d: {
+        GLuint index = reader.value<GLuint>();
+        GLdouble x = reader.value<GLdouble>();
+        GLdouble y = reader.value<GLdouble>();
+        glVertexAttrib2d(index, x, y);
+        return true;
+    }
+    case GlFunction::VertexAttrib2dv: {
+        GLuint index = reader.value<GLuint>();
+        const GLdouble * v = static_cast<const GLdouble *>(reader.bytes());
+        glVertexAttrib2dv(index, v);
+        return true;
+    }
+    case GlFunction::VertexAttrib2f: {
+        GLuint index = reader.value<GLuint>();
+        GLfloat x = reader.value<GLfloat>();
+        GLfloat y = reader.value<GLfloat>();
+        glVertexAttrib2f(index, x, y);
+        return true;
+    }
+    case GlFunction::VertexAttrib2fv: {
+        GLuint index = reader.value<GLuint>();
+        const GLfloat * v = static_cast<const GLfloat *>(reader.bytes());
+        glVertexAttrib2fv(index, v);
+        return true;
+    }
+    case GlFunction::VertexAttrib2s: {
+        GLuint index = reader.value<GLuint>();
+        GLshort x = reader.value<GLshort>();
+        GLshort y = reader.value<GLshort>();
+        glVertexAttrib2s(index, x, y);
+        return true;
+    }
+    case GlFunction::VertexAttrib2sv: {
+        GLuint index = reader.value<GLuint>();
+        const GLshort * v = static_cast<const GLshort *>(reader.bytes());
+        glVertexAttrib2sv(index, v);
+        return true;
+    }
+    case GlFunction::VertexAttrib3d: {
+        GLuint index = reader.value<GLuint>();
+        GLdouble x = reader.value<GLdouble>();
+        GLdouble y = reader.value<GLdouble>();
+        GLdouble z = reader.value<GLdouble>();
+        glVertexAttrib3d(index, x, y, z);
+        return true;
+    }
+    case GlFunction::VertexAttrib3dv: {
+        GLuint index = reader.value<GLuint>();
+        const GLdouble * v = static_cast<const GLdouble *>(reader.bytes());
+        glVertexAttrib3dv(index, v);
+        return true;
+    }
+    case GlFunction::VertexAttrib3f: {
+        GLuint index = reader.value<GLuint>();
+        GLfloat x = reader.value<GLfloat>();
+        GLfloat y = reader.value<GLfloat>();
+        GLfloat z = reader.value<GLfloat>();
+        glVertexAttrib3f(index, x, y, z);
+        return true;
+    }
+    case GlFunction::VertexAttrib3fv: {
+        GLuint index = reader.value<GLuint>();
+        const GLfloat * v = static_cast<const GLfloat *>(reader.bytes());
+        glVertexAttrib3fv(index, v);
+        return true;
+    }
+    case GlFunction::VertexAttrib3s: {
+        GLuint index = reader.value<GLuint>();
+        GLshort x = reader.value<GLshort>();
+        GLshort y = reader.value<GLshort>();
+        GLshort z = reader.value<GLshort>();
+        glVertexAttrib3s(index, x, y, z);
+        return true;
+    }
+    case GlFunction::VertexAttrib3sv: {
+        GLuint index = reader.value<GLuint>();
+        const GLshort * v = static_cast<const GLshort *>(reader.bytes());
+        glVertexAttrib3sv(index, v);
+        return true;
+    }
+    case GlFunction::VertexAttrib4Nub: {
+        GLuint index = reader.value<GLuint>();
+        GLubyte x = reader.value<GLubyte>();
+        GLubyte y = reader.value<GLubyte>();
+        GLubyte z = reader.value<GLubyte>();
+        GLubyte w = reader.value<GLubyte>();
+        glVertexAttrib4Nub(index, x, y, z, w);
+        return true;
+    }
+    case GlFunction::VertexAttrib4d: {
+        GLuint index = reader.value<GLuint>();
+        GLdouble x = reader.value<GLdouble>();
+        GLdouble y = reader.value<GLdouble>();
+        GLdouble z = reader.value<GLdouble>();
+        GLdouble w = reader.value<GLdouble>();
+        glVertexAttrib4d(index, x, y, z, w);
+        return true;
+    }
+    case GlFunction::VertexAttrib4dv: {
+        GLuint index = reader.value<GLuint>();
+        const GLdouble * v = static_cast<const GLdouble *>(reader.bytes());
+        glVertexAttrib4dv(index, v);
+        return true;
+    }
+    case GlFunction::VertexAttrib4f: {
+        GLuint index = reader.value<GLuint>();
+        GLfloat x = reader.value<GLfloat>();
+        GLfloat y = reader.value<GLfloat>();
+        GLfloat z = reader.value<GLfloat>();
+        GLfloat w = reader.value<GLfloat>();
+        glVertexAttrib4f(index, x, y, z, w);
+        return true;
+    }
+    case GlFunction::VertexAttrib4fv: {
+        GLuint index = reader.value<GLuint>();
+        const GLfloat * v = static_cast<const GLfloat *>(reader.bytes());
+        glVertexAttrib4fv(index, v);
+        return true;
+    }
+    case GlFunction::VertexAttrib4s: {
+        GLuint index = reader.value<GLuint>();
+        GLshort x = reader.value<GLshort>();
+        GLshort y = reader.value<GLshort>();
+        GLshort z = reader.value<GLshort>();
+        GLshort w = reader.value<GLshort>();
+        glVertexAttrib4s(index, x, y, z, w);
+        return true;
+    }
+    case GlFunction::VertexAttrib4sv: {
+        GLuint index = reader.value<GLuint>();
+        const GLshort * v = static_cast<const GLshort *>(reader.bytes());
+        glVertexAttrib4sv(index, v);
+        return true;
+    }
+    case GlFunction::VertexAttribPointer: {
+        GLuint index = reader.value<GLuint>();
+        GLint size = reader.value<GLint>();
+        GLenum type = reader.value<GLenum>();
+        GLboolean normalized = reader.value<GLboolean>();
+        GLsizei stride = reader.value<GLsizei>();
+        const void * pointer = reader.offset();
+        glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+        return true;
+    }
+    case GlFunction::UniformMatrix2x3fv: {
+        GLint location = reader.value<GLint>();
+        GLsizei count = reader.value<GLsizei>();
+        GLboolean transpose = reader.value<GLboolean>();
+        const GLfloat * value = static_cast<const GLfloat *>(reader.bytes());
+        glUniformMatrix2x3fv(location, count, transpose, value);
+        return true;
+    }
+    case GlFunction::UniformMatrix3x2fv: {
+        GLint location = reader.value<GLint>();
+        GLsizei count = reader.value<GLsizei>();
+        GLboolean transpose = reader.value<GLboolean>();
+        const GLfloat * value = static_cast<const GLfloat *>(reader.bytes());
+        glUniformMatrix3x2fv(location, count, transpose, value);
+        return true;
+    }
+    case GlFunction::UniformMatrix2x4fv: {
+        GLint location = reader.value<GLint>();
+        GLsizei count = reader.value<GLsizei>();
+        GLboolean transpose = reader.value<GLboolean>();
+        const GLfloat * value = static_cast<const GLfloat *>(reader.bytes());
+        glUniformMatrix2x4fv(location, count, transpose, value);
+        return true;
+    }
+    case GlFunction::UniformMatrix4x2fv: {
+        GLint location = reader.value<GLint>();
+        GLsizei count = reader.value<GLsizei>();
+        GLboolean transpose = reader.value<GLboolean>();
+        const GLfloat * value = static_cast<const GLfloat *>(reader.bytes());
+        glUniformMatrix4x2fv(location, count, transpose, value);
+        return true;
+    }
+    case GlFunction::UniformMatrix3x4fv: {
+        GLint location = reader.value<GLint>();
+        GLsizei count = reader.value<GLsizei>();
+        GLboolean transpose = reader.value<GLboolean>();
+        const GLfloat * value = static_cast<const GLfloat *>(reader.bytes());
+        glUniformMatrix3x4fv(location, count, transpose, value);
+        return true;
+    }
+    case GlFunction::UniformMatrix4x3fv: {
+        GLint location = reader.value<GLint>();
+        GLsizei count = reader.value<GLsizei>();
+        GLboolean transpose = reader.value<GLboolean>();
+        const GLfloat * value = static_cast<const GLfloat *>(reader.bytes());
+        glUniformMatrix4x3fv(location, count, transpose, value);
+        return true;
+    }
+    case GlFunction::ColorMaski: {
+        GLuint index = reader.value<GLuint>();
+        GLboolean r = reader.value<GLboolean>();
+        GLboolean g = reader.value<GLboolean>();
+        GLboolean b = reader.value<GLboolean>();
+        GLboolean a = reader.value<GLboolean>();
+        glColorMaski(index, r, g, b, a);
+        return true;
+    }
+    case GlFunction::GetBooleani_v: {
+        GLenum target = reader.value<GLenum>();
+        GLuint index = reader.value<GLuint>();
+        GLboolean * data = static_cast<GLboolean *>(reader.scratch());
+        glGetBooleani_v(target, index, data);
+        return true;
+    }
+    case GlFunction::GetIntegeri_v: {
+        GLenum target = reader.value<GLenum>();
+        GLuint index = reader.value<GLuint>();
+        GLint * data = static_cast<GLint *>(reader.scratch());
+        glGetIntegeri_v(target, index, data);
+        return true;
+    }
+    case GlFunction::Enablei: {
+        GLenum target = reader.value<GLenum>();
+        GLuint index = reader.value<GLuint>();
+        glEnablei(target, index);
+        return true;
+    }
+    case GlFunction::Disablei: {
+        GLenum target = reader.value<GLenum>();
+        GLuint index = reader.value<GLuint>();
+        glDisablei(target, index);
+        return true;
+    }
+    case GlFunction::IsEnabledi: {
+        GLenum target = reader.value<GLenum>();
+        GLuint index = reader.value<GLuint>();
+        glIsEnabledi(target, index);
+        return true;
+    }
+    case GlFunction::BeginTransformFeedback: {
+        GLenum primitiveMode = reader.value<GLenum>();
+        glBeginTransformFeedback(primitiveMode);
+        return true;
+    }
+    case GlFunction::EndTransformFeedback: {
+        glEndTransformFeedback();
+        return true;
+    }
+    case GlFunction::BindBufferRange: {
+        GLenum target = reader.value<GLenum>();
+        GLuint index = reader.value<GLuint>();
+        GLuint buffer = reader.name(GlObject::Buffer, reader.value<GLuint>());
+        GLintptr offset = reader.value<GLintptr>();
+        GLsizeiptr size = reader.value<GLsizeiptr>();
+        glBindBufferRange(target, index, buffer, offset, size);
+        return true;
+    }
+    case GlFunction::BindBufferBase: {
+        GLenum target = reader.value<GLenum>();
+        GLuint index = reader.value<GLuint>();
+        GLuint buffer = reader.name(GlObject::Buffer, reader.value<GLuint>());
+        glBindBufferBase(target, index, buffer);
+        return true;
+    }
+    case GlFunction::GetTransformFeedbackVarying: {
+        GLuint program = reader.name(GlObject::Program, reader.value<GLuint>());
+        GLuint index = reader.value<GLuint>();
+        GLsizei bufSize = reader.value<GLsizei>();
+        GLsizei * length = static_cast<GLsizei *>(reader.scratch());
+        GLsizei * size = static_cast<GLsizei *>(reader.scratch());
+        GLenum * type = static_cast<GLenum *>(reader.scratch());
+        GLchar * name = static_cast<GLchar *>(reader.scratch());
+        glGetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+        return true;
+    }
+    case GlFunction::ClampColor: {
+        GLenum target = reader.value<GLenum>();
+        GLenum clamp = reader.value<GLenum>();
+        glClampColor(target, clamp);
+        return true;
+    }
+    case GlFunction::BeginConditionalRender: {
+        GLuint id = reader.name(GlObject::Query, reader.value<GLuint>());
+        GLenum mode = reader.value<GLenum>();
+        glBeginConditionalRender(id, mode);
+        return true;
+    }
+    case GlFunction::EndConditionalRender: {
+        glEndConditionalRender();
+        return true;
+    }
+    case GlFunction::VertexAttribIPointer: {
+        GLuint index = reader.value<GLuint>();
+        GLint size = reader.value<GLint>();
+        GLenum type = reader.value<GLenum>();
+        GLsizei stride = reader.value<GLsizei>();
+        const void * pointer = reader.offset();
+        glVertexAttribIPointer(index, size, type, stride, pointer);
+        return true;
+    }
+    case GlFunction::GetVertexAttribIiv: {
+        GLuint index = reader.value<GLuint>();
+        GLenum pname = reader.value<GLenum>();
+        GLint * params = static_cast<GLint *>(reader.scratch());
+        glGetVertexAttribIiv(index, pname, params);
+        return true;
+    }
+    case GlFunction::GetVertexAttribIuiv: {
+        GLuint index = reader.value<GLuint>();
+        GLenum pname = reader.value<GLenum>();
+        GLuint * params = static_cast<GLuint *>(reader.scratch());
+        glGetVertexAttribIuiv(index, pname, params);
+        return true;
+    }
+    case GlFunction::VertexAttribI1i: {
+        GLuint index = reader.value<GLuint>();
+        GLint x = reader.value<GLint>();
+        glVertexAttribI1i(index, x);
+        return true;
+    }
+    case GlFunction::VertexAttribI2i: {
+        GLuint index = reader.value<GLuint>();
+        GLint x = reader.value<GLint>();
+        GLint y = reader.value<GLint>();
+        glVertexAttribI2i(index, x, y);
+        return true;
+    }
+    case GlFunction::VertexAttribI3i: {
+        GLuint index = reader.value<GLuint>();
+        GLint x = reader.value<GLint>();
+        GLint y = reader.value<GLint>();
+        GLint z = reader.value<GLint>();
+        glVertexAttribI3i(index, x, y, z);
+        return true;
+    }
+    case GlFunction::VertexAttribI4i: {
+        GLuint index = reader.value<GLuint>();
+        GLint x = reader.value<GLint>();
+        GLint y = reader.value<GLint>();
+        GLint z = reader.value<GLint>();
+        GLint w = reader.value<GLint>();
+        glVertexAttribI4i(index, x, y, z, w);
+        return true;
+    }
+    case GlFunction::VertexAttribI1ui: {
+        GLuint index = reader.value<GLuint>();
+        GLuint x = reader.value<GLuint>();
+        glVertexAttribI1ui(index, x);
+        return true;
+    }
+    case GlFunction::VertexAttribI2ui: {
+        GLuint index = reader.value<GLuint>();
+        GLuint x = reader.value<GLuint>();
+        GLuint y = reader.value<GLuint>();
+        glVertexAttribI2ui(index, x, y);
+        return true;
+    }
+    case GlFunction::VertexAttribI3ui: {
+        GLuint index = reader.value<GLuint>();
+        GLuint x = reader.value<GLuint>();
+        GLuint y = reader.value<GLuint>();
+        GLuint z = reader.value<GLuint>();
+        glVertexAttribI3ui(index, x, y, z);
+        return true;
+    }
+    case GlFunction::VertexAttribI4ui: {
+        GLuint index = reader.value<GLuint>();
+        GLuint x = reader.value<GLuint>();
+        GLuint y = reader.value<GLuint>();
+        GLuint z = reader.value<GLuint>();
+        GLuint w = reader.value<GLuint>();
+        glVertexAttribI4ui(index, x, y, z, w);
+        return true;
+    }
+    case GlFunction::GetUniformuiv: {
+        GLuint program = reader.name(GlObject::Program, reader.value<GLuint>());
+        GLint location = reader.value<GLint>();
+        GLuint * params = static_cast<GLuint *>(reader.scratch());
+        glGetUniformuiv(program, location, params);
+        return true;
+    }
+    case GlFunction::BindFragDataLocation: {
+        GLuint program = reader.name(GlObject::Program, reader.value<GLuint>());
+        GLuint color = reader.value<GLuint>();
+        const GLchar * name = reader.string();
+        glBindFragDataLocation(program, color, name);
+        return true;
+    }
+    case GlFunction::GetFragDataLocation: {
+        GLuint program = reader.name(GlObject::Program, reader.value<GLuint>());
+        const GLchar * name = reader.string();
+        glGetFragDataLocation(program, name);
+        return true;
+    }
+    case GlFunction::Uniform1ui: {
+        GLint location = reader.value<GLint>();
+        GLuint v0 = reader.value<GLuint>();
+        glUniform1ui(location, v0);
+        return true;
+    }
+    case GlFunction::Uniform2ui: {
+        GLint location = reader.value<GLint>();
+        GLuint v0 = reader.value<GLuint>();
+        GLuint v1 = reader.value<GLuint>();
+        glUniform2ui(location, v0, v1);
+        return true;
+    }
+    case GlFunction::Uniform3ui: {
+        GLint location = reader.value<GLint>();
+        GLuint v0 = reader.value<GLuint>();
+        GLuint v1 = reader.value<GLuint>();
+        GLuint v2 = reader.value<GLuint>();
+        glUniform3ui(location, v0, v1, v2);
+        return true;
+    }
+    case GlFunction::Uniform4ui: {
+        GLint location = reader.value<GLint>();
+        GLuint v0 = reader.value<GLuint>();
+        GLuint v1 = reader.value<GLuint>();
+        GLuint v2 = reader.value<GLuint>();
+        GLuint v3 = reader.value<GLuint>();
+        glUniform4ui(location, v0, v1, v2, v3);
+        return true;
+    }
+    case GlFunction::Uniform1uiv: {
+        GLint location = reader.value<GLint>();
+        GLsizei count = reader.value<GLsizei>();
+        const GLuint * value = static_cast<const GLuint *>(reader.bytes());
+        glUniform1uiv(location, count, value);
+        return true;
+    }
+    case GlFunction::Uniform2uiv: {
+        GLint location = reader.value<GLint>();
+        GLsizei count = reader.value<GLsizei>();
+        const GLuint * value = static_cast<const GLuint *>(reader.bytes());
+        glUniform2uiv(location, count, value);
+        return true;
+    }
+    case GlFunction::Uniform3uiv: {
+        GLint location = reader.value<GLint>();
+        GLsizei count = reader.value<GLsizei>();
+        const GLuint * value = static_cast<const GLuint *>(reader.bytes());
+        glUniform3uiv(location, count, value);
+        return true;
+    }
+    case GlFunction::Uniform4uiv: {
+        GLint location = reader.value<GLint>();
+        GLsizei count = reader.value<GLsizei>();
+        const GLuint * value = static_cast<const GLuint *>(reader.bytes());
+        glUniform4uiv(location, count, value);
+        return true;
+    }
+    case GlFunction::GetTexParameterIiv: {
+        GLenum target = reader.value<GLenum>();
+        GLenum pname = reader.value<GLenum>();
+        GLint * params = static_cast<GLint *>(reader.scratch());
+        glGetTexParameterIiv(target, pname, params);
+        return true;
+    }
+    case GlFunction::GetTexParameterIuiv: {
+        GLenum target = reader.value<GLenum>();
+        GLenum pname = reader.value<GLenum>();
+        GLuint * params = static_cast<GLuint *>(reader.scratch());
+        glGetTexParameterIuiv(target, pname, params);
+        return true;
+    }
+    case GlFunction::ClearBufferiv: {
+        GLenum buffer = reader.value<GLenum>();
+        GLint drawbuffer = reader.value<GLint>();
+        const GLint * value = static_cast<const GLint *>(reader.bytes());
+        glClearBufferiv(buffer, drawbuffer, value);
+        return true;
+    }
+    case GlFunction::ClearBufferuiv: {
+        GLenum buffer = reader.value<GLenum>();
+        GLint drawbuffer = reader.value<GLint>();
+        const GLuint * value = static_cast<const GLuint *>(reader.bytes());
+        glClearBufferuiv(buffer, drawbuffer, value);
+        return true;
+    }
+    case GlFunction::ClearBufferfv: {
+        GLenum buffer = reader.value<GLenum>();
+        GLint drawbuffer = reader.value<GLint>();
+        const GLfloat * value = static_cast<const GLfloat *>(reader.bytes());
+        glClearBufferfv(buffer, drawbuffer, value);
+        return true;
+    }
+    case GlFunction::ClearBufferfi: {
+        GLenum buffer = reader.value<GLenum>();
+        GLint drawbuffer = reader.value<GLint>();
+        GLfloat depth = reader.value<GLfloat>();
+        GLint stencil = reader.value<GLint>();
+        glClearBufferfi(buffer, drawbuffer, depth, stencil);
+        return true;
+    }
+    case GlFunction::GetStringi: {
+        GLenum name = reader.value<GLenum>();
+        GLuint index = reader.value<GLuint>();
+        glGetStringi(name, index);
+        return true;
+    }
+    case GlFunction::IsRenderbuffer: {
+        GLuint renderbuffer = reader.name(GlObject::Renderbuffer, reader.value<GLuint>());
+        glIsRenderbuffer(renderbuffer);
+        return true;
+    }
+    case GlFunction::BindRenderbuffer: {
+        GLenum target = reader.value<GLenum>();
+        GLuint renderbuffer = reader.name(GlObject::Renderbuffer, reader.value<GLuint>());
+        glBindRenderbuffer(target, renderbuffer);
+        return true;
+    }
+    case GlFunction::DeleteRenderbuffers: {
+        GLsizei n = reader.value<GLsizei>();
+        const GLuint * renderbuffers = reader.names(GlObject::Renderbuffer, n);
+        glDeleteRenderbuffers(n, renderbuffers);
+        return true;
+    }
+    case GlFunction::GenRenderbuffers: {
+        GLsizei n = reader.value<GLsizei>();
+        GLuint * renderbuffers = static_cast<GLuint *>(reader.scratch());
+        glGenRenderbuffers(n, renderbuffers);
+        reader.mapNames(GlObject::Renderbuffer, n, renderbuffers);
+        return true;
+    }
+    case GlFunction::RenderbufferStorage: {
+        GLenum target = reader.value<GLenum>();
+        GLenum internalformat = reader.value<GLenum>();
+        GLsizei width = reader.value<GLsizei>();
+        GLsizei height = reader.value<GLsizei>();
+        glRenderbufferStorage(target, internalformat, width, height);
+        return true;
+    }
+    case GlFunction::GetRenderbufferParameteriv: {
+        GLenum target = reader.value<GLenum>();
+        GLenum pname = reader.value<GLenum>();
+        GLint * params = static_cast<GLint *>(reader.scratch());
+        glGetRenderbufferParameteriv(target, pname, params);
+        return true;
+    }
+    case GlFunction::IsFramebuffer: {
+        GLuint framebuffer = reader.name(GlObject::Framebuffer, reader.value<GLuint>());
+        glIsFramebuffer(framebuffer);
+        return true;
+    }
+    case GlFunction::BindFramebuffer: {
+        GLenum target = reader.value<GLenum>();
+        GLuint framebuffer = reader.name(GlObject::Framebuffer, reader.value<GLuint>());
+        glBindFramebuffer(target, framebuffer);
+        return true;
+    }
+    case GlFunction::DeleteFramebuffers: {
+        GLsizei n = reader.value<GLsizei>();
+        const GLuint * framebuffers = reader.names(GlObject::Framebuffer, n);
+        glDeleteFramebuffers(n, framebuffers);
+        return true;
+    }
+    case GlFunction::GenFramebuffers: {
+        GLsizei n = reader.value<GLsizei>();
+        GLuint * framebuffers = static_cast<GLuint *>(reader.scratch());
+        glGenFramebuffers(n, framebuffers);
+        reader.mapNames(GlObject::Framebuffer, n, framebuffers);
+        return true;
+    }
+    case GlFunction::CheckFramebufferStatus: {
+        GLenum target = reader.value<GLenum>();
+        glCheckFramebufferStatus(target);
+        return true;
+    }
+    case GlFunction::FramebufferTexture1D: {
+        GLenum target = reader.value<GLenum>();
+        GLenum attachment = reader.value<GLenum>();
+        GLenum textarget = reader.value<GLenum>();
+        GLuint texture = reader.name(GlObject::Texture, reader.value<GLuint>());
+        GLint level = reader.value<GLint>();
+        glFramebufferTexture1D(target, attachment, textarget, texture, level);
+        return true;
+    }
+    case GlFunction::FramebufferTexture2D: {
+        GLenum target = reader.value<GLenum>();
+        GLenum attachment = reader.value<GLenum>();
+        GLenum textarget = reader.value<GLenum>();
+        GLuint texture = reader.name(GlObject::Texture, reader.value<GLuint>());
+        GLint level = reader.value<GLint>();
+        glFramebufferTexture2D(target, attachment, textarget, texture, level);
+        return true;
+    }
+    case GlFunction::FramebufferTexture3D: {
+        GLenum target = reader.value<GLenum>();
+        GLenum attachment = reader.value<GLenum>();
+        GLenum textarget = reader.value<GLenum>();
+        GLuint texture = reader.name(GlObject::Texture, reader.value<GLuint>());
+        GLint level = reader.value<GLint>();
+        GLint zoffset = reader.value<GLint>();
+        glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+        return true;
+    }
+    case GlFunction::FramebufferRenderbuffer: {
+        GLenum target = reader.value<GLenum>();
+        GLenum attachment = reader.value<GLenum>();
+        GLenum renderbuffertarget = reader.value<GLenum>();
+        GLuint renderbuffer = reader.name(GlObject::Renderbuffer, reader.value<GLuint>());
+        glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+        return true;
+    }
+    case GlFunction::GetFramebufferAttachmentParameteriv: {
+        GLenum target = reader.value<GLenum>();
+        GLenum attachment = reader.value<GLenum>();
+        GLenum pname = reader.value<GLenum>();
+        GLint * params = static_cast<GLint *>(reader.scratch());
+        glGetFramebufferAttachmentParameteriv(target, attachment, pname, params);
+        return true;
+    }
+    case GlFunction::GenerateMipmap: {
+        GLenum target = reader.value<GLenum>();
+        glGenerateMipmap(target);
+        return true;
+    }
+    case GlFunction::BlitFramebuffer: {
+        GLint srcX0 = reader.value<GLint>();
+        GLint srcY0 = reader.value<GLint>();
+        GLint srcX1 = reader.value<GLint>();
+        GLint srcY1 = reader.value<GLint>();
+        GLint dstX0 = reader.value<GLint>();
+        GLint dstY0 = reader.value<GLint>();
+        GLint dstX1 = reader.value<GLint>();
+        GLint dstY1 = reader.value<GLint>();
+        GLbitfield mask = reader.value<GLbitfield>();
+        GLenum filter = reader.value<GLenum>();
+        glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+        return true;
+    }
+    case GlFunction::RenderbufferStorageMultisample: {
+        GLenum target = reader.value<GLenum>();
+        GLsizei samples = reader.value<GLsizei>();
+        GLenum internalformat = reader.value<GLenum>();
+        GLsizei width = reader.value<GLsizei>();
+        GLsizei height = reader.value<GLsizei>();
+        glRenderbufferStorageMultisample(target, samples, internalformat, width, height);
+        return true;
+    }
+    case GlFunction::FramebufferTextureLayer: {
+        GLenum target = reader.value<GLenum>();
+        GLenum attachment = reader.value<GLenum>();
+        GLuint texture = reader.name(GlObject::Texture, reader.value<GLuint>());
+        GLint level = reader.value<GLint>();
+        GLint layer = reader.value<GLint>();
+        glFramebufferTextureLayer(target, attachment, texture, level, layer);
+        return true;
+    }
+    case GlFunction::BindVertexArray: {
+        GLuint array = reader.name(GlObject::VertexArray, reader.value<GLuint>());
+        glBindVertexArray(array);
+        return true;
+    }
+    case GlFunction::DeleteVertexArrays: {
+        GLsizei n = reader.value<GLsizei>();
+        const GLuint * arrays = reader.names(GlObject::VertexArray, n);
+        glDeleteVertexArrays(n, arrays);
+        return true;
+    }
+    case GlFunction::GenVertexArrays: {
+        GLsizei n = reader.value<GLsizei>();
+        GLuint * arrays = static_cast<GLuint *>(reader.scratch());
+        glGenVertexArrays(n, arrays);
+        reader.mapNames(GlObject::VertexArray, n, arrays);
+        return true;
+    }
+    case GlFunction::IsVertexArray: {
+        GLuint array = reader.name(GlObject::VertexArray, reader.value<GLuint>());
+        glIsVertexArray(array);
+        return true;
+    }
+    case GlFunction::DrawArraysInstanced: {
+        GLenum mode = reader.value<GLenum>();
+        GLint first = reader.value<GLint>();
+        GLsizei count = reader.value<GLsizei>();
+        GLsizei instancecount = reader.value<GLsizei>();
+        glDrawArraysInstanced(mode, first, count, instancecount);
+        return true;
+    }
+    case GlFunction::DrawElementsInstanced: {
+        GLenum mode = reader.value<GLenum>();
+        GLsizei count = reader.value<GLsizei>();
+        GLenum type = reader.value<GLenum>();
+        const void * indices = reader.offset();
+        GLsizei instancecount = reader.value<GLsizei>();
+        glDrawElementsInstanced(mode, count, type, indices, instancecount);
+        return true;
+    }
+    case GlFunction::TexBuffer: {
+        GLenum target = reader.value<GLenum>();
+        GLenum internalformat = reader.value<GLenum>();
+        GLuint buffer = reader.name(GlObject::Buffer, reader.value<GLuint>());
+        glTexBuffer(target, internalformat, buffer);
+        return true;
+    }
+    case GlFunction::PrimitiveRestartIndex: {
+        GLuint index = reader.value<GLuint>();
+        glPrimitiveRestartIndex(index);
+        return true;
+    }
+    case GlFunction::CopyBufferSubData: {
+        GLenum readTarget = reader.value<GLenum>();
+        GLenum writeTarget = reader.value<GLenum>();
+        GLintptr readOffset = reader.value<GLintptr>();
+        GLintptr writeOffset = reader.value<GLintptr>();
+        GLsizeiptr size = reader.value<GLsizeiptr>();
+        glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+        return true;
+    }
+    case GlFunction::GetActiveUniformName: {
+        GLuint program = reader.name(GlObject::Program, reader.value<GLuint>());
+        GLuint uniformIndex = reader.value<GLuint>();
+        GLsizei bufSize = reader.value<GLsizei>();
+        GLsizei * length = static_cast<GLsizei *>(reader.scratch());
+        GLchar * uniformName = static_cast<GLchar *>(reader.scratch());
+        glGetActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
+        return true;
+    }
+    case GlFunction::GetUniformBlockIndex: {
+        GLuint program = reader.name(GlObject::Program, reader.value<GLuint>());
+        const GLchar * uniformBlockName = reader.string();
+        glGetUniformBlockIndex(program, uniformBlockName);
+        return true;
+    }
+    case GlFunction::GetActiveUniformBlockiv: {
+        GLuint program = reader.name(GlObject::Program, reader.value<GLuint>());
+        GLuint uniformBlockIndex = reader.value<GLuint>();
+        GLenum pname = reader.value<GLenum>();
+        GLint * params = static_cast<GLint *>(reader.scratch());
+        glGetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+        return true;
+    }
+    case GlFunction::GetActiveUniformBlockName: {
+        GLuint program = reader.name(GlObject::Program, reader.value<GLuint>());
+        GLuint uniformBlockIndex = reader.value<GLuint>();
+        GLsizei bufSize = reader.value<GLsizei>();
+        GLsizei * length = static_cast<GLsizei *>(reader.scratch());
+        GLchar * uniformBlockName = static_cast<GLchar *>(reader.scratch());
+        glGetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+        return true;
+    }
+    case GlFunction::UniformBlockBinding: {
+        GLuint program = reader.name(GlObject::Program, reader.value<GLuint>());
+        GLuint uniformBlockIndex = reader.value<GLuint>();
+        GLuint uniformBlockBinding = reader.value<GLuint>();
+        glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+        return true;
+    }
+    case GlFunction::DrawElementsBaseVertex: {
+        GLenum mode = reader.value<GLenum>();
+        GLsizei count = reader.value<GLsizei>();
+        GLenum type = reader.value<GLenum>();
+        const void * indices = reader.offset();
+        GLint basevertex = reader.value<GLint>();
+        glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+        return true;
+    }
+    case GlFunction::DrawRangeElementsBaseVertex: {
+        GLenum mode = reader.value<GLenum>();
+        GLuint start = reader.value<GLuint>();
+        GLuint end = reader.value<GLuint>();
+        GLsizei count = reader.value<GLsizei>();
+        GLenum type = reader.value<GLenum>();
+        const void * indices = reader.offset();
+        GLint basevertex = reader.value<GLint>();
+        glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+        return true;
+    }
+    case GlFunction::DrawElementsInstancedBaseVertex: {
+        GLenum mode = reader.value<GLenum>();
+        GLsizei count = reader.value<GLsizei>();
+        GLenum type = reader.value<GLenum>();
+        const void * indices = reader.offset();
+        GLsizei instancecount = reader.value<GLsizei>();
+        GLint basevertex = reader.value<GLint>();
+        glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+        return true;
+    }
+    case GlFunction::ProvokingVertex: {
+        GLenum mode = reader.value<GLenum>();
+        glProvokingVertex(mode);
+        return true;
+    }
+    case GlFunction::GetInteger64v: {
+        GLenum pname = reader.value<GLenum>();
+        GLint64 * data = static_cast<GLint64 *>(reader.scratch());
+        glGetInteger64v(pname, data);
+        return true;
+    }
+    case GlFunction::GetInteger64i_v: {
+        GLenum target = reader.value<GLenum>();
+        GLuint index = reader.value<GLuint>();
+        GLint64 * data = static_cast<GLint64 *>(reader.scratch());
+        glGetInteger64i_v(target, index, data);
+        return true;
+    }
+    case GlFunction::GetBufferParameteri64v: {
+        GLenum target = reader.value<GLenum>();
+        GLenum pname = reader.value<GLenum>();
+        GLint64 * params = static_cast<GLint64 *>(reader.scratch());
+        glGetBufferParameteri64v(target, pname, params);
+        return true;
+    }
+    case GlFunction::FramebufferTexture: {
+        GLenum target = reader.value<GLenum>();
+        GLenum attachment = reader.value<GLenum>();
+        GLuint texture = reader.name(GlObject::Texture, reader.value<GLuint>());
+        GLint level = reader.value<GLint>();
+        glFramebufferTexture(target, attachment, texture, level);
+        return true;
+    }
+    case GlFunction::TexImage2DMultisample: {
+        GLenum target = reader.value<GLenum>();
+        GLsizei samples = reader.value<GLsizei>();
+        GLenum internalformat = reader.value<GLenum>();
+        GLsizei width = reader.value<GLsizei>();
+        GLsizei height = reader.value<GLsizei>();
+        GLboolean fixedsamplelocations = reader.value<GLboolean>();
+        glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+        return true;
+    }
+    case GlFunction::TexImage3DMultisample: {
+        GLenum target = reader.value<GLenum>();
+        GLsizei samples = reader.value<GLsizei>();
+        GLenum internalformat = reader.value<GLenum>();
+        GLsizei width = reader.value<GLsizei>();
+        GLsizei height = reader.value<GLsizei>();
+        GLsizei depth = reader.value<GLsizei>();
+        GLboolean fixedsamplelocations = reader.value<GLboolean>();
+        glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+        return true;
+    }
+    case GlFunction::GetMultisamplefv: {
+        GLenum pname = reader.value<GLenum>();
+        GLuint index = reader.value<GLuint>();
+        GLfloat * val = static_cast<GLfloat *>(reader.scratch());
+        glGetMultisamplefv(pname, index, val);
+        return true;
+    }
+    case GlFunction::SampleMaski: {
+        GLuint maskNumber = reader.value<GLuint>();
+        GLbitfield mask = reader.value<GLbitfield>();
+        glSampleMaski(maskNumber, mask);
+        return true;
+    }
+    case GlFunction::BindFragDataLocationIndexed: {
+        GLuint program = reader.name(GlObject::Program, reader.value<GLuint>());
+        GLuint colorNumber = reader.value<GLuint>();
+        GLuint index = reader.value<GLuint>();
+        const GLchar * name = reader.string();
+        glBindFragDataLocationIndexed(program, colorNumber, index, name);
+        return true;
+    }
+    case GlFunction::GetFragDataIndex: {
+        GLuint program = reader.name(GlObject::Program, reader.value<GLuint>());
+        const GLchar * name = reader.string();
+        glGetFragDataIndex(program, name);
+        return true;
+    }
+    case GlFunction::GenSamplers: {
+        GLsizei count = reader.value<GLsizei>();
+        GLuint * samplers = static_cast<GLuint *>(reader.scratch());
+        glGenSamplers(count, samplers);
+        reader.mapNames(GlObject::Sampler, count, samplers);
+        return true;
+    }
+    case GlFunction::DeleteSamplers: {
+        GLsizei count = reader.value<GLsizei>();
+        const GLuint * samplers = reader.names(GlObject::Sampler, count);
+        glDeleteSamplers(count, samplers);
+        return true;
+    }
+    case GlFunction::IsSampler: {
+        GLuint sampler = reader.name(GlObject::Sampler, reader.value<GLuint>());
+        glIsSampler(sampler);
+        return true;
+    }
+    case GlFunction::BindSampler: {
+        GLuint unit = reader.value<GLuint>();
+        GLuint sampler = reader.name(GlObject::Sampler, reader.value<GLuint>());
+        glBindSampler(unit, sampler);
+        return true;
+    }
+    case GlFunction::SamplerParameteri: {
+        GLuint sampler = reader.name(GlObject::Sampler, reader.value<GLuint>());
+        GLenum pname = reader.value<GLenum>();
+        GLint param = reader.value<GLint>();
+        glSamplerParameteri(sampler, pname, param);
+        return true;
+    }
+    case GlFunction::SamplerParameteriv: {
+        GLuint sampler = reader.name(GlObject::Sampler, reader.value<GLuint>());
+        GLenum pname = reader.value<GLenum>();
+        const GLint * param = static_cast<const GLint *>(reader.bytes());
+        glSamplerParameteriv(sampler, pname, param);
+        return true;
+    }
+    case GlFunction::SamplerParameterf: {
+        GLuint sampler = reader.name(GlObject::Sampler, reader.value<GLuint>());
+        GLenum pname = reader.value<GLenum>();
+        GLfloat param = reader.value<GLfloat>();
+        glSamplerParameterf(sampler, pname, param);
+        return true;
+    }
+    case GlFunction::SamplerParameterfv: {
+        GLuint sampler = reader.name(GlObject::Sampler, reader.value<GLuint>());
+        GLenum pname = reader.value<GLenum>();
+        const GLfloat * param = static_cast<const GLfloat *>(reader.bytes());
+        glSamplerParameterfv(sampler, pname, param);
+        return true;
+    }
+    case GlFunction::GetSamplerParameteriv: {
+        GLuint sampler = reader.name(GlObject::Sampler, reader.value<GLuint>());
+        GLenum pname = reader.value<GLenum>();
+        GLint * params = static_cast<GLint *>(reader.scratch());
+        glGetSamplerParameteriv(sampler, pname, params);
+        return true;
+    }
+    case GlFunction::GetSamplerParameterIiv: {
+        GLuint sampler = reader.name(GlObject::Sampler, reader.value<GLuint>());
+        GLenum pname = reader.value<GLenum>();
+        GLint * params = static_cast<GLint *>(reader.scratch());
+        glGetSamplerParameterIiv(sampler, pname, params);
+        return true;
+    }
+    case GlFunction::GetSamplerParameterfv: {
+        GLuint sampler = reader.name(GlObject::Sampler, reader.value<GLuint>());
+        GLenum pname = reader.value<GLenum>();
+        GLfloat * params = static_cast<GLfloat *>(reader.scratch());
+        glGetSamplerParameterfv(sampler, pname, params);
+        return true;
+    }
+    case GlFunction::GetSamplerParameterIuiv: {
+        GLuint sampler = reader.name(GlObject::Sampler, reader.value<GLuint>());
+        GLenum pname = reader.value<GLenum>();
+        GLuint * params = static_cast<GLuint *>(reader.scratch());
+        glGetSamplerParameterIuiv(sampler, pname, params);
+        return true;
+    }
+    case GlFunction::QueryCounter: {
+        GLuint id = reader.name(GlObject::Query, reader.value<GLuint>());
+        GLenum target = reader.value<GLenum>();
+        glQueryCounter(id, target);
+        return true;
+    }
+    case GlFunction::GetQueryObjecti64v: {
+        GLuint id = reader.name(GlObject::Query, reader.value<GLuint>());
+        GLenum pname = reader.value<GLenum>();
+        GLint64 * params = static_cast<GLint64 *>(reader.scratch());
+        glGetQueryObjecti64v(id, pname, params);
+        return true;
+    }
+    case GlFunction::GetQueryObjectui64v: {
+        GLuint id = reader.name(GlObject::Query, reader.value<GLuint>());
+        GLenum pname = reader.value<GLenum>();
+        GLuint64 * params = static_cast<GLuint64 *>(reader.scratch());
+        glGetQueryObjectui64v(id, pname, params);
+        return true;
+    }
+    case GlFunction::VertexAttribDivisor: {
+        GLuint index = reader.value<GLuint>();
+        GLuint divisor = reader.value<GLuint>();
+        glVertexAttribDivisor(index, divisor);
+        return true;
+    }
+    case GlFunction::VertexAttribP1ui: {
+        GLuint index = reader.value<GLuint>();
+        GLenum type = reader.value<GLenum>();
+        GLboolean normalized = reader.value<GLboolean>();
+        GLuint value = reader.value<GLuint>();
+        glVertexAttribP1ui(index, type, normalized, value);
+        return true;
+    }
+    case GlFunction::VertexAttribP2ui: {
+        GLuint index = reader.value<GLuint>();
+        GLenum type = reader.value<GLenum>();
+        GLboolean normalized = reader.value<GLboolean>();
+        GLuint value = reader.value<GLuint>();
+        glVertexAttribP2ui(index, type, normalized, value);
+        return true;
+    }
+    case GlFunction::VertexAttribP3ui: {
+        GLuint index = reader.value<GLuint>();
+        GLenum type = reader.value<GLenum>();
+        GLboolean normalized = reader.value<GLboolean>();
+        GLuint value = reader.value<GLuint>();
+        glVertexAttribP3ui(index, type, normalized, value);
+        return true;
+    }
+    case GlFunction::VertexAttribP4ui: {
+        GLuint index = reader.value<GLuint>();
+        GLenum type = reader.value<GLenum>();
+        GLboolean normalized = reader.value<GLboolean>();
+        GLuint value = reader.value<GLuint>();
+        glVertexAttribP4ui(index, type, normalized, value);
+        return true;
+    }
+    case GlFunction::VertexP2ui: {
+        GLenum type = reader.value<GLenum>();
+        GLuint value = reader.value<GLuint>();
+        glVertexP2ui(type, value);
+        return true;
+    }
+    case GlFunction::VertexP3ui: {
+        GLenum type = reader.value<GLenum>();
+        GLuint value = reader.value<GLuint>();
+        glVertexP3ui(type, value);
+        return true;
+    }
+    case GlFunction::VertexP4ui: {
+        GLenum type = reader.value<GLenum>();
+        GLuint value = reader.value<GLuint>();
+        glVertexP4ui(type, value);
+        return true;
+    }
+    case GlFunction::TexCoordP1ui: {
+        GLenum type = reader.value<GLenum>();
+        GLuint coords = reader.value<GLuint>();
+        glTexCoordP1ui(type, coords);
+        return true;
+    }
+    case GlFunction::TexCoordP2ui: {
+        GLenum type = reader.value<GLenum>();
+        GLuint coords = reader.value<GLuint>();
+        glTexCoordP2ui(type, coords);
+        return true;
+    }
+    case GlFunction::TexCoordP3ui: {
+        GLenum type = reader.value<GLenum>();
+        GLuint coords = reader.value<GLuint>();
+        glTexCoordP3ui(type, coords);
+        return true;
+    }
+    case GlFunction::TexCoordP4ui: {
+        GLenum type = reader.value<GLenum>();
+        GLuint coords = reader.value<GLuint>();
+        glTexCoordP4ui(type, coords);
+        return true;
+    }
+    case GlFunction::MultiTexCoordP1ui: {
+        GLenum texture = reader.value<GLenum>();
+        GLenum type = reader.value<GLenum>();
+        GLuint coords = reader.value<GLuint>();
+        glMultiTexCoordP1ui(texture, type, coords);
+        return true;
+    }
+    case GlFunction::MultiTexCoordP2ui: {
+        GLenum texture = reader.value<GLenum>();
+        GLenum type = reader.value<GLenum>();
+        GLuint coords = reader.value<GLuint>();
+        glMultiTexCoordP2ui(texture, type, coords);
+        return true;
+    }
+    case GlFunction::MultiTexCoordP3ui: {
+        GLenum texture = reader.value<GLenum>();
+        GLenum type = reader.value<GLenum>();
+        GLuint coords = reader.value<GLuint>();
+        glMultiTexCoordP3ui(texture, type, coords);
+        return true;
+    }
+    case GlFunction::MultiTexCoordP4ui: {
+        GLenum texture = reader.value<GLenum>();
+        GLenum type = reader.value<GLenum>();
+        GLuint coords = reader.value<GLuint>();
+        glMultiTexCoordP4ui(texture, type, coords);
+        return true;
+    }
+    case GlFunction::NormalP3ui: {
+        GLenum type = reader.value<GLenum>();
+        GLuint coords = reader.value<GLuint>();
+        glNormalP3ui(type, coords);
+        return true;
+    }
+    case GlFunction::ColorP3ui: {
+        GLenum type = reader.value<GLenum>();
+        GLuint color = reader.value<GLuint>();
+        glColorP3ui(type, color);
+        return true;
+    }
+    case GlFunction::ColorP4ui: {
+        GLenum type = reader.value<GLenum>();
+        GLuint color = reader.value<GLuint>();
+        glColorP4ui(type, color);
+        return true;
+    }
+    case GlFunction::SecondaryColorP3ui: {
+        GLenum type = reader.value<GLenum>();
+        GLuint color = reader.value<GLuint>();
+        glSecondaryColorP3ui(type, color);
+        return true;
+    }
+    case GlFunction::MinSampleShading: {
+        GLfloat value = reader.value<GLfloat>();
+        glMinSampleShading(value);
+        return true;
+    }
+    case GlFunction::BlendEquationi: {
+        GLuint buf = reader.value<GLuint>();
+        GLenum mode = reader.value<GLenum>();
+        glBlendEquationi(buf, mode);
+        return true;
+    }
+    case GlFunction::BlendEquationSeparatei: {
+        GLuint buf = reader.value<GLuint>();
+        GLenum modeRGB = reader.value<GLenum>();
+        GLenum modeAlpha = reader.value<GLenum>();
+        glBlendEquationSeparatei(buf, modeRGB, modeAlpha);
+        return true;
+    }
+    case GlFunction::BlendFunci: {
+        GLuint buf = reader.value<GLuint>();
+        GLenum src = reader.value<GLenum>();
+        GLenum dst = reader.value<GLenum>();
+        glBlendFunci(buf, src, dst);
+        return true;
+    }
+    case GlFunction::BlendFuncSeparatei: {
+        GLuint buf = reader.value<GLuint>();
+        GLenum srcRGB = reader.value<GLenum>();
+        GLenum dstRGB = reader.value<GLenum>();
+        GLenum srcAlpha = reader.value<GLenum>();
+        GLenum dstAlpha = reader.value<GLenum>();
+        glBlendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+        return true;
+    }
+    case GlFunction::DrawArraysIndirect: {
+        GLenum mode = reader.value<GLenum>();
+        const void * indirect = reader.offset();
+        glDrawArraysIndirect(mode, indirect);
+        return true;
+    }
+    case GlFunction::DrawElementsIndirect: {
+        GLenum mode = reader.value<GLenum>();
+        GLenum type = reader.value<GLenum>();
+        const void * indirect = reader.offset();
+        glDrawElementsIndirect(mode, type, indirect);
+        return true;
+    }
+    case GlFunction::Uniform1d: {
+        GLint location = reader.value<GLint>();
+        GLdouble x = reader.value<GLdouble>();
+        glUniform1d(location, x);
+        return true;
+    }
+    case GlFunction::Uniform2d: {
+        GLint location = reader.value<GLint>();
+        GLdouble x = reader.value<GLdouble>();
+        GLdouble y = reader.value<GLdouble>();
+        glUniform2d(location, x, y);
+        return true;
+    }
+    case GlFunction::Uniform3d: {
+        GLint location = reader.value<GLint>();
+        GLdouble x = reader.value<GLdouble>();
+        GLdouble y = reader.value<GLdouble>();
+        GLdouble z = reader.value<GLdouble>();
+        glUniform3d(location, x, y, z);
+        return true;
+    }
+    case GlFunction::Uniform4d: {
+        GLint location = reader.value<GLint>();
+        GLdouble x = reader.value<GLdouble>();
+        GLdouble y = reader.value<GLdouble>();
+        GLdouble z = reader.value<GLdouble>();
+        GLdouble w = reader.value<GLdouble>();
+        glUniform4d(location, x, y, z, w);
+        return true;
+    }
+    case GlFunction::Uniform1dv: {
+        GLint location = reader.value<GLint>();
+        GLsizei count = reader.value<GLsizei>();
+        const GLdouble * value = static_cast<const GLdouble *>(reader.bytes());
+        glUniform1dv(location, count, value);
+        return true;
+    }
+    case GlFunction::Uniform2dv: {
+        GLint location = reader.value<GLint>();
+        GLsizei count = reader.value<GLsizei>();
+        const GLdouble * value = static_cast<const GLdouble *>(reader.bytes());
+        glUniform2dv(location, count, value);
+        return true;
+    }
+    case GlFunction::Uniform3dv: {
+        GLint location = reader.value<GLint>();
+        GLsizei count = reader.value<GLsizei>();
+        const GLdouble * value = static_cast<const GLdouble *>(reader.bytes());
+        glUniform3dv(location, count, value);
+        return true;
+    }
+    case GlFunction::Uniform4dv: {
+        GLint location = reader.value<GLint>();
+        GLsizei count = reader.value<GLsizei>();
+        const GLdouble * value = static_cast<const GLdouble *>(reader.bytes());
+        glUniform4dv(location, count, value);
+        return true;
+    }
+    case GlFunction::UniformMatrix2dv: {
+        GLint location = reader.value<GLint>();
+        GLsizei count = reader.value<GLsizei>();
+        GLboolean transpose = reader.value<GLboolean>();
+        const GLdouble * value = static_cast<const GLdouble *>(reader.bytes());
+        glUniformMatrix2dv(location, count, transpose, value);
+        return true;
+    }
+    case GlFunction::UniformMatrix3dv: {
+        GLint location = reader.value<GLint>();
+        GLsizei count = reader.value<GLsizei>();
+        GLboolean transpose = reader.value<GLboolean>();
+        const GLdouble * value = static_cast<const GLdouble *>(reader.bytes());
+        glUniformMatrix3dv(location, count, transpose, value);
+        return true;
+    }
+    case GlFunction::UniformMatrix4dv: {
+        GLint location = reader.value<GLint>();
+        GLsizei count = reader.value<GLsizei>();
+        GLboolean transpose = reader.value<GLboolean>();
+        const GLdouble * value = static_cast<const GLdouble *>(reader.bytes());
+        glUniformMatrix4dv(location, count, transpose, value);
+        return true;
+    }
+    case GlFunction::UniformMatrix2x3dv: {
+        GLint location = reader.value<GLint>();
+        GLsizei count = reader.value<GLsizei>();
+        GLboolean transpose = reader.value<GLboolean>();
+        const GLdouble * value = static_cast<const GLdouble *>(reader.bytes());
+        glUniformMatrix2x3dv(location, count, transpose, value);
+        return true;
+    }
+    case GlFunction::UniformMatrix2x4dv: {
+        GLint location = reader.value<GLint>();
+        GLsizei count = reader.value<GLsizei>();
+        GLboolean transpose = reader.value<GLboolean>();
+        const GLdouble * value = static_cast<const GLdouble *>(reader.bytes());
+        glUniformMatrix2x4dv(location, count, transpose, value);
+        return true;
+    }
+    case GlFunction::UniformMatrix3x2dv: {
+        GLint location = reader.value<GLint>();
+        GLsizei count = reader.value<GLsizei>();
+        GLboolean transpose = reader.value<GLboolean>();
+        const GLdouble * value = static_cast<const GLdouble *>(reader.bytes());
+        glUniformMatrix3x2dv(location, count, transpose, value);
+        return true;
+    }
+    case GlFunction::UniformMatrix3x4dv: {
+        GLint location = reader.value<GLint>();
+        GLsizei count = reader.value<GLsizei>();
+        GLboolean transpose = reader.value<GLboolean>();
+        const GLdouble * value = static_cast<const GLdouble *>(reader.bytes());
+        glUniformMatrix3x4dv(location, count, transpose, value);
+        return true;
+    }
+    case GlFunction::UniformMatrix4x2dv: {
+        GLint location = reader.value<GLint>();
+        GLsizei count = reader.value<GLsizei>();
+        GLboolean transpose = reader.value<GLboolean>();
+        const GLdouble * value = static_cast<const GLdouble *>(reader.bytes());
+        glUniformMatrix4x2dv(location, count, transpose, value);
+        return true;
+    }
+    case GlFunction::UniformMatrix4x3dv: {
+        GLint location = reader.value<GLint>();
+        GLsizei count = reader.value<GLsizei>();
+        GLboolean transpose = reader.value<GLboolean>();
+        const GLdouble * value = static_cast<const GLdouble *>(reader.bytes());
+        glUniformMatrix4x3dv(location, count, transpose, value);
+        return true;
+    }
+    case GlFunction::GetUniformdv: {
+        GLuint program = reader.name(GlObject::Program, reader.value<GLuint>());
+        GLint location = reader.value<GLint>();
+        GLdouble * params = static_cast<GLdouble *>(reader.scratch());
+        glGetUniformdv(program, location, params);
+        return true;
+    }
+    case GlFunction::GetSubroutineUniformLocation: {
+        GLuint program = reader.name(GlObject::Program, reader.value<GLuint>());
+        GLenum shadertype = reader.value<GLenum>();
+        const GLchar * name = reader.string();
+        glGetSubroutineUniformLocation(program, shadertype, name);
+        return true;
+    }
+    case GlFunction::GetSubroutineIndex: {
+        GLuint program = reader.name(GlObject::Program, reader.value<GLuint>());
+        GLenum shadertype = reader.value<GLenum>();
+        const GLchar * name = reader.string();
+        glGetSubroutineIndex(program, shadertype, name);
+        return true;
+    }
+    case GlFunction::GetActiveSubroutineUniformiv: {
+        GLuint program = reader.name(GlObject::Program, reader.value<GLuint>());
+        GLenum shadertype = reader.value<GLenum>();
+        GLuint index = reader.value<GLuint>();
+        GLenum pname = reader.value<GLenum>();
+        GLint * values = static_cast<GLint *>(reader.scratch());
+        glGetActiveSubroutineUniformiv(program, shadertype, index, pname, values);
+        return true;
+    }
+    case GlFunction::GetActiveSubroutineUniformName: {
+        GLuint program = reader.name(GlObject::Program, reader.value<GLuint>());
+        GLenum shadertype = reader.value<GLenum>();
+        GLuint index = reader.value<GLuint>();
+        GLsizei bufSize = reader.value<GLsizei>();
+        GLsizei * length = static_cast<GLsizei *>(reader.scratch());
+        GLchar * name = static_cast<GLchar *>(reader.scratch());
+        glGetActiveSubroutineUniformName(program, shadertype, index, bufSize, length, name);
+        return true;
+    }
+    case GlFunction::GetActiveSubroutineName: {
+        GLuint program = reader.name(GlObject::Program, reader.value<GLuint>());
+        GLenum shadertype = reader.value<GLenum>();
+        GLuint index = reader.value<GLuint>();
+        GLsizei bufSize = reader.value<GLsizei>();
+        GLsizei * length = static_cast<GLsizei *>(reader.scratch());
+        GLchar * name = static_cast<GLchar *>(reader.scratch());
+        glGetActiveSubroutineName(program, shadertype, index, bufSize, length, name);
+        return true;
+    }
+    case GlFunction::GetUniformSubroutineuiv: {
+        GLenum shadertype = reader.value<GLenum>();
+        GLint location = reader.value<GLint>();
+        GLuint * params = static_cast<GLuint *>(reader.scratch());
+        glGetUniformSubroutineuiv(shadertype, location, params);
+        return true;
+    }
+    case GlFunction::GetProgramStageiv: {
+        GLuint program = reader.name(GlObject::Program, reader.value<GLuint>());
+        GLenum shadertype = reader.value<GLenum>();
+        GLenum pname = reader.value<GLenum>();
+        GLint * values = static_cast<GLint *>(reader.scratch());
+        glGetProgramStageiv(program, shadertype, pname, values);
+        return true;
+    }
+    case GlFunction::PatchParameteri: {
+        GLenum pname = reader.value<GLenum>();
+        GLint value = reader.value<GLint>();
+        glPatchParameteri(pname, value);
+        return true;
+    }
+    case GlFunction::BindTransformFeedback: {
+        GLenum target = reader.value<GLenum>();
+        GLuint id = reader.name(GlObject::TransformFeedback, reader.value<GLuint>());
+        glBindTransformFeedback(target, id);
+        return true;
+    }
+    case GlFunction::DeleteTransformFeedbacks: {
+        GLsizei n = reader.value<GLsizei>();
+        const GLuint * ids = reader.names(GlObject::TransformFeedback, n);
+        glDeleteTransformFeedbacks(n, ids);
+        return true;
+    }
+    case GlFunction::GenTransformFeedbacks: {
+        GLsizei n = reader.value<GLsizei>();
+        GLuint * ids = static_cast<GLuint *>(reader.scratch());
+        glGenTransformFeedbacks(n, ids);
+        reader.mapNames(GlObject::TransformFeedback, n, ids);
+        return true;
+    }
+    case GlFunction::IsTransformFeedback: {
+        GLuint id = reader.name(GlObject::TransformFeedback, reader.value<GLuint>());
+        glIsTransformFeedback(id);
+        return true;
+    }
+    case GlFunction::PauseTransformFeedback: {
+        glPauseTransformFeedback();
+        return true;
+    }
+    case GlFunction::ResumeTransformFeedback: {
+        glResumeTransformFeedback();
+        return true;
+    }
+    case GlFunction::DrawTransformFeedback: {
+        GLenum mode = reader.value<GLenum>();
+        GLuint id = reader.name(GlObject::TransformFeedback, reader.value<GLuint>());
+        glDrawTransformFeedback(mode, id);
+        return true;
+    }
+    case GlFunction::DrawTransformFeedbackStream: {
+        GLenum mode = reader.value<GLenum>();
+        GLuint id = reader.name(GlObject::TransformFeedback, reader.value<GLuint>());
+        GLuint stream = reader.value<GLuint>();
+        glDrawTransformFeedbackStream(mode, id, stream);
+        return true;
+    }
+    case GlFunction::BeginQueryIndexed: {
+        GLenum target = reader.value<GLenum>();
+        GLuint index = reader.value<GLuint>();
+        GLuint id = reader.name(GlObject::Query, reader.value<GLuint>());
+        glBeginQueryIndexed(target, index, id);
+        return true;
+    }
+    case GlFunction::EndQueryIndexed: {
+        GLenum target = reader.value<GLenum>();
+        GLuint index = reader.value<GLuint>();
+        glEndQueryIndexed(target, index);
+        return true;
+    }
+    case GlFunction::GetQueryIndexediv: {
+        GLenum target = reader.value<GLenum>();
+        GLuint index = reader.value<GLuint>();
+        GLenum pname = reader.value<GLenum>();
+        GLint * params = static_cast<GLint *>(reader.scratch());
+        glGetQueryIndexediv(target, index, pname, params);
+        return true;
+    }
+    default:
+        return false;
+    }
+}
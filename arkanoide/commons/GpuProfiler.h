@@ -0,0 +1,150 @@
+// Escopos de GPU para o Profiler, com consultas GL_TIMESTAMP (glQueryCounter).
+// Timestamps em vez de GL_TIME_ELAPSED porque podem ser aninhados. Os resultados de um
+// quadro só são lidos LATENCY quadros depois, e só se já estiverem disponíveis: nunca
+// há espera pela GPU; se ainda não estiverem prontos, os escopos daquele quadro se perdem.
+// Só a thread dona do contexto usa.
+
+#pragma once
+
+#include <vector>
+
+#include <glad/glad.h>
+
+#include "Profiler.h"
+
+class GpuProfiler {
+public:
+    static const int LATENCY = 3;
+
+    ~GpuProfiler() {
+        destroy();
+    }
+
+    // Libera as consultas; precisa do contexto corrente
+    void destroy() {
+        for (auto& frame : frames) {
+            if (!frame.queries.empty()) {
+                glDeleteQueries(static_cast<GLsizei>(frame.queries.size()), frame.queries.data());
+            }
+            frame.queries.clear();
+            frame.scopes.clear();
+        }
+    }
+
+    // Início do quadro: publica o quadro de LATENCY atrás e reaproveita as consultas dele
+    void beginFrame() {
+        frameIndex = (frameIndex + 1) % LATENCY;
+        FrameQueries& frame = frames[frameIndex];
+        if (!frame.scopes.empty()) {
+            publish(frame);
+        }
+        frame.scopes.clear();
+        frame.used = 0;
+        active = Profiler::isEnabled();
+        if (active) {
+            calibrate();
+        }
+    }
+
+    // Retorna o índice a passar para end(), ou -1 se o profiler estiver desligado
+    int begin(const char* name) {
+        if (!active) {
+            return -1;
+        }
+        FrameQueries& frame = frames[frameIndex];
+        frame.scopes.push_back(Scope{ name, nextQuery(frame), 0 });
+        glQueryCounter(frame.queries[frame.scopes.back().begin], GL_TIMESTAMP);
+        return static_cast<int>(frame.scopes.size()) - 1;
+    }
+
+    void end(int scope) {
+        if (scope < 0) {
+            return;
+        }
+        FrameQueries& frame = frames[frameIndex];
+        frame.scopes[scope].end = nextQuery(frame);
+        glQueryCounter(frame.queries[frame.scopes[scope].end], GL_TIMESTAMP);
+    }
+
+private:
+    struct Scope {
+        const char* name;
+        size_t begin;
+        size_t end;
+    };
+
+    struct FrameQueries {
+        std::vector<GLuint> queries;
+        std::vector<Scope> scopes;
+        size_t used = 0;
+    };
+
+    size_t nextQuery(FrameQueries& frame) {
+        if (frame.used == frame.queries.size()) {
+            GLuint query;
+            glGenQueries(1, &query);
+            frame.queries.push_back(query);
+        }
+        return frame.used++;
+    }
+
+    void publish(const FrameQueries& frame) {
+        // Consultas terminam em ordem: se a última está pronta, todas estão
+        GLuint available = GL_FALSE;
+        glGetQueryObjectuiv(frame.queries[frame.used - 1], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available) {
+            return;
+        }
+        for (const auto& scope : frame.scopes) {
+            if (scope.end == 0) {
+                continue; // begin() sem end()
+            }
+            GLuint64 begin = 0;
+            GLuint64 end = 0;
+            glGetQueryObjectui64v(frame.queries[scope.begin], GL_QUERY_RESULT, &begin);
+            glGetQueryObjectui64v(frame.queries[scope.end], GL_QUERY_RESULT, &end);
+            Profiler::record(scope.name, toCpuTime(begin), toCpuTime(end), Profiler::GPU_THREAD);
+        }
+    }
+
+    // Relógio da GPU -> relógio do Profiler; refeito a cada quadro para não acumular deriva
+    void calibrate() {
+        GLint64 gpuNow = 0;
+        glGetInteger64v(GL_TIMESTAMP, &gpuNow);
+        offset = static_cast<int64_t>(Profiler::now()) - gpuNow;
+    }
+
+    uint64_t toCpuTime(GLuint64 gpuTime) const {
+        int64_t time = static_cast<int64_t>(gpuTime) + offset;
+        return time > 0 ? static_cast<uint64_t>(time) : 0;
+    }
+
+    FrameQueries frames[LATENCY];
+    int frameIndex = 0;
+    bool active = false;
+    int64_t offset = 0;
+};
+
+class GpuProfileScope {
+public:
+    GpuProfileScope(GpuProfiler& profiler, const char* name) : profiler(profiler) {
+        scope = profiler.begin(name);
+    }
+
+    ~GpuProfileScope() {
+        profiler.end(scope);
+    }
+
+    GpuProfileScope(const GpuProfileScope&) = delete;
+    GpuProfileScope& operator=(const GpuProfileScope&) = delete;
+
+private:
+    GpuProfiler& profiler;
+    int scope;
+};
+
+#ifdef PROFILER_DISABLED
+#define GPU_PROFILE_SCOPE(profiler, name) ((void)0)
+#else
+#define GPU_PROFILE_SCOPE(profiler, name) GpuProfileScope PROFILE_CONCAT(gpuProfileScope, __LINE__)(profiler, name)
+#endif
@@ -0,0 +1,214 @@
+// Camada de instâncias que fica na GPU entre quadros (os blocos): a cópia da CPU é densa,
+// [0, size()), e um bitmap marca os slots alterados desde o último flush(), que vira
+// trechos para glBufferSubData (LayerUpdate). Cada instância tem uma chave estável (ex.:
+// linha * colunas + coluna). Remover é swap-remove: a última instância tapa o buraco,
+// então um bloco quebrado custa um slot reenviado e o buffer nunca tem buracos.
+//
+// O swap-remove embaralha a ordem e a capacidade só cresce, então flush() também
+// desfragmenta de tempos em tempos: com menos de 1/4 da capacidade em uso, o buffer
+// encolhe e as instâncias voltam à ordem das chaves, num único envio completo.
+//
+// À parte dos slots, a camada anota a área de cada instância posta ou tirada (o dano),
+// para quem guarda a camada já desenhada (o cache de camadas do Renderer) redesenhar só ali.
+// Só uma thread usa (a de quadros).
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "CommandBuffer.h"
+
+class InstanceLayer {
+public:
+    // Trechos sujos separados por menos slots limpos que isto viram um envio só: reenviar
+    // alguns slots a mais custa menos que outra chamada ao driver
+    static constexpr int MERGE_GAP = 16;
+    static constexpr int MIN_CAPACITY = 256;
+    // Acima disto o dano vira "a camada inteira"
+    static constexpr int MAX_DAMAGE = 256;
+
+    int size() const {
+        return static_cast<int>(instances.size());
+    }
+
+    int getCapacity() const {
+        return capacity;
+    }
+
+    bool contains(uint64_t key) const {
+        return slots.count(key) != 0;
+    }
+
+    // Uma chave que já está na camada só tem a instância trocada
+    void add(uint64_t key, const InstanceData& instance) {
+        auto found = slots.find(key);
+        if (found != slots.end()) {
+            addDamage(instances[found->second]);
+            addDamage(instance);
+            instances[found->second] = instance;
+            markDirty(found->second);
+            return;
+        }
+        addDamage(instance);
+        int slot = size();
+        slots.emplace(key, slot);
+        keys.push_back(key);
+        instances.push_back(instance);
+        markDirty(slot);
+    }
+
+    // Retorna false se a chave não está na camada
+    bool remove(uint64_t key) {
+        auto found = slots.find(key);
+        if (found == slots.end()) {
+            return false;
+        }
+        int slot = found->second;
+        slots.erase(found);
+        addDamage(instances[slot]);
+
+        int last = size() - 1;
+        if (slot != last) {
+            instances[slot] = instances[last];
+            keys[slot] = keys[last];
+            slots[keys[slot]] = slot;
+            markDirty(slot);
+        }
+        instances.pop_back();
+        keys.pop_back();
+        return true;
+    }
+
+    void clear() {
+        instances.clear();
+        keys.clear();
+        slots.clear();
+        damageAll = true;
+    }
+
+    // Translação da camada inteira, aplicada na projeção: rolar não reenvia nada
+    void setOffset(glm::vec2 offset) {
+        this->offset = offset;
+    }
+
+    // Escreve em `update` o que mudou desde o último flush
+    void flush(LayerUpdate& update) {
+        update.spans.clear();
+        update.data.clear();
+
+        int count = size();
+        int wanted = capacity;
+        if (count > capacity) {
+            wanted = std::max(capacity, MIN_CAPACITY);
+            while (wanted < count) {
+                wanted *= 2;
+            }
+        } else if (capacity > MIN_CAPACITY && count < capacity / 4) {
+            defragment();
+            wanted = MIN_CAPACITY;
+            while (wanted < 2 * count) {
+                wanted *= 2;
+            }
+        }
+
+        if (wanted != capacity) {
+            // Buffer novo: vai tudo de uma vez
+            capacity = wanted;
+            if (count > 0) {
+                update.spans.push_back(InstanceSpan{ 0, count });
+            }
+        } else {
+            collectSpans(count, update.spans);
+        }
+        for (const auto& span : update.spans) {
+            update.data.insert(update.data.end(), instances.begin() + span.first, instances.begin() + span.first + span.count);
+        }
+        if (dirtyBegin < dirtyEnd) {
+            std::fill(dirty.begin() + dirtyBegin, dirty.begin() + dirtyEnd, 0);
+        }
+        dirtyBegin = dirty.size();
+        dirtyEnd = 0;
+
+        update.count = count;
+        update.capacity = capacity;
+        update.offset = offset;
+        update.damage.swap(damage);
+        update.damageAll = damageAll;
+        damage.clear();
+        damageAll = false;
+    }
+
+private:
+    void addDamage(const InstanceData& instance) {
+        if (damageAll) {
+            return;
+        }
+        if (damage.size() >= static_cast<size_t>(MAX_DAMAGE)) {
+            damageAll = true;
+            damage.clear();
+            return;
+        }
+        glm::vec2 half = 0.5f * instance.scale;
+        damage.push_back(glm::vec4(instance.offset - half, instance.offset + half));
+    }
+
+    void markDirty(int slot) {
+        size_t word = static_cast<size_t>(slot) / 64;
+        if (word >= dirty.size()) {
+            dirty.resize(std::max(word + 1, 2 * dirty.size()), 0);
+        }
+        dirty[word] |= uint64_t(1) << (slot % 64);
+        dirtyBegin = std::min(dirtyBegin, word);
+        dirtyEnd = std::max(dirtyEnd, word + 1);
+    }
+
+    // Bits marcados abaixo de `count` (os acima são slots que saíram pelo fim), em ordem
+    void collectSpans(int count, std::vector<InstanceSpan>& spans) const {
+        for (size_t word = dirtyBegin; word < dirtyEnd; ++word) {
+            for (uint64_t bits = dirty[word]; bits != 0; bits &= bits - 1) {
+                int slot = static_cast<int>(word * 64) + __builtin_ctzll(bits);
+                if (slot >= count) {
+                    return;
+                }
+                if (!spans.empty() && slot - (spans.back().first + spans.back().count) < MERGE_GAP) {
+                    spans.back().count = slot + 1 - spans.back().first;
+                } else {
+                    spans.push_back(InstanceSpan{ slot, 1 });
+                }
+            }
+        }
+    }
+
+    // Volta as instâncias à ordem das chaves; o buffer é reenviado inteiro em seguida
+    void defragment() {
+        std::vector<int> order(instances.size());
+        for (size_t i = 0; i < order.size(); ++i) {
+            order[i] = static_cast<int>(i);
+        }
+        std::sort(order.begin(), order.end(), [this](int a, int b) { return keys[a] < keys[b]; });
+
+        std::vector<InstanceData> sortedInstances(instances.size());
+        std::vector<uint64_t> sortedKeys(keys.size());
+        for (size_t i = 0; i < order.size(); ++i) {
+            sortedInstances[i] = instances[order[i]];
+            sortedKeys[i] = keys[order[i]];
+            slots[sortedKeys[i]] = static_cast<int>(i);
+        }
+        instances.swap(sortedInstances);
+        keys.swap(sortedKeys);
+    }
+
+    std::vector<InstanceData> instances;
+    std::vector<uint64_t> keys;                 // chave de cada slot
+    std::unordered_map<uint64_t, int> slots;    // chave -> slot
+    std::vector<uint64_t> dirty;                // um bit por slot
+    size_t dirtyBegin = 0;                      // palavras de dirty com algum bit: [begin, end)
+    size_t dirtyEnd = 0;
+    int capacity = 0;                           // do buffer na GPU, como no último flush
+    std::vector<glm::vec4> damage;              // desde o último flush
+    bool damageAll = false;
+    glm::vec2 offset = glm::vec2(0.0f);
+};
@@ -0,0 +1,475 @@
+// Sistema de jobs com roubo de trabalho, um só por processo, que as threads do jogo
+// dividem em vez de cada uma ter o seu grupo de threads: a simulação (fase larga da
+// colisão), a thread de quadros (partículas e o grafo do quadro), o rasterizador por
+// software e os geradores de geometria. São size() - 1 workers; quem espera também
+// executa jobs, então o total de threads ocupadas fica no número de núcleos.
+//
+// Cada worker tem um deque de Chase-Lev (WorkStealingDeque.h) e um anel de MAX_JOBS jobs
+// pré-alocados: submeter não aloca nem trava. Sem trabalho no próprio deque, o worker rouba
+// do de outro; depois de SPIN buscas sem achar nada, dorme até alguém submeter. Threads de
+// fora do pool pegam emprestado um de MAX_EXTERNAL slots enquanto estão dentro de um
+// parallelFor, de um JobGraph::run ou de um Scope; sem slot livre, o trabalho roda na hora,
+// na própria thread.
+//
+// Um JobCounter conta os jobs submetidos com ele que ainda não terminaram; wait() ajuda a
+// executar até ele zerar. Um job só volta para o anel de quem o submeteu quando termina;
+// com o anel todo ocupado (jobs aninhados demais), o trabalho roda na hora.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Profiler.h"
+#include "WorkStealingDeque.h"
+
+struct JobCounter {
+    std::atomic<int> pending{ 0 };
+
+    bool done() const {
+        return pending.load(std::memory_order_acquire) == 0;
+    }
+};
+
+class JobSystem {
+public:
+    static constexpr int MAX_JOBS = 1024;        // por thread; potência de 2
+    static constexpr int MAX_EXTERNAL = 4;       // threads de fora do pool submetendo ao mesmo tempo
+    static constexpr int CHUNKS_PER_THREAD = 4;  // trechos de um parallelFor por thread, para equilibrar
+    static constexpr int SPIN = 64;
+    static constexpr size_t STORAGE = 48;        // bytes para a função de run()
+
+    // `numThreads` conta quem espera; 0 = uma por núcleo
+    explicit JobSystem(int numThreads = 0) : id(nextId()) {
+        if (numThreads <= 0) {
+            numThreads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+        }
+        numWorkers = numThreads - 1;
+        slots.reset(new Slot[numWorkers + MAX_EXTERNAL]);
+        for (int i = 0; i < numWorkers; ++i) {
+            threads.emplace_back([this, i]() { workerLoop(i); });
+        }
+    }
+
+    ~JobSystem() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            running.store(false, std::memory_order_relaxed);
+            ++wakeEpoch;
+        }
+        wakeUp.notify_all();
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    int size() const {
+        return numWorkers + 1;
+    }
+
+    // Empresta um slot a uma thread de fora do pool enquanto existir, para ela submeter
+    // com run(); dentro de um worker não faz nada. Pode ser aninhado. Os jobs submetidos
+    // precisam terminar (wait) antes do fim do Scope.
+    class Scope {
+    public:
+        explicit Scope(JobSystem& jobs) : jobs(jobs) {
+            jobs.acquire();
+        }
+
+        ~Scope() {
+            jobs.release();
+        }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        JobSystem& jobs;
+    };
+
+    // Submete task() ligado a `counter`. Numa thread sem slot (fora de um Scope) ou com o anel
+    // cheio, executa na hora.
+    template <typename F>
+    void run(JobCounter& counter, F&& task) {
+        using Task = typename std::decay<F>::type;
+        static_assert(sizeof(Task) <= STORAGE && alignof(Task) <= alignof(std::max_align_t), "Captura grande demais para um job");
+        Slot* slot = currentSlot();
+        Job* job = slot ? slot->allocate() : nullptr;
+        if (!job) {
+            task();
+            return;
+        }
+        new (job->storage) Task(std::forward<F>(task));
+        job->execute = [](Job& job) {
+            Task* task = std::launder(reinterpret_cast<Task*>(job.storage));
+            (*task)();
+            task->~Task();
+        };
+        job->counter = &counter;
+        counter.pending.fetch_add(1, std::memory_order_relaxed);
+        submit(*slot, *job);
+        wake(1);
+    }
+
+    // Executa jobs até `counter` zerar
+    void wait(JobCounter& counter) {
+        PROFILE_SCOPE("JobSystem::wait");
+        Slot* slot = currentSlot();
+        while (!counter.done()) {
+            Job* job = findJob(slot);
+            if (job) {
+                execute(*job);
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    // Divide [first, last) em trechos de pelo menos `grain` índices e chama body(begin, end)
+    // em cada um; quem chama executa o primeiro e só retorna quando todos terminaram
+    template <typename F>
+    void parallelFor(int first, int last, int grain, const F& body) {
+        int count = last - first;
+        if (count <= 0) {
+            return;
+        }
+        grain = std::max(grain, 1);
+        int chunks = std::min((count + grain - 1) / grain, size() * CHUNKS_PER_THREAD);
+        if (chunks <= 1 || numWorkers == 0) {
+            body(first, last);
+            return;
+        }
+        Scope scope(*this);
+        Slot* slot = currentSlot();
+        if (!slot) {
+            body(first, last);
+            return;
+        }
+
+        auto bound = [first, count, chunks](int chunk) {
+            return first + static_cast<int>(static_cast<int64_t>(count) * chunk / chunks);
+        };
+        JobCounter counter;
+        for (int chunk = chunks - 1; chunk >= 1; --chunk) {
+            Job* job = slot->allocate();
+            if (!job) {
+                body(bound(chunk), bound(chunk + 1));
+                continue;
+            }
+            job->execute = [](Job& job) {
+                (*static_cast<const F*>(job.body))(job.first, job.last);
+            };
+            job->counter = &counter;
+            job->body = &body;
+            job->first = bound(chunk);
+            job->last = bound(chunk + 1);
+            counter.pending.fetch_add(1, std::memory_order_relaxed);
+            submit(*slot, *job);
+        }
+        wake(chunks - 1);
+        body(first, bound(1));
+        wait(counter);
+    }
+
+private:
+    struct Job {
+        void (*execute)(Job&);
+        JobCounter* counter;
+        const void* body;  // parallelFor: o corpo, na pilha de quem chamou
+        int first, last;
+        std::atomic<bool> free{ true };  // quem executa devolve ao anel
+        alignas(std::max_align_t) unsigned char storage[STORAGE];  // run(): a função
+    };
+
+    struct Slot {
+        WorkStealingDeque<Job*, MAX_JOBS> deque;
+        std::unique_ptr<Job[]> jobs{ new Job[MAX_JOBS] };
+        unsigned next = 0;
+        std::atomic<bool> leased{ false };
+
+        // O próximo job livre do anel, ou nullptr se todos estão pendentes; só a dona chama
+        Job* allocate() {
+            for (int i = 0; i < MAX_JOBS; ++i) {
+                Job& job = jobs[next++ & (MAX_JOBS - 1)];
+                if (job.free.load(std::memory_order_acquire)) {
+                    job.free.store(false, std::memory_order_relaxed);
+                    return &job;
+                }
+            }
+            return nullptr;
+        }
+    };
+
+    // Slot da thread atual: fixo num worker, emprestado (com profundidade) fora do pool
+    struct Lease {
+        uint64_t system = 0;
+        Slot* slot = nullptr;
+        int depth = 0;
+    };
+
+    static uint64_t nextId() {
+        static std::atomic<uint64_t> next{ 1 };
+        return next.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    static Lease& lease() {
+        thread_local Lease lease;
+        return lease;
+    }
+
+    Slot* currentSlot() const {
+        const Lease& current = lease();
+        return current.system == id ? current.slot : nullptr;
+    }
+
+    void acquire() {
+        Lease& current = lease();
+        if (current.system == id) {
+            ++current.depth;
+            return;
+        }
+        if (current.system != 0) {
+            return; // já está com o slot de outro JobSystem
+        }
+        for (int i = 0; i < MAX_EXTERNAL; ++i) {
+            Slot& slot = slots[numWorkers + i];
+            bool expected = false;
+            if (!slot.leased.load(std::memory_order_relaxed) &&
+                slot.leased.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+                current = Lease{ id, &slot, 1 };
+                return;
+            }
+        }
+    }
+
+    void release() {
+        Lease& current = lease();
+        if (current.system != id || --current.depth > 0) {
+            return;
+        }
+        // O deque está vazio: tudo que foi submetido no Scope já terminou
+        current.slot->leased.store(false, std::memory_order_release);
+        current = Lease();
+    }
+
+    static void execute(Job& job) {
+        JobCounter* counter = job.counter;
+        job.execute(job);
+        job.free.store(true, std::memory_order_release);
+        counter->pending.fetch_sub(1, std::memory_order_release);
+    }
+
+    void submit(Slot& slot, Job& job) {
+        if (!slot.deque.push(&job)) {
+            execute(job); // deque cheio
+        }
+    }
+
+    // O mais recente do próprio deque ou o mais antigo de outro, começando de um slot
+    // diferente a cada busca para espalhar os roubos
+    Job* findJob(Slot* own) {
+        Job* job;
+        if (own && own->deque.pop(job)) {
+            return job;
+        }
+        thread_local unsigned victim = 0;
+        int count = numWorkers + MAX_EXTERNAL;
+        for (int i = 0; i < count; ++i) {
+            Slot& slot = slots[(victim + i) % count];
+            if (&slot != own && slot.deque.steal(job)) {
+                victim += i;
+                return job;
+            }
+        }
+        ++victim;
+        return nullptr;
+    }
+
+    void wake(int count) {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (sleepers.load(std::memory_order_relaxed) == 0) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ++wakeEpoch;
+        }
+        if (count == 1) {
+            wakeUp.notify_one();
+        } else {
+            wakeUp.notify_all();
+        }
+    }
+
+    void workerLoop(int index) {
+        Profiler::setThreadName("job " + std::to_string(index));
+        Slot& slot = slots[index];
+        lease() = Lease{ id, &slot, 1 };
+        int idle = 0;
+        while (running.load(std::memory_order_relaxed)) {
+            Job* job = findJob(&slot);
+            if (job) {
+                execute(*job);
+                idle = 0;
+                continue;
+            }
+            if (++idle < SPIN) {
+                std::this_thread::yield();
+                continue;
+            }
+            idle = 0;
+
+            // Anuncia que vai dormir e procura de novo: quem submeter depois disso vê o
+            // anúncio e muda a época, então não há como perder o aviso
+            uint64_t seenEpoch;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                seenEpoch = wakeEpoch;
+            }
+            sleepers.fetch_add(1, std::memory_order_seq_cst);
+            job = findJob(&slot);
+            if (!job) {
+                std::unique_lock<std::mutex> lock(mutex);
+                // running também conta: o destrutor pode ter mudado a época antes de
+                // seenEpoch ser lido, e aí a época sozinha nunca mais mudaria
+                wakeUp.wait(lock, [&]() { return wakeEpoch != seenEpoch || !running.load(std::memory_order_relaxed); });
+            }
+            sleepers.fetch_sub(1, std::memory_order_relaxed);
+            if (job) {
+                execute(*job);
+            }
+        }
+        lease() = Lease();
+    }
+
+    const uint64_t id;  // distingue sistemas no Lease, mesmo se um novo ocupar o endereço de outro
+    int numWorkers = 0;
+    std::unique_ptr<Slot[]> slots;  // workers, depois os emprestáveis
+    std::vector<std::thread> threads;
+
+    std::atomic<bool> running{ true };
+    std::atomic<int> sleepers{ 0 };
+    std::mutex mutex;
+    std::condition_variable wakeUp;
+    uint64_t wakeEpoch = 0;
+};
+
+// Grafo de tarefas de um quadro: nós com dependências, executados no JobSystem assim que
+// as dependências terminam. Montado de novo a cada quadro (clear() guarda a memória dos
+// nós); precisa ser acíclico. As funções dos nós são copiadas para `resource`, que pode ser
+// a FrameArena do quadro: aí montar o grafo não aloca, desde que clear() venha antes do
+// reset() da arena.
+class JobGraph {
+public:
+    explicit JobGraph(std::pmr::memory_resource* resource = std::pmr::get_default_resource()) : resource(resource) {
+    }
+
+    JobGraph(const JobGraph&) = delete;
+    JobGraph& operator=(const JobGraph&) = delete;
+
+    ~JobGraph() {
+        clear();
+    }
+
+    // Nó novo, sem dependências; retorna o índice
+    template <typename F>
+    int add(F&& task) {
+        using Task = typename std::decay<F>::type;
+        if (used == nodes.size()) {
+            nodes.emplace_back();
+        }
+        Node& node = nodes[used];
+        node.task = new (resource->allocate(sizeof(Task), alignof(Task))) Task(std::forward<F>(task));
+        node.invoke = [](void* task) {
+            (*static_cast<Task*>(task))();
+        };
+        node.destroy = [](void* task, std::pmr::memory_resource* resource) {
+            static_cast<Task*>(task)->~Task();
+            resource->deallocate(task, sizeof(Task), alignof(Task));
+        };
+        node.successors.clear();
+        node.dependencies = 0;
+        return static_cast<int>(used++);
+    }
+
+    // `after` só começa depois que `before` termina
+    void precede(int before, int after) {
+        nodes[before].successors.push_back(after);
+        ++nodes[after].dependencies;
+    }
+
+    size_t size() const {
+        return used;
+    }
+
+    void clear() {
+        for (size_t i = 0; i < used; ++i) {
+            nodes[i].destroy(nodes[i].task, resource);
+        }
+        used = 0;
+    }
+
+    // Executa todos os nós e espera o último
+    void run(JobSystem& jobs) {
+        if (used == 0) {
+            return;
+        }
+        if (remainingCapacity < used) {
+            remaining.reset(new std::atomic<int>[used]);
+            remainingCapacity = used;
+        }
+        for (size_t i = 0; i < used; ++i) {
+            remaining[i].store(nodes[i].dependencies, std::memory_order_relaxed);
+        }
+
+        JobSystem::Scope scope(jobs);
+        this->jobs = &jobs;
+        for (size_t i = 0; i < used; ++i) {
+            if (nodes[i].dependencies == 0) {
+                submit(static_cast<int>(i));
+            }
+        }
+        jobs.wait(counter);
+        this->jobs = nullptr;
+    }
+
+private:
+    struct Node {
+        void* task = nullptr;
+        void (*invoke)(void*) = nullptr;
+        void (*destroy)(void*, std::pmr::memory_resource*) = nullptr;
+        std::vector<int> successors;
+        int dependencies = 0;
+    };
+
+    void submit(int index) {
+        jobs->run(counter, [this, index]() {
+            nodes[index].invoke(nodes[index].task);
+            for (int successor : nodes[index].successors) {
+                if (remaining[successor].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    submit(successor);
+                }
+            }
+        });
+    }
+
+    std::pmr::memory_resource* resource;
+    std::vector<Node> nodes;
+    size_t used = 0;
+    std::unique_ptr<std::atomic<int>[]> remaining;
+    size_t remainingCapacity = 0;
+    JobCounter counter;
+    JobSystem* jobs = nullptr;
+};
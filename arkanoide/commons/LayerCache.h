@@ -0,0 +1,214 @@
+// Textura do tamanho da tela que guarda o que já foi desenhado, redesenhada só onde muda.
+// O Renderer usa duas: o cache das camadas estáticas (fundo e blocos), para o quadro
+// começar com um único quadrado de tela cheia em vez de redesenhar todos os blocos, e o
+// próprio quadro, que só é refeito em volta do que se mexeu e depois copiado para a tela.
+// A textura é dividida em tiles de TILE pixels; o dano marca tiles e redraw() limpa e
+// redesenha só os retângulos de tiles marcados (com scissor), que quem desenha não precisa
+// saber recortar. Só a thread dona do contexto usa.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+class LayerCache {
+public:
+    static constexpr int TILE = 64;
+    // Com mais retângulos que isto, redesenha o retângulo que envolve todos: cada
+    // retângulo repete o desenho da camada inteira (o scissor só corta os fragmentos)
+    static constexpr int MAX_RECTS = 4;
+
+    ~LayerCache() {
+        destroy();
+    }
+
+    // Precisa do contexto corrente
+    void destroy() {
+        if (framebuffer != 0) {
+            glDeleteFramebuffers(1, &framebuffer);
+            glDeleteTextures(1, &texture);
+        }
+        framebuffer = 0;
+        texture = 0;
+        width = 0;
+        height = 0;
+    }
+
+    // Acompanha o tamanho da tela; trocar de tamanho descarta o conteúdo. Retorna false se o
+    // framebuffer não puder ser usado (aí as camadas devem ser desenhadas direto).
+    bool resize(int width, int height) {
+        if (width == this->width && height == this->height) {
+            return complete;
+        }
+        destroy();
+        this->width = width;
+        this->height = height;
+        if (width <= 0 || height <= 0) {
+            complete = false;
+            return false;
+        }
+
+        glGenTextures(1, &texture);
+        glBindTexture(GL_TEXTURE_2D, texture);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glBindTexture(GL_TEXTURE_2D, 0);
+
+        glGenFramebuffers(1, &framebuffer);
+        glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture, 0);
+        complete = glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+        tilesX = (width + TILE - 1) / TILE;
+        tilesY = (height + TILE - 1) / TILE;
+        tiles.assign(static_cast<size_t>(tilesX) * tilesY, 0);
+        invalidate();
+        return complete;
+    }
+
+    // Tudo precisa ser redesenhado
+    void invalidate() {
+        std::fill(tiles.begin(), tiles.end(), 1);
+        dirtyTiles = static_cast<int>(tiles.size());
+    }
+
+    // Marca os tiles que cobrem o retângulo (min.x, min.y, max.x, max.y), em coordenadas
+    // de tela (-1..1); um pixel de folga para as regras de rasterização
+    void damage(const glm::vec4& rect) {
+        if (tiles.empty()) {
+            return;
+        }
+        int x0 = toTile(std::floor((rect.x + 1.0f) * 0.5f * width) - 1.0f, tilesX);
+        int y0 = toTile(std::floor((rect.y + 1.0f) * 0.5f * height) - 1.0f, tilesY);
+        int x1 = toTile(std::ceil((rect.z + 1.0f) * 0.5f * width) + 1.0f, tilesX);
+        int y1 = toTile(std::ceil((rect.w + 1.0f) * 0.5f * height) + 1.0f, tilesY);
+        for (int y = y0; y <= y1; ++y) {
+            for (int x = x0; x <= x1; ++x) {
+                uint8_t& tile = tiles[static_cast<size_t>(y) * tilesX + x];
+                dirtyTiles += tile == 0;
+                tile = 1;
+            }
+        }
+    }
+
+    // Os tiles marcados em `other` (ainda não redesenhados), se as duas têm o mesmo tamanho
+    void damage(const LayerCache& other) {
+        if (other.tiles.size() != tiles.size() || other.width != width || other.height != height) {
+            invalidate();
+            return;
+        }
+        for (size_t i = 0; i < tiles.size(); ++i) {
+            dirtyTiles += other.tiles[i] & ~tiles[i];
+            tiles[i] |= other.tiles[i];
+        }
+    }
+
+    bool isDirty() const {
+        return dirtyTiles > 0;
+    }
+
+    // Redesenha os tiles marcados: `draw()` desenha as camadas inteiras no framebuffer já
+    // ligado, uma vez por retângulo de tiles. O viewport precisa ser o da tela.
+    template <typename Draw>
+    void redraw(Draw draw) {
+        if (!isDirty()) {
+            return;
+        }
+        collectRects();
+        glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+        glEnable(GL_SCISSOR_TEST);
+        for (const auto& rect : rects) {
+            int x = rect.x * TILE;
+            int y = rect.y * TILE;
+            glScissor(x, y, std::min(rect.z * TILE, width) - x, std::min(rect.w * TILE, height) - y);
+            glClear(GL_COLOR_BUFFER_BIT);
+            draw();
+        }
+        glDisable(GL_SCISSOR_TEST);
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+        std::fill(tiles.begin(), tiles.end(), 0);
+        dirtyTiles = 0;
+    }
+
+    GLuint getTexture() const {
+        return texture;
+    }
+
+    // Copia a textura para o framebuffer da janela, inteira: sem a idade do back buffer
+    // (que o GLFW não expõe) não há como saber o que já está nele
+    void present() {
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+        glBlitFramebuffer(0, 0, width, height, 0, 0, width, height, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    }
+
+private:
+    static int toTile(float pixel, int count) {
+        int tile = static_cast<int>(pixel) / TILE;
+        return std::min(std::max(tile, 0), count - 1);
+    }
+
+    // Retângulos de tiles [x, z) x [y, w): corridas de cada linha, juntadas com a linha de
+    // cima quando cobrem as mesmas colunas
+    void collectRects() {
+        rects.clear();
+        for (int y = 0; y < tilesY; ++y) {
+            size_t rowStart = rects.size();
+            for (int x = 0; x < tilesX;) {
+                if (!tiles[static_cast<size_t>(y) * tilesX + x]) {
+                    ++x;
+                    continue;
+                }
+                int end = x;
+                while (end < tilesX && tiles[static_cast<size_t>(y) * tilesX + end]) {
+                    ++end;
+                }
+                rects.push_back(glm::ivec4(x, y, end, y + 1));
+                x = end;
+            }
+            // Junta com um retângulo que termina na linha de cima com as mesmas colunas
+            for (size_t i = rowStart; i < rects.size();) {
+                auto above = std::find_if(rects.begin(), rects.begin() + rowStart, [&](const glm::ivec4& other) {
+                    return other.w == y && other.x == rects[i].x && other.z == rects[i].z;
+                });
+                if (above != rects.begin() + rowStart) {
+                    above->w = y + 1;
+                    rects.erase(rects.begin() + i);
+                } else {
+                    ++i;
+                }
+            }
+        }
+
+        if (rects.size() > static_cast<size_t>(MAX_RECTS)) {
+            glm::ivec4 bounds = rects[0];
+            for (const auto& rect : rects) {
+                bounds = glm::ivec4(std::min(bounds.x, rect.x), std::min(bounds.y, rect.y), std::max(bounds.z, rect.z), std::max(bounds.w, rect.w));
+            }
+            rects.assign(1, bounds);
+        }
+    }
+
+    GLuint framebuffer = 0;
+    GLuint texture = 0;
+    int width = 0;
+    int height = 0;
+    bool complete = false;
+
+    int tilesX = 0;
+    int tilesY = 0;
+    std::vector<uint8_t> tiles; // 1 = precisa ser redesenhado
+    int dirtyTiles = 0;
+    std::vector<glm::ivec4> rects;
+};
@@ -0,0 +1,201 @@
+// Profiler de quadros: escopos de CPU (PROFILE_SCOPE) e de GPU (GpuProfiler.h) vão para
+// uma fila sem locks e podem ser exportados no formato trace_event do Chrome
+// (abrir em chrome://tracing ou https://ui.perfetto.dev).
+//
+// Desligado por padrão: cada PROFILE_SCOPE custa só a leitura de um atômico até alguém
+// chamar Profiler::start(). Compilando com -DPROFILER_DISABLED os macros somem.
+//
+// Uso típico:
+//     Profiler::start();
+//     ... { PROFILE_SCOPE("recordBlocks"); ... } ...
+//     Profiler::collect();                  // uma vez por quadro, esvazia a fila
+//     Profiler::writeChromeTrace("trace.json");
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "MpscRing.h"
+
+struct ProfileEvent {
+    const char* name;  // literal: só o ponteiro é guardado
+    uint64_t start;    // ns desde Profiler::now() == 0
+    uint64_t duration;
+    uint32_t thread;
+};
+
+class Profiler {
+public:
+    // Linha reservada para os escopos de GPU no trace
+    static const uint32_t GPU_THREAD = 0;
+
+    // O histórico guarda só as últimas HISTORY_FRAMES chamadas de collect() (30 s a 60 Hz):
+    // ligado por uma sessão longa, o profiler não cresce sem limite
+    static const size_t HISTORY_FRAMES = 1800;
+
+    static void start() {
+        epoch();
+        enabled().store(true, std::memory_order_relaxed);
+    }
+
+    static void stop() {
+        enabled().store(false, std::memory_order_relaxed);
+    }
+
+    static bool isEnabled() {
+        return enabled().load(std::memory_order_relaxed);
+    }
+
+    static uint64_t now() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch()).count());
+    }
+
+    // Id da thread chamadora no trace (1, 2, ...; 0 é a GPU)
+    static uint32_t threadId() {
+        static std::atomic<uint32_t> next{ GPU_THREAD + 1 };
+        thread_local uint32_t id = next.fetch_add(1, std::memory_order_relaxed);
+        return id;
+    }
+
+    static void setThreadName(const std::string& name) {
+        setThreadName(threadId(), name);
+    }
+
+    static void setThreadName(uint32_t thread, const std::string& name) {
+        State& state = shared();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        state.threadNames[thread] = name;
+    }
+
+    // Pode ser chamado de qualquer thread. Com a fila cheia o evento é descartado e contado.
+    static void record(const char* name, uint64_t start, uint64_t end, uint32_t thread) {
+        if (!shared().events.push(ProfileEvent{ name, start, end - start, thread })) {
+            shared().dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    // Move os eventos da fila para o histórico; chamar periodicamente (ex.: uma vez por quadro).
+    // Cada chamada conta como um quadro do histórico; os mais antigos saem.
+    static void collect() {
+        State& state = shared();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        ProfileEvent event;
+        size_t count = 0;
+        while (state.events.pop(event)) {
+            state.history.push_back(event);
+            ++count;
+        }
+        state.frameSizes.push_back(count);
+        if (state.frameSizes.size() > HISTORY_FRAMES) {
+            state.history.erase(state.history.begin(), state.history.begin() + state.frameSizes.front());
+            state.frameSizes.pop_front();
+        }
+    }
+
+    static uint64_t dropped() {
+        return shared().dropped.load(std::memory_order_relaxed);
+    }
+
+    static bool writeChromeTrace(const std::string& path) {
+        collect();
+        State& state = shared();
+        std::lock_guard<std::mutex> lock(state.mutex);
+
+        FILE* file = std::fopen(path.c_str(), "w");
+        if (!file) {
+            return false;
+        }
+
+        std::fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+        std::fprintf(file, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"GPU\"}}", GPU_THREAD);
+        for (const auto& thread : state.threadNames) {
+            std::fprintf(file, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s\"}}",
+                thread.first, escape(thread.second.c_str()).c_str());
+        }
+        // trace_event usa microssegundos; as casas decimais mantêm a resolução de ns
+        for (const auto& event : state.history) {
+            std::fprintf(file, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+                escape(event.name).c_str(), event.thread, event.start / 1000.0, event.duration / 1000.0);
+        }
+        // Eventos perdidos com a fila cheia deixam buracos no trace: o total vai junto
+        std::fprintf(file, "\n],\"otherData\":{\"droppedEvents\":\"%llu\"}}\n", static_cast<unsigned long long>(dropped()));
+        return std::fclose(file) == 0;
+    }
+
+private:
+    struct State {
+        MpscRing<ProfileEvent, 1 << 16> events;
+        std::atomic<uint64_t> dropped{ 0 };
+        std::mutex mutex;
+        std::deque<ProfileEvent> history;
+        std::deque<size_t> frameSizes;  // eventos de cada collect() ainda no histórico
+        std::map<uint32_t, std::string> threadNames;
+    };
+
+    static State& shared() {
+        static State state;
+        return state;
+    }
+
+    static std::atomic<bool>& enabled() {
+        static std::atomic<bool> value{ false };
+        return value;
+    }
+
+    static std::chrono::steady_clock::time_point epoch() {
+        static const std::chrono::steady_clock::time_point value = std::chrono::steady_clock::now();
+        return value;
+    }
+
+    static std::string escape(const char* text) {
+        std::string result;
+        for (; *text; ++text) {
+            if (*text == '"' || *text == '\\') {
+                result += '\\';
+            }
+            result += *text;
+        }
+        return result;
+    }
+};
+
+// Mede do construtor ao destrutor; o estado de start() é lido uma vez, na entrada
+class ProfileScope {
+public:
+    explicit ProfileScope(const char* name) {
+        if (Profiler::isEnabled()) {
+            this->name = name;
+            start = Profiler::now();
+        }
+    }
+
+    ~ProfileScope() {
+        if (name) {
+            Profiler::record(name, start, Profiler::now(), Profiler::threadId());
+        }
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    const char* name = nullptr;
+    uint64_t start = 0;
+};
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+
+#ifdef PROFILER_DISABLED
+#define PROFILE_SCOPE(name) ((void)0)
+#else
+#define PROFILE_SCOPE(name) ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(name)
+#endif
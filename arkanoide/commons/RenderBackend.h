@@ -0,0 +1,22 @@
+// O que a thread de quadros vê de um renderer: Renderer (OpenGL) ou SoftwareRenderer
+// (rasterizador por software, para máquinas sem GPU). Os dois recebem quadros já gravados
+// numa thread própria e executam cada quadro entregue, em ordem.
+
+#pragma once
+
+#include "CommandBuffer.h"
+
+class RenderBackend {
+public:
+    virtual ~RenderBackend() = default;
+
+    virtual void start() = 0;
+    virtual void stop() = 0;
+
+    // Entrega o quadro gravado e devolve em `frame` os buffers de um quadro já executado
+    virtual void submit(Frame& frame) = 0;
+
+    // Podem ser chamados de qualquer thread
+    virtual void resize(int width, int height) = 0;
+    virtual void toggleOverlay() = 0;
+};
@@ -0,0 +1,626 @@
+// Thread de render: é a única dona do contexto OpenGL.
+// Recebe quadros já gravados (Frame) e os submete enquanto a thread principal
+// simula e grava o próximo quadro. Há no máximo um quadro pendente e um em execução.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include "glm/gtc/matrix_transform.hpp"
+#include <glm/gtc/type_ptr.hpp>
+
+#include "CommandBuffer.h"
+#include "GlTrace.h"
+#include "GpuProfiler.h"
+#include "LayerCache.h"
+#include "Profiler.h"
+#include "RenderBackend.h"
+#include "ShaderVariants.h"
+#include "ShaderWatcher.h"
+#include "StatsOverlay.h"
+
+class Renderer : public RenderBackend {
+public:
+    Renderer(GLFWwindow* window, int width, int height) {
+        this->window = window;
+        this->width = width;
+        this->height = height;
+    }
+
+    ~Renderer() override {
+        stop();
+    }
+
+    // O contexto precisa estar livre (glfwMakeContextCurrent(nullptr)) na thread que chama start()
+    void start() override {
+        running = true;
+        thread = std::thread([this]() { renderLoop(); });
+    }
+
+    void stop() override {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!running) {
+                return;
+            }
+            running = false;
+        }
+        frameReady.notify_all();
+        slotFree.notify_all();
+        thread.join();
+    }
+
+    // Entrega o quadro gravado para a thread de render. Bloqueia só se ainda houver
+    // um quadro pendente; em troca devolve em `frame` os buffers de um quadro já
+    // submetido, para serem reaproveitados sem novas alocações.
+    void submit(Frame& frame) override {
+        std::unique_lock<std::mutex> lock(mutex);
+        slotFree.wait(lock, [this]() { return !hasPending || !running; });
+        std::swap(pending, frame);
+        hasPending = true;
+        frameReady.notify_one();
+    }
+
+    // Pode ser chamado de qualquer thread (ex.: callback de resize do GLFW)
+    void resize(int width, int height) override {
+        this->width = width;
+        this->height = height;
+    }
+
+    // Mostra/esconde o HUD de estatísticas; pode ser chamado de qualquer thread
+    void toggleOverlay() override {
+        overlayVisible = !overlayVisible;
+    }
+
+private:
+    void renderLoop() {
+        glfwMakeContextCurrent(window);
+        Profiler::setThreadName("render");
+        createResources();
+
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                frameReady.wait(lock, [this]() { return hasPending || !running; });
+                if (!hasPending) {
+                    break;
+                }
+                std::swap(current, pending);
+                hasPending = false;
+                slotFree.notify_one();
+            }
+
+            if (viewportWidth != width || viewportHeight != height) {
+                viewportWidth = width;
+                viewportHeight = height;
+                glViewport(0, 0, viewportWidth, viewportHeight);
+            }
+
+            gpuProfiler.beginFrame();
+            execute(current);
+
+            overlay.setVisible(overlayVisible);
+            overlay.draw(shaders->get(ShaderFeature::Instanced), viewportWidth, viewportHeight);
+
+            PROFILE_SCOPE("swapBuffers");
+            glfwSwapBuffers(window);
+            GlTrace::markFrame();
+        }
+
+        destroyResources();
+        glfwMakeContextCurrent(nullptr);
+    }
+
+    void execute(const Frame& frame) {
+        PROFILE_SCOPE("execute");
+        GPU_PROFILE_SCOPE(gpuProfiler, "frame");
+
+        // Fronteira de quadro: shaders editados no disco começam a recompilar aqui e só
+        // substituem o programa em uso quando linkarem com sucesso
+        bool reloaded = false;
+        for (int id : watcher.takeChanged()) {
+            shaders->reload(id);
+            reloaded = true;
+        }
+
+        // Conclui o que o driver já compilou; os demais programas continuam em paralelo.
+        // Um programa novo pode desenhar diferente: o cache de camadas é refeito.
+        if (shaders->poll() || reloaded) {
+            projectionLocations.clear();
+            layerCache.invalidate();
+        }
+
+        // Agrupa comandos seguidos com o mesmo programa e a mesma malha; a ordem de
+        // desenho entre lotes é a mesma da gravação. Os lotes do fundo vêm primeiro.
+        instances.clear();
+        batches.clear();
+        addBatches(frame.background);
+        backgroundBatches = batches.size();
+        for (const auto& buffer : frame.buffers) {
+            addBatches(buffer);
+        }
+
+        // Mesmo num quadro sem nada para desenhar: as mudanças da camada se acumulam
+        uploadLayer(frame.bricks);
+        if (instances.empty() && frame.pointRanges.empty() && frame.bricks.count == 0) {
+            glClear(GL_COLOR_BUFFER_BIT);
+            frameCache.invalidate();
+            return;
+        }
+
+        GPU_PROFILE_SCOPE(gpuProfiler, "draw");
+        glm::mat4 projection = glm::ortho(-1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+        uploadBatches();
+        uploadPoints(frame);
+        bool cached = updateLayerCache(frame, projection);
+        if (cached && frameCache.resize(viewportWidth, viewportHeight)) {
+            drawPartial(frame, projection);
+        } else {
+            // Quadro inteiro direto na janela; o próximo parcial parte do zero
+            frameCache.invalidate();
+            if (cached) {
+                compositeLayerCache();
+            } else {
+                glClear(GL_COLOR_BUFFER_BIT);
+                drawStatic(frame.bricks, projection);
+            }
+            drawDynamic(projection);
+        }
+
+        glBindVertexArray(0);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+
+    // Paddle, bolas e partículas
+    void drawDynamic(const glm::mat4& projection) {
+        drawBatches(projection, backgroundBatches, batches.size());
+        drawPoints(projection);
+    }
+
+    // O quadro anterior continua em frameCache: só os tiles onde algo aparecia no quadro
+    // anterior, aparece neste ou mudou nas camadas estáticas são refeitos (cache das
+    // camadas + o que se mexe, com scissor), e o resultado é copiado para a janela. Num
+    // quadro parado nada é desenhado.
+    void drawPartial(const Frame& frame, const glm::mat4& projection) {
+        PROFILE_SCOPE("drawPartial");
+        for (const auto& rect : dynamicDamage) {
+            frameCache.damage(rect);
+        }
+        collectDynamicDamage(frame);
+        for (const auto& rect : dynamicDamage) {
+            frameCache.damage(rect);
+        }
+        frameCache.redraw([this, &projection]() {
+            compositeLayerCache();
+            drawDynamic(projection);
+        });
+        frameCache.present();
+    }
+
+    // Área de cada comando dinâmico e de cada trecho de partículas, em coordenadas de tela
+    void collectDynamicDamage(const Frame& frame) {
+        dynamicDamage.clear();
+        for (size_t i = backgroundBatches; i < batches.size(); ++i) {
+            const Batch& batch = batches[i];
+            if (batch.mesh != Mesh::Quad) {
+                // Malhas em coordenadas absolutas (a moldura): a tela toda
+                dynamicDamage.assign(1, glm::vec4(-1.0f, -1.0f, 1.0f, 1.0f));
+                return;
+            }
+            for (GLsizei j = batch.first; j < batch.first + batch.count; ++j) {
+                glm::vec2 half = 0.5f * instances[j].scale;
+                dynamicDamage.push_back(glm::vec4(instances[j].offset - half, instances[j].offset + half));
+            }
+        }
+        // Pontos de 2 pixels: meio ponto de folga em cada direção
+        glm::vec2 pointMargin(2.0f / std::max(viewportWidth, 1), 2.0f / std::max(viewportHeight, 1));
+        for (size_t i = 0; i < pointFirsts.size(); ++i) {
+            const PointVertex* point = frame.points.data() + pointFirsts[i];
+            glm::vec2 low = point->position;
+            glm::vec2 high = point->position;
+            for (GLsizei j = 0; j < pointCounts[i]; ++j) {
+                low = glm::min(low, point[j].position);
+                high = glm::max(high, point[j].position);
+            }
+            dynamicDamage.push_back(glm::vec4(low - pointMargin, high + pointMargin));
+        }
+    }
+
+    void addBatches(const CommandBuffer& buffer) {
+        for (const auto& command : buffer.getCommands()) {
+            if (batches.empty() || batches.back().program != command.program || batches.back().mesh != command.mesh) {
+                batches.push_back(Batch{ command.program, command.mesh, static_cast<GLsizei>(instances.size()), 0 });
+            }
+            instances.push_back(InstanceData{ command.position, command.scale, command.color });
+            ++batches.back().count;
+        }
+    }
+
+    // Fundo e blocos no framebuffer ligado
+    void drawStatic(const LayerUpdate& bricks, const glm::mat4& projection) {
+        drawBatches(projection, 0, backgroundBatches);
+        drawLayer(bricks, projection);
+    }
+
+    // Leva o cache de camadas ao estado deste quadro; false se as camadas estáticas devem
+    // ser desenhadas direto. Com a camada em movimento (rolagem) o cache seria refeito
+    // inteiro a cada quadro, então fica de lado até ela parar.
+    bool updateLayerCache(const Frame& frame, const glm::mat4& projection) {
+        const LayerUpdate& bricks = frame.bricks;
+        bool hasStatic = backgroundBatches > 0 || bricks.count > 0;
+        bool moving = bricks.offset != cachedOffset;
+        cachedOffset = bricks.offset;
+        if (!hasStatic || moving || !layerCache.resize(viewportWidth, viewportHeight)) {
+            layerCache.invalidate();
+            return false;
+        }
+
+        if (!sameCommands(frame.background.getCommands(), cachedBackground)) {
+            cachedBackground = frame.background.getCommands();
+            layerCache.invalidate();
+        }
+        if (bricks.damageAll) {
+            layerCache.invalidate();
+        } else {
+            glm::vec4 offset(bricks.offset, bricks.offset);
+            for (const auto& rect : bricks.damage) {
+                layerCache.damage(rect + offset);
+            }
+        }
+
+        if (layerCache.isDirty()) {
+            frameCache.damage(layerCache);
+            PROFILE_SCOPE("redrawLayerCache");
+            GPU_PROFILE_SCOPE(gpuProfiler, "redrawLayerCache");
+            layerCache.redraw([this, &bricks, &projection]() { drawStatic(bricks, projection); });
+        }
+        return true;
+    }
+
+    // O cache cobre a tela toda (inclusive o fundo vazio), então substitui o glClear
+    void compositeLayerCache() {
+        GLuint program = shaders->get(COMPOSITE_FEATURES);
+        if (program == 0) {
+            glClear(GL_COLOR_BUFFER_BIT);
+            return;
+        }
+        if (program != compositeProgram) {
+            compositeProgram = program;
+            compositeScaleLocation = glGetUniformLocation(program, "scale");
+        }
+        glUseProgram(program);
+        glUniform1f(compositeScaleLocation, 2.0f); // quadrado unitário -> tela cheia
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D, layerCache.getTexture());
+        glBindVertexArray(screenVAO);
+        glDrawArrays(GL_TRIANGLES, 0, meshes[static_cast<int>(Mesh::Quad)].count);
+        glBindTexture(GL_TEXTURE_2D, 0);
+    }
+
+    static bool sameCommands(const std::vector<DrawCommand>& a, const std::vector<DrawCommand>& b) {
+        return std::equal(a.begin(), a.end(), b.begin(), b.end(), [](const DrawCommand& x, const DrawCommand& y) {
+            return x.program == y.program && x.mesh == y.mesh && x.position == y.position && x.scale == y.scale && x.color == y.color;
+        });
+    }
+
+    // Camada dos blocos: só os trechos que mudaram vão para a GPU; o buffer só é
+    // realocado quando a capacidade muda, e aí os trechos cobrem a camada inteira
+    void uploadLayer(const LayerUpdate& layer) {
+        if (layer.capacity == layerCapacity && layer.spans.empty()) {
+            return;
+        }
+        PROFILE_SCOPE("uploadLayer");
+        glBindBuffer(GL_ARRAY_BUFFER, layerVBO);
+        if (layer.capacity != layerCapacity) {
+            glBufferData(GL_ARRAY_BUFFER, static_cast<size_t>(layer.capacity) * sizeof(InstanceData), nullptr, GL_DYNAMIC_DRAW);
+            layerCapacity = layer.capacity;
+        }
+        const InstanceData* data = layer.data.data();
+        for (const auto& span : layer.spans) {
+            glBufferSubData(GL_ARRAY_BUFFER, static_cast<size_t>(span.first) * sizeof(InstanceData), static_cast<size_t>(span.count) * sizeof(InstanceData), data);
+            data += span.count;
+        }
+    }
+
+    void drawLayer(const LayerUpdate& layer, const glm::mat4& projection) {
+        if (layer.count == 0) {
+            return;
+        }
+        GLuint program = shaders->get(programFeatures(Program::Flat));
+        if (program == 0) {
+            return;
+        }
+        glm::mat4 translated = glm::translate(projection, glm::vec3(layer.offset, 0.0f));
+        glUseProgram(program);
+        glUniformMatrix4fv(getProjectionLocation(program), 1, GL_FALSE, glm::value_ptr(translated));
+        glBindVertexArray(layerVAO);
+        glDrawArraysInstanced(GL_TRIANGLES, 0, meshes[static_cast<int>(Mesh::Quad)].count, layer.count);
+    }
+
+    // Um único upload por quadro; glBufferData com o tamanho todo deixa o driver
+    // trocar o armazenamento em vez de esperar o quadro anterior terminar
+    void uploadBatches() {
+        if (instances.empty()) {
+            return;
+        }
+        glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+        glBufferData(GL_ARRAY_BUFFER, instances.size() * sizeof(InstanceData), instances.data(), GL_STREAM_DRAW);
+    }
+
+    // Lotes [first, last)
+    void drawBatches(const glm::mat4& projection, size_t first, size_t last) {
+        GLuint boundProgram = 0;
+
+        for (size_t i = first; i < last; ++i) {
+            const Batch& batch = batches[i];
+            // Só espera pelas variantes que este quadro realmente usa
+            GLuint program = shaders->get(programFeatures(batch.program));
+            if (program == 0) {
+                continue;
+            }
+            if (program != boundProgram) {
+                glUseProgram(program);
+                glUniformMatrix4fv(getProjectionLocation(program), 1, GL_FALSE, glm::value_ptr(projection));
+                boundProgram = program;
+            }
+
+            const MeshBuffers& mesh = meshes[static_cast<int>(batch.mesh)];
+            glBindVertexArray(mesh.VAO);
+            setInstanceOffset(batch.first);
+            glDrawArraysInstanced(mesh.primitive, 0, mesh.count, batch.count);
+        }
+    }
+
+    // Partículas: um upload de Frame::points até o fim do último trecho e um único
+    // glMultiDrawArrays com os trechos de todas as threads gravadoras
+    void uploadPoints(const Frame& frame) {
+        pointFirsts.clear();
+        pointCounts.clear();
+        GLint end = 0;
+        for (const auto& range : frame.pointRanges) {
+            if (range.count > 0) {
+                pointFirsts.push_back(range.first);
+                pointCounts.push_back(range.count);
+                end = std::max(end, range.first + range.count);
+            }
+        }
+        if (pointCounts.empty()) {
+            return;
+        }
+        glBindBuffer(GL_ARRAY_BUFFER, pointVBO);
+        glBufferData(GL_ARRAY_BUFFER, static_cast<size_t>(end) * sizeof(PointVertex), frame.points.data(), GL_STREAM_DRAW);
+    }
+
+    void drawPoints(const glm::mat4& projection) {
+        if (pointCounts.empty()) {
+            return;
+        }
+        GLuint program = shaders->get(POINT_FEATURES);
+        if (program == 0) {
+            return;
+        }
+        glUseProgram(program);
+        glUniformMatrix4fv(getProjectionLocation(program), 1, GL_FALSE, glm::value_ptr(projection));
+
+        glBindVertexArray(pointVAO);
+        glMultiDrawArrays(GL_POINTS, pointFirsts.data(), pointCounts.data(), static_cast<GLsizei>(pointCounts.size()));
+    }
+
+    static uint32_t programFeatures(Program program) {
+        switch (program) {
+        case Program::Circle:
+            return ShaderFeature::Projection | ShaderFeature::Instanced | ShaderFeature::SdfCircle;
+        case Program::Flat:
+        default:
+            return ShaderFeature::Projection | ShaderFeature::Instanced;
+        }
+    }
+
+    // Partículas: posição e cor por vértice, sem instâncias
+    static constexpr uint32_t POINT_FEATURES = ShaderFeature::Projection | ShaderFeature::VertexColor;
+
+    // Cache de camadas: Mesh::Quad escalado para a tela, com a cor da textura do cache
+    static constexpr uint32_t COMPOSITE_FEATURES = ShaderFeature::Scale | ShaderFeature::ScreenTexture;
+
+    GLint getProjectionLocation(GLuint program) {
+        auto found = projectionLocations.find(program);
+        if (found == projectionLocations.end()) {
+            found = projectionLocations.emplace(program, glGetUniformLocation(program, "projection")).first;
+        }
+        return found->second;
+    }
+
+    // Sem glDrawArraysInstancedBaseInstance no GL 3.3: cada lote aponta os atributos
+    // por instância para o seu trecho do buffer (o VAO já está ligado)
+    void setInstanceOffset(GLsizei first) {
+        const char* base = reinterpret_cast<const char*>(static_cast<size_t>(first) * sizeof(InstanceData));
+        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(InstanceData), base + offsetof(InstanceData, offset));
+        glVertexAttribPointer(3, 2, GL_FLOAT, GL_FALSE, sizeof(InstanceData), base + offsetof(InstanceData, scale));
+        glVertexAttribPointer(4, 3, GL_FLOAT, GL_FALSE, sizeof(InstanceData), base + offsetof(InstanceData, color));
+    }
+
+    void createResources() {
+        // Todas as variantes são disparadas juntas; o primeiro quadro espera só pelas que usar
+#ifdef ARKANOIDE_HOT_RELOAD
+        shaders.reset(new ShaderVariants(&watcher));
+#else
+        shaders.reset(new ShaderVariants());
+#endif
+        shaders->request(programFeatures(Program::Flat));
+        shaders->request(programFeatures(Program::Circle));
+        shaders->request(POINT_FEATURES);
+        shaders->request(COMPOSITE_FEATURES);
+        shaders->request(ShaderFeature::Instanced); // HUD, em coordenadas de tela
+        watcher.start();
+
+        glGenBuffers(1, &instanceVBO);
+        overlay.create();
+
+        // Partículas: vec2 de posição e a cor RGBA8 lida como vec3 normalizado
+        glGenVertexArrays(1, &pointVAO);
+        glGenBuffers(1, &pointVBO);
+        glBindVertexArray(pointVAO);
+        glBindBuffer(GL_ARRAY_BUFFER, pointVBO);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(PointVertex), (void*)offsetof(PointVertex, position));
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(1, 3, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(PointVertex), (void*)offsetof(PointVertex, color));
+        glEnableVertexAttribArray(1);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glBindVertexArray(0);
+        glPointSize(2.0f);
+
+        meshes.push_back(createMesh(meshVertices(Mesh::Quad), GL_TRIANGLES));
+        meshes.push_back(createMesh(meshVertices(Mesh::Contour), GL_LINE_STRIP));
+
+        // Camada dos blocos: o quadrado com os atributos por instância fixos no início do
+        // seu próprio buffer, que persiste entre quadros
+        glGenBuffers(1, &layerVBO);
+        glGenVertexArrays(1, &layerVAO);
+        glBindVertexArray(layerVAO);
+        glBindBuffer(GL_ARRAY_BUFFER, meshes[static_cast<int>(Mesh::Quad)].VBO);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+        glEnableVertexAttribArray(0);
+        glBindBuffer(GL_ARRAY_BUFFER, layerVBO);
+        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(InstanceData), (void*)offsetof(InstanceData, offset));
+        glVertexAttribPointer(3, 2, GL_FLOAT, GL_FALSE, sizeof(InstanceData), (void*)offsetof(InstanceData, scale));
+        glVertexAttribPointer(4, 3, GL_FLOAT, GL_FALSE, sizeof(InstanceData), (void*)offsetof(InstanceData, color));
+        for (GLuint attribute = 2; attribute <= 4; ++attribute) {
+            glEnableVertexAttribArray(attribute);
+            glVertexAttribDivisor(attribute, 1);
+        }
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glBindVertexArray(0);
+
+        // Composição do cache: só a posição do quadrado
+        glGenVertexArrays(1, &screenVAO);
+        glBindVertexArray(screenVAO);
+        glBindBuffer(GL_ARRAY_BUFFER, meshes[static_cast<int>(Mesh::Quad)].VBO);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+        glEnableVertexAttribArray(0);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glBindVertexArray(0);
+
+        glLineWidth(3.0f);
+    }
+
+    void destroyResources() {
+        watcher.stop();
+        gpuProfiler.destroy();
+        overlay.destroy();
+        for (auto& mesh : meshes) {
+            glDeleteVertexArrays(1, &mesh.VAO);
+            glDeleteBuffers(1, &mesh.VBO);
+        }
+        meshes.clear();
+        glDeleteBuffers(1, &instanceVBO);
+        instanceVBO = 0;
+        glDeleteVertexArrays(1, &pointVAO);
+        glDeleteBuffers(1, &pointVBO);
+        pointVAO = 0;
+        pointVBO = 0;
+        glDeleteVertexArrays(1, &layerVAO);
+        glDeleteBuffers(1, &layerVBO);
+        layerVAO = 0;
+        layerVBO = 0;
+        layerCapacity = 0;
+        glDeleteVertexArrays(1, &screenVAO);
+        screenVAO = 0;
+        layerCache.destroy();
+        frameCache.destroy();
+        cachedBackground.clear();
+        compositeProgram = 0;
+        projectionLocations.clear();
+        shaders.reset();
+    }
+
+    struct MeshBuffers {
+        GLuint VAO, VBO;
+        GLenum primitive;
+        GLsizei count;
+    };
+
+    MeshBuffers createMesh(const std::vector<glm::vec2>& vertices, GLenum primitive) {
+        MeshBuffers mesh;
+        mesh.primitive = primitive;
+        mesh.count = static_cast<GLsizei>(vertices.size());
+        glGenVertexArrays(1, &mesh.VAO);
+        glGenBuffers(1, &mesh.VBO);
+        glBindVertexArray(mesh.VAO);
+        glBindBuffer(GL_ARRAY_BUFFER, mesh.VBO);
+        glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(glm::vec2), vertices.data(), GL_STATIC_DRAW);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(glm::vec2), (void*)0);
+        glEnableVertexAttribArray(0);
+
+        // Atributos por instância; os ponteiros são definidos por lote em setInstanceOffset
+        glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+        for (GLuint attribute = 2; attribute <= 4; ++attribute) {
+            glEnableVertexAttribArray(attribute);
+            glVertexAttribDivisor(attribute, 1);
+        }
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glBindVertexArray(0);
+        return mesh;
+    }
+
+    GLFWwindow* window;
+    std::atomic<int> width;
+    std::atomic<int> height;
+    std::atomic<bool> overlayVisible{ false };
+
+    std::thread thread;
+    std::mutex mutex;
+    std::condition_variable frameReady;
+    std::condition_variable slotFree;
+    bool running = false;
+    bool hasPending = false;
+    Frame pending;
+    Frame current;
+
+    struct Batch {
+        Program program;
+        Mesh mesh;
+        GLsizei first;
+        GLsizei count;
+    };
+
+    // Recursos GL: só acessados pela thread de render
+    std::unique_ptr<ShaderVariants> shaders;
+    ShaderWatcher watcher;
+    GpuProfiler gpuProfiler;
+    StatsOverlay overlay;
+    std::unordered_map<GLuint, GLint> projectionLocations;
+    std::vector<MeshBuffers> meshes;
+    GLuint instanceVBO = 0;
+    GLuint pointVAO = 0;
+    GLuint pointVBO = 0;
+    GLuint layerVAO = 0;
+    GLuint layerVBO = 0;
+    int layerCapacity = 0;
+    GLuint screenVAO = 0;
+    LayerCache layerCache;
+    LayerCache frameCache;                  // o último quadro, antes do HUD
+    std::vector<glm::vec4> dynamicDamage;   // onde o que se mexe estava no último quadro parcial
+    std::vector<DrawCommand> cachedBackground;
+    glm::vec2 cachedOffset = glm::vec2(0.0f);
+    GLuint compositeProgram = 0;
+    GLint compositeScaleLocation = -1;
+    int viewportWidth = 0;
+    int viewportHeight = 0;
+
+    // Reaproveitados entre quadros
+    std::vector<InstanceData> instances;
+    std::vector<Batch> batches;
+    size_t backgroundBatches = 0;
+    std::vector<GLint> pointFirsts;
+    std::vector<GLsizei> pointCounts;
+};
@@ -14,6 +14,8 @@
 // GLFW
 #include <GLFW/glfw3.h>
 
+#include "ShaderCache.h"
+
 using namespace std;
 
 class Shader
@@ -52,6 +54,12 @@ public:
 		{
 			std::cout << "ERROR::SHADER::FILE_NOT_SUCCESFULLY_READ" << std::endl;
 		}
+		// Reuse the program binary from a previous run when the driver accepts it
+		this->ID = ShaderCache::load(vertexCode, fragmentCode);
+		if (this->ID != 0)
+		{
+			return;
+		}
 		const GLchar* vShaderCode = vertexCode.c_str();
 		const GLchar * fShaderCode = fragmentCode.c_str();
 		// 2. Compile shaders
@@ -84,6 +92,7 @@ public:
 		this->ID = glCreateProgram();
 		glAttachShader(this->ID, vertex);
 		glAttachShader(this->ID, fragment);
+		ShaderCache::prepare(this->ID);
 		glLinkProgram(this->ID);
 		// Print linking errors if any
 		glGetProgramiv(this->ID, GL_LINK_STATUS, &success);
@@ -92,6 +101,10 @@ public:
 			glGetProgramInfoLog(this->ID, 512, NULL, infoLog);
 			std::cout << "ERROR::SHADER::PROGRAM::LINKING_FAILED\n" << infoLog << std::endl;
 		}
+		else
+		{
+			ShaderCache::save(this->ID, vertexCode, fragmentCode);
+		}
 		// Delete the shaders as they're linked into our program now and no longer necessery
 		glDeleteShader(vertex);
 		glDeleteShader(fragment);
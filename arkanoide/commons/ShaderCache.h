@@ -0,0 +1,252 @@
+// Cache em disco de programas já linkados (GL_ARB_get_program_binary).
+// A chave é o hash das fontes + vendor/renderer/versão do driver, então trocar de
+// driver ou editar um shader simplesmente gera uma chave nova.
+//
+// Uso típico:
+//     GLuint program = ShaderCache::load(vs, fs);
+//     if (program == 0) {
+//         ... compila, ShaderCache::prepare(program) antes do glLinkProgram ...
+//         ShaderCache::save(program, vs, fs);
+//     }
+//
+// Diretório: $PG2023_SHADER_CACHE, senão $XDG_CACHE_HOME/pg2023/shaders,
+// senão ~/.cache/pg2023/shaders.
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+// A glad do repositório foi gerada para GL 4.0; program binary é do 4.1
+#ifndef GL_PROGRAM_BINARY_RETRIEVABLE_HINT
+#define GL_PROGRAM_BINARY_RETRIEVABLE_HINT 0x8257
+#define GL_PROGRAM_BINARY_LENGTH 0x8741
+#define GL_NUM_PROGRAM_BINARY_FORMATS 0x87FE
+#endif
+
+class ShaderCache {
+public:
+    // Programa linkado a partir do cache, ou 0 se não houver entrada ou o driver rejeitar o binário
+    static GLuint load(const std::string& vertexSource, const std::string& fragmentSource) {
+        return load(sourceKey(vertexSource, fragmentSource));
+    }
+
+    // Mesmo que acima, para quem já tem os hashes das fontes (ex.: shaders embutidos)
+    static GLuint load(uint64_t sourceKey) {
+        if (!available()) {
+            return 0;
+        }
+
+        uint64_t programKey = key(sourceKey);
+        std::string path = entryPath(programKey);
+        std::error_code error;
+        uintmax_t fileSize = std::filesystem::file_size(path, error);
+        if (error || fileSize < sizeof(Header)) {
+            return 0;
+        }
+        std::ifstream file(path, std::ios::binary);
+        if (!file) {
+            return 0;
+        }
+
+        Header header;
+        file.read(reinterpret_cast<char*>(&header), sizeof(header));
+        if (!file || header.magic != MAGIC || header.key != programKey) {
+            return 0;
+        }
+        // O tamanho vem do arquivo: uma entrada truncada ou corrompida é só um erro de cache,
+        // nunca uma alocação do tamanho que estiver escrito ali
+        if (header.length == 0 || header.length > MAX_BINARY_LENGTH || header.length != fileSize - sizeof(header)) {
+            file.close();
+            std::remove(path.c_str());
+            return 0;
+        }
+
+        std::vector<char> binary(header.length);
+        file.read(binary.data(), header.length);
+        if (!file) {
+            return 0;
+        }
+
+        GLuint program = glCreateProgram();
+        api().programBinary(program, header.format, binary.data(), static_cast<GLsizei>(binary.size()));
+
+        GLint success;
+        glGetProgramiv(program, GL_LINK_STATUS, &success);
+        if (!success) {
+            // Driver atualizado ou binário corrompido: descarta e deixa o chamador recompilar
+            glDeleteProgram(program);
+            std::remove(path.c_str());
+            return 0;
+        }
+        return program;
+    }
+
+    // Deve ser chamado antes do glLinkProgram para o driver manter o binário recuperável
+    static void prepare(GLuint program) {
+        if (available()) {
+            api().programParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+        }
+    }
+
+    // Grava o binário de um programa já linkado com sucesso
+    static void save(GLuint program, const std::string& vertexSource, const std::string& fragmentSource) {
+        save(program, sourceKey(vertexSource, fragmentSource));
+    }
+
+    static void save(GLuint program, uint64_t sourceKey) {
+        if (!available()) {
+            return;
+        }
+
+        GLint success;
+        glGetProgramiv(program, GL_LINK_STATUS, &success);
+        GLint length = 0;
+        glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+        if (!success || length <= 0 || static_cast<uint32_t>(length) > MAX_BINARY_LENGTH) {
+            return;
+        }
+
+        Header header;
+        header.magic = MAGIC;
+        header.key = key(sourceKey);
+        std::vector<char> binary(length);
+        GLsizei written = 0;
+        api().getProgramBinary(program, length, &written, &header.format, binary.data());
+        header.length = static_cast<uint32_t>(written);
+
+        std::error_code error;
+        std::filesystem::create_directories(directory(), error);
+
+        // Escreve num arquivo temporário e renomeia, para outra instância nunca ler pela metade
+        std::string path = entryPath(header.key);
+        std::string temporaryPath = path + ".tmp";
+        {
+            std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+            if (!file) {
+                return;
+            }
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            file.write(binary.data(), written);
+            if (!file) {
+                return;
+            }
+        }
+        std::filesystem::rename(temporaryPath, path, error);
+    }
+
+    // Desligado, load() sempre erra e save() não grava (ex.: ao gravar um trace GL, em que
+    // um programa vindo de glProgramBinary não poderia ser reproduzido)
+    static void setEnabled(bool enabled) {
+        ShaderCache::enabled() = enabled;
+    }
+
+    // Identifica o par de fontes; a chave final ainda mistura a descrição do driver
+    static uint64_t sourceKey(uint64_t vertexHash, uint64_t fragmentHash) {
+        uint64_t hashes[2] = { vertexHash, fragmentHash };
+        return hash(reinterpret_cast<const char*>(hashes), sizeof(hashes));
+    }
+
+    static uint64_t sourceKey(const std::string& vertexSource, const std::string& fragmentSource) {
+        return sourceKey(hash(vertexSource.data(), vertexSource.size()), hash(fragmentSource.data(), fragmentSource.size()));
+    }
+
+    // FNV-1a de 64 bits (o mesmo de tools/embed_shaders.py)
+    static uint64_t hash(const char* data, size_t size, uint64_t seed = 14695981039346656037ull) {
+        uint64_t value = seed;
+        for (size_t i = 0; i < size; ++i) {
+            value ^= static_cast<unsigned char>(data[i]);
+            value *= 1099511628211ull;
+        }
+        return value;
+    }
+
+private:
+    static const uint32_t MAGIC = 0x43534750; // "PGSC"
+    static const uint32_t MAX_BINARY_LENGTH = 64 * 1024 * 1024;
+
+    struct Header {
+        uint32_t magic;
+        GLenum format;
+        uint32_t length;
+        uint64_t key;
+    };
+
+    // Como os PFNGL*PROC da glad, com a convenção de chamada do GL (stdcall no Windows)
+    typedef void (APIENTRYP GetProgramBinaryProc)(GLuint, GLsizei, GLsizei*, GLenum*, void*);
+    typedef void (APIENTRYP ProgramBinaryProc)(GLuint, GLenum, const void*, GLsizei);
+    typedef void (APIENTRYP ProgramParameteriProc)(GLuint, GLenum, GLint);
+
+    struct Api {
+        GetProgramBinaryProc getProgramBinary = nullptr;
+        ProgramBinaryProc programBinary = nullptr;
+        ProgramParameteriProc programParameteri = nullptr;
+        bool supported = false;
+    };
+
+    // Carregado na primeira chamada, com o contexto corrente
+    static Api& api() {
+        static Api instance = []() {
+            Api loaded;
+            loaded.getProgramBinary = (GetProgramBinaryProc)glfwGetProcAddress("glGetProgramBinary");
+            loaded.programBinary = (ProgramBinaryProc)glfwGetProcAddress("glProgramBinary");
+            loaded.programParameteri = (ProgramParameteriProc)glfwGetProcAddress("glProgramParameteri");
+
+            GLint numFormats = 0;
+            glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &numFormats);
+            loaded.supported = loaded.getProgramBinary && loaded.programBinary && loaded.programParameteri && numFormats > 0;
+            return loaded;
+        }();
+        return instance;
+    }
+
+    static bool& enabled() {
+        static bool value = true;
+        return value;
+    }
+
+    static bool available() {
+        return enabled() && api().supported;
+    }
+
+    static uint64_t key(uint64_t sourceKey) {
+        static const std::string driver = []() {
+            std::string description;
+            for (GLenum name : { GL_VENDOR, GL_RENDERER, GL_VERSION }) {
+                const GLubyte* value = glGetString(name);
+                description += value ? reinterpret_cast<const char*>(value) : "";
+                description += '\n';
+            }
+            return description;
+        }();
+
+        return hash(reinterpret_cast<const char*>(&sourceKey), sizeof(sourceKey), hash(driver.data(), driver.size()));
+    }
+
+    static std::string directory() {
+        if (const char* path = std::getenv("PG2023_SHADER_CACHE")) {
+            return path;
+        }
+        if (const char* path = std::getenv("XDG_CACHE_HOME")) {
+            return std::string(path) + "/pg2023/shaders";
+        }
+        if (const char* path = std::getenv("HOME")) {
+            return std::string(path) + "/.cache/pg2023/shaders";
+        }
+        return ".shader-cache";
+    }
+
+    static std::string entryPath(uint64_t programKey) {
+        char name[32];
+        std::snprintf(name, sizeof(name), "%016llx.bin", static_cast<unsigned long long>(programKey));
+        return directory() + "/" + name;
+    }
+};
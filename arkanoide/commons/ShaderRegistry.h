@@ -0,0 +1,273 @@
+// Registro de programas compilados de forma assíncrona.
+// Todos os glCompileShader/glLinkProgram são disparados de uma vez em request(); com
+// GL_KHR_parallel_shader_compile o driver compila em paralelo e poll() só consulta
+// GL_COMPLETION_STATUS_KHR, sem bloquear. get() bloqueia apenas no programa pedido.
+// Programas que já estão no ShaderCache ficam prontos na hora.
+// Pedir de novo um programa que já existe (hot-reload) compila em segundo plano e só
+// troca o handle quando o novo linkar com sucesso; se falhar, o antigo continua valendo.
+// `defines` (linhas "#define X") é injetado logo após o #version, para variantes de um
+// mesmo uber-shader (ver ShaderVariants.h).
+
+#pragma once
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include "EmbeddedShaders.h"
+#include "ShaderCache.h"
+
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+
+class ShaderRegistry {
+public:
+    ShaderRegistry() {
+        // Mesma função nas duas extensões; 0xFFFFFFFF deixa o driver escolher o número de threads
+        typedef void (*MaxShaderCompilerThreadsProc)(GLuint);
+        MaxShaderCompilerThreadsProc maxShaderCompilerThreads = nullptr;
+        if (glfwExtensionSupported("GL_KHR_parallel_shader_compile")) {
+            maxShaderCompilerThreads = (MaxShaderCompilerThreadsProc)glfwGetProcAddress("glMaxShaderCompilerThreadsKHR");
+        } else if (glfwExtensionSupported("GL_ARB_parallel_shader_compile")) {
+            maxShaderCompilerThreads = (MaxShaderCompilerThreadsProc)glfwGetProcAddress("glMaxShaderCompilerThreadsARB");
+        }
+        if (maxShaderCompilerThreads) {
+            maxShaderCompilerThreads(0xFFFFFFFF);
+            parallel = true;
+        }
+    }
+
+    ~ShaderRegistry() {
+        for (auto& entry : entries) {
+            release(entry.second);
+        }
+    }
+
+    // Dispara a compilação e retorna imediatamente
+    void request(int id, const std::string& vertexSource, const std::string& fragmentSource) {
+        request(id, vertexSource, fragmentSource, ShaderCache::sourceKey(vertexSource, fragmentSource));
+    }
+
+    void request(int id, const std::string& vertexSource, const std::string& fragmentSource, uint64_t sourceKey) {
+        Entry& entry = entries[id];
+        discardPending(entry);
+        entry.sourceKey = sourceKey;
+
+        GLuint cached = ShaderCache::load(sourceKey);
+        if (cached != 0) {
+            activate(entry, cached);
+            return;
+        }
+
+        const GLchar* vShaderCode = vertexSource.c_str();
+        const GLchar* fShaderCode = fragmentSource.c_str();
+        entry.vertex = glCreateShader(GL_VERTEX_SHADER);
+        glShaderSource(entry.vertex, 1, &vShaderCode, NULL);
+        glCompileShader(entry.vertex);
+        entry.fragment = glCreateShader(GL_FRAGMENT_SHADER);
+        glShaderSource(entry.fragment, 1, &fShaderCode, NULL);
+        glCompileShader(entry.fragment);
+
+        // O link pode ser pedido antes da compilação terminar; o driver encadeia os dois
+        entry.pending = glCreateProgram();
+        glAttachShader(entry.pending, entry.vertex);
+        glAttachShader(entry.pending, entry.fragment);
+        ShaderCache::prepare(entry.pending);
+        glLinkProgram(entry.pending);
+    }
+
+    // Fontes embutidas no binário (commons/EmbeddedShaders.h): nenhum acesso a disco,
+    // e o hash gerado no build já serve de chave do ShaderCache
+    void requestEmbedded(int id, const std::string& vertexPath, const std::string& fragmentPath, const std::string& defines = "") {
+        const EmbeddedShader* vertex = findEmbeddedShader(vertexPath);
+        const EmbeddedShader* fragment = findEmbeddedShader(fragmentPath);
+        if (!vertex || !fragment) {
+            std::cout << "ERROR::SHADER::NOT_EMBEDDED " << (vertex ? fragmentPath : vertexPath) << std::endl;
+            return;
+        }
+        uint64_t sourceKey = ShaderCache::sourceKey(vertex->hash, fragment->hash);
+        if (!defines.empty()) {
+            sourceKey = ShaderCache::hash(defines.data(), defines.size(), sourceKey);
+        }
+        request(id, withDefines(vertex->source, defines), withDefines(fragment->source, defines), sourceKey);
+    }
+
+    void requestFiles(int id, const std::string& vertexPath, const std::string& fragmentPath, const std::string& defines = "") {
+        request(id, withDefines(readFile(vertexPath), defines), withDefines(readFile(fragmentPath), defines));
+        Entry& entry = entries[id];
+        entry.vertexPath = vertexPath;
+        entry.fragmentPath = fragmentPath;
+        entry.defines = defines;
+    }
+
+    // Relê do disco os arquivos de um programa pedido com requestFiles
+    void reload(int id) {
+        auto found = entries.find(id);
+        if (found != entries.end() && !found->second.vertexPath.empty()) {
+            std::string vertexPath = found->second.vertexPath;
+            std::string fragmentPath = found->second.fragmentPath;
+            std::string defines = found->second.defines;
+            requestFiles(id, vertexPath, fragmentPath, defines);
+        }
+    }
+
+    // Conclui, sem bloquear, os programas que o driver já terminou.
+    // Retorna true se algum handle mudou (caches de uniform precisam ser refeitos).
+    bool poll() {
+        bool swapped = false;
+        for (auto& entry : entries) {
+            if (entry.second.pending != 0 && isComplete(entry.second)) {
+                swapped |= finish(entry.second);
+            }
+        }
+        return swapped;
+    }
+
+    bool isReady(int id) const {
+        auto found = entries.find(id);
+        return found != entries.end() && found->second.program != 0;
+    }
+
+    bool isPending(int id) const {
+        auto found = entries.find(id);
+        return found != entries.end() && found->second.pending != 0;
+    }
+
+    // Programa pronto para uso. Só bloqueia se ainda não existir nenhuma versão dele;
+    // durante um reload continua devolvendo a versão antiga. 0 se falhou.
+    GLuint get(int id) {
+        auto found = entries.find(id);
+        if (found == entries.end()) {
+            return 0;
+        }
+        Entry& entry = found->second;
+        if (entry.program == 0 && entry.pending != 0) {
+            finish(entry);
+        }
+        return entry.program;
+    }
+
+    bool isParallel() const {
+        return parallel;
+    }
+
+    static std::string readFile(const std::string& path) {
+        std::ifstream file(path);
+        if (!file) {
+            std::cout << "ERROR::SHADER::FILE_NOT_SUCCESFULLY_READ " << path << std::endl;
+            return "";
+        }
+        std::stringstream stream;
+        stream << file.rdbuf();
+        return stream.str();
+    }
+
+    // Insere `defines` depois da linha do #version (que precisa continuar sendo a primeira)
+    static std::string withDefines(std::string_view source, const std::string& defines) {
+        std::string result(source);
+        if (defines.empty()) {
+            return result;
+        }
+        size_t lineEnd = result.find('\n');
+        size_t position = result.compare(0, 8, "#version") == 0 && lineEnd != std::string::npos ? lineEnd + 1 : 0;
+        result.insert(position, defines);
+        return result;
+    }
+
+private:
+    struct Entry {
+        GLuint program = 0;  // versão em uso
+        GLuint pending = 0;  // versão compilando
+        GLuint vertex = 0;
+        GLuint fragment = 0;
+        uint64_t sourceKey = 0;
+        std::string vertexPath;
+        std::string fragmentPath;
+        std::string defines;
+    };
+
+    bool isComplete(const Entry& entry) const {
+        if (!parallel) {
+            return true;
+        }
+        GLint complete = GL_FALSE;
+        glGetProgramiv(entry.pending, GL_COMPLETION_STATUS_KHR, &complete);
+        return complete == GL_TRUE;
+    }
+
+    // Lê o resultado (bloqueia se o driver ainda não terminou) e libera os shaders.
+    // Retorna true se a versão em uso foi trocada.
+    bool finish(Entry& entry) {
+        GLint success;
+        GLchar infoLog[512];
+        bool swapped = false;
+
+        glGetProgramiv(entry.pending, GL_LINK_STATUS, &success);
+        if (!success) {
+            glGetShaderiv(entry.vertex, GL_COMPILE_STATUS, &success);
+            if (!success) {
+                glGetShaderInfoLog(entry.vertex, 512, NULL, infoLog);
+                std::cout << "ERROR::SHADER::VERTEX::COMPILATION_FAILED\n" << infoLog << std::endl;
+            }
+            glGetShaderiv(entry.fragment, GL_COMPILE_STATUS, &success);
+            if (!success) {
+                glGetShaderInfoLog(entry.fragment, 512, NULL, infoLog);
+                std::cout << "ERROR::SHADER::FRAGMENT::COMPILATION_FAILED\n" << infoLog << std::endl;
+            }
+            glGetProgramInfoLog(entry.pending, 512, NULL, infoLog);
+            std::cout << "ERROR::SHADER::PROGRAM::LINKING_FAILED\n" << infoLog << std::endl;
+            glDeleteProgram(entry.pending);
+        } else {
+            ShaderCache::save(entry.pending, entry.sourceKey);
+            activate(entry, entry.pending);
+            swapped = true;
+        }
+        entry.pending = 0;
+
+        glDeleteShader(entry.vertex);
+        glDeleteShader(entry.fragment);
+        entry.vertex = 0;
+        entry.fragment = 0;
+        return swapped;
+    }
+
+    void activate(Entry& entry, GLuint program) {
+        if (entry.program != 0) {
+            glDeleteProgram(entry.program);
+        }
+        entry.program = program;
+    }
+
+    void discardPending(Entry& entry) {
+        if (entry.vertex != 0) {
+            glDeleteShader(entry.vertex);
+        }
+        if (entry.fragment != 0) {
+            glDeleteShader(entry.fragment);
+        }
+        if (entry.pending != 0) {
+            glDeleteProgram(entry.pending);
+        }
+        entry.vertex = 0;
+        entry.fragment = 0;
+        entry.pending = 0;
+    }
+
+    void release(Entry& entry) {
+        discardPending(entry);
+        if (entry.program != 0) {
+            glDeleteProgram(entry.program);
+        }
+        entry.program = 0;
+    }
+
+    std::unordered_map<int, Entry> entries;
+    bool parallel = false;
+};
@@ -0,0 +1,112 @@
+// Variantes do uber-shader (shaders/uber.vs e shaders/uber.fs).
+// Cada combinação de ShaderFeature vira um conjunto de "#define" injetado na fonte; o
+// id da variante no ShaderRegistry é a própria máscara, então só as combinações que
+// alguém realmente pede são compiladas (e cada uma vai para o ShaderCache separada).
+//
+// Uso típico (arkanoide):
+//     ShaderVariants variants;
+//     variants.request(ShaderFeature::Projection | ShaderFeature::Instanced);
+//     GLuint program = variants.get(ShaderFeature::Projection | ShaderFeature::Instanced);
+//
+// Programas de uma fonte só (Listas), sem registro:
+//     std::string vs = shaderVariantSource(UBER_VERTEX_SHADER, ShaderFeature::VertexColor);
+
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <set>
+#include <string>
+
+#include "Assets.h"
+#include "EmbeddedShaders.h"
+#include "ShaderRegistry.h"
+#include "ShaderWatcher.h"
+
+#define UBER_VERTEX_SHADER "shaders/uber.vs"
+#define UBER_FRAGMENT_SHADER "shaders/uber.fs"
+
+namespace ShaderFeature {
+    enum : uint32_t {
+        None = 0,
+        VertexColor = 1 << 0,  // cor por vértice em location 1
+        Instanced = 1 << 1,    // deslocamento/escala/cor por instância em locations 2..4
+        SdfCircle = 1 << 2,    // quadrado unitário recortado em círculo no fragment shader
+        Scale = 1 << 3,        // uniform float scale
+        Projection = 1 << 4,   // uniform mat4 projection
+        Model = 1 << 5,        // uniform mat4 model
+        ScreenTexture = 1 << 6 // cor lida de uma textura do tamanho da tela, no pixel do próprio fragmento
+    };
+}
+
+// Linhas "#define" de uma combinação de features, em ordem fixa (faz parte da chave do cache)
+inline std::string shaderDefines(uint32_t features) {
+    static const char* const names[] = { "VERTEX_COLOR", "INSTANCED", "SDF_CIRCLE", "SCALE", "PROJECTION", "MODEL", "SCREEN_TEXTURE" };
+    std::string defines;
+    for (int bit = 0; bit < 7; ++bit) {
+        if (features & (1u << bit)) {
+            defines += "#define ";
+            defines += names[bit];
+            defines += '\n';
+        }
+    }
+    return defines;
+}
+
+// Fonte embutida já com os defines da variante; vazia se `path` não estiver embutido
+inline std::string shaderVariantSource(const char* path, uint32_t features) {
+    const EmbeddedShader* shader = findEmbeddedShader(path);
+    if (!shader) {
+        std::cout << "ERROR::SHADER::NOT_EMBEDDED " << path << std::endl;
+        return "";
+    }
+    return ShaderRegistry::withDefines(shader->source, shaderDefines(features));
+}
+
+class ShaderVariants {
+public:
+    // Com `watcher`, as variantes são lidas do disco (raiz de assets) e recompiladas quando
+    // o uber-shader muda; sem ele, usam as fontes embutidas.
+    explicit ShaderVariants(ShaderWatcher* watcher = nullptr) {
+        this->watcher = watcher;
+    }
+
+    // Dispara a compilação da variante, se ainda não foi pedida; não bloqueia
+    void request(uint32_t features) {
+        if (!requested.insert(features).second) {
+            return;
+        }
+        int id = static_cast<int>(features);
+        if (watcher) {
+            registry.requestFiles(id, assetPath(UBER_VERTEX_SHADER), assetPath(UBER_FRAGMENT_SHADER), shaderDefines(features));
+            watcher->watch(id, assetPath(UBER_VERTEX_SHADER));
+            watcher->watch(id, assetPath(UBER_FRAGMENT_SHADER));
+        } else {
+            registry.requestEmbedded(id, UBER_VERTEX_SHADER, UBER_FRAGMENT_SHADER, shaderDefines(features));
+        }
+    }
+
+    // Programa da variante; na primeira vez que uma variante é pedida aqui, compila e espera
+    GLuint get(uint32_t features) {
+        request(features);
+        return registry.get(static_cast<int>(features));
+    }
+
+    // Ids do ShaderWatcher são as próprias máscaras de features
+    void reload(int id) {
+        registry.reload(id);
+    }
+
+    bool poll() {
+        return registry.poll();
+    }
+
+    size_t size() const {
+        return requested.size();
+    }
+
+private:
+    ShaderRegistry registry;
+    ShaderWatcher* watcher;
+    std::set<uint32_t> requested;
+};
@@ -0,0 +1,113 @@
+// Observa arquivos de shader com inotify numa thread em segundo plano.
+// Só marca quais programas mudaram; quem recompila é a thread de render, no início
+// de um quadro, através do ShaderRegistry (que mantém o programa antigo se falhar).
+
+#pragma once
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+class ShaderWatcher {
+public:
+    ShaderWatcher() {
+        inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        stopFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    }
+
+    ~ShaderWatcher() {
+        stop();
+        if (inotifyFd >= 0) {
+            close(inotifyFd);
+        }
+        if (stopFd >= 0) {
+            close(stopFd);
+        }
+    }
+
+    // Associa um arquivo ao programa `id`. Observa o diretório, não o arquivo, porque
+    // a maioria dos editores salva escrevendo um arquivo novo e renomeando por cima.
+    void watch(int id, const std::string& path) {
+        if (inotifyFd < 0) {
+            return;
+        }
+        size_t slash = path.find_last_of('/');
+        std::string directory = slash == std::string::npos ? "." : path.substr(0, slash);
+        std::string name = slash == std::string::npos ? path : path.substr(slash + 1);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        int descriptor = inotify_add_watch(inotifyFd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+        if (descriptor >= 0) {
+            files[{ descriptor, name }].push_back(id);
+        }
+    }
+
+    void start() {
+        if (inotifyFd >= 0 && stopFd >= 0) {
+            thread = std::thread([this]() { watchLoop(); });
+        }
+    }
+
+    void stop() {
+        if (thread.joinable()) {
+            uint64_t one = 1;
+            ssize_t written = write(stopFd, &one, sizeof(one));
+            (void)written;
+            thread.join();
+        }
+    }
+
+    // Programas cujos arquivos mudaram desde a última chamada
+    std::set<int> takeChanged() {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::set<int> result;
+        result.swap(changed);
+        return result;
+    }
+
+private:
+    void watchLoop() {
+        alignas(inotify_event) char buffer[4096];
+        pollfd fds[2] = { { inotifyFd, POLLIN, 0 }, { stopFd, POLLIN, 0 } };
+
+        while (true) {
+            if (poll(fds, 2, -1) < 0) {
+                continue;
+            }
+            if (fds[1].revents & POLLIN) {
+                return;
+            }
+
+            ssize_t length;
+            while ((length = read(inotifyFd, buffer, sizeof(buffer))) > 0) {
+                std::lock_guard<std::mutex> lock(mutex);
+                for (char* cursor = buffer; cursor < buffer + length;) {
+                    inotify_event* event = reinterpret_cast<inotify_event*>(cursor);
+                    if (event->len > 0) {
+                        auto found = files.find({ event->wd, event->name });
+                        if (found != files.end()) {
+                            changed.insert(found->second.begin(), found->second.end());
+                        }
+                    }
+                    cursor += sizeof(inotify_event) + event->len;
+                }
+            }
+        }
+    }
+
+    int inotifyFd = -1;
+    int stopFd = -1;
+    std::thread thread;
+    std::mutex mutex;
+    std::map<std::pair<int, std::string>, std::vector<int>> files;
+    std::set<int> changed;
+};
@@ -0,0 +1,70 @@
+// Nível de SIMD dos kernels (colisão de blocos, integração das bolas), escolhido em
+// tempo de execução. Os kernels AVX são compilados com __attribute__((target(...))),
+// então o binário roda em qualquer x86-64 e só usa AVX2/AVX-512 se a CPU tiver.
+
+#pragma once
+
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define SIMD_X86
+#endif
+
+// Do mais simples ao mais largo; a comparação (<=) diz se um nível cabe em outro
+enum class SimdLevel {
+    Scalar,  // referência
+    Sse2,    // 4 floats por instrução
+    Avx2,    // 8
+    Avx512   // 16
+};
+
+inline const char* simdLevelName(SimdLevel level) {
+    switch (level) {
+    case SimdLevel::Sse2:
+        return "sse2";
+    case SimdLevel::Avx2:
+        return "avx2";
+    case SimdLevel::Avx512:
+        return "avx512";
+    case SimdLevel::Scalar:
+    default:
+        return "scalar";
+    }
+}
+
+// O melhor nível que a CPU suporta
+inline SimdLevel detectSimdLevel() {
+#ifdef SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return SimdLevel::Avx512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return SimdLevel::Avx2;
+    }
+    return SimdLevel::Sse2;
+#else
+    return SimdLevel::Scalar;
+#endif
+}
+
+// Nível usado pelo jogo: o detectado, ou um menor forçado com
+// ARKANOIDE_SIMD=scalar|sse2|avx2|avx512 (para comparar no bench)
+inline SimdLevel activeSimdLevel() {
+    static const SimdLevel level = []() {
+        SimdLevel detected = detectSimdLevel();
+        const char* forced = std::getenv("ARKANOIDE_SIMD");
+        if (!forced) {
+            return detected;
+        }
+        for (SimdLevel candidate : { SimdLevel::Scalar, SimdLevel::Sse2, SimdLevel::Avx2, SimdLevel::Avx512 }) {
+            if (std::strcmp(forced, simdLevelName(candidate)) == 0 && candidate <= detected) {
+                return candidate;
+            }
+        }
+        return detected;
+    }();
+    return level;
+}
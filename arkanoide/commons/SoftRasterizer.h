@@ -0,0 +1,737 @@
+// Rasterizador por software das primitivas que o repositório usa: GL_TRIANGLES,
+// GL_TRIANGLE_FAN, GL_LINE_STRIP/GL_LINE_LOOP e GL_POINTS, com cor sólida ou por vértice,
+// mais os quadrados e círculos instanciados do jogo. Serve para rodar o jogo e as cenas do
+// bench sem GPU nem Mesa (SoftwareRenderer, bench --software).
+//
+// O quadro fica na memória, em RGBA8 com o vermelho no byte mais baixo e a linha 0 embaixo,
+// como no GL. Desenhar só monta as primitivas (já em pixels) e as distribui em tiles de
+// TILE x TILE pelas caixas que ocupam; finish() rasteriza os tiles em paralelo no JobSystem,
+// cada job pegando o próximo tile livre. Dentro de um tile as primitivas são aplicadas na ordem em
+// que foram desenhadas, então o quadro não depende do número de threads. Só uma thread
+// desenha (a dona, como um contexto GL); com muitas primitivas, elas são rasterizadas em
+// lotes de MAX_BATCH, para a memória não crescer com a cena.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "CommandBuffer.h"
+#include "JobSystem.h"
+#include "Profiler.h"
+#include "Simd.h"
+
+enum class SoftPrimitive {
+    Triangles,
+    TriangleFan,
+    LineStrip,
+    LineLoop,
+    Points
+};
+
+// Cor 0..1 no formato do quadro (o mesmo de PointVertex::color)
+inline uint32_t softColor(glm::vec3 color) {
+    glm::vec3 clamped = glm::clamp(color, glm::vec3(0.0f), glm::vec3(1.0f));
+    uint32_t r = static_cast<uint32_t>(clamped.x * 255.0f + 0.5f);
+    uint32_t g = static_cast<uint32_t>(clamped.y * 255.0f + 0.5f);
+    uint32_t b = static_cast<uint32_t>(clamped.z * 255.0f + 0.5f);
+    return r | (g << 8) | (b << 16) | (0xFFu << 24);
+}
+
+// Triângulo em pixels, já no sentido anti-horário. w_i(x, y) = a_i x + b_i y + c_i é a
+// função da aresta oposta ao vértice i: positiva dentro, e w0 + w1 + w2 = 2 * área.
+struct SoftTriangle {
+    float a[3], b[3], c[3];
+    float inverseA[3];               // 1 / a_i (0 nas arestas horizontais), para clipSpan
+    uint32_t topLeft[3];             // ~0u se os pixels exatamente sobre a aresta são pintados
+    float red[3], green[3], blue[3]; // cor de cada vértice, 0..1 (só com smooth)
+    float scale;                     // 255 / (w0 + w1 + w2)
+    uint32_t color;                  // cor sólida (sem smooth)
+    bool smooth;
+    int x0, y0, x1, y1;              // pixels cobertos possíveis: [x0, x1) x [y0, y1)
+};
+
+// Retângulo alinhado aos eixos (Mesh::Quad sólido, pontos)
+struct SoftRect {
+    int x0, y0, x1, y1;
+    uint32_t color;
+};
+
+// Mesh::Quad recortado em elipse, como Program::Circle: ((x - cx) * invRx)² + ((y - cy) * invRy)² <= 1
+struct SoftDisc {
+    float cx, cy, invRx, invRy;
+    int x0, y0, x1, y1;
+    uint32_t color;
+};
+
+// --- Kernels de uma linha de um triângulo ---
+//
+// Os pixels de um tile são avaliados a partir do centro do primeiro pixel da linha no tile
+// (w = w(origem) + a * dx), na mesma ordem de operações em todos os níveis e sem FMA: o
+// quadro é bit a bit o mesmo em escalar, SSE2 e AVX2. Como as duas faces de uma aresta
+// compartilhada calculam exatamente -w uma da outra, a regra top-left decide sozinha os
+// pixels sobre ela.
+
+#ifndef __clang__
+#pragma GCC push_options
+#pragma GCC optimize("fp-contract=off")
+#endif
+
+inline float softEdge(const SoftTriangle& triangle, int i, float x, float y) {
+    return triangle.a[i] * x + triangle.b[i] * y + triangle.c[i];
+}
+
+inline bool softCovered(float w, uint32_t topLeft) {
+    return w > 0.0f || (w == 0.0f && topLeft != 0);
+}
+
+inline uint32_t softChannel(const float* color, float w0, float w1, float w2, float scale) {
+    float value = (w0 * color[0] + w1 * color[1] + w2 * color[2]) * scale;
+    value = std::min(std::max(value, 0.0f), 255.0f);
+    return static_cast<uint32_t>(value + 0.5f);
+}
+
+// Pixels [from, to) da linha de centro y; originX é a primeira coluna do tile
+inline void softTriangleSpanScalar(const SoftTriangle& triangle, float y, int originX, int from, int to, uint32_t* row) {
+    float origin = static_cast<float>(originX) + 0.5f;
+    float e0 = softEdge(triangle, 0, origin, y);
+    float e1 = softEdge(triangle, 1, origin, y);
+    float e2 = softEdge(triangle, 2, origin, y);
+    for (int x = from; x < to; ++x) {
+        float dx = static_cast<float>(x - originX);
+        float w0 = e0 + triangle.a[0] * dx;
+        float w1 = e1 + triangle.a[1] * dx;
+        float w2 = e2 + triangle.a[2] * dx;
+        if (!softCovered(w0, triangle.topLeft[0]) || !softCovered(w1, triangle.topLeft[1]) || !softCovered(w2, triangle.topLeft[2])) {
+            continue;
+        }
+        if (!triangle.smooth) {
+            row[x] = triangle.color;
+            continue;
+        }
+        uint32_t r = softChannel(triangle.red, w0, w1, w2, triangle.scale);
+        uint32_t g = softChannel(triangle.green, w0, w1, w2, triangle.scale);
+        uint32_t b = softChannel(triangle.blue, w0, w1, w2, triangle.scale);
+        row[x] = r | (g << 8) | (b << 16) | (0xFFu << 24);
+    }
+}
+
+#ifdef SIMD_X86
+
+inline __m128 softCoveredSse2(__m128 w, __m128 topLeft) {
+    __m128 zero = _mm_setzero_ps();
+    return _mm_or_ps(_mm_cmpgt_ps(w, zero), _mm_and_ps(_mm_cmpeq_ps(w, zero), topLeft));
+}
+
+inline __m128i softChannelSse2(const float* color, __m128 w0, __m128 w1, __m128 w2, __m128 scale) {
+    __m128 value = _mm_add_ps(_mm_add_ps(_mm_mul_ps(w0, _mm_set1_ps(color[0])), _mm_mul_ps(w1, _mm_set1_ps(color[1]))),
+                              _mm_mul_ps(w2, _mm_set1_ps(color[2])));
+    value = _mm_mul_ps(value, scale);
+    value = _mm_min_ps(_mm_max_ps(value, _mm_setzero_ps()), _mm_set1_ps(255.0f));
+    return _mm_cvttps_epi32(_mm_add_ps(value, _mm_set1_ps(0.5f)));
+}
+
+inline void softTriangleSpanSse2(const SoftTriangle& triangle, float y, int originX, int from, int to, uint32_t* row) {
+    float origin = static_cast<float>(originX) + 0.5f;
+    const __m128 e0 = _mm_set1_ps(softEdge(triangle, 0, origin, y));
+    const __m128 e1 = _mm_set1_ps(softEdge(triangle, 1, origin, y));
+    const __m128 e2 = _mm_set1_ps(softEdge(triangle, 2, origin, y));
+    const __m128 a0 = _mm_set1_ps(triangle.a[0]);
+    const __m128 a1 = _mm_set1_ps(triangle.a[1]);
+    const __m128 a2 = _mm_set1_ps(triangle.a[2]);
+    const __m128 topLeft0 = _mm_castsi128_ps(_mm_set1_epi32(static_cast<int>(triangle.topLeft[0])));
+    const __m128 topLeft1 = _mm_castsi128_ps(_mm_set1_epi32(static_cast<int>(triangle.topLeft[1])));
+    const __m128 topLeft2 = _mm_castsi128_ps(_mm_set1_epi32(static_cast<int>(triangle.topLeft[2])));
+    const __m128 scale = _mm_set1_ps(triangle.scale);
+    const __m128 lanes = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+    const __m128i alpha = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+    const __m128i flat = _mm_set1_epi32(static_cast<int>(triangle.color));
+
+    int x = from;
+    for (; x + 4 <= to; x += 4) {
+        __m128 dx = _mm_add_ps(_mm_set1_ps(static_cast<float>(x - originX)), lanes);
+        __m128 w0 = _mm_add_ps(e0, _mm_mul_ps(a0, dx));
+        __m128 w1 = _mm_add_ps(e1, _mm_mul_ps(a1, dx));
+        __m128 w2 = _mm_add_ps(e2, _mm_mul_ps(a2, dx));
+        __m128 inside = _mm_and_ps(_mm_and_ps(softCoveredSse2(w0, topLeft0), softCoveredSse2(w1, topLeft1)), softCoveredSse2(w2, topLeft2));
+        if (_mm_movemask_ps(inside) == 0) {
+            continue;
+        }
+        __m128i color = flat;
+        if (triangle.smooth) {
+            __m128i r = softChannelSse2(triangle.red, w0, w1, w2, scale);
+            __m128i g = softChannelSse2(triangle.green, w0, w1, w2, scale);
+            __m128i b = softChannelSse2(triangle.blue, w0, w1, w2, scale);
+            color = _mm_or_si128(_mm_or_si128(r, _mm_slli_epi32(g, 8)), _mm_or_si128(_mm_slli_epi32(b, 16), alpha));
+        }
+        __m128i mask = _mm_castps_si128(inside);
+        __m128i* pixels = reinterpret_cast<__m128i*>(row + x);
+        __m128i old = _mm_loadu_si128(pixels);
+        _mm_storeu_si128(pixels, _mm_or_si128(_mm_and_si128(mask, color), _mm_andnot_si128(mask, old)));
+    }
+    softTriangleSpanScalar(triangle, y, originX, x, to, row);
+}
+
+__attribute__((target("avx2")))
+inline __m256 softCoveredAvx2(__m256 w, __m256 topLeft) {
+    __m256 zero = _mm256_setzero_ps();
+    return _mm256_or_ps(_mm256_cmp_ps(w, zero, _CMP_GT_OQ), _mm256_and_ps(_mm256_cmp_ps(w, zero, _CMP_EQ_OQ), topLeft));
+}
+
+__attribute__((target("avx2")))
+inline __m256i softChannelAvx2(const float* color, __m256 w0, __m256 w1, __m256 w2, __m256 scale) {
+    __m256 value = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(w0, _mm256_set1_ps(color[0])), _mm256_mul_ps(w1, _mm256_set1_ps(color[1]))),
+                                 _mm256_mul_ps(w2, _mm256_set1_ps(color[2])));
+    value = _mm256_mul_ps(value, scale);
+    value = _mm256_min_ps(_mm256_max_ps(value, _mm256_setzero_ps()), _mm256_set1_ps(255.0f));
+    return _mm256_cvttps_epi32(_mm256_add_ps(value, _mm256_set1_ps(0.5f)));
+}
+
+__attribute__((target("avx2")))
+inline void softTriangleSpanAvx2(const SoftTriangle& triangle, float y, int originX, int from, int to, uint32_t* row) {
+    float origin = static_cast<float>(originX) + 0.5f;
+    const __m256 e0 = _mm256_set1_ps(softEdge(triangle, 0, origin, y));
+    const __m256 e1 = _mm256_set1_ps(softEdge(triangle, 1, origin, y));
+    const __m256 e2 = _mm256_set1_ps(softEdge(triangle, 2, origin, y));
+    const __m256 a0 = _mm256_set1_ps(triangle.a[0]);
+    const __m256 a1 = _mm256_set1_ps(triangle.a[1]);
+    const __m256 a2 = _mm256_set1_ps(triangle.a[2]);
+    const __m256 topLeft0 = _mm256_castsi256_ps(_mm256_set1_epi32(static_cast<int>(triangle.topLeft[0])));
+    const __m256 topLeft1 = _mm256_castsi256_ps(_mm256_set1_epi32(static_cast<int>(triangle.topLeft[1])));
+    const __m256 topLeft2 = _mm256_castsi256_ps(_mm256_set1_epi32(static_cast<int>(triangle.topLeft[2])));
+    const __m256 scale = _mm256_set1_ps(triangle.scale);
+    const __m256 lanes = _mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f);
+    const __m256i alpha = _mm256_set1_epi32(static_cast<int>(0xFF000000u));
+    const __m256i flat = _mm256_set1_epi32(static_cast<int>(triangle.color));
+
+    int x = from;
+    for (; x + 8 <= to; x += 8) {
+        __m256 dx = _mm256_add_ps(_mm256_set1_ps(static_cast<float>(x - originX)), lanes);
+        __m256 w0 = _mm256_add_ps(e0, _mm256_mul_ps(a0, dx));
+        __m256 w1 = _mm256_add_ps(e1, _mm256_mul_ps(a1, dx));
+        __m256 w2 = _mm256_add_ps(e2, _mm256_mul_ps(a2, dx));
+        __m256 inside = _mm256_and_ps(_mm256_and_ps(softCoveredAvx2(w0, topLeft0), softCoveredAvx2(w1, topLeft1)), softCoveredAvx2(w2, topLeft2));
+        if (_mm256_movemask_ps(inside) == 0) {
+            continue;
+        }
+        __m256i color = flat;
+        if (triangle.smooth) {
+            __m256i r = softChannelAvx2(triangle.red, w0, w1, w2, scale);
+            __m256i g = softChannelAvx2(triangle.green, w0, w1, w2, scale);
+            __m256i b = softChannelAvx2(triangle.blue, w0, w1, w2, scale);
+            color = _mm256_or_si256(_mm256_or_si256(r, _mm256_slli_epi32(g, 8)), _mm256_or_si256(_mm256_slli_epi32(b, 16), alpha));
+        }
+        __m256i* pixels = reinterpret_cast<__m256i*>(row + x);
+        __m256i old = _mm256_loadu_si256(pixels);
+        _mm256_storeu_si256(pixels, _mm256_blendv_epi8(old, color, _mm256_castps_si256(inside)));
+    }
+    softTriangleSpanScalar(triangle, y, originX, x, to, row);
+}
+
+#endif
+
+#ifndef __clang__
+#pragma GCC pop_options
+#endif
+
+class SoftRasterizer {
+public:
+    static constexpr int TILE = 64;
+    // Primitivas montadas antes de rasterizar um lote
+    static constexpr int MAX_BATCH = 1 << 16;
+
+    // Sem `jobs`, rasteriza só na thread que chama finish(). AVX-512 usa o kernel AVX2: uma
+    // linha de tile tem só 64 pixels.
+    explicit SoftRasterizer(JobSystem* jobs = nullptr, SimdLevel level = activeSimdLevel()) : jobs(jobs) {
+        this->level = std::min(level, SimdLevel::Avx2);
+        switch (this->level) {
+#ifdef SIMD_X86
+        case SimdLevel::Avx2:
+            span = softTriangleSpanAvx2;
+            break;
+        case SimdLevel::Sse2:
+            span = softTriangleSpanSse2;
+            break;
+#endif
+        default:
+            this->level = SimdLevel::Scalar;
+            span = softTriangleSpanScalar;
+            break;
+        }
+    }
+
+    // Descarta o conteúdo; não pode ser chamado entre clear() e finish()
+    void resize(int width, int height) {
+        if (width == this->width && height == this->height) {
+            return;
+        }
+        this->width = std::max(width, 0);
+        this->height = std::max(height, 0);
+        pixels.assign(static_cast<size_t>(this->width) * this->height, 0);
+        tilesX = (this->width + TILE - 1) / TILE;
+        tilesY = (this->height + TILE - 1) / TILE;
+        bins.assign(static_cast<size_t>(tilesX) * tilesY, std::vector<uint32_t>());
+    }
+
+    int getWidth() const {
+        return width;
+    }
+
+    int getHeight() const {
+        return height;
+    }
+
+    int getThreads() const {
+        return jobs ? jobs->size() : 1;
+    }
+
+    SimdLevel getSimdLevel() const {
+        return level;
+    }
+
+    // Largura das linhas em pixels (glLineWidth); as linhas viram retângulos dessa largura
+    void setLineWidth(float lineWidth) {
+        this->lineWidth = lineWidth;
+    }
+
+    // Lado dos pontos em pixels (glPointSize)
+    void setPointSize(float pointSize) {
+        this->pointSize = pointSize;
+    }
+
+    // Começa um quadro; a tela só é limpa no finish(), tile a tile, junto com o resto
+    void clear(uint32_t color) {
+        clearColor = color;
+        clearPending = true;
+    }
+
+    // Vértices em coordenadas de tela (-1..1), uma cor para tudo
+    void draw(SoftPrimitive primitive, const glm::vec2* positions, int count, glm::vec3 color) {
+        assemble(primitive, positions, nullptr, count, softColor(color));
+    }
+
+    // Uma cor por vértice, interpolada nos triângulos e nas linhas
+    void draw(SoftPrimitive primitive, const glm::vec2* positions, const glm::vec3* colors, int count) {
+        assemble(primitive, positions, colors, count, 0);
+    }
+
+    // Mesh::Quad com Program::Flat: o quadrado unitário escalado e deslocado
+    void drawRect(glm::vec2 center, glm::vec2 scale, glm::vec3 color) {
+        SoftRect rect;
+        if (quadBounds(center, scale, rect.x0, rect.y0, rect.x1, rect.y1)) {
+            rect.color = softColor(color);
+            addRect(rect);
+        }
+    }
+
+    // Mesh::Quad com Program::Circle: a elipse inscrita no quadrado
+    void drawDisc(glm::vec2 center, glm::vec2 scale, glm::vec3 color) {
+        SoftDisc disc;
+        if (!quadBounds(center, scale, disc.x0, disc.y0, disc.x1, disc.y1)) {
+            return;
+        }
+        glm::vec2 pixelCenter = toPixels(center);
+        disc.cx = pixelCenter.x;
+        disc.cy = pixelCenter.y;
+        disc.invRx = 1.0f / (0.25f * scale.x * width);
+        disc.invRy = 1.0f / (0.25f * scale.y * height);
+        disc.color = softColor(color);
+        if (discs.size() >= static_cast<size_t>(MAX_BATCH)) {
+            rasterize();
+        }
+        discs.push_back(disc);
+        bin(DISC, static_cast<uint32_t>(discs.size() - 1), disc.x0, disc.y0, disc.x1, disc.y1);
+    }
+
+    // Partículas já compactadas (GL_POINTS com cor RGBA8)
+    void drawPoints(const PointVertex* points, int count) {
+        for (int i = 0; i < count; ++i) {
+            addPoint(toPixels(points[i].position), points[i].color);
+        }
+    }
+
+    // Rasteriza o que falta do quadro e bloqueia até o último tile
+    void finish() {
+        rasterize();
+    }
+
+    const uint32_t* getPixels() const {
+        return pixels.data();
+    }
+
+    // Imagem PPM binária, de cima para baixo; false se o arquivo não puder ser escrito
+    bool writePpm(const std::string& path) const {
+        std::ofstream file(path, std::ios::binary);
+        if (!file) {
+            return false;
+        }
+        file << "P6\n" << width << " " << height << "\n255\n";
+        std::vector<char> line(static_cast<size_t>(width) * 3);
+        for (int y = height - 1; y >= 0; --y) {
+            const uint32_t* row = pixels.data() + static_cast<size_t>(y) * width;
+            for (int x = 0; x < width; ++x) {
+                line[x * 3] = static_cast<char>(row[x] & 0xFF);
+                line[x * 3 + 1] = static_cast<char>((row[x] >> 8) & 0xFF);
+                line[x * 3 + 2] = static_cast<char>((row[x] >> 16) & 0xFF);
+            }
+            file.write(line.data(), static_cast<std::streamsize>(line.size()));
+        }
+        return static_cast<bool>(file);
+    }
+
+private:
+    // Entrada de um tile: o tipo nos 2 bits de cima, o índice no vetor do tipo no resto
+    static constexpr uint32_t TRIANGLE = 0;
+    static constexpr uint32_t RECT = 1;
+    static constexpr uint32_t DISC = 2;
+    static constexpr int KIND_SHIFT = 30;
+    static constexpr uint32_t INDEX_MASK = (1u << KIND_SHIFT) - 1;
+
+    using SpanKernel = void (*)(const SoftTriangle&, float, int, int, int, uint32_t*);
+
+    glm::vec2 toPixels(glm::vec2 position) const {
+        return glm::vec2((position.x + 1.0f) * 0.5f * width, (position.y + 1.0f) * 0.5f * height);
+    }
+
+    // Primeiro pixel com o centro em >= edge, e o primeiro com o centro em > edge, limitados
+    // à tela
+    static int firstCenterAtOrAfter(float edge, int limit) {
+        float pixel = std::ceil(edge - 0.5f);
+        return static_cast<int>(std::min(std::max(pixel, 0.0f), static_cast<float>(limit)));
+    }
+
+    static int firstCenterAfter(float edge, int limit) {
+        float pixel = std::floor(edge - 0.5f) + 1.0f;
+        return static_cast<int>(std::min(std::max(pixel, 0.0f), static_cast<float>(limit)));
+    }
+
+    // Pixels de um retângulo alinhado com a regra dos dois triângulos de Mesh::Quad: a
+    // aresta esquerda e a de cima pintam, a direita e a de baixo não
+    bool pixelBounds(glm::vec2 low, glm::vec2 high, int& x0, int& y0, int& x1, int& y1) const {
+        x0 = firstCenterAtOrAfter(low.x, width);
+        x1 = firstCenterAtOrAfter(high.x, width);
+        y0 = firstCenterAfter(low.y, height);
+        y1 = firstCenterAfter(high.y, height);
+        return x0 < x1 && y0 < y1;
+    }
+
+    bool quadBounds(glm::vec2 center, glm::vec2 scale, int& x0, int& y0, int& x1, int& y1) const {
+        glm::vec2 half = 0.5f * glm::abs(scale);
+        return pixelBounds(toPixels(center - half), toPixels(center + half), x0, y0, x1, y1);
+    }
+
+    void assemble(SoftPrimitive primitive, const glm::vec2* positions, const glm::vec3* colors, int count, uint32_t color) {
+        auto vertexColor = [colors](int i) { return colors ? colors + i : nullptr; };
+        switch (primitive) {
+        case SoftPrimitive::Triangles:
+            for (int i = 0; i + 2 < count; i += 3) {
+                addTriangle(toPixels(positions[i]), toPixels(positions[i + 1]), toPixels(positions[i + 2]),
+                            vertexColor(i), vertexColor(i + 1), vertexColor(i + 2), color);
+            }
+            break;
+        case SoftPrimitive::TriangleFan: {
+            if (count < 3) {
+                break;
+            }
+            glm::vec2 center = toPixels(positions[0]);
+            for (int i = 1; i + 1 < count; ++i) {
+                addTriangle(center, toPixels(positions[i]), toPixels(positions[i + 1]), vertexColor(0), vertexColor(i), vertexColor(i + 1), color);
+            }
+            break;
+        }
+        case SoftPrimitive::LineStrip:
+        case SoftPrimitive::LineLoop:
+            for (int i = 0; i + 1 < count; ++i) {
+                addLine(toPixels(positions[i]), toPixels(positions[i + 1]), vertexColor(i), vertexColor(i + 1), color);
+            }
+            if (primitive == SoftPrimitive::LineLoop && count > 1) {
+                addLine(toPixels(positions[count - 1]), toPixels(positions[0]), vertexColor(count - 1), vertexColor(0), color);
+            }
+            break;
+        case SoftPrimitive::Points:
+            for (int i = 0; i < count; ++i) {
+                addPoint(toPixels(positions[i]), colors ? softColor(colors[i]) : color);
+            }
+            break;
+        }
+    }
+
+    // Sem cores por vértice (c0 nulo), o triângulo é da cor `color`
+    void addTriangle(glm::vec2 p0, glm::vec2 p1, glm::vec2 p2, const glm::vec3* c0, const glm::vec3* c1, const glm::vec3* c2, uint32_t color) {
+        float area = (p1.x - p0.x) * (p2.y - p0.y) - (p2.x - p0.x) * (p1.y - p0.y);
+        if (!(area != 0.0f) || !std::isfinite(area)) {
+            return; // degenerado: não cobre nenhum pixel
+        }
+        // Sem descarte de faces, como o GL por padrão: tudo vira anti-horário
+        if (area < 0.0f) {
+            std::swap(p1, p2);
+            std::swap(c1, c2);
+            area = -area;
+        }
+
+        // Caixa com os centros sobre as quatro bordas: quem decide esses pixels são as arestas
+        SoftTriangle triangle;
+        glm::vec2 low = glm::min(glm::min(p0, p1), p2);
+        glm::vec2 high = glm::max(glm::max(p0, p1), p2);
+        triangle.x0 = firstCenterAtOrAfter(low.x, width);
+        triangle.y0 = firstCenterAtOrAfter(low.y, height);
+        triangle.x1 = firstCenterAfter(high.x, width);
+        triangle.y1 = firstCenterAfter(high.y, height);
+        if (triangle.x0 >= triangle.x1 || triangle.y0 >= triangle.y1) {
+            return;
+        }
+
+        const glm::vec2 points[3] = { p0, p1, p2 };
+        for (int i = 0; i < 3; ++i) {
+            glm::vec2 from = points[(i + 1) % 3];
+            glm::vec2 to = points[(i + 2) % 3];
+            triangle.a[i] = from.y - to.y;
+            triangle.b[i] = to.x - from.x;
+            triangle.c[i] = from.x * to.y - from.y * to.x;
+            triangle.inverseA[i] = triangle.a[i] != 0.0f ? 1.0f / triangle.a[i] : 0.0f;
+            // Aresta esquerda (descendo) ou de cima (horizontal, indo para a esquerda)
+            bool topLeft = triangle.a[i] > 0.0f || (triangle.a[i] == 0.0f && triangle.b[i] < 0.0f);
+            triangle.topLeft[i] = topLeft ? ~0u : 0u;
+        }
+        triangle.scale = 255.0f / area;
+        triangle.color = color;
+        triangle.smooth = c0 != nullptr;
+        if (triangle.smooth) {
+            const glm::vec3* colors[3] = { c0, c1, c2 };
+            for (int i = 0; i < 3; ++i) {
+                triangle.red[i] = colors[i]->x;
+                triangle.green[i] = colors[i]->y;
+                triangle.blue[i] = colors[i]->z;
+            }
+        }
+
+        if (triangles.size() >= static_cast<size_t>(MAX_BATCH)) {
+            rasterize();
+        }
+        triangles.push_back(triangle);
+        binTriangle(static_cast<uint32_t>(triangles.size() - 1));
+    }
+
+    // Linha como o retângulo de largura lineWidth em volta do segmento (dois triângulos)
+    void addLine(glm::vec2 from, glm::vec2 to, const glm::vec3* fromColor, const glm::vec3* toColor, uint32_t color) {
+        glm::vec2 direction = to - from;
+        float length = glm::length(direction);
+        if (!(length > 0.0f)) {
+            return;
+        }
+        glm::vec2 normal = glm::vec2(-direction.y, direction.x) * (0.5f * lineWidth / length);
+        addTriangle(from - normal, to - normal, to + normal, fromColor, toColor, toColor, color);
+        addTriangle(from - normal, to + normal, from + normal, fromColor, toColor, fromColor, color);
+    }
+
+    void addPoint(glm::vec2 position, uint32_t color) {
+        SoftRect rect;
+        glm::vec2 half(0.5f * pointSize);
+        if (pixelBounds(position - half, position + half, rect.x0, rect.y0, rect.x1, rect.y1)) {
+            rect.color = color;
+            addRect(rect);
+        }
+    }
+
+    void addRect(const SoftRect& rect) {
+        if (rects.size() >= static_cast<size_t>(MAX_BATCH)) {
+            rasterize();
+        }
+        rects.push_back(rect);
+        bin(RECT, static_cast<uint32_t>(rects.size() - 1), rect.x0, rect.y0, rect.x1, rect.y1);
+    }
+
+    void bin(uint32_t kind, uint32_t index, int x0, int y0, int x1, int y1) {
+        uint32_t entry = (kind << KIND_SHIFT) | index;
+        for (int ty = y0 / TILE; ty <= (y1 - 1) / TILE; ++ty) {
+            for (int tx = x0 / TILE; tx <= (x1 - 1) / TILE; ++tx) {
+                bins[static_cast<size_t>(ty) * tilesX + tx].push_back(entry);
+            }
+        }
+    }
+
+    // Só os tiles da caixa que o triângulo toca de fato: um tile fica de fora se estiver
+    // inteiro do lado de fora de alguma aresta (triângulos finos e compridos, como as
+    // linhas da espiral, cruzam a caixa na diagonal)
+    void binTriangle(uint32_t index) {
+        const SoftTriangle& triangle = triangles[index];
+        uint32_t entry = (TRIANGLE << KIND_SHIFT) | index;
+        int tx0 = triangle.x0 / TILE;
+        int tx1 = (triangle.x1 - 1) / TILE;
+        int ty0 = triangle.y0 / TILE;
+        int ty1 = (triangle.y1 - 1) / TILE;
+        bool single = tx0 == tx1 && ty0 == ty1;
+        for (int ty = ty0; ty <= ty1; ++ty) {
+            for (int tx = tx0; tx <= tx1; ++tx) {
+                if (!single && !touchesTile(triangle, tx, ty)) {
+                    continue;
+                }
+                bins[static_cast<size_t>(ty) * tilesX + tx].push_back(entry);
+            }
+        }
+    }
+
+    static bool touchesTile(const SoftTriangle& triangle, int tx, int ty) {
+        float left = static_cast<float>(tx * TILE);
+        float bottom = static_cast<float>(ty * TILE);
+        float right = left + TILE;
+        float top = bottom + TILE;
+        for (int i = 0; i < 3; ++i) {
+            // Canto do tile onde a aresta é maior
+            float x = triangle.a[i] > 0.0f ? right : left;
+            float y = triangle.b[i] > 0.0f ? top : bottom;
+            if (softEdge(triangle, i, x, y) < 0.0f) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Rasteriza os tiles com o que foi montado até aqui e esvazia os lotes
+    void rasterize() {
+        if (!clearPending && triangles.empty() && rects.empty() && discs.empty()) {
+            return;
+        }
+        PROFILE_SCOPE("rasterize");
+        nextTile.store(0);
+        if (jobs) {
+            // Um job por thread; os tiles são divididos pelo contador, não pelo parallelFor
+            jobs->parallelFor(0, jobs->size(), 1, [this](int, int) { rasterizeTiles(); });
+        } else {
+            rasterizeTiles();
+        }
+
+        clearPending = false;
+        triangles.clear();
+        rects.clear();
+        discs.clear();
+        for (auto& tile : bins) {
+            tile.clear();
+        }
+    }
+
+    void rasterizeTiles() {
+        int count = tilesX * tilesY;
+        for (int tile = nextTile.fetch_add(1); tile < count; tile = nextTile.fetch_add(1)) {
+            rasterizeTile(tile);
+        }
+    }
+
+    // Estreita [from, to) em volta de onde as arestas cruzam a linha, para triângulos finos
+    // (as fatias de um leque) não varrerem a caixa inteira. A folga cobre o arredondamento
+    // de w, que cresce quando a aresta é quase horizontal; quem decide os pixels continua
+    // sendo o kernel, então o resultado é o mesmo.
+    static bool clipSpan(const SoftTriangle& triangle, float y, int originX, int& from, int& to) {
+        float origin = static_cast<float>(originX) + 0.5f;
+        for (int i = 0; i < 3; ++i) {
+            float w = softEdge(triangle, i, origin, y);
+            float a = triangle.a[i];
+            if (a == 0.0f) {
+                // Aresta horizontal: w é o mesmo na linha inteira
+                if (w < 0.0f) {
+                    return false;
+                }
+                continue;
+            }
+            float inverse = std::fabs(triangle.inverseA[i]);
+            float margin = 2.0f + (std::fabs(w) * inverse + TILE) * 1e-6f;
+            float crossing = -w * triangle.inverseA[i];
+            if (a > 0.0f) {
+                float first = std::max(std::floor(crossing - margin), -1.0f);
+                from = std::max(from, originX + static_cast<int>(std::min(first, static_cast<float>(TILE))));
+            } else {
+                float last = std::min(std::ceil(crossing + margin), static_cast<float>(TILE + 1));
+                to = std::min(to, originX + static_cast<int>(std::max(last, -1.0f)));
+            }
+        }
+        return from < to;
+    }
+
+    void rasterizeTile(int tile) {
+        int left = (tile % tilesX) * TILE;
+        int bottom = (tile / tilesX) * TILE;
+        int right = std::min(left + TILE, width);
+        int top = std::min(bottom + TILE, height);
+        if (clearPending) {
+            for (int y = bottom; y < top; ++y) {
+                uint32_t* row = pixels.data() + static_cast<size_t>(y) * width;
+                std::fill(row + left, row + right, clearColor);
+            }
+        }
+
+        for (uint32_t entry : bins[tile]) {
+            uint32_t index = entry & INDEX_MASK;
+            switch (entry >> KIND_SHIFT) {
+            case TRIANGLE: {
+                const SoftTriangle& triangle = triangles[index];
+                int x0 = std::max(triangle.x0, left);
+                int x1 = std::min(triangle.x1, right);
+                for (int y = std::max(triangle.y0, bottom); y < std::min(triangle.y1, top); ++y) {
+                    float centerY = static_cast<float>(y) + 0.5f;
+                    int from = x0;
+                    int to = x1;
+                    if (clipSpan(triangle, centerY, left, from, to)) {
+                        span(triangle, centerY, left, from, to, pixels.data() + static_cast<size_t>(y) * width);
+                    }
+                }
+                break;
+            }
+            case RECT: {
+                const SoftRect& rect = rects[index];
+                int x0 = std::max(rect.x0, left);
+                int x1 = std::min(rect.x1, right);
+                for (int y = std::max(rect.y0, bottom); y < std::min(rect.y1, top); ++y) {
+                    uint32_t* row = pixels.data() + static_cast<size_t>(y) * width;
+                    std::fill(row + x0, row + x1, rect.color);
+                }
+                break;
+            }
+            case DISC: {
+                const SoftDisc& disc = discs[index];
+                int x0 = std::max(disc.x0, left);
+                int x1 = std::min(disc.x1, right);
+                for (int y = std::max(disc.y0, bottom); y < std::min(disc.y1, top); ++y) {
+                    uint32_t* row = pixels.data() + static_cast<size_t>(y) * width;
+                    float dy = (static_cast<float>(y) + 0.5f - disc.cy) * disc.invRy;
+                    for (int x = x0; x < x1; ++x) {
+                        float dx = (static_cast<float>(x) + 0.5f - disc.cx) * disc.invRx;
+                        if (dx * dx + dy * dy <= 1.0f) {
+                            row[x] = disc.color;
+                        }
+                    }
+                }
+                break;
+            }
+            }
+        }
+    }
+
+    SimdLevel level;
+    SpanKernel span;
+
+    int width = 0;
+    int height = 0;
+    std::vector<uint32_t> pixels;
+    int tilesX = 0;
+    int tilesY = 0;
+    float lineWidth = 1.0f;
+    float pointSize = 1.0f;
+    uint32_t clearColor = 0;
+    bool clearPending = false;
+
+    // O lote atual; cada tile lista as primitivas que o tocam, em ordem de desenho
+    std::vector<SoftTriangle> triangles;
+    std::vector<SoftRect> rects;
+    std::vector<SoftDisc> discs;
+    std::vector<std::vector<uint32_t>> bins;
+
+    JobSystem* jobs;
+    std::atomic<int> nextTile{ 0 };
+};
@@ -0,0 +1,172 @@
+// Renderer sem GPU: recebe os mesmos quadros (Frame) que o Renderer, na sua própria thread,
+// e os desenha num SoftRasterizer; o quadro pronto fica na memória do rasterizador. Serve
+// para rodar o jogo onde não há GPU nem Mesa (bench --software).
+//
+// A camada dos blocos vira uma cópia na CPU atualizada pelos mesmos trechos de
+// LayerUpdate. Não há cache de camadas nem quadros parciais: os blocos custam um
+// retângulo cada, que o rasterizador já divide entre as threads por tile. O HUD (F3) é
+// desenhado com GL e não existe aqui.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "CommandBuffer.h"
+#include "Profiler.h"
+#include "RenderBackend.h"
+#include "SoftRasterizer.h"
+
+class SoftwareRenderer : public RenderBackend {
+public:
+    // Os mesmos de glLineWidth/glPointSize no Renderer
+    static constexpr float LINE_WIDTH = 3.0f;
+    static constexpr float POINT_SIZE = 2.0f;
+    static constexpr uint32_t CLEAR_COLOR = 0xFF000000u;
+
+    // Entre start() e stop() só a thread de render usa o rasterizador
+    SoftwareRenderer(SoftRasterizer& rasterizer, int width, int height) : rasterizer(rasterizer) {
+        this->width = width;
+        this->height = height;
+    }
+
+    ~SoftwareRenderer() override {
+        stop();
+    }
+
+    void start() override {
+        running = true;
+        thread = std::thread([this]() { renderLoop(); });
+    }
+
+    void stop() override {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!running) {
+                return;
+            }
+            running = false;
+        }
+        frameReady.notify_all();
+        slotFree.notify_all();
+        thread.join();
+    }
+
+    // Mesma troca do Renderer: no máximo um quadro pendente e um em execução
+    void submit(Frame& frame) override {
+        std::unique_lock<std::mutex> lock(mutex);
+        slotFree.wait(lock, [this]() { return !hasPending || !running; });
+        std::swap(pending, frame);
+        hasPending = true;
+        frameReady.notify_one();
+    }
+
+    void resize(int width, int height) override {
+        this->width = width;
+        this->height = height;
+    }
+
+    void toggleOverlay() override {
+    }
+
+    // Quadros já desenhados; depois do stop(), o último está em rasterizer.getPixels()
+    uint64_t getFramesRendered() const {
+        return framesRendered;
+    }
+
+private:
+    void renderLoop() {
+        Profiler::setThreadName("render");
+        rasterizer.setLineWidth(LINE_WIDTH);
+        rasterizer.setPointSize(POINT_SIZE);
+
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                frameReady.wait(lock, [this]() { return hasPending || !running; });
+                if (!hasPending) {
+                    break;
+                }
+                std::swap(current, pending);
+                hasPending = false;
+                slotFree.notify_one();
+            }
+
+            execute(current);
+            ++framesRendered;
+        }
+    }
+
+    // Mesma ordem do Renderer: fundo, blocos, buffers gravados e partículas por cima
+    void execute(const Frame& frame) {
+        PROFILE_SCOPE("execute");
+        applyLayer(frame.bricks);
+
+        rasterizer.resize(width, height);
+        rasterizer.clear(CLEAR_COLOR);
+        drawCommands(frame.background);
+        for (int i = 0; i < frame.bricks.count; ++i) {
+            const InstanceData& brick = layer[i];
+            rasterizer.drawRect(brick.offset + frame.bricks.offset, brick.scale, brick.color);
+        }
+        for (const auto& buffer : frame.buffers) {
+            drawCommands(buffer);
+        }
+        for (const auto& range : frame.pointRanges) {
+            rasterizer.drawPoints(frame.points.data() + range.first, range.count);
+        }
+        rasterizer.finish();
+    }
+
+    // Como o uploadLayer do Renderer, só que para a cópia na CPU
+    void applyLayer(const LayerUpdate& update) {
+        if (update.capacity != static_cast<int>(layer.size())) {
+            layer.resize(update.capacity);
+        }
+        const InstanceData* data = update.data.data();
+        for (const auto& span : update.spans) {
+            std::copy(data, data + span.count, layer.begin() + span.first);
+            data += span.count;
+        }
+    }
+
+    void drawCommands(const CommandBuffer& buffer) {
+        for (const auto& command : buffer.getCommands()) {
+            if (command.mesh == Mesh::Contour) {
+                // Linha aberta, transformada como uma instância
+                const std::vector<glm::vec2>& vertices = meshVertices(Mesh::Contour);
+                contour.resize(vertices.size());
+                for (size_t i = 0; i < vertices.size(); ++i) {
+                    contour[i] = vertices[i] * command.scale + command.position;
+                }
+                rasterizer.draw(SoftPrimitive::LineStrip, contour.data(), static_cast<int>(contour.size()), command.color);
+            } else if (command.program == Program::Circle) {
+                rasterizer.drawDisc(command.position, command.scale, command.color);
+            } else {
+                rasterizer.drawRect(command.position, command.scale, command.color);
+            }
+        }
+    }
+
+    SoftRasterizer& rasterizer;
+    std::atomic<int> width;
+    std::atomic<int> height;
+    std::atomic<uint64_t> framesRendered{ 0 };
+
+    std::thread thread;
+    std::mutex mutex;
+    std::condition_variable frameReady;
+    std::condition_variable slotFree;
+    bool running = false;
+    bool hasPending = false;
+    Frame pending;
+    Frame current;
+
+    std::vector<InstanceData> layer; // cópia da camada dos blocos, com a capacidade do último quadro
+    std::vector<glm::vec2> contour;
+};
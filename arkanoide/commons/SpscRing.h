@@ -0,0 +1,43 @@
+// Fila circular sem locks para exatamente um produtor e um consumidor.
+// Capacity precisa ser potência de 2; push falha (retorna false) se a fila estiver cheia.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+template <typename T, size_t Capacity>
+class SpscRing {
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity precisa ser potência de 2");
+
+public:
+    // Só o produtor chama
+    bool push(const T& value) {
+        size_t currentTail = tail.load(std::memory_order_relaxed);
+        if (currentTail - head.load(std::memory_order_acquire) == Capacity) {
+            return false;
+        }
+        items[currentTail & (Capacity - 1)] = value;
+        tail.store(currentTail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Só o consumidor chama: próximo item sem removê-lo, ou nullptr se vazia
+    const T* front() const {
+        size_t currentHead = head.load(std::memory_order_relaxed);
+        if (currentHead == tail.load(std::memory_order_acquire)) {
+            return nullptr;
+        }
+        return &items[currentHead & (Capacity - 1)];
+    }
+
+    // Só o consumidor chama, depois de um front() não nulo
+    void pop() {
+        head.store(head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+private:
+    T items[Capacity];
+    alignas(64) std::atomic<size_t> head{ 0 };
+    alignas(64) std::atomic<size_t> tail{ 0 };
+};
@@ -0,0 +1,304 @@
+// HUD de depuração: percentis do tempo de quadro (p50/p95/p99), histograma dos últimos
+// quadros e os contadores da GlIntercept (draw calls, trocas de programa, bytes enviados,
+// objetos GL vivos). Texto numa fonte bitmap 3x5 embutida; cada pixel aceso e cada barra
+// do histograma é uma instância de um mesmo quadrado, então o HUD inteiro é um draw só.
+//
+// Uso (uma thread GL, depois de GlIntercept::install()):
+//     overlay.create();
+//     ... desenha a cena ...
+//     overlay.draw(program, width, height);  // program: variante ShaderFeature::Instanced
+//     glfwSwapBuffers(window);
+//
+// draw() também fecha o quadro dos contadores (GlIntercept::resetFrame), então precisa ser
+// chamado todo quadro, mesmo com o HUD escondido.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <glm/glm.hpp>
+
+#include "GlIntercept.h"
+
+class StatsOverlay {
+public:
+    static constexpr int HISTORY = 240;  // quadros usados nos percentis e no histograma
+
+    ~StatsOverlay() {
+        destroy();
+    }
+
+    void create() {
+        float quad[] = {
+            0.0f, 0.0f,
+            1.0f, 0.0f,
+            1.0f, 1.0f,
+            1.0f, 1.0f,
+            0.0f, 1.0f,
+            0.0f, 0.0f
+        };
+        glGenVertexArrays(1, &VAO);
+        glGenBuffers(1, &quadVBO);
+        glGenBuffers(1, &instanceVBO);
+        glBindVertexArray(VAO);
+        glBindBuffer(GL_ARRAY_BUFFER, quadVBO);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(quad), quad, GL_STATIC_DRAW);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+        glEnableVertexAttribArray(0);
+
+        glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Instance), (void*)offsetof(Instance, offset));
+        glVertexAttribPointer(3, 2, GL_FLOAT, GL_FALSE, sizeof(Instance), (void*)offsetof(Instance, scale));
+        glVertexAttribPointer(4, 3, GL_FLOAT, GL_FALSE, sizeof(Instance), (void*)offsetof(Instance, color));
+        for (GLuint attribute = 2; attribute <= 4; ++attribute) {
+            glEnableVertexAttribArray(attribute);
+            glVertexAttribDivisor(attribute, 1);
+        }
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glBindVertexArray(0);
+    }
+
+    void destroy() {
+        if (VAO != 0) {
+            glDeleteVertexArrays(1, &VAO);
+            glDeleteBuffers(1, &quadVBO);
+            glDeleteBuffers(1, &instanceVBO);
+            VAO = 0;
+        }
+    }
+
+    void setVisible(bool visible) {
+        this->visible = visible;
+    }
+
+    bool isVisible() const {
+        return visible;
+    }
+
+    // Para programas de uma thread só: alterna o HUD com F3
+    void handleKeys(GLFWwindow* window) {
+        bool pressed = glfwGetKey(window, GLFW_KEY_F3) == GLFW_PRESS;
+        if (pressed && !togglePressed) {
+            visible = !visible;
+        }
+        togglePressed = pressed;
+    }
+
+    void draw(GLuint program, int width, int height) {
+        double now = glfwGetTime();
+        if (lastFrame > 0.0) {
+            frameTimes[frameCount % HISTORY] = static_cast<float>((now - lastFrame) * 1000.0);
+            ++frameCount;
+        }
+        lastFrame = now;
+
+        // Lidos antes de o próprio HUD desenhar, para mostrar só o custo da cena
+        GlFrameCounters counters = GlIntercept::frame();
+        const GlObjectCounts& objects = GlIntercept::objects();
+
+        if (visible && program != 0 && VAO != 0 && width > 0 && height > 0) {
+            build(counters, objects, width, height);
+            render(program, width, height);
+        }
+        GlIntercept::resetFrame();
+    }
+
+private:
+    struct Instance {
+        glm::vec2 offset;
+        glm::vec2 scale;
+        glm::vec3 color;
+    };
+
+    static const int PIXEL = 2;          // tamanho, em pixels da tela, de um pixel da fonte
+    static const int GLYPH_ADVANCE = 4;  // 3 colunas + 1 de espaço
+    static const int LINE_ADVANCE = 7;   // 5 linhas + 2 de espaço
+
+    // Glifos 3x5 de ' ' a 'Z', 3 bits por linha de cima para baixo (bit 14 = canto superior esquerdo)
+    static uint16_t glyph(char character) {
+        static const uint16_t font[] = {
+            0x0000, // ' '
+            0x0000, // '!'
+            0x0000, // '"'
+            0x0000, // '#'
+            0x0000, // '$'
+            0x52A5, // '%'
+            0x0000, // '&'
+            0x0000, // '\''
+            0x1491, // '('
+            0x4494, // ')'
+            0x0000, // '*'
+            0x0000, // '+'
+            0x0000, // ','
+            0x01C0, // '-'
+            0x0002, // '.'
+            0x12A4, // '/'
+            0x7B6F, // '0'
+            0x2C97, // '1'
+            0x73E7, // '2'
+            0x73CF, // '3'
+            0x5BC9, // '4'
+            0x79CF, // '5'
+            0x79EF, // '6'
+            0x7249, // '7'
+            0x7BEF, // '8'
+            0x7BCF, // '9'
+            0x0410, // ':'
+            0x0000, // ';'
+            0x0000, // '<'
+            0x0000, // '='
+            0x0000, // '>'
+            0x0000, // '?'
+            0x0000, // '@'
+            0x2BED, // 'A'
+            0x6BAE, // 'B'
+            0x3923, // 'C'
+            0x6B6E, // 'D'
+            0x79A7, // 'E'
+            0x79A4, // 'F'
+            0x396B, // 'G'
+            0x5BED, // 'H'
+            0x7497, // 'I'
+            0x126A, // 'J'
+            0x5BAD, // 'K'
+            0x4927, // 'L'
+            0x5FED, // 'M'
+            0x7B6D, // 'N'
+            0x2B6A, // 'O'
+            0x6BA4, // 'P'
+            0x2B7B, // 'Q'
+            0x6BAD, // 'R'
+            0x388E, // 'S'
+            0x7492, // 'T'
+            0x5B6F, // 'U'
+            0x5B6A, // 'V'
+            0x5BFD, // 'W'
+            0x5AAD, // 'X'
+            0x5A92, // 'Y'
+            0x72A7, // 'Z'
+        };
+        if (character >= 'a' && character <= 'z') {
+            character = static_cast<char>(character - 'a' + 'A');
+        }
+        if (character < ' ' || character > 'Z') {
+            return 0;
+        }
+        return font[character - ' '];
+    }
+
+    void build(const GlFrameCounters& counters, const GlObjectCounts& objects, int width, int height) {
+        instances.clear();
+        pixelWidth = 2.0f * PIXEL / static_cast<float>(width);
+        pixelHeight = 2.0f * PIXEL / static_cast<float>(height);
+
+        int samples = std::min(frameCount, HISTORY);
+        sorted.assign(frameTimes, frameTimes + samples);
+        std::sort(sorted.begin(), sorted.end());
+
+        char line[128];
+        int row = 0;
+        std::snprintf(line, sizeof(line), "FRAME MS  P50 %.2f  P95 %.2f  P99 %.2f", percentile(0.50f), percentile(0.95f), percentile(0.99f));
+        text(line, row++, glm::vec3(1.0f, 1.0f, 0.3f));
+        std::snprintf(line, sizeof(line), "DRAWS %llu  INSTANCES %llu", ull(counters.drawCalls), ull(counters.instances));
+        text(line, row++, glm::vec3(1.0f));
+        std::snprintf(line, sizeof(line), "BINDS  PROGRAM %llu  VAO %llu  BUFFER %llu  TEXTURE %llu  FBO %llu",
+            ull(counters.programBinds), ull(counters.vertexArrayBinds), ull(counters.bufferBinds), ull(counters.textureBinds), ull(counters.framebufferBinds));
+        text(line, row++, glm::vec3(1.0f));
+        std::snprintf(line, sizeof(line), "UPLOAD %.1f KB", counters.bytesUploaded / 1024.0);
+        text(line, row++, glm::vec3(1.0f));
+        std::snprintf(line, sizeof(line), "LIVE  BUFFERS %lld  VAOS %lld  TEXTURES %lld  FBOS %lld  PROGRAMS %lld  SHADERS %lld  QUERIES %lld",
+            ll(objects.buffers), ll(objects.vertexArrays), ll(objects.textures), ll(objects.framebuffers), ll(objects.programs), ll(objects.shaders), ll(objects.queries));
+        text(line, row++, glm::vec3(1.0f));
+
+        histogram(row);
+    }
+
+    // Barras dos últimos quadros (mais antigo à esquerda); 33 ms ocupam a altura toda,
+    // a linha de referência marca 16.7 ms
+    void histogram(int row) {
+        const float maxMilliseconds = 33.3f;
+        const float barsHeight = 20.0f * pixelHeight;
+        float top = 1.0f - (row * LINE_ADVANCE + 2) * pixelHeight;
+        float bottom = top - barsHeight;
+        float barWidth = pixelWidth / 2.0f;
+
+        int samples = std::min(frameCount, HISTORY);
+        for (int i = 0; i < samples; ++i) {
+            float milliseconds = frameTimes[(frameCount - samples + i) % HISTORY];
+            float height = std::min(milliseconds / maxMilliseconds, 1.0f) * barsHeight;
+            glm::vec3 color = milliseconds > 16.7f ? glm::vec3(1.0f, 0.3f, 0.3f) : glm::vec3(0.3f, 1.0f, 0.3f);
+            instances.push_back(Instance{ glm::vec2(-1.0f + pixelWidth + i * barWidth, bottom), glm::vec2(barWidth, height), color });
+        }
+        float target = bottom + 16.7f / maxMilliseconds * barsHeight;
+        instances.push_back(Instance{ glm::vec2(-1.0f + pixelWidth, target), glm::vec2(HISTORY * barWidth, pixelHeight / 4.0f), glm::vec3(1.0f) });
+    }
+
+    void text(const char* line, int row, glm::vec3 color) {
+        float top = 1.0f - (row * LINE_ADVANCE + 1) * pixelHeight;
+        for (int column = 0; line[column] != '\0'; ++column) {
+            uint16_t bits = glyph(line[column]);
+            float left = -1.0f + (column * GLYPH_ADVANCE + 1) * pixelWidth;
+            for (int bit = 0; bit < 15; ++bit) {
+                if (bits & (1 << (14 - bit))) {
+                    int x = bit % 3;
+                    int y = bit / 3;
+                    instances.push_back(Instance{ glm::vec2(left + x * pixelWidth, top - (y + 1) * pixelHeight), glm::vec2(pixelWidth, pixelHeight), color });
+                }
+            }
+        }
+    }
+
+    // Desenha sobre a janela toda e devolve o viewport da cena (as Listas usam quadrantes)
+    void render(GLuint program, int width, int height) {
+        GLint viewport[4];
+        glGetIntegerv(GL_VIEWPORT, viewport);
+        glViewport(0, 0, width, height);
+        glUseProgram(program);
+        glBindVertexArray(VAO);
+        glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+        glBufferData(GL_ARRAY_BUFFER, instances.size() * sizeof(Instance), instances.data(), GL_STREAM_DRAW);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glDrawArraysInstanced(GL_TRIANGLES, 0, 6, static_cast<GLsizei>(instances.size()));
+        glBindVertexArray(0);
+        glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+    }
+
+    float percentile(float fraction) const {
+        if (sorted.empty()) {
+            return 0.0f;
+        }
+        size_t index = static_cast<size_t>(fraction * (sorted.size() - 1) + 0.5f);
+        return sorted[index];
+    }
+
+    static unsigned long long ull(uint64_t value) {
+        return static_cast<unsigned long long>(value);
+    }
+
+    static long long ll(int64_t value) {
+        return static_cast<long long>(value);
+    }
+
+    GLuint VAO = 0;
+    GLuint quadVBO = 0;
+    GLuint instanceVBO = 0;
+    bool visible = false;
+    bool togglePressed = false;
+
+    float frameTimes[HISTORY] = {};
+    int frameCount = 0;
+    double lastFrame = 0.0;
+
+    // Reaproveitados entre quadros
+    std::vector<Instance> instances;
+    std::vector<float> sorted;
+    float pixelWidth = 0.0f;
+    float pixelHeight = 0.0f;
+};
@@ -0,0 +1,52 @@
+// Buffer triplo sem locks para um escritor e um leitor.
+// O escritor sempre tem um slot livre para escrever e o leitor sempre pega a
+// última versão publicada; nenhum dos dois espera pelo outro.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+template <typename T>
+class TripleBuffer {
+public:
+    explicit TripleBuffer(const T& initial) : slots{ initial, initial, initial } {}
+
+    // Passa por cada um dos três slots; só antes de escritor e leitor começarem (ex.: para
+    // reservar capacidade, que as cópias do construtor não levam junto)
+    template <typename F>
+    void forEachSlot(F function) {
+        for (T& slot : slots) {
+            function(slot);
+        }
+    }
+
+    // Slot exclusivo do escritor; válido até o próximo publish()
+    T& write() {
+        return slots[back];
+    }
+
+    // Torna o slot escrito visível para o leitor
+    void publish() {
+        uint8_t previous = middle.exchange(static_cast<uint8_t>(back | DIRTY), std::memory_order_acq_rel);
+        back = previous & INDEX;
+    }
+
+    // Pega a versão mais recente publicada (ou mantém a atual se não houve publicação nova)
+    const T& read() {
+        if (middle.load(std::memory_order_relaxed) & DIRTY) {
+            uint8_t previous = middle.exchange(front, std::memory_order_acq_rel);
+            front = previous & INDEX;
+        }
+        return slots[front];
+    }
+
+private:
+    static const uint8_t INDEX = 0x3;
+    static const uint8_t DIRTY = 0x4;
+
+    T slots[3];
+    uint8_t back = 0;                  // só o escritor mexe
+    uint8_t front = 2;                 // só o leitor mexe
+    std::atomic<uint8_t> middle{ 1 };  // índice trocado entre os dois + bit de novo
+};
@@ -0,0 +1,72 @@
+// Deque de Chase-Lev com capacidade fixa (versão C11 de Lê et al., 2013): a thread dona
+// empilha e desempilha no fundo, sem locks e quase sem atômicos caros; as outras roubam do
+// topo, disputando só com um CAS. A dona pega o mais recente (ainda quente no cache) e quem
+// rouba leva o mais antigo, que costuma ser o maior pedaço de trabalho.
+// Capacity precisa ser potência de 2; push falha (retorna false) se o deque estiver cheio.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+template <typename T, size_t Capacity>
+class WorkStealingDeque {
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity precisa ser potência de 2");
+
+public:
+    // Só a dona chama
+    bool push(T value) {
+        int64_t b = bottom.load(std::memory_order_relaxed);
+        int64_t t = top.load(std::memory_order_acquire);
+        if (b - t >= static_cast<int64_t>(Capacity)) {
+            return false;
+        }
+        slots[b & (Capacity - 1)].store(value, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom.store(b + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // Só a dona chama: retira o item mais recente, ou retorna false
+    bool pop(T& value) {
+        int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+        bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t t = top.load(std::memory_order_relaxed);
+        if (t > b) {
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return false;
+        }
+        value = slots[b & (Capacity - 1)].load(std::memory_order_relaxed);
+        if (t == b) {
+            // Último item: disputa com quem estiver roubando
+            bool won = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return won;
+        }
+        return true;
+    }
+
+    // Qualquer thread chama: retira o item mais antigo, ou retorna false (vazio ou perdeu a disputa)
+    bool steal(T& value) {
+        int64_t t = top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t b = bottom.load(std::memory_order_acquire);
+        if (t >= b) {
+            return false;
+        }
+        value = slots[t & (Capacity - 1)].load(std::memory_order_relaxed);
+        return top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    }
+
+    // Aproximado quando outras threads mexem no deque
+    bool empty() const {
+        return bottom.load(std::memory_order_relaxed) <= top.load(std::memory_order_relaxed);
+    }
+
+private:
+    alignas(64) std::atomic<int64_t> top{ 0 };
+    alignas(64) std::atomic<int64_t> bottom{ 0 };
+    std::atomic<T> slots[Capacity];
+};
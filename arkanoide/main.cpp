@@ -2,22 +2,76 @@
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
 #include <vector>
+#include <algorithm>
+#include <cstdlib>
+#include <cmath>
+#include <memory>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <commons/CommandBuffer.h>
+#include <commons/FrameArena.h>
+#include <commons/GlIntercept.h>
+#include <commons/GlTrace.h>
+#include <commons/InstanceLayer.h>
+#include <commons/JobSystem.h>
+#include <commons/Profiler.h>
+#include <commons/Renderer.h>
+#include <commons/TripleBuffer.h>
 #include "Paddle.h"
 #include "Block.h"
 #include "Ball.h"
-#include <glm/gtc/type_ptr.hpp>
+#include "BallPool.h"
+#include "Board.h"
+#include "ParticleSystem.h"
+#include "ScrollingBoard.h"
+#include "Simulation.h"
 
 const int WINDOW_WIDTH = 800;
 const int WINDOW_HEIGHT = 600;
-float blockWidth = 0.15f;
-float blockHeight = 0.1f;
-int numRows = 7;
-int numCols = 8;
-std::vector<glm::vec3> randomColors;
-std::vector<Block> disabledBlocks;
+Board board(7, 8);
+
+// Modo em rolagem (ARKANOIDE_SCROLL): só existe com uma fase carregada
+std::unique_ptr<ScrollingBoard> scrollingBoard;
+float scrollSpeed = 0.0f;
+
+// Efeitos de quebra dos blocos; com o anel cheio as partículas mais antigas são substituídas
+const int PARTICLE_CAPACITY = 1 << 16;
+
+// Produtor: callback de teclado na thread principal. Consumidor: thread de simulação.
+GameInput input;
+
+void key_callback(GLFWwindow* window, int key, int, int action, int) {
+    if (action == GLFW_REPEAT) {
+        return;
+    }
+    bool pressed = action == GLFW_PRESS;
+    if (key == GLFW_KEY_F3) {
+        if (pressed) {
+            static_cast<Renderer*>(glfwGetWindowUserPointer(window))->toggleOverlay();
+        }
+        return;
+    }
+
+    // Só as teclas que a simulação usa vão para a fila
+    if (key == GLFW_KEY_LEFT) {
+        input.heldLeft.store(pressed, std::memory_order_relaxed);
+    } else if (key == GLFW_KEY_RIGHT) {
+        input.heldRight.store(pressed, std::memory_order_relaxed);
+    } else if (key == GLFW_KEY_SPACE && pressed) {
+        input.startRequested.store(true, std::memory_order_relaxed);
+    } else {
+        return;
+    }
+    if (!input.events.push(InputEvent{ glfwGetTime(), key, pressed })) {
+        input.dropped.store(true, std::memory_order_release);
+    }
+}
 
 void framebuffer_size_callback(GLFWwindow* window, int width, int height) {
-    glViewport(0, 0, width, height);
+    // O contexto GL pertence à thread de render; ela aplica o viewport no próximo quadro
+    Renderer* renderer = static_cast<Renderer*>(glfwGetWindowUserPointer(window));
+    renderer->resize(width, height);
 }
 
 // Função para inicializar o GLFW e criar a janela
@@ -48,166 +102,170 @@ bool initGLAD() {
         std::cerr << "Erro ao inicializar o GLAD" << std::endl;
         return false;
     }
+    // Contadores do HUD (F3)
+    GlIntercept::install();
     return true;
 }
 
-glm::vec3 getRandomColor() {
-    float r = static_cast<float>(rand()) / RAND_MAX;
-    float g = static_cast<float>(rand()) / RAND_MAX;
-    float b = static_cast<float>(rand()) / RAND_MAX;
-    return glm::vec3(r, g, b);
-}
-
-void populateRandomColors() {
-    randomColors.reserve(numRows);
-    for (int i = 0; i < numRows; ++i) {
-        randomColors.push_back(getRandomColor());
+// ARKANOIDE_GL_STATS=1 mede cada função GL e imprime o relatório ao sair;
+// ARKANOIDE_GL_TRACE=arquivo também grava as chamadas para tools/gl_replay
+void initGLTrace() {
+    const char* tracePath = std::getenv("ARKANOIDE_GL_TRACE");
+    if (!tracePath && !std::getenv("ARKANOIDE_GL_STATS")) {
+        return;
+    }
+    GlTrace::install();
+    if (tracePath) {
+        ShaderCache::setEnabled(false);
+        if (!GlTrace::startRecording(tracePath)) {
+            std::cerr << "Erro ao abrir o trace " << tracePath << std::endl;
+        }
     }
 }
 
-GLuint createShaderProgram(const char* vertexShaderSource, const char* fragmentShaderSource) {
-    GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
-    glShaderSource(vertexShader, 1, &vertexShaderSource, nullptr);
-    glCompileShader(vertexShader);
-
-    GLuint fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
-    glShaderSource(fragmentShader, 1, &fragmentShaderSource, nullptr);
-    glCompileShader(fragmentShader);
-
-    GLuint shaderProgram = glCreateProgram();
-    glAttachShader(shaderProgram, vertexShader);
-    glAttachShader(shaderProgram, fragmentShader);
-    glLinkProgram(shaderProgram);
-
-    glDeleteShader(vertexShader);
-    glDeleteShader(fragmentShader);
-
-    return shaderProgram;
+void recordContour(CommandBuffer& commands) {
+    commands.push(Program::Flat, Mesh::Contour, glm::vec2(0.0f, 0.0f), glm::vec2(1.0f, 1.0f), glm::vec3(0.0f, 0.0f, 1.0f));
 }
 
-bool isBlockInDisabledBlocks(const std::vector<Block>& disabledBlocks, const Block& block) {
-    for (const auto& disabledBlock : disabledBlocks) {
-        if (disabledBlock.getPosition() == block.getPosition()) {
-            return true;
-        }
+// Camada dos blocos: segue os chunks residentes em rolagem e perde os blocos quebrados
+// desde o último quadro (disabledBlocks a partir de firstBroken)
+void updateBricks(InstanceLayer& bricks, ResidentChunks& shownChunks, const GameState& state, size_t firstBroken) {
+    if (scrollingBoard) {
+        scrollingBoard->updateLayer(state.resident, state.disabledBlocks, shownChunks, bricks);
+        bricks.setOffset(glm::vec2(0.0f, -state.scroll));
+    }
+    for (size_t i = firstBroken; i < state.disabledBlocks.size(); ++i) {
+        const Block& block = state.disabledBlocks[i];
+        bricks.remove(scrollingBoard ? scrollingBoard->getBlockKey(block) : board.getBlockKey(block));
     }
-    return false;
 }
 
-std::vector<Block> drawBlocks() {
-    std::vector<Block> activeBlocks;
-    for (int i = 0; i < numRows; ++i) {
-        glm::vec3 randomColor = randomColors[i];
-        for (int j = 0; j < numCols; ++j) {
-            float x = -0.65f + j * (blockWidth + 0.02f);  // Espaçamento entre os blocos: 0.02f
-            float y = 0.8f - i * (blockHeight + 0.02f);  // Espaçamento entre os blocos: 0.02f
-            Block block(blockWidth, blockHeight, x, y);
-
-            if (!isBlockInDisabledBlocks(disabledBlocks, block)) {
-                block.draw(randomColor.x, randomColor.y, randomColor.z);
-                activeBlocks.push_back(block);
-            }            
+// Estilhaços dos mesmos blocos, na posição em que estão na tela
+void emitBlockBreaks(ParticleSystem& particles, const GameState& state, size_t firstBroken) {
+    for (size_t i = firstBroken; i < state.disabledBlocks.size(); ++i) {
+        const Block& block = state.disabledBlocks[i];
+        if (scrollingBoard) {
+            Block onScreen(block.getWidth(), block.getHeight(), block.getX(), block.getY() - state.scroll);
+            particles.emitBlockBreak(onScreen, scrollingBoard->getColor(state.resident, block));
+        } else {
+            particles.emitBlockBreak(block, board.getBlockColor(block));
         }
     }
-    return activeBlocks;
 }
 
-void drawContour() {
-    const char* vertexShaderSource = R"(
-        #version 330 core
-        layout (location = 0) in vec2 aPos;
-        uniform mat4 projection;
-        void main() {
-            gl_Position = projection * vec4(aPos.x, aPos.y, 0.0, 1.0);
+// Grava o quadro inteiro como um grafo de jobs: a camada dos blocos (com a moldura como
+// fundo estático), as partículas (emitidas e depois avançadas em trechos paralelos) e
+// paddle e bolas não dependem umas das outras e rodam ao mesmo tempo. As funções dos nós
+// ficam na arena do quadro, que o grafo do quadro anterior solta antes do reset.
+void recordFrame(Frame& frame, JobSystem& jobs, JobGraph& graph, FrameArena& arena, InstanceLayer& bricks, ResidentChunks& shownChunks,
+                 const GameState& state, size_t firstBroken, ParticleSystem& particles, float deltaTime) {
+    PROFILE_SCOPE("recordFrame");
+    frame.buffers.resize(2);
+    frame.clear();
+
+    graph.clear();
+    arena.reset();
+    graph.add([&]() {
+        updateBricks(bricks, shownChunks, state, firstBroken);
+        bricks.flush(frame.bricks);
+        recordContour(frame.background);
+    });
+    int emit = graph.add([&]() { emitBlockBreaks(particles, state, firstBroken); });
+    int update = graph.add([&]() { updateParticles(jobs, particles, deltaTime, frame); });
+    graph.precede(emit, update);
+    graph.add([&]() {
+        state.paddle.record(frame.buffers[0]);
+        state.balls.record(frame.buffers[1]);
+    });
+    graph.run(jobs);
+}
+
+// Thread de simulação: passo fixo no relógio do GLFW (o mesmo dos eventos). Cada tick só
+// roda depois que o seu intervalo terminou, então todos os eventos dele já estão na fila.
+void simulationLoop(GameState state, TripleBuffer<GameState>& stateBuffer, JobSystem& jobs, std::atomic<bool>& running) {
+    Profiler::setThreadName("simulation");
+    Simulation simulation(board, scrollingBoard.get(), scrollSpeed, input, jobs);
+    reserveGameState(state, board, scrollingBoard.get());
+    double tickStart = glfwGetTime();
+
+    while (running && !state.gameOver) {
+        double tickEnd = tickStart + SIMULATION_TICK;
+        double now = glfwGetTime();
+        if (now < tickEnd) {
+            std::this_thread::sleep_for(std::chrono::duration<double>(tickEnd - now));
+            continue;
         }
-    )";
-
-    const char* fragmentShaderSource = R"(
-        #version 330 core
-        out vec4 FragColor;
-        uniform vec3 shapeColor;
-        void main() {
-            FragColor = vec4(shapeColor, 1.0);
+        if (now - tickEnd > 100 * SIMULATION_TICK) {
+            // Muito atrasado (ex.: processo suspenso): não tenta recuperar os ticks perdidos
+            tickStart = now - SIMULATION_TICK;
+            tickEnd = now;
         }
-    )";
-
-    GLuint shaderProgram = createShaderProgram(vertexShaderSource, fragmentShaderSource);
-
-    float vertices[] = {
-        -0.8f, -1.0f,
-        -0.8f, 0.9f,
-         0.7f, 0.9f,
-         0.7f, -1.0f
-    };
-
-    GLuint VAO, VBO;
-    glGenVertexArrays(1, &VAO);
-    glGenBuffers(1, &VBO);
-
-    glBindVertexArray(VAO);
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
-
-    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-
-    glUseProgram(shaderProgram);
 
-    glm::mat4 projection = glm::ortho(-1.0f, 1.0f, -1.0f, 1.0f, -1.0f, 1.0f);
-    GLint projectionLocation = glGetUniformLocation(shaderProgram, "projection");
-    glUniformMatrix4fv(projectionLocation, 1, false, glm::value_ptr(projection));
-
-    GLint shapeColorLocation = glGetUniformLocation(shaderProgram, "shapeColor");
-    glUniform3f(shapeColorLocation, 0.0f, 0.0f, 1.0f);
-
-    glLineWidth(3.0f);
-
-    glDrawArrays(GL_LINE_STRIP, 0, 4);
-
-    glDeleteVertexArrays(1, &VAO);
-    glDeleteBuffers(1, &VBO);
+        simulation.tick(state, tickStart, tickEnd);
+        stateBuffer.write() = state;
+        stateBuffer.publish();
+        tickStart = tickEnd;
+    }
 }
 
-bool checkCollisionPaddle(Ball& ball, Paddle& paddle) {
-    // Obteem as informações do paddle
-    float paddleX = paddle.getPosition().x;
-    float paddleY = paddle.getPosition().y;
-    float paddleWidth = paddle.getWidth();
-    float paddleHeight = paddle.getHeight();
-
-    // Obtem as informações da bola
-    glm::vec2 ballPosition = ball.getPosition();
-    float ballRadius = ball.getRadius();
-
-    // Verifica a colisão
-    if (ballPosition.x + ballRadius > paddleX - paddleWidth / 2.0f &&
-        ballPosition.x - ballRadius < paddleX + paddleWidth / 2.0f &&
-        ballPosition.y + ballRadius > paddleY - paddleHeight / 2.0f &&
-        ballPosition.y - ballRadius < paddleY + paddleHeight / 2.0f) {
-        // Ocorreu colisao, inverte o componente y da velocidade da bola para fazê-la quicar para cima
-        glm::vec2 ballVelocity = ball.velocity;
-        ballVelocity.y = -ballVelocity.y;
-        ball.velocity = ballVelocity;
-        return true; // Houve colisão
+// Thread de quadros: pega o último retrato (nunca bloqueia a simulação), grava e entrega ao render
+void frameLoop(GLFWwindow* window, Renderer& renderer, TripleBuffer<GameState>& stateBuffer, JobSystem& jobs, std::atomic<bool>& running) {
+    Profiler::setThreadName("frames");
+    FrameArena arena;
+    JobGraph graph(&arena);
+    Frame frame;
+    ParticleSystem particles(PARTICLE_CAPACITY);
+    uint64_t brokenBlocks = 0;
+    double lastFrame = glfwGetTime();
+
+    // Blocos como camada persistente na GPU: o tabuleiro vai inteiro no primeiro quadro e
+    // depois só os slots que mudam. Em rolagem ela segue os chunks residentes.
+    InstanceLayer bricks;
+    ResidentChunks shownChunks;
+    if (!scrollingBoard) {
+        board.fillLayer({}, bricks);
     }
 
-    return false; // Não houve colisão
-}
+    while (running) {
+        PROFILE_SCOPE("frame");
+        const GameState& state = stateBuffer.read();
+        if (state.gameOver) {
+            glfwSetWindowShouldClose(window, GLFW_TRUE);
+            glfwPostEmptyEvent();
+        }
 
-void verifyCollisionBlocks(std::vector<Block>& blocks, Ball& ball) {
-    // Loop através de todos os blocos
-    for (auto& block : blocks) {
-        if (block.checkCollision(ball)) { 
-            disabledBlocks.push_back(block);
-            ball.moveCollision(block);
-            break;
+        // Partículas são só visuais: vivem nesta thread e andam no tempo dos quadros
+        double now = glfwGetTime();
+        float deltaTime = static_cast<float>(std::min(now - lastFrame, 0.05));
+        lastFrame = now;
+
+        // Os quebrados desde o último quadro são as últimas entradas de disabledBlocks (a
+        // poda da rolagem preserva a ordem e só tira blocos já fora da tela)
+        size_t fresh = static_cast<size_t>(std::min<uint64_t>(state.brokenBlocks - brokenBlocks, state.disabledBlocks.size()));
+        brokenBlocks = state.brokenBlocks;
+
+        // Grava o quadro N+1 enquanto a thread de render ainda submete o quadro N
+        recordFrame(frame, jobs, graph, arena, bricks, shownChunks, state, state.disabledBlocks.size() - fresh, particles, deltaTime);
+        {
+            PROFILE_SCOPE("submit");
+            renderer.submit(frame);
         }
+
+        // Esvazia a fila de eventos antes que ela encha
+        Profiler::collect();
     }
 }
 
 int main() {
     GLFWwindow* window = nullptr;
 
+    // ARKANOIDE_TRACE=arquivo.json grava um trace do Chrome com os escopos de CPU e GPU
+    const char* tracePath = std::getenv("ARKANOIDE_TRACE");
+    if (tracePath) {
+        Profiler::start();
+        Profiler::setThreadName("main");
+    }
+
     if (!initGLFW(window)) {
         return -1;
     }
@@ -215,73 +273,82 @@ int main() {
     if (!initGLAD()) {
         return -1;
     }
+    initGLTrace();
 
-    glViewport(0, 0, WINDOW_WIDTH, WINDOW_HEIGHT);
+    // A partir daqui o contexto GL é da thread de render
+    glfwMakeContextCurrent(nullptr);
+    Renderer renderer(window, WINDOW_WIDTH, WINDOW_HEIGHT);
+    glfwSetWindowUserPointer(window, &renderer);
     glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
-    populateRandomColors();
-    
-    Paddle paddle(0.2f, 0.02f, 0.0f);
-    Ball ball(0.02f, glm::vec2(0.0f, -0.85f), glm::vec2(0.8f, 0.8f));
+    glfwSetKeyCallback(window, key_callback);
+    renderer.start();
 
-    bool gameStarted = false; // Variável para controlar se o jogo começou
-    int first = 0;
-
-    while (!glfwWindowShouldClose(window)) {
-        // Verifique eventos
-        glfwPollEvents();
-    
-        float deltaTime = 0.016f;
-
-        // Verifique se spaço foi pressionado
-        if (!gameStarted && glfwGetKey(window, GLFW_KEY_SPACE) == GLFW_PRESS) {
-            first = 1;
-            gameStarted = true; // Inicie o jogo
-        }
+    // ARKANOIDE_BALLS=N começa com N bolas em leque, como teste de carga; o padrão é uma
+    int initialBalls = 1;
+    if (const char* count = std::getenv("ARKANOIDE_BALLS")) {
+        initialBalls = std::max(1, std::atoi(count));
+    }
 
-        if (gameStarted) {
-            if (glfwGetKey(window, GLFW_KEY_LEFT) == GLFW_PRESS) {
-                paddle.moveLeft(deltaTime);
+    // ARKANOIDE_LEVEL=fase.lvl joga uma fase compilada com tools/compile_level.py
+    if (const char* levelPath = std::getenv("ARKANOIDE_LEVEL")) {
+        auto level = std::make_shared<LevelFile>();
+        if (level->open(levelPath)) {
+            board = Board(level);
+            // ARKANOIDE_SCROLL=velocidade percorre a fase de baixo para cima, sem fim
+            if (const char* speed = std::getenv("ARKANOIDE_SCROLL")) {
+                scrollSpeed = static_cast<float>(std::atof(speed));
+                scrollingBoard.reset(new ScrollingBoard(level));
             }
-            if (glfwGetKey(window, GLFW_KEY_RIGHT) == GLFW_PRESS) {
-                paddle.moveRight(deltaTime);
-            }
-
-            glClear(GL_COLOR_BUFFER_BIT);
-            drawContour();
-            paddle.draw();
-            std::vector<Block> activeBlocks = drawBlocks();
+        } else {
+            std::cout << "Fase inválida ou inexistente: " << levelPath << "; usando o tabuleiro padrão" << std::endl;
+        }
+    }
 
+    GameState initialState = {
+        Paddle(0.2f, 0.02f, 0.0f),
+        BallPool(std::max(MAX_BALLS, initialBalls)),
+        {},
+        {},
+        false,
+        false,
+        0,
+        0.0f,
+        {}
+    };
+    for (int i = 0; i < initialBalls; ++i) {
+        float angle = (initialBalls > 1) ? (static_cast<float>(i) / (initialBalls - 1) - 0.5f) : 0.0f;
+        initialState.balls.spawn(Ball(0.02f, glm::vec2(0.0f, -0.85f), rotate(glm::vec2(0.8f, 0.8f), angle)));
+    }
 
-            if (first == 1) {
-                ball.moveFirst(glm::vec2(1.0f, 1.0f), deltaTime);
-                first = 2;
-            } else {
-                ball.move(deltaTime);
-            }
+    TripleBuffer<GameState> stateBuffer(initialState);
+    stateBuffer.forEachSlot([](GameState& slot) { reserveGameState(slot, board, scrollingBoard.get()); });
+    std::atomic<bool> running{ true };
+    // Um só pool para a simulação e a thread de quadros, uma thread por núcleo
+    JobSystem jobs;
+    std::thread simulation(simulationLoop, initialState, std::ref(stateBuffer), std::ref(jobs), std::ref(running));
+    std::thread frames(frameLoop, window, std::ref(renderer), std::ref(stateBuffer), std::ref(jobs), std::ref(running));
 
-            if (ball.getPosition().y < -1.0f) {
-                glfwSetWindowShouldClose(window, GLFW_TRUE);
-            }
+    // A thread principal só bombeia eventos: acorda assim que chega uma tecla, então o
+    // carimbo de tempo do evento não depende da taxa de quadros
+    while (!glfwWindowShouldClose(window)) {
+        glfwWaitEvents();
+    }
 
-            verifyCollisionBlocks(activeBlocks, ball); 
-            checkCollisionPaddle(ball, paddle);
+    running = false;
+    simulation.join();
+    frames.join();
+    renderer.stop();
 
-            if (disabledBlocks.size() == numCols * numRows) {
-                glfwSetWindowShouldClose(window, GLFW_TRUE);
-            }    
-            
-            ball.draw();
-        } else {
-            drawContour();
-            paddle.draw();
-            drawBlocks();
-            ball.draw();
-        }
+    if (tracePath) {
+        Profiler::writeChromeTrace(tracePath);
+    }
+    if (GlTrace::isRecording() || std::getenv("ARKANOIDE_GL_STATS")) {
+        GlTrace::stopRecording();
+        GlTrace::writeReport(std::cout);
+    }
 
-    glfwSwapBuffers(window);
-}
     // Encerre o GLFW
     glfwTerminate();
 
     return 0;
-}
\ No newline at end of file
+}
@@ -1,45 +1,11 @@
 #include "Ball.h"
 #include "Block.h" 
-#include <commons/Shader.h>
-#include "glm/gtc/matrix_transform.hpp"
-#include <glm/gtc/type_ptr.hpp>
-#include <vector>
+#include <commons/Profiler.h>
 
 Ball::Ball(float radius, glm::vec2 initialPosition, glm::vec2 velocity) {
     this->radius = radius;
     this->position = initialPosition;
     this->velocity = velocity;
-
-    int numSegments = 30;
-    float angleIncrement = 2 * glm::pi<float>() / static_cast<float>(numSegments);
-
-    std::vector<float> vertices;
-    vertices.reserve(2 * (numSegments + 1));
-    vertices.push_back(0.0f);
-    vertices.push_back(0.0f);
-
-    for (int i = 0; i <= numSegments; ++i) {
-        float angle = static_cast<float>(i) * angleIncrement;
-        float x = radius * glm::cos(angle);
-        float y = radius * glm::sin(angle);
-        vertices.push_back(x);
-        vertices.push_back(y);
-    }
-
-    glGenVertexArrays(1, &VAO);
-    glGenBuffers(1, &VBO);
-    glBindVertexArray(VAO);
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), vertices.data(), GL_STATIC_DRAW);
-    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
-}
-
-Ball::~Ball() {
-    glDeleteVertexArrays(1, &VAO);
-    glDeleteBuffers(1, &VBO);
 }
 
 void Ball::moveFirst(glm::vec2 direction, float deltaTime) {
@@ -126,25 +92,9 @@ void Ball::moveCollision(Block& block) {
 
 
 
-void Ball::draw() {
-    Shader shader("/home/jayme/College/processamento-grafico/PG2023/arkanoide/objects/ball/ball.vs", "/home/jayme/College/processamento-grafico/PG2023/arkanoide/objects/ball/ball.fs");
-    
-    shader.Use();
-
-    glm::mat4 projection = glm::mat4(1);
-	projection = glm::ortho(-1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
-
-    glm::mat4 model = glm::mat4(1.0f);
-    model = glm::translate(model, glm::vec3(position, 0.0f));
-
-    shader.setMat4("projection", glm::value_ptr(projection));
-    shader.setMat4("model", glm::value_ptr(model));
-    shader.setVec3("color", 0.0f, 0.0f, 1.0f);
-
-    int numSegments = 30;
-    glBindVertexArray(VAO);
-    glDrawArrays(GL_TRIANGLE_FAN, 0, numSegments + 2);
-    glBindVertexArray(0);
+void Ball::record(CommandBuffer& commands) const {
+    PROFILE_SCOPE("Ball::record");
+    commands.push(Program::Circle, Mesh::Quad, position, glm::vec2(2.0f * radius), glm::vec3(0.0f, 0.0f, 1.0f));
 }
 
 glm::vec2 Ball::getPosition() const {
@@ -0,0 +1,348 @@
+#include "BallPool.h"
+#include <algorithm>
+#include <commons/Profiler.h>
+
+// Limites do campo, os mesmos de Ball::move
+static const float LEFT_WALL = -0.8f;
+static const float RIGHT_WALL = 0.7f;
+static const float CEILING = 0.9f;
+
+BallPool::BallPool(int capacity) {
+    this->capacity = capacity;
+    size_t padded = static_cast<size_t>(capacity + PADDING - 1) / PADDING * PADDING;
+    x.assign(padded, 0.0f);
+    y.assign(padded, 0.0f);
+    vx.assign(padded, 0.0f);
+    vy.assign(padded, 0.0f);
+    radius.assign(padded, 0.0f);
+    alive.assign(capacity, 0);
+    freeList.reserve(capacity);
+    clear();
+}
+
+BallPool& BallPool::operator=(const BallPool& other) {
+    if (this == &other) {
+        return *this;
+    }
+    if (capacity != other.capacity) {
+        x = other.x;
+        y = other.y;
+        vx = other.vx;
+        vy = other.vy;
+        radius = other.radius;
+        alive = other.alive;
+        freeList = other.freeList;
+    } else {
+        // Além de [0, other.used), limpa o que sobrou de um estado anterior maior
+        size_t range = static_cast<size_t>(std::max(used, other.used));
+        std::copy(other.x.begin(), other.x.begin() + range, x.begin());
+        std::copy(other.y.begin(), other.y.begin() + range, y.begin());
+        std::copy(other.vx.begin(), other.vx.begin() + range, vx.begin());
+        std::copy(other.vy.begin(), other.vy.begin() + range, vy.begin());
+        std::copy(other.radius.begin(), other.radius.begin() + range, radius.begin());
+        std::copy(other.alive.begin(), other.alive.begin() + range, alive.begin());
+        freeList.assign(other.freeList.begin(), other.freeList.end());
+    }
+    capacity = other.capacity;
+    count = other.count;
+    used = other.used;
+    return *this;
+}
+
+int BallPool::spawn(const Ball& ball) {
+    if (freeList.empty()) {
+        return -1;
+    }
+    int index = freeList.back();
+    freeList.pop_back();
+    alive[index] = 1;
+    set(index, ball);
+    ++count;
+    used = std::max(used, index + 1);
+    return index;
+}
+
+void BallPool::despawn(int index) {
+    if (!alive[index]) {
+        return;
+    }
+    alive[index] = 0;
+    set(index, Ball(0.0f, glm::vec2(0.0f), glm::vec2(0.0f)));
+    freeList.push_back(index);
+    --count;
+    while (used > 0 && !alive[used - 1]) {
+        --used;
+    }
+}
+
+void BallPool::clear() {
+    std::fill(x.begin(), x.end(), 0.0f);
+    std::fill(y.begin(), y.end(), 0.0f);
+    std::fill(vx.begin(), vx.end(), 0.0f);
+    std::fill(vy.begin(), vy.end(), 0.0f);
+    std::fill(radius.begin(), radius.end(), 0.0f);
+    std::fill(alive.begin(), alive.end(), 0);
+    // Em ordem decrescente, para spawn usar primeiro os índices baixos
+    freeList.clear();
+    for (int i = capacity - 1; i >= 0; --i) {
+        freeList.push_back(i);
+    }
+    count = 0;
+    used = 0;
+}
+
+bool BallPool::isAlive(int index) const {
+    return alive[index] != 0;
+}
+
+int BallPool::size() const {
+    return count;
+}
+
+int BallPool::getCapacity() const {
+    return capacity;
+}
+
+int BallPool::end() const {
+    return used;
+}
+
+Ball BallPool::get(int index) const {
+    return Ball(radius[index], glm::vec2(x[index], y[index]), glm::vec2(vx[index], vy[index]));
+}
+
+void BallPool::set(int index, const Ball& ball) {
+    x[index] = ball.getPosition().x;
+    y[index] = ball.getPosition().y;
+    vx[index] = ball.velocity.x;
+    vy[index] = ball.velocity.y;
+    radius[index] = ball.getRadius();
+}
+
+void BallPool::record(CommandBuffer& commands) const {
+    PROFILE_SCOPE("BallPool::record");
+    for (int i = 0; i < used; ++i) {
+        if (alive[i]) {
+            commands.push(Program::Circle, Mesh::Quad, glm::vec2(x[i], y[i]), glm::vec2(2.0f * radius[i]), glm::vec3(0.0f, 0.0f, 1.0f));
+        }
+    }
+}
+
+// Caixa do paddle calculada como em checkCollisionPaddle
+struct PaddleBounds {
+    float left, right, bottom, top;
+
+    explicit PaddleBounds(const Paddle& paddle) {
+        left = paddle.getPosition().x - paddle.getWidth() / 2.0f;
+        right = paddle.getPosition().x + paddle.getWidth() / 2.0f;
+        bottom = paddle.getPosition().y - paddle.getHeight() / 2.0f;
+        top = paddle.getPosition().y + paddle.getHeight() / 2.0f;
+    }
+};
+
+static void integrateScalar(BallPool& pool, float deltaTime, const PaddleBounds& paddle) {
+    for (int i = 0; i < pool.end(); ++i) {
+        float r = pool.radius[i];
+        float newX = pool.x[i] + pool.vx[i] * deltaTime;
+        float newY = pool.y[i] + pool.vy[i] * deltaTime;
+
+        if (newX - r < LEFT_WALL) {
+            pool.vx[i] = -pool.vx[i];
+            newX = LEFT_WALL + r;
+        }
+        if (newX + r > RIGHT_WALL) {
+            pool.vx[i] = -pool.vx[i];
+            newX = RIGHT_WALL - r;
+        }
+        if (newY + r > CEILING) {
+            pool.vy[i] = -pool.vy[i];
+            newY = CEILING - r;
+        }
+
+        if (newX + r > paddle.left && newX - r < paddle.right && newY + r > paddle.bottom && newY - r < paddle.top) {
+            pool.vy[i] = -pool.vy[i];
+        }
+
+        pool.x[i] = newX;
+        pool.y[i] = newY;
+    }
+}
+
+#ifdef SIMD_X86
+
+// SSE2 não tem blendv: seleção com and/andnot/or
+static inline __m128 select128(__m128 mask, __m128 ifTrue, __m128 ifFalse) {
+    return _mm_or_ps(_mm_and_ps(mask, ifTrue), _mm_andnot_ps(mask, ifFalse));
+}
+
+static void integrateSse2(BallPool& pool, float deltaTime, const PaddleBounds& paddle) {
+    const __m128 dt = _mm_set1_ps(deltaTime);
+    const __m128 sign = _mm_set1_ps(-0.0f);
+    const __m128 left = _mm_set1_ps(LEFT_WALL);
+    const __m128 right = _mm_set1_ps(RIGHT_WALL);
+    const __m128 ceiling = _mm_set1_ps(CEILING);
+    const __m128 paddleLeft = _mm_set1_ps(paddle.left);
+    const __m128 paddleRight = _mm_set1_ps(paddle.right);
+    const __m128 paddleBottom = _mm_set1_ps(paddle.bottom);
+    const __m128 paddleTop = _mm_set1_ps(paddle.top);
+    for (int i = 0; i < pool.end(); i += 4) {
+        __m128 r = _mm_loadu_ps(&pool.radius[i]);
+        __m128 vx = _mm_loadu_ps(&pool.vx[i]);
+        __m128 vy = _mm_loadu_ps(&pool.vy[i]);
+        __m128 x = _mm_add_ps(_mm_loadu_ps(&pool.x[i]), _mm_mul_ps(vx, dt));
+        __m128 y = _mm_add_ps(_mm_loadu_ps(&pool.y[i]), _mm_mul_ps(vy, dt));
+
+        __m128 hit = _mm_cmplt_ps(_mm_sub_ps(x, r), left);
+        vx = _mm_xor_ps(vx, _mm_and_ps(hit, sign));
+        x = select128(hit, _mm_add_ps(left, r), x);
+
+        hit = _mm_cmpgt_ps(_mm_add_ps(x, r), right);
+        vx = _mm_xor_ps(vx, _mm_and_ps(hit, sign));
+        x = select128(hit, _mm_sub_ps(right, r), x);
+
+        hit = _mm_cmpgt_ps(_mm_add_ps(y, r), ceiling);
+        vy = _mm_xor_ps(vy, _mm_and_ps(hit, sign));
+        y = select128(hit, _mm_sub_ps(ceiling, r), y);
+
+        hit = _mm_and_ps(_mm_and_ps(_mm_cmpgt_ps(_mm_add_ps(x, r), paddleLeft), _mm_cmplt_ps(_mm_sub_ps(x, r), paddleRight)),
+                         _mm_and_ps(_mm_cmpgt_ps(_mm_add_ps(y, r), paddleBottom), _mm_cmplt_ps(_mm_sub_ps(y, r), paddleTop)));
+        vy = _mm_xor_ps(vy, _mm_and_ps(hit, sign));
+
+        _mm_storeu_ps(&pool.x[i], x);
+        _mm_storeu_ps(&pool.y[i], y);
+        _mm_storeu_ps(&pool.vx[i], vx);
+        _mm_storeu_ps(&pool.vy[i], vy);
+    }
+}
+
+__attribute__((target("avx2")))
+static void integrateAvx2(BallPool& pool, float deltaTime, const PaddleBounds& paddle) {
+    const __m256 dt = _mm256_set1_ps(deltaTime);
+    const __m256 sign = _mm256_set1_ps(-0.0f);
+    const __m256 left = _mm256_set1_ps(LEFT_WALL);
+    const __m256 right = _mm256_set1_ps(RIGHT_WALL);
+    const __m256 ceiling = _mm256_set1_ps(CEILING);
+    const __m256 paddleLeft = _mm256_set1_ps(paddle.left);
+    const __m256 paddleRight = _mm256_set1_ps(paddle.right);
+    const __m256 paddleBottom = _mm256_set1_ps(paddle.bottom);
+    const __m256 paddleTop = _mm256_set1_ps(paddle.top);
+    for (int i = 0; i < pool.end(); i += 8) {
+        __m256 r = _mm256_loadu_ps(&pool.radius[i]);
+        __m256 vx = _mm256_loadu_ps(&pool.vx[i]);
+        __m256 vy = _mm256_loadu_ps(&pool.vy[i]);
+        __m256 x = _mm256_add_ps(_mm256_loadu_ps(&pool.x[i]), _mm256_mul_ps(vx, dt));
+        __m256 y = _mm256_add_ps(_mm256_loadu_ps(&pool.y[i]), _mm256_mul_ps(vy, dt));
+
+        __m256 hit = _mm256_cmp_ps(_mm256_sub_ps(x, r), left, _CMP_LT_OQ);
+        vx = _mm256_xor_ps(vx, _mm256_and_ps(hit, sign));
+        x = _mm256_blendv_ps(x, _mm256_add_ps(left, r), hit);
+
+        hit = _mm256_cmp_ps(_mm256_add_ps(x, r), right, _CMP_GT_OQ);
+        vx = _mm256_xor_ps(vx, _mm256_and_ps(hit, sign));
+        x = _mm256_blendv_ps(x, _mm256_sub_ps(right, r), hit);
+
+        hit = _mm256_cmp_ps(_mm256_add_ps(y, r), ceiling, _CMP_GT_OQ);
+        vy = _mm256_xor_ps(vy, _mm256_and_ps(hit, sign));
+        y = _mm256_blendv_ps(y, _mm256_sub_ps(ceiling, r), hit);
+
+        hit = _mm256_and_ps(_mm256_and_ps(_mm256_cmp_ps(_mm256_add_ps(x, r), paddleLeft, _CMP_GT_OQ),
+                                          _mm256_cmp_ps(_mm256_sub_ps(x, r), paddleRight, _CMP_LT_OQ)),
+                            _mm256_and_ps(_mm256_cmp_ps(_mm256_add_ps(y, r), paddleBottom, _CMP_GT_OQ),
+                                          _mm256_cmp_ps(_mm256_sub_ps(y, r), paddleTop, _CMP_LT_OQ)));
+        vy = _mm256_xor_ps(vy, _mm256_and_ps(hit, sign));
+
+        _mm256_storeu_ps(&pool.x[i], x);
+        _mm256_storeu_ps(&pool.y[i], y);
+        _mm256_storeu_ps(&pool.vx[i], vx);
+        _mm256_storeu_ps(&pool.vy[i], vy);
+    }
+}
+
+// No GCC, target("avx512f") liga FMA e mul+add viraria vfmadd (resultado diferente do
+// escalar); o aviso é falso positivo do GCC 12 em avx512fintrin.h
+#ifndef __clang__
+#pragma GCC push_options
+#pragma GCC optimize("fp-contract=off")
+#endif
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+__attribute__((target("avx512f")))
+static inline __m512 negate(__m512 value, __mmask16 lanes, __m512i sign) {
+    __m512i bits = _mm512_castps_si512(value);
+    return _mm512_castsi512_ps(_mm512_mask_xor_epi32(bits, lanes, bits, sign));
+}
+
+__attribute__((target("avx512f")))
+static void integrateAvx512(BallPool& pool, float deltaTime, const PaddleBounds& paddle) {
+    const __m512 dt = _mm512_set1_ps(deltaTime);
+    const __m512 left = _mm512_set1_ps(LEFT_WALL);
+    const __m512 right = _mm512_set1_ps(RIGHT_WALL);
+    const __m512 ceiling = _mm512_set1_ps(CEILING);
+    const __m512 paddleLeft = _mm512_set1_ps(paddle.left);
+    const __m512 paddleRight = _mm512_set1_ps(paddle.right);
+    const __m512 paddleBottom = _mm512_set1_ps(paddle.bottom);
+    const __m512 paddleTop = _mm512_set1_ps(paddle.top);
+    const __m512i sign = _mm512_set1_epi32(static_cast<int>(0x80000000u));
+    for (int i = 0; i < pool.end(); i += 16) {
+        __m512 r = _mm512_loadu_ps(&pool.radius[i]);
+        __m512 vx = _mm512_loadu_ps(&pool.vx[i]);
+        __m512 vy = _mm512_loadu_ps(&pool.vy[i]);
+        __m512 x = _mm512_add_ps(_mm512_loadu_ps(&pool.x[i]), _mm512_mul_ps(vx, dt));
+        __m512 y = _mm512_add_ps(_mm512_loadu_ps(&pool.y[i]), _mm512_mul_ps(vy, dt));
+
+        // Máscaras de 16 bits: a negação troca o bit de sinal só nos lanes marcados
+        __mmask16 hit = _mm512_cmp_ps_mask(_mm512_sub_ps(x, r), left, _CMP_LT_OQ);
+        vx = negate(vx, hit, sign);
+        x = _mm512_mask_add_ps(x, hit, left, r);
+
+        hit = _mm512_cmp_ps_mask(_mm512_add_ps(x, r), right, _CMP_GT_OQ);
+        vx = negate(vx, hit, sign);
+        x = _mm512_mask_sub_ps(x, hit, right, r);
+
+        hit = _mm512_cmp_ps_mask(_mm512_add_ps(y, r), ceiling, _CMP_GT_OQ);
+        vy = negate(vy, hit, sign);
+        y = _mm512_mask_sub_ps(y, hit, ceiling, r);
+
+        hit = _mm512_cmp_ps_mask(_mm512_add_ps(x, r), paddleLeft, _CMP_GT_OQ) &
+              _mm512_cmp_ps_mask(_mm512_sub_ps(x, r), paddleRight, _CMP_LT_OQ) &
+              _mm512_cmp_ps_mask(_mm512_add_ps(y, r), paddleBottom, _CMP_GT_OQ) &
+              _mm512_cmp_ps_mask(_mm512_sub_ps(y, r), paddleTop, _CMP_LT_OQ);
+        vy = negate(vy, hit, sign);
+
+        _mm512_storeu_ps(&pool.x[i], x);
+        _mm512_storeu_ps(&pool.y[i], y);
+        _mm512_storeu_ps(&pool.vx[i], vx);
+        _mm512_storeu_ps(&pool.vy[i], vy);
+    }
+}
+#pragma GCC diagnostic pop
+#ifndef __clang__
+#pragma GCC pop_options
+#endif
+
+#endif
+
+void integrateBallsWith(SimdLevel level, BallPool& pool, float deltaTime, const Paddle& paddle) {
+    PaddleBounds bounds(paddle);
+    switch (level) {
+#ifdef SIMD_X86
+    case SimdLevel::Avx512:
+        integrateAvx512(pool, deltaTime, bounds);
+        return;
+    case SimdLevel::Avx2:
+        integrateAvx2(pool, deltaTime, bounds);
+        return;
+    case SimdLevel::Sse2:
+        integrateSse2(pool, deltaTime, bounds);
+        return;
+#endif
+    case SimdLevel::Scalar:
+    default:
+        integrateScalar(pool, deltaTime, bounds);
+        return;
+    }
+}
+
+void integrateBalls(BallPool& pool, float deltaTime, const Paddle& paddle) {
+    integrateBallsWith(activeSimdLevel(), pool, deltaTime, paddle);
+}
@@ -0,0 +1,66 @@
+#ifndef BALL_POOL_H
+#define BALL_POOL_H
+
+#include <cstdint>
+#include <vector>
+#include <glm/glm.hpp>
+#include <commons/CommandBuffer.h>
+#include <commons/Simd.h>
+#include "Ball.h"
+#include "Paddle.h"
+
+// Bolas em arrays separados (SoA), para integrar muitas de uma vez com SIMD.
+// Capacidade fixa: tudo é alocado no construtor e spawn/despawn só mexem na lista de
+// posições livres, então criar ou perder bolas durante o jogo nunca aloca. Posições
+// livres continuam nos arrays (paradas, raio 0); os kernels as processam sem efeito e
+// quem percorre as bolas pula as que não estão vivas. Os arrays têm tamanho múltiplo
+// de PADDING para os kernels lerem grupos inteiros.
+class BallPool {
+public:
+    static const int PADDING = 16;
+
+    explicit BallPool(int capacity);
+    BallPool(const BallPool& other) = default;
+
+    // Com a mesma capacidade, copia só as posições em uso e não aloca (é o caso do
+    // GameState publicado a cada tick pelo TripleBuffer)
+    BallPool& operator=(const BallPool& other);
+
+    // Índice da nova bola, ou -1 se o pool estiver cheio
+    int spawn(const Ball& ball);
+    void despawn(int index);
+    void clear();
+
+    bool isAlive(int index) const;
+    int size() const;
+    int getCapacity() const;
+
+    // 1 + o maior índice já ocupado desde o último clear(); percorrer [0, end())
+    int end() const;
+
+    // Cópia/escrita de uma bola, para as regras que ainda trabalham com Ball
+    Ball get(int index) const;
+    void set(int index, const Ball& ball);
+
+    // Grava todas as bolas vivas (como Ball::record); viram um único draw instanciado
+    void record(CommandBuffer& commands) const;
+
+    std::vector<float> x, y, vx, vy, radius;
+
+private:
+    std::vector<uint8_t> alive;
+    std::vector<int> freeList;  // pilha; reservada com a capacidade inteira
+    int capacity;
+    int count = 0;
+    int used = 0;
+};
+
+// Um passo de Ball::move seguido de checkCollisionPaddle para as bolas em [0, end()), com o
+// mesmo resultado bit a bit: anda, resolve as paredes em -0.8/0.7 e o teto em 0.9 e
+// quica no paddle. Vários lanes por instrução, com seleções no lugar dos desvios.
+void integrateBalls(BallPool& pool, float deltaTime, const Paddle& paddle);
+
+// Igual, num nível específico (que a CPU precisa suportar); usado pelos microbenchmarks
+void integrateBallsWith(SimdLevel level, BallPool& pool, float deltaTime, const Paddle& paddle);
+
+#endif
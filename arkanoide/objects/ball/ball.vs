@@ -1,11 +0,0 @@
-#version 330 core
-layout(location = 0) in vec2 aPos;
-
-uniform mat4 model;
-uniform mat4 projection;
-out vec2 TexCoords;
-
-void main() {
-    gl_Position = projection * model * vec4(aPos, 0.0, 1.0);
-    TexCoords = aPos;
-}
\ No newline at end of file
@@ -2,7 +2,7 @@
 #define Block_H
 
 #include <glm/glm.hpp>
-#include <glad/glad.h>
+#include <commons/CommandBuffer.h>
 #include "Ball.h"
 
 class Ball;
@@ -10,9 +10,11 @@ class Ball;
 class Block {
 public:
     Block(float width, float height, float initialX, float initialY);
-    ~Block();
 
-    void draw(float r, float g, float b);
+    void record(CommandBuffer& commands, glm::vec3 color) const;
+
+    // O mesmo quadrado, como instância de uma camada persistente (InstanceLayer)
+    InstanceData instance(glm::vec3 color) const;
 
     float getX() const;
     float getY() const;
@@ -22,7 +24,6 @@ public:
     bool checkCollision(Ball& ball);
 
 private:
-    GLuint VAO, VBO;
     glm::vec2 position;
     float width, height;
 };
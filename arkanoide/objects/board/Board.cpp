@@ -0,0 +1,243 @@
+#include "Board.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <utility>
+#include <commons/Profiler.h>
+
+static glm::vec3 getRandomColor() {
+    float r = static_cast<float>(rand()) / RAND_MAX;
+    float g = static_cast<float>(rand()) / RAND_MAX;
+    float b = static_cast<float>(rand()) / RAND_MAX;
+    return glm::vec3(r, g, b);
+}
+
+Board::Board(int numRows, int numCols) {
+    this->numRows = numRows;
+    this->numCols = numCols;
+    this->numBricks = numRows * numCols;
+
+    // Medidas do tabuleiro 7x8 original, escaladas para caber na mesma área
+    float scaleX = 8.0f / numCols;
+    float scaleY = 7.0f / numRows;
+    this->blockWidth = 0.15f * scaleX;
+    this->blockHeight = 0.1f * scaleY;
+    this->spacingX = 0.02f * scaleX;
+    this->spacingY = 0.02f * scaleY;
+    this->originX = -0.65f;
+    this->originY = 0.8f;
+
+    rowColors.reserve(numRows);
+    for (int i = 0; i < numRows; ++i) {
+        rowColors.push_back(getRandomColor());
+    }
+}
+
+Board::Board(std::shared_ptr<const LevelFile> level) {
+    const LevelHeader& header = level->header();
+    this->numRows = static_cast<int>(header.rows);
+    this->numCols = static_cast<int>(header.cols);
+    this->numBricks = static_cast<int>(header.bricks);
+    this->blockWidth = header.blockWidth;
+    this->blockHeight = header.blockHeight;
+    this->spacingX = header.spacingX;
+    this->spacingY = header.spacingY;
+    this->originX = header.originX;
+    this->originY = header.originY;
+    this->level = std::move(level);
+}
+
+int Board::getRows() const {
+    return numRows;
+}
+
+int Board::getCols() const {
+    return numCols;
+}
+
+int Board::size() const {
+    return numBricks;
+}
+
+const LevelFile* Board::getLevel() const {
+    return level.get();
+}
+
+Block Board::getBlock(int row, int col) const {
+    float x = originX + col * (blockWidth + spacingX);
+    float y = originY - row * (blockHeight + spacingY);
+    return Block(blockWidth, blockHeight, x, y);
+}
+
+bool Board::hasBlock(int row, int col) const {
+    return getHitPoints(row, col) > 0;
+}
+
+int Board::getHitPoints(int row, int col) const {
+    if (!level) {
+        return 1;
+    }
+    return level->hitPoints()[static_cast<size_t>(row) * numCols + col];
+}
+
+glm::vec3 Board::getColor(int row, int col) const {
+    if (!level) {
+        return rowColors[row];
+    }
+    uint32_t index = level->colorIndices()[static_cast<size_t>(row) * numCols + col];
+    const float* color = level->palette() + 3 * std::min(index, level->header().paletteSize - 1);
+    return glm::vec3(color[0], color[1], color[2]);
+}
+
+void Board::getCell(const Block& block, int& row, int& col) const {
+    row = static_cast<int>(std::lround((originY - block.getY()) / (blockHeight + spacingY)));
+    col = static_cast<int>(std::lround((block.getX() - originX) / (blockWidth + spacingX)));
+    row = std::min(std::max(row, 0), numRows - 1);
+    col = std::min(std::max(col, 0), numCols - 1);
+}
+
+glm::vec3 Board::getBlockColor(const Block& block) const {
+    int row, col;
+    getCell(block, row, col);
+    return getColor(row, col);
+}
+
+int Board::getBlockHitPoints(const Block& block) const {
+    int row, col;
+    getCell(block, row, col);
+    return getHitPoints(row, col);
+}
+
+std::pmr::vector<Block> Board::getActiveBlocks(const std::vector<Block>& disabledBlocks, std::pmr::memory_resource* resource) const {
+    // Reservado de uma vez: numa arena, cada realocação deixaria o vetor antigo para trás
+    std::pmr::vector<Block> activeBlocks(resource);
+    activeBlocks.reserve(numBricks);
+    std::pmr::vector<uint64_t> disabled = disabledBitmap(disabledBlocks, resource);
+    for (int i = 0; i < numRows; ++i) {
+        for (int j = 0; j < numCols; ++j) {
+            size_t key = static_cast<size_t>(i) * numCols + j;
+            if (hasBlock(i, j) && !(disabled[key / 64] >> (key % 64) & 1)) {
+                activeBlocks.push_back(getBlock(i, j));
+            }
+        }
+    }
+    return activeBlocks;
+}
+
+std::pmr::vector<uint64_t> Board::disabledBitmap(const std::vector<Block>& disabledBlocks, std::pmr::memory_resource* resource) const {
+    std::pmr::vector<uint64_t> disabled((static_cast<size_t>(numRows) * numCols + 63) / 64, 0, resource);
+    for (const auto& block : disabledBlocks) {
+        uint64_t key = getBlockKey(block);
+        disabled[key / 64] |= uint64_t(1) << (key % 64);
+    }
+    return disabled;
+}
+
+uint64_t Board::getBlockKey(const Block& block) const {
+    int row, col;
+    getCell(block, row, col);
+    return static_cast<uint64_t>(row) * numCols + col;
+}
+
+void Board::fillLayer(const std::vector<Block>& disabledBlocks, InstanceLayer& layer) const {
+    PROFILE_SCOPE("fillLayer");
+    std::pmr::vector<uint64_t> disabled = disabledBitmap(disabledBlocks, std::pmr::get_default_resource());
+    for (int i = 0; i < numRows; ++i) {
+        for (int j = 0; j < numCols; ++j) {
+            size_t key = static_cast<size_t>(i) * numCols + j;
+            if (hasBlock(i, j) && !(disabled[key / 64] >> (key % 64) & 1)) {
+                layer.add(key, getBlock(i, j).instance(getColor(i, j)));
+            }
+        }
+    }
+}
+
+bool isBlockInDisabledBlocks(const std::vector<Block>& disabledBlocks, const Block& block) {
+    for (const auto& disabledBlock : disabledBlocks) {
+        if (disabledBlock.getPosition() == block.getPosition()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool checkCollisionPaddle(Ball& ball, Paddle& paddle) {
+    // Obteem as informações do paddle
+    float paddleX = paddle.getPosition().x;
+    float paddleY = paddle.getPosition().y;
+    float paddleWidth = paddle.getWidth();
+    float paddleHeight = paddle.getHeight();
+
+    // Obtem as informações da bola
+    glm::vec2 ballPosition = ball.getPosition();
+    float ballRadius = ball.getRadius();
+
+    // Verifica a colisão
+    if (ballPosition.x + ballRadius > paddleX - paddleWidth / 2.0f &&
+        ballPosition.x - ballRadius < paddleX + paddleWidth / 2.0f &&
+        ballPosition.y + ballRadius > paddleY - paddleHeight / 2.0f &&
+        ballPosition.y - ballRadius < paddleY + paddleHeight / 2.0f) {
+        // Ocorreu colisao, inverte o componente y da velocidade da bola para fazê-la quicar para cima
+        glm::vec2 ballVelocity = ball.velocity;
+        ballVelocity.y = -ballVelocity.y;
+        ball.velocity = ballVelocity;
+        return true; // Houve colisão
+    }
+
+    return false; // Não houve colisão
+}
+
+void CollisionBlocks::assign(std::pmr::vector<Block> activeBlocks) {
+    blocks = std::move(activeBlocks);
+    bounds.assign(blocks);
+    resisted.clear();
+}
+
+void CollisionBlocks::beginTick() {
+    for (int index : resisted) {
+        bounds.set(index, blocks[index]);
+    }
+    resisted.clear();
+}
+
+void CollisionBlocks::resist(int index) {
+    resisted.push_back(index);
+}
+
+int verifyCollisionBlocks(std::pmr::vector<Block>& blocks, BlockBounds& bounds, Ball& ball, std::vector<Block>& disabledBlocks) {
+    return verifyCollisionBlocks(blocks, bounds, ball, disabledBlocks, UNKNOWN_CANDIDATE);
+}
+
+// Bolas por trecho do parallelFor: abaixo disso o teste de uma bola custa menos que um job
+static const int CANDIDATE_GRAIN = 64;
+
+void findCollisionCandidates(JobSystem& jobs, const BlockBounds& bounds, const BallPool& balls, float offsetY, std::pmr::vector<int>& candidates) {
+    PROFILE_SCOPE("findCollisionCandidates");
+    int end = balls.end();
+    candidates.resize(end);
+    jobs.parallelFor(0, end, CANDIDATE_GRAIN, [&](int first, int last) {
+        for (int i = first; i < last; ++i) {
+            if (!balls.isAlive(i) || balls.y[i] < -1.0f) {
+                candidates[i] = UNKNOWN_CANDIDATE;
+                continue;
+            }
+            glm::vec2 center = glm::vec2(balls.x[i], balls.y[i]) + glm::vec2(0.0f, offsetY);
+            candidates[i] = collideCircle(bounds, center, balls.radius[i]);
+        }
+    });
+}
+
+int verifyCollisionBlocks(std::pmr::vector<Block>& blocks, BlockBounds& bounds, Ball& ball, std::vector<Block>& disabledBlocks, int candidate) {
+    // Sem PROFILE_SCOPE: roda uma vez por bola por tick; quem chama mede a passada inteira
+    // Mesmo critério de Block::checkCollision, vários blocos por instrução
+    int hit = candidate;
+    if (candidate == UNKNOWN_CANDIDATE || (candidate >= 0 && !bounds.contains(candidate))) {
+        hit = collideCircle(bounds, ball.getPosition(), ball.getRadius());
+    }
+    if (hit >= 0) {
+        disabledBlocks.push_back(blocks[hit]);
+        ball.moveCollision(blocks[hit]);
+        bounds.remove(hit);
+    }
+    return hit;
+}
@@ -0,0 +1,115 @@
+#ifndef BOARD_H
+#define BOARD_H
+
+#include <memory>
+#include <memory_resource>
+#include <vector>
+#include <glm/glm.hpp>
+#include <commons/CommandBuffer.h>
+#include <commons/InstanceLayer.h>
+#include <commons/JobSystem.h>
+#include "Ball.h"
+#include "BallPool.h"
+#include "Block.h"
+#include "CollisionKernels.h"
+#include "LevelFile.h"
+#include "Paddle.h"
+
+// Grade de blocos do jogo. O tabuleiro padrão (7x8) é o original; tabuleiros maiores
+// ocupam a mesma área com blocos proporcionalmente menores (usados pelo bench). Um
+// tabuleiro também pode vir de uma fase compilada (LevelFile): aí medidas, células
+// vazias, resistência e cores são as do arquivo, lidas direto do mapeamento.
+class Board {
+public:
+    Board(int numRows, int numCols);
+    explicit Board(std::shared_ptr<const LevelFile> level);
+
+    int getRows() const;
+    int getCols() const;
+
+    // Número de blocos (células não vazias)
+    int size() const;
+
+    // Fase de onde o tabuleiro veio, ou nullptr se foi gerado
+    const LevelFile* getLevel() const;
+
+    Block getBlock(int row, int col) const;
+    bool hasBlock(int row, int col) const;
+    int getHitPoints(int row, int col) const;
+    glm::vec3 getColor(int row, int col) const;
+
+    // Célula de um bloco deste tabuleiro (ex.: um bloco de disabledBlocks)
+    void getCell(const Block& block, int& row, int& col) const;
+    glm::vec3 getBlockColor(const Block& block) const;
+    int getBlockHitPoints(const Block& block) const;
+
+    // Chave de um bloco numa InstanceLayer: linha * colunas + coluna
+    uint64_t getBlockKey(const Block& block) const;
+
+    // Blocos fora de disabledBlocks, em O(blocos + quebrados); o vetor e o bitmap
+    // temporário saem de `resource`
+    std::pmr::vector<Block> getActiveBlocks(const std::vector<Block>& disabledBlocks,
+                                            std::pmr::memory_resource* resource = std::pmr::get_default_resource()) const;
+
+    // Põe na camada todos os blocos fora de disabledBlocks; daí em diante basta tirar os
+    // que forem quebrados (InstanceLayer::remove com getBlockKey)
+    void fillLayer(const std::vector<Block>& disabledBlocks, InstanceLayer& layer) const;
+
+private:
+    // Um bit por chave (getBlockKey), ligado para cada bloco de disabledBlocks
+    std::pmr::vector<uint64_t> disabledBitmap(const std::vector<Block>& disabledBlocks, std::pmr::memory_resource* resource) const;
+
+    int numRows, numCols, numBricks;
+    float blockWidth, blockHeight;
+    float spacingX, spacingY;
+    float originX, originY;
+    std::vector<glm::vec3> rowColors;        // tabuleiro gerado: uma cor por linha
+    std::shared_ptr<const LevelFile> level;  // tabuleiro de fase
+};
+
+bool isBlockInDisabledBlocks(const std::vector<Block>& disabledBlocks, const Block& block);
+
+// Blocos inteiros vistos pela colisão, mantidos de um tick para o outro: montados uma vez
+// (assign) e depois cada bloco atingido só esvazia a sua caixa. Nada é refeito por tick,
+// então o custo do tick não cresce com o número de blocos já quebrados. Quem monta precisa
+// chamar assign de novo quando os blocos mudam por fora da colisão (ex.: chunks da rolagem).
+struct CollisionBlocks {
+    std::pmr::vector<Block> blocks;  // o bloco de cada caixa de bounds
+    BlockBounds bounds;
+    std::vector<int> resisted;       // caixas que voltam no próximo beginTick
+
+    // activeBlocks pode vir de uma arena: com outro resource, os blocos são copiados para
+    // `blocks`, que guarda a capacidade de uma montagem para a outra
+    void assign(std::pmr::vector<Block> activeBlocks);
+
+    // Começo do tick: devolve as caixas dos blocos que aguentaram um golpe no tick anterior.
+    // Até lá elas ficam vazias, como se as caixas fossem refeitas a cada tick.
+    void beginTick();
+
+    // O bloco da caixa `index` (retornada por verifyCollisionBlocks) aguentou o golpe
+    void resist(int index);
+};
+
+// Quica a bola no paddle; retorna se houve colisão
+bool checkCollisionPaddle(Ball& ball, Paddle& paddle);
+
+// Desativa o primeiro bloco de `blocks` que a bola atinge e a desvia dele; `bounds` são
+// as caixas dos mesmos blocos (BlockBounds::assign, ou as de CollisionBlocks). A caixa do
+// bloco atingido é esvaziada, para outra bola não o desativar de novo. Retorna a caixa
+// atingida, ou -1.
+int verifyCollisionBlocks(std::pmr::vector<Block>& blocks, BlockBounds& bounds, Ball& ball, std::vector<Block>& disabledBlocks);
+
+// Fase larga de verifyCollisionBlocks para todas as bolas do pool, em paralelo: candidates[i]
+// recebe o primeiro bloco que a bola i (deslocada de offsetY, como na colisão em rolagem)
+// atinge em `bounds`, -1 se nenhum, ou UNKNOWN_CANDIDATE se a bola está morta ou já caiu.
+// Só lê `bounds`; as bolas ainda são resolvidas uma a uma, na ordem, pela sobrecarga abaixo.
+const int UNKNOWN_CANDIDATE = -2;
+void findCollisionCandidates(JobSystem& jobs, const BlockBounds& bounds, const BallPool& balls, float offsetY, std::pmr::vector<int>& candidates);
+
+// verifyCollisionBlocks com o resultado de findCollisionCandidates para esta bola. As caixas
+// só são removidas durante o tick, então o candidato continua sendo o primeiro atingido
+// enquanto não for removido por uma bola anterior; aí (ou sem candidato) testa de novo.
+// O resultado é o mesmo de testar bola a bola.
+int verifyCollisionBlocks(std::pmr::vector<Block>& blocks, BlockBounds& bounds, Ball& ball, std::vector<Block>& disabledBlocks, int candidate);
+
+#endif
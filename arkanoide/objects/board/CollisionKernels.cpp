@@ -0,0 +1,176 @@
+#include "CollisionKernels.h"
+#include <cstring>
+#include <limits>
+
+// Os kernels SIMD usam só min/max, subtração, multiplicação e comparação, sem FMA:
+// o resultado é bit a bit o mesmo da versão escalar (compilada sem -mfma).
+
+void BlockBounds::assign(const std::pmr::vector<Block>& blocks) {
+    count = static_cast<int>(blocks.size());
+    size_t padded = (blocks.size() + PADDING - 1) / PADDING * PADDING;
+    const float infinity = std::numeric_limits<float>::infinity();
+    minX.assign(padded, infinity);
+    minY.assign(padded, infinity);
+    maxX.assign(padded, -infinity);
+    maxY.assign(padded, -infinity);
+    for (size_t i = 0; i < blocks.size(); ++i) {
+        set(static_cast<int>(i), blocks[i]);
+    }
+}
+
+void BlockBounds::set(int index, const Block& block) {
+    minX[index] = block.getX();
+    minY[index] = block.getY();
+    maxX[index] = block.getX() + block.getWidth();
+    maxY[index] = block.getY() + block.getHeight();
+}
+
+void BlockBounds::remove(int index) {
+    const float infinity = std::numeric_limits<float>::infinity();
+    minX[index] = infinity;
+    minY[index] = infinity;
+    maxX[index] = -infinity;
+    maxY[index] = -infinity;
+}
+
+bool BlockBounds::contains(int index) const {
+    return minX[index] <= maxX[index];
+}
+
+int BlockBounds::maskWords() const {
+    return (count + 63) / 64;
+}
+
+static int collideScalar(const BlockBounds& bounds, float x, float y, float radiusSquared, uint64_t* hitMask) {
+    int first = -1;
+    for (int i = 0; i < bounds.count; ++i) {
+        float closestX = (x < bounds.minX[i]) ? bounds.minX[i] : ((x > bounds.maxX[i]) ? bounds.maxX[i] : x);
+        float closestY = (y < bounds.minY[i]) ? bounds.minY[i] : ((y > bounds.maxY[i]) ? bounds.maxY[i] : y);
+        float distanceX = x - closestX;
+        float distanceY = y - closestY;
+        if ((distanceX * distanceX) + (distanceY * distanceY) <= radiusSquared) {
+            if (!hitMask) {
+                return i;
+            }
+            hitMask[i / 64] |= uint64_t(1) << (i % 64);
+            if (first < 0) {
+                first = i;
+            }
+        }
+    }
+    return first;
+}
+
+// Os grupos têm 4, 8 ou 16 blocos e começam em múltiplos do tamanho, então os bits de
+// um grupo nunca cruzam a fronteira de uma palavra da máscara
+static inline bool recordGroup(int base, uint64_t bits, uint64_t* hitMask, int& first) {
+    if (bits == 0) {
+        return false;
+    }
+    if (first < 0) {
+        first = base + __builtin_ctzll(bits);
+    }
+    if (hitMask) {
+        hitMask[base / 64] |= bits << (base % 64);
+    }
+    return !hitMask;
+}
+
+#ifdef SIMD_X86
+
+static int collideSse2(const BlockBounds& bounds, float x, float y, float radiusSquared, uint64_t* hitMask) {
+    const __m128 px = _mm_set1_ps(x);
+    const __m128 py = _mm_set1_ps(y);
+    const __m128 r2 = _mm_set1_ps(radiusSquared);
+    int first = -1;
+    for (int i = 0; i < bounds.count; i += 4) {
+        __m128 closestX = _mm_min_ps(_mm_max_ps(px, _mm_loadu_ps(&bounds.minX[i])), _mm_loadu_ps(&bounds.maxX[i]));
+        __m128 closestY = _mm_min_ps(_mm_max_ps(py, _mm_loadu_ps(&bounds.minY[i])), _mm_loadu_ps(&bounds.maxY[i]));
+        __m128 dx = _mm_sub_ps(px, closestX);
+        __m128 dy = _mm_sub_ps(py, closestY);
+        __m128 distance = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+        uint64_t bits = static_cast<uint64_t>(_mm_movemask_ps(_mm_cmple_ps(distance, r2)));
+        if (recordGroup(i, bits, hitMask, first)) {
+            break;
+        }
+    }
+    return first;
+}
+
+__attribute__((target("avx2")))
+static int collideAvx2(const BlockBounds& bounds, float x, float y, float radiusSquared, uint64_t* hitMask) {
+    const __m256 px = _mm256_set1_ps(x);
+    const __m256 py = _mm256_set1_ps(y);
+    const __m256 r2 = _mm256_set1_ps(radiusSquared);
+    int first = -1;
+    for (int i = 0; i < bounds.count; i += 8) {
+        __m256 closestX = _mm256_min_ps(_mm256_max_ps(px, _mm256_loadu_ps(&bounds.minX[i])), _mm256_loadu_ps(&bounds.maxX[i]));
+        __m256 closestY = _mm256_min_ps(_mm256_max_ps(py, _mm256_loadu_ps(&bounds.minY[i])), _mm256_loadu_ps(&bounds.maxY[i]));
+        __m256 dx = _mm256_sub_ps(px, closestX);
+        __m256 dy = _mm256_sub_ps(py, closestY);
+        __m256 distance = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+        uint64_t bits = static_cast<uint64_t>(_mm256_movemask_ps(_mm256_cmp_ps(distance, r2, _CMP_LE_OQ)));
+        if (recordGroup(i, bits, hitMask, first)) {
+            break;
+        }
+    }
+    return first;
+}
+
+// No GCC, target("avx512f") liga FMA e mul+add viraria vfmadd (resultado diferente do
+// escalar); o aviso é falso positivo do GCC 12 em avx512fintrin.h
+#ifndef __clang__
+#pragma GCC push_options
+#pragma GCC optimize("fp-contract=off")
+#endif
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+__attribute__((target("avx512f")))
+static int collideAvx512(const BlockBounds& bounds, float x, float y, float radiusSquared, uint64_t* hitMask) {
+    const __m512 px = _mm512_set1_ps(x);
+    const __m512 py = _mm512_set1_ps(y);
+    const __m512 r2 = _mm512_set1_ps(radiusSquared);
+    int first = -1;
+    for (int i = 0; i < bounds.count; i += 16) {
+        __m512 closestX = _mm512_min_ps(_mm512_max_ps(px, _mm512_loadu_ps(&bounds.minX[i])), _mm512_loadu_ps(&bounds.maxX[i]));
+        __m512 closestY = _mm512_min_ps(_mm512_max_ps(py, _mm512_loadu_ps(&bounds.minY[i])), _mm512_loadu_ps(&bounds.maxY[i]));
+        __m512 dx = _mm512_sub_ps(px, closestX);
+        __m512 dy = _mm512_sub_ps(py, closestY);
+        __m512 distance = _mm512_add_ps(_mm512_mul_ps(dx, dx), _mm512_mul_ps(dy, dy));
+        uint64_t bits = static_cast<uint64_t>(_mm512_cmp_ps_mask(distance, r2, _CMP_LE_OQ));
+        if (recordGroup(i, bits, hitMask, first)) {
+            break;
+        }
+    }
+    return first;
+}
+#pragma GCC diagnostic pop
+#ifndef __clang__
+#pragma GCC pop_options
+#endif
+
+#endif
+
+int collideCircleWith(SimdLevel level, const BlockBounds& bounds, glm::vec2 center, float radius, uint64_t* hitMask) {
+    if (hitMask) {
+        std::memset(hitMask, 0, bounds.maskWords() * sizeof(uint64_t));
+    }
+    float radiusSquared = radius * radius;
+    switch (level) {
+#ifdef SIMD_X86
+    case SimdLevel::Avx512:
+        return collideAvx512(bounds, center.x, center.y, radiusSquared, hitMask);
+    case SimdLevel::Avx2:
+        return collideAvx2(bounds, center.x, center.y, radiusSquared, hitMask);
+    case SimdLevel::Sse2:
+        return collideSse2(bounds, center.x, center.y, radiusSquared, hitMask);
+#endif
+    case SimdLevel::Scalar:
+    default:
+        return collideScalar(bounds, center.x, center.y, radiusSquared, hitMask);
+    }
+}
+
+int collideCircle(const BlockBounds& bounds, glm::vec2 center, float radius, uint64_t* hitMask) {
+    return collideCircleWith(activeSimdLevel(), bounds, center, radius, hitMask);
+}
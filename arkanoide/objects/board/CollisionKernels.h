@@ -0,0 +1,51 @@
+#ifndef COLLISION_KERNELS_H
+#define COLLISION_KERNELS_H
+
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+#include <glm/glm.hpp>
+#include <commons/Simd.h>
+#include "Block.h"
+
+// Caixas dos blocos em arrays separados (SoA), no formato que os kernels SIMD leem
+// direto: [minX, maxX] x [minY, maxY] do bloco i na posição i de cada array. Os
+// arrays têm tamanho múltiplo de PADDING; as posições extras são caixas vazias
+// (min = +inf, max = -inf) que nunca colidem. Os arrays saem de `resource` (ex.: a
+// FrameArena do tick, quando as caixas são montadas de novo a cada tick).
+struct BlockBounds {
+    static const int PADDING = 16;
+
+    std::pmr::vector<float> minX, minY, maxX, maxY;
+    int count = 0;
+
+    explicit BlockBounds(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : minX(resource), minY(resource), maxX(resource), maxY(resource) {
+    }
+
+    void assign(const std::pmr::vector<Block>& blocks);
+
+    // Troca a caixa i por uma vazia, sem mexer nos índices das outras
+    void remove(int index);
+
+    // Põe de volta na posição i a caixa de `block` (i < count)
+    void set(int index, const Block& block);
+
+    // Se a caixa i ainda não foi removida
+    bool contains(int index) const;
+
+    // Palavras de 64 bits necessárias para a máscara de colisões
+    int maskWords() const;
+};
+
+// Testa o círculo contra todos os blocos, com o mesmo critério de Block::checkCollision
+// (ponto mais próximo da caixa a no máximo `radius` do centro). Retorna o índice do
+// primeiro bloco atingido (na ordem dos arrays) ou -1. Com `hitMask` (maskWords()
+// palavras) percorre todos e marca o bit i de cada bloco atingido; sem ela, para no
+// primeiro grupo com colisão.
+int collideCircle(const BlockBounds& bounds, glm::vec2 center, float radius, uint64_t* hitMask = nullptr);
+
+// Igual, num nível específico (que a CPU precisa suportar); usado pelos microbenchmarks
+int collideCircleWith(SimdLevel level, const BlockBounds& bounds, glm::vec2 center, float radius, uint64_t* hitMask = nullptr);
+
+#endif
@@ -0,0 +1,121 @@
+#include "LevelFile.h"
+#include <algorithm>
+#include <initializer_list>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static const uint64_t SECTION_ALIGNMENT = 64;
+
+// Os mesmos tamanhos de struct.Struct em tools/compile_level.py
+static_assert(sizeof(LevelHeader) == 96, "LevelHeader mudou: atualize tools/compile_level.py");
+static_assert(sizeof(LevelChunk) == 16, "LevelChunk mudou: atualize tools/compile_level.py");
+
+// Seção [offset, offset + length) alinhada e dentro do arquivo, sem estourar nas somas
+static bool validSection(uint64_t offset, uint64_t length, uint64_t fileSize) {
+    return offset % SECTION_ALIGNMENT == 0 && offset <= fileSize && length <= fileSize - offset;
+}
+
+LevelFile::~LevelFile() {
+    close();
+}
+
+bool LevelFile::open(const char* path) {
+    close();
+    int fd = ::open(path, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(LevelHeader)) {
+        ::close(fd);
+        return false;
+    }
+    size_t length = static_cast<size_t>(info.st_size);
+    void* mapped = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // o mapeamento continua válido
+    if (mapped == MAP_FAILED) {
+        return false;
+    }
+    data = static_cast<const uint8_t*>(mapped);
+    size = length;
+
+    const LevelHeader& level = header();
+    uint64_t cells = static_cast<uint64_t>(level.rows) * level.cols;
+    bool valid = level.magic == MAGIC && level.version == VERSION && level.fileSize == size &&
+                 level.rows > 0 && level.cols > 0 && level.paletteSize > 0 && level.bricks <= cells &&
+                 level.chunkRows > 0 && level.chunkCount == (level.rows + level.chunkRows - 1) / level.chunkRows &&
+                 validSection(level.paletteOffset, uint64_t(level.paletteSize) * 3 * sizeof(float), size) &&
+                 validSection(level.chunkOffset, uint64_t(level.chunkCount) * sizeof(LevelChunk), size) &&
+                 validSection(level.hitPointsOffset, cells, size) &&
+                 validSection(level.colorOffset, cells, size);
+    if (!valid) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+void LevelFile::close() {
+    if (data) {
+        munmap(const_cast<uint8_t*>(data), size);
+        data = nullptr;
+        size = 0;
+    }
+}
+
+const LevelHeader& LevelFile::header() const {
+    return *reinterpret_cast<const LevelHeader*>(data);
+}
+
+const float* LevelFile::palette() const {
+    return reinterpret_cast<const float*>(data + header().paletteOffset);
+}
+
+const LevelChunk* LevelFile::chunks() const {
+    return reinterpret_cast<const LevelChunk*>(data + header().chunkOffset);
+}
+
+const uint8_t* LevelFile::hitPoints() const {
+    return data + header().hitPointsOffset;
+}
+
+const uint8_t* LevelFile::colorIndices() const {
+    return data + header().colorOffset;
+}
+
+void LevelFile::prefetch(int chunk) const {
+    advise(chunk, MADV_WILLNEED);
+}
+
+void LevelFile::release(int chunk) const {
+    advise(chunk, MADV_DONTNEED);
+}
+
+void LevelFile::advise(int chunk, int advice) const {
+    // Linhas do chunk calculadas pelo cabeçalho (já conferido), não pela tabela
+    const LevelHeader& level = header();
+    uint32_t firstRow = static_cast<uint32_t>(chunk) * level.chunkRows;
+    uint32_t rowCount = std::min(level.chunkRows, level.rows - firstRow);
+    size_t first = static_cast<size_t>(firstRow) * level.cols;
+    size_t length = static_cast<size_t>(rowCount) * level.cols;
+
+    // madvise quer endereços alinhados à página; as bordas parciais ficam de fora no
+    // release (são compartilhadas com os chunks vizinhos) e entram no prefetch
+    const uintptr_t page = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    for (uint64_t offset : { level.hitPointsOffset, level.colorOffset }) {
+        uintptr_t begin = reinterpret_cast<uintptr_t>(data + offset + first);
+        uintptr_t end = begin + length;
+        if (advice == MADV_DONTNEED) {
+            begin = (begin + page - 1) / page * page;
+            end = end / page * page;
+        } else {
+            begin = begin / page * page;
+            end = (end + page - 1) / page * page;
+        }
+        if (begin < end) {
+            madvise(reinterpret_cast<void*>(begin), end - begin, advice);
+        }
+    }
+}
@@ -0,0 +1,82 @@
+#ifndef LEVEL_FILE_H
+#define LEVEL_FILE_H
+
+#include <cstddef>
+#include <cstdint>
+
+// Fase compilada (.lvl), gerada por tools/compile_level.py a partir do formato texto.
+// O arquivo é mapeado com mmap e lido direto do mapeamento: abrir só confere o
+// cabeçalho, então custa o mesmo para 56 ou para milhões de blocos, e só as páginas
+// realmente tocadas ocupam memória.
+//
+// Layout (little-endian, cada seção alinhada em 64 bytes):
+//     LevelHeader
+//     paleta          paletteSize x float[3] (RGB)
+//     chunks          chunkCount x LevelChunk
+//     hitPoints       rows * cols x uint8   (0 = célula vazia)
+//     colorIndices    rows * cols x uint8   (índice na paleta)
+// As células estão em ordem de linha, então as linhas de um chunk são contíguas em
+// cada array; prefetch()/release() trazem e devolvem chunks inteiros, para fases em
+// rolagem maiores que a memória que se quer ocupar.
+struct LevelHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t rows, cols;
+    uint32_t bricks;          // células com hitPoints > 0
+    uint32_t paletteSize;
+    uint32_t chunkRows;       // linhas por chunk (o último pode ter menos)
+    uint32_t chunkCount;
+    float blockWidth, blockHeight;
+    float spacingX, spacingY;
+    float originX, originY;   // canto inferior esquerdo do bloco (0, 0); linhas descem
+    uint64_t paletteOffset;
+    uint64_t chunkOffset;
+    uint64_t hitPointsOffset;
+    uint64_t colorOffset;
+    uint64_t fileSize;
+};
+
+// Faixa vertical de um chunk, para achar os chunks visíveis sem tocar nas células
+struct LevelChunk {
+    uint32_t firstRow;
+    uint32_t rowCount;
+    float top, bottom;
+};
+
+class LevelFile {
+public:
+    static const uint32_t MAGIC = 0x4C4B5241; // "ARKL"
+    static const uint32_t VERSION = 1;
+
+    LevelFile() = default;
+    ~LevelFile();
+
+    LevelFile(const LevelFile&) = delete;
+    LevelFile& operator=(const LevelFile&) = delete;
+
+    // false se o arquivo não existir ou o cabeçalho não bater com o tamanho/seções
+    bool open(const char* path);
+    void close();
+
+    const LevelHeader& header() const;
+
+    // Ponteiros para dentro do mapeamento; valem enquanto o arquivo estiver aberto.
+    // Os índices de cor não são conferidos ao abrir (seria O(n)): quem lê limita à paleta.
+    const float* palette() const;
+    const LevelChunk* chunks() const;
+    const uint8_t* hitPoints() const;
+    const uint8_t* colorIndices() const;
+
+    // Pede ao kernel para ler as páginas do chunk em segundo plano / para descartá-las
+    // (continuam válidas: são relidas do arquivo se forem tocadas de novo)
+    void prefetch(int chunk) const;
+    void release(int chunk) const;
+
+private:
+    void advise(int chunk, int advice) const;
+
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+};
+
+#endif
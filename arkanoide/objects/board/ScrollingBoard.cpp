@@ -0,0 +1,300 @@
+#include "ScrollingBoard.h"
+#include <algorithm>
+#include <cmath>
+#include <commons/Profiler.h>
+#include "Board.h"
+
+// Faixa visível da tela em y (a mesma moldura de recordContour)
+static const float SCREEN_BOTTOM = -1.0f;
+static const float SCREEN_TOP = 0.9f;
+
+ScrollingBoard::ScrollingBoard(std::shared_ptr<const LevelFile> level) {
+    const LevelHeader& header = level->header();
+    rows = static_cast<int>(header.rows);
+    cols = static_cast<int>(header.cols);
+    rowsPerChunk = static_cast<int>(header.chunkRows);
+    chunkCount = static_cast<int>(header.chunkCount);
+    blockWidth = header.blockWidth;
+    blockHeight = header.blockHeight;
+    pitchX = header.blockWidth + header.spacingX;
+    pitchY = header.blockHeight + header.spacingY;
+    originX = header.originX;
+    this->level = std::move(level);
+
+    // Linhas que cabem na janela mais o chunk de antecedência; cada volta da fase pode
+    // trazer um chunk mais curto (o último do arquivo)
+    int windowRows = static_cast<int>(std::ceil((SCREEN_TOP - SCREEN_BOTTOM + blockHeight) / pitchY)) + 1 + rowsPerChunk;
+    maxResident = std::min(windowRows, (windowRows + rowsPerChunk - 1) / rowsPerChunk + 2 + windowRows / rows + 1);
+
+    requests.reserve(maxResident);
+    releases.reserve(maxResident);
+    loaded.reserve(maxResident);
+    pager = std::thread([this]() { pagerLoop(); });
+}
+
+ScrollingBoard::~ScrollingBoard() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        running = false;
+    }
+    wake.notify_one();
+    pager.join();
+}
+
+int ScrollingBoard::getMaxResident() const {
+    return maxResident;
+}
+
+int ScrollingBoard::chunkOfRow(int row) const {
+    int lap = row / rows;
+    int fileRow = rows - 1 - row % rows;
+    return lap * chunkCount + (chunkCount - 1 - fileRow / rowsPerChunk);
+}
+
+int ScrollingBoard::fileChunkOf(int chunk) const {
+    return chunkCount - 1 - chunk % chunkCount;
+}
+
+void ScrollingBoard::chunkRange(int chunk, int& firstRow, int& rowCount) const {
+    int lap = chunk / chunkCount;
+    int fileChunk = fileChunkOf(chunk);
+    int fileEnd = std::min((fileChunk + 1) * rowsPerChunk, rows);
+    firstRow = lap * rows + (rows - fileEnd);
+    rowCount = fileEnd - fileChunk * rowsPerChunk;
+}
+
+// Chunks [firstChunk, lastChunk] com alguma linha na tela, mais um acima (antecedência)
+void ScrollingBoard::window(float scroll, int& firstChunk, int& lastChunk) const {
+    float lowest = std::floor((scroll + SCREEN_BOTTOM - blockHeight - BASE_Y) / pitchY);
+    float highest = std::floor((scroll + SCREEN_TOP - BASE_Y) / pitchY);
+    firstChunk = chunkOfRow(static_cast<int>(std::max(lowest, 0.0f)));
+    lastChunk = chunkOfRow(static_cast<int>(std::max(highest, 0.0f))) + 1;
+}
+
+std::shared_ptr<BoardChunk> ScrollingBoard::load(int index) const {
+    PROFILE_SCOPE("loadChunk");
+    auto chunk = std::make_shared<BoardChunk>();
+    chunk->index = index;
+    chunkRange(index, chunk->firstRow, chunk->rowCount);
+    chunk->cells.assign(static_cast<size_t>(chunk->rowCount) * cols, -1);
+
+    const LevelHeader& header = level->header();
+    const uint8_t* hitPoints = level->hitPoints();
+    const uint8_t* colorIndices = level->colorIndices();
+    const float* palette = level->palette();
+    level->prefetch(fileChunkOf(index));
+
+    for (int local = 0; local < chunk->rowCount; ++local) {
+        int row = chunk->firstRow + local;
+        size_t fileRow = static_cast<size_t>(rows - 1 - row % rows);
+        float y = BASE_Y + row * pitchY;
+        for (int col = 0; col < cols; ++col) {
+            uint8_t strength = hitPoints[fileRow * cols + col];
+            if (strength == 0) {
+                continue;
+            }
+            uint32_t colorIndex = std::min<uint32_t>(colorIndices[fileRow * cols + col], header.paletteSize - 1);
+            const float* color = palette + 3 * colorIndex;
+            chunk->cells[static_cast<size_t>(local) * cols + col] = static_cast<int>(chunk->blocks.size());
+            chunk->blocks.push_back(Block(blockWidth, blockHeight, originX + col * pitchX, y));
+            chunk->colors.push_back(glm::vec3(color[0], color[1], color[2]));
+            chunk->hitPoints.push_back(strength);
+        }
+    }
+    return chunk;
+}
+
+void ScrollingBoard::pagerLoop() {
+    Profiler::setThreadName("pager");
+    std::vector<int> work;
+    std::vector<int> dropped;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [this]() { return !running || !requests.empty() || !releases.empty(); });
+            if (!running) {
+                return;
+            }
+            work.swap(requests);
+            dropped.swap(releases);
+        }
+
+        for (int fileChunk : dropped) {
+            level->release(fileChunk);
+        }
+        dropped.clear();
+
+        // Um chunk por vez, publicando assim que fica pronto
+        for (int index : work) {
+            std::shared_ptr<const BoardChunk> chunk = load(index);
+            std::lock_guard<std::mutex> lock(mutex);
+            loaded.push_back(std::move(chunk));
+            loadedCount.store(static_cast<int>(loaded.size()), std::memory_order_release);
+        }
+        work.clear();
+    }
+}
+
+static void pruneBelow(std::vector<Block>& blocks, float y) {
+    blocks.erase(std::remove_if(blocks.begin(), blocks.end(), [y](const Block& block) { return block.getY() < y; }), blocks.end());
+}
+
+void ScrollingBoard::update(float scroll, ResidentChunks& resident, std::vector<Block>& disabledBlocks, std::vector<Block>& damagedBlocks) {
+    int firstChunk, lastChunk;
+    window(scroll, firstChunk, lastChunk);
+
+    // Saíram por baixo: a rolagem só sobe, então nunca voltam
+    auto& chunks = resident.chunks;
+    size_t evicted = 0;
+    while (evicted < chunks.size() && chunks[evicted]->index < firstChunk) {
+        ++evicted;
+    }
+    bool hasWork = evicted > 0 || nextRequest <= lastChunk || loadedCount.load(std::memory_order_acquire) > 0;
+    if (!hasWork) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (evicted > 0) {
+        for (size_t i = 0; i < evicted; ++i) {
+            releases.push_back(fileChunkOf(chunks[i]->index));
+        }
+        chunks.erase(chunks.begin(), chunks.begin() + evicted);
+        int firstRow, rowCount;
+        chunkRange(firstChunk, firstRow, rowCount);
+        float bottom = BASE_Y + firstRow * pitchY - 0.5f * pitchY;
+        pruneBelow(disabledBlocks, bottom);
+        pruneBelow(damagedBlocks, bottom);
+    }
+
+    for (auto& chunk : loaded) {
+        if (chunk->index < firstChunk) {
+            releases.push_back(fileChunkOf(chunk->index)); // chegou atrasado, já saiu por baixo
+            continue;
+        }
+        // Sem espaço: sai o residente mais antigo (o mais baixo, o próximo a sair da tela).
+        // O que chegou fica, porque nextRequest já passou dele e ele não seria pedido de novo.
+        if (static_cast<int>(chunks.size()) >= maxResident) {
+            const BoardChunk& oldest = *chunks.front();
+            releases.push_back(fileChunkOf(oldest.index));
+            float top = BASE_Y + (oldest.firstRow + oldest.rowCount) * pitchY - 0.5f * pitchY;
+            pruneBelow(disabledBlocks, top);
+            pruneBelow(damagedBlocks, top);
+            chunks.erase(chunks.begin());
+        }
+        auto position = std::lower_bound(chunks.begin(), chunks.end(), chunk->index,
+                                         [](const std::shared_ptr<const BoardChunk>& resident, int index) { return resident->index < index; });
+        chunks.insert(position, std::move(chunk));
+    }
+    loaded.clear();
+    loadedCount.store(0, std::memory_order_relaxed);
+
+    for (int index = std::max(nextRequest, firstChunk); index <= lastChunk; ++index) {
+        requests.push_back(index);
+    }
+    nextRequest = std::max(nextRequest, lastChunk + 1);
+    wake.notify_one();
+}
+
+std::pmr::vector<Block> ScrollingBoard::getActiveBlocks(const ResidentChunks& resident, const std::vector<Block>& disabledBlocks,
+                                                        std::pmr::memory_resource* resource) const {
+    size_t total = 0;
+    for (const auto& chunk : resident.chunks) {
+        total += chunk->blocks.size();
+    }
+    std::pmr::vector<Block> activeBlocks(resource);
+    activeBlocks.reserve(total);
+    std::pmr::vector<uint64_t> disabled = disabledKeys(disabledBlocks, resource);
+    for (const auto& chunk : resident.chunks) {
+        for (const auto& block : chunk->blocks) {
+            if (!isDisabled(disabled, getBlockKey(block))) {
+                activeBlocks.push_back(block);
+            }
+        }
+    }
+    return activeBlocks;
+}
+
+void ScrollingBoard::updateLayer(const ResidentChunks& resident, const std::vector<Block>& disabledBlocks, ResidentChunks& shown, InstanceLayer& layer) const {
+    if (shown.chunks == resident.chunks) {
+        return;
+    }
+    PROFILE_SCOPE("updateLayer");
+    std::pmr::vector<uint64_t> disabled = disabledKeys(disabledBlocks, std::pmr::get_default_resource());
+    // As duas listas estão em ordem de índice: um merge acha quem saiu e quem entrou
+    auto old = shown.chunks.begin();
+    auto current = resident.chunks.begin();
+    while (old != shown.chunks.end() || current != resident.chunks.end()) {
+        bool gone = current == resident.chunks.end() || (old != shown.chunks.end() && (*old)->index < (*current)->index);
+        bool added = !gone && (old == shown.chunks.end() || (*current)->index < (*old)->index);
+        if (gone) {
+            const BoardChunk& chunk = **old++;
+            for (size_t cell = 0; cell < chunk.cells.size(); ++cell) {
+                if (chunk.cells[cell] >= 0) {
+                    layer.remove(keyOf(chunk, static_cast<int>(cell)));
+                }
+            }
+        } else if (added) {
+            const BoardChunk& chunk = **current++;
+            for (size_t cell = 0; cell < chunk.cells.size(); ++cell) {
+                int index = chunk.cells[cell];
+                uint64_t key = keyOf(chunk, static_cast<int>(cell));
+                if (index >= 0 && !isDisabled(disabled, key)) {
+                    layer.add(key, chunk.blocks[index].instance(chunk.colors[index]));
+                }
+            }
+        } else {
+            ++old;
+            ++current;
+        }
+    }
+    shown.chunks = resident.chunks;
+}
+
+uint64_t ScrollingBoard::keyOf(const BoardChunk& chunk, int cell) const {
+    return static_cast<uint64_t>(chunk.firstRow + cell / cols) * cols + cell % cols;
+}
+
+std::pmr::vector<uint64_t> ScrollingBoard::disabledKeys(const std::vector<Block>& disabledBlocks, std::pmr::memory_resource* resource) const {
+    std::pmr::vector<uint64_t> keys(resource);
+    keys.reserve(disabledBlocks.size());
+    for (const auto& block : disabledBlocks) {
+        keys.push_back(getBlockKey(block));
+    }
+    std::sort(keys.begin(), keys.end());
+    return keys;
+}
+
+bool ScrollingBoard::isDisabled(const std::pmr::vector<uint64_t>& disabled, uint64_t key) {
+    return std::binary_search(disabled.begin(), disabled.end(), key);
+}
+
+uint64_t ScrollingBoard::getBlockKey(const Block& block) const {
+    int64_t row = std::lround((block.getY() - BASE_Y) / pitchY);
+    int64_t col = std::lround((block.getX() - originX) / pitchX);
+    return static_cast<uint64_t>(row) * cols + static_cast<uint64_t>(col);
+}
+
+const BoardChunk* ScrollingBoard::find(const ResidentChunks& resident, const Block& block, int& index) const {
+    int row = static_cast<int>(std::lround((block.getY() - BASE_Y) / pitchY));
+    int col = static_cast<int>(std::lround((block.getX() - originX) / pitchX));
+    for (const auto& chunk : resident.chunks) {
+        if (row >= chunk->firstRow && row < chunk->firstRow + chunk->rowCount && col >= 0 && col < cols) {
+            index = chunk->cells[static_cast<size_t>(row - chunk->firstRow) * cols + col];
+            return index >= 0 ? chunk.get() : nullptr;
+        }
+    }
+    return nullptr;
+}
+
+int ScrollingBoard::getHitPoints(const ResidentChunks& resident, const Block& block) const {
+    int index;
+    const BoardChunk* chunk = find(resident, block, index);
+    return chunk ? chunk->hitPoints[index] : 1;
+}
+
+glm::vec3 ScrollingBoard::getColor(const ResidentChunks& resident, const Block& block) const {
+    int index;
+    const BoardChunk* chunk = find(resident, block, index);
+    return chunk ? chunk->colors[index] : glm::vec3(1.0f);
+}
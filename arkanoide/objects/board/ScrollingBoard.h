@@ -0,0 +1,112 @@
+#ifndef SCROLLING_BOARD_H
+#define SCROLLING_BOARD_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <glm/glm.hpp>
+#include <commons/InstanceLayer.h>
+#include "Block.h"
+#include "LevelFile.h"
+
+// Um chunk da fase decodificado para o modo em rolagem: os blocos não vazios das suas
+// linhas, com cor e resistência. Imutável depois de carregado, então vários retratos do
+// GameState podem apontar para ele ao mesmo tempo.
+struct BoardChunk {
+    int index;      // chunk virtual (ver ScrollingBoard)
+    int firstRow;   // linha virtual da base do chunk
+    int rowCount;
+    std::vector<Block> blocks;
+    std::vector<glm::vec3> colors;
+    std::vector<uint8_t> hitPoints;
+    std::vector<int> cells; // (linha local * colunas + coluna) -> índice em blocks, ou -1
+};
+
+// Chunks residentes em ordem crescente de índice; copiar só copia ponteiros
+struct ResidentChunks {
+    std::vector<std::shared_ptr<const BoardChunk>> chunks;
+};
+
+// Modo em rolagem sobre uma fase compilada. A fase é percorrida de baixo para cima e
+// repete ao chegar na linha 0: a linha virtual v é a linha (rows - 1 - v % rows) do
+// arquivo, e os chunks virtuais seguem a mesma ordem. Os blocos ficam em "coordenadas
+// de rolagem", fixas (linha virtual v em BASE_Y + v * passo); a tela mostra y - scroll.
+//
+// Só os chunks perto da janela visível ficam residentes. Uma thread própria lê o
+// mapeamento (onde acontecem as faltas de página) e decodifica os chunks pedidos; a
+// simulação nunca espera por ela: um chunk atrasado só aparece um pouco depois. Os que
+// saem por baixo são devolvidos ao kernel (LevelFile::release). Memória e custo por tick
+// dependem do tamanho da janela, não da altura da fase.
+class ScrollingBoard {
+public:
+    static constexpr float BASE_Y = 0.2f;
+
+    explicit ScrollingBoard(std::shared_ptr<const LevelFile> level);
+    ~ScrollingBoard();
+
+    ScrollingBoard(const ScrollingBoard&) = delete;
+    ScrollingBoard& operator=(const ScrollingBoard&) = delete;
+
+    // Limite de chunks residentes: janela visível, um chunk de antecedência e folga
+    int getMaxResident() const;
+
+    // Um tick da simulação: incorpora os chunks que o pager terminou, pede os que vão
+    // entrar na janela e descarta os que saíram, junto com as entradas deles nas listas
+    // de blocos quebrados/danificados (que assim também não crescem sem limite)
+    void update(float scroll, ResidentChunks& resident, std::vector<Block>& disabledBlocks, std::vector<Block>& damagedBlocks);
+
+    // Blocos residentes não quebrados, em coordenadas de rolagem, em O((residentes +
+    // quebrados) log quebrados); o vetor e as chaves temporárias saem de `resource`
+    std::pmr::vector<Block> getActiveBlocks(const ResidentChunks& resident, const std::vector<Block>& disabledBlocks,
+                                            std::pmr::memory_resource* resource = std::pmr::get_default_resource()) const;
+
+    // Leva a camada dos blocos dos chunks de `shown` para os de `resident`: tira os blocos
+    // dos chunks que saíram e põe os dos que entraram, menos os quebrados. A camada fica em
+    // coordenadas de rolagem (a tela é só um deslocamento dela). Roda na thread de quadros.
+    void updateLayer(const ResidentChunks& resident, const std::vector<Block>& disabledBlocks, ResidentChunks& shown, InstanceLayer& layer) const;
+
+    // Chave de um bloco residente numa InstanceLayer: linha virtual * colunas + coluna
+    uint64_t getBlockKey(const Block& block) const;
+
+    // Resistência e cor de um bloco residente (em coordenadas de rolagem)
+    int getHitPoints(const ResidentChunks& resident, const Block& block) const;
+    glm::vec3 getColor(const ResidentChunks& resident, const Block& block) const;
+
+private:
+    void window(float scroll, int& firstChunk, int& lastChunk) const;
+    int chunkOfRow(int row) const;
+    int fileChunkOf(int chunk) const;
+    void chunkRange(int chunk, int& firstRow, int& rowCount) const;
+    std::shared_ptr<BoardChunk> load(int chunk) const;
+    uint64_t keyOf(const BoardChunk& chunk, int cell) const;
+    // Chaves (getBlockKey) de disabledBlocks, em ordem, para busca binária
+    std::pmr::vector<uint64_t> disabledKeys(const std::vector<Block>& disabledBlocks, std::pmr::memory_resource* resource) const;
+    static bool isDisabled(const std::pmr::vector<uint64_t>& disabled, uint64_t key);
+    const BoardChunk* find(const ResidentChunks& resident, const Block& block, int& index) const;
+    void pagerLoop();
+
+    std::shared_ptr<const LevelFile> level;
+    int rows, cols, rowsPerChunk, chunkCount;
+    float blockWidth, blockHeight, pitchX, pitchY, originX;
+    int maxResident;
+
+    // Fila do pager; protegida por mutex
+    std::thread pager;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::vector<int> requests;  // chunks virtuais a decodificar
+    std::vector<int> releases;  // chunks do arquivo a devolver
+    std::vector<std::shared_ptr<const BoardChunk>> loaded;
+    std::atomic<int> loadedCount{ 0 };
+    bool running = true;
+
+    // Só a simulação
+    int nextRequest = 0;
+};
+
+#endif
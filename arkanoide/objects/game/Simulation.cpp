@@ -0,0 +1,170 @@
+#include "Simulation.h"
+#include <algorithm>
+#include <cmath>
+#include <GLFW/glfw3.h>
+#include <commons/Profiler.h>
+
+void reserveGameState(GameState& state, const Board& board, const ScrollingBoard* scrollingBoard) {
+    if (scrollingBoard) {
+        state.resident.chunks.reserve(scrollingBoard->getMaxResident());
+        return;
+    }
+    int hits = 0; // golpes que os blocos resistentes ainda aguentam
+    for (int i = 0; i < board.getRows(); ++i) {
+        for (int j = 0; j < board.getCols(); ++j) {
+            hits += std::max(0, board.getHitPoints(i, j) - 1);
+        }
+    }
+    state.disabledBlocks.reserve(board.size());
+    state.damagedBlocks.reserve(hits);
+}
+
+glm::vec2 rotate(glm::vec2 vector, float angle) {
+    float c = std::cos(angle);
+    float s = std::sin(angle);
+    return glm::vec2(vector.x * c - vector.y * s, vector.x * s + vector.y * c);
+}
+
+static Ball offsetBall(const Ball& ball, float offsetY) {
+    return Ball(ball.getRadius(), ball.getPosition() + glm::vec2(0.0f, offsetY), ball.velocity);
+}
+
+// Duas cópias da bola, no mesmo lugar, com a velocidade girada para cada lado
+static void splitBall(BallPool& balls, const Ball& ball) {
+    balls.spawn(Ball(ball.getRadius(), ball.getPosition(), rotate(ball.velocity, -SPLIT_ANGLE)));
+    balls.spawn(Ball(ball.getRadius(), ball.getPosition(), rotate(ball.velocity, SPLIT_ANGLE)));
+}
+
+Simulation::Simulation(const Board& board, ScrollingBoard* scrollingBoard, float scrollSpeed, GameInput& input, JobSystem& jobs)
+    : board(board), scrollingBoard(scrollingBoard), scrollSpeed(scrollSpeed), input(input), jobs(jobs) {
+}
+
+void Simulation::restart() {
+    collisionBuilt = false;
+}
+
+// Blocos de fase podem aguentar mais de um golpe: conta quantos o bloco já levou
+bool Simulation::resistsHit(const GameState& state, const Block& block) const {
+    int hits = 0;
+    for (const auto& damaged : state.damagedBlocks) {
+        if (damaged.getPosition() == block.getPosition()) {
+            ++hits;
+        }
+    }
+    int hitPoints = scrollingBoard ? scrollingBoard->getHitPoints(state.resident, block) : board.getBlockHitPoints(block);
+    return hits + 1 < hitPoints;
+}
+
+void Simulation::movePaddle(GameState& state, float deltaTime) const {
+    if (!state.gameStarted || deltaTime <= 0.0f) {
+        return;
+    }
+    if (keys.left) {
+        state.paddle.moveLeft(deltaTime);
+    }
+    if (keys.right) {
+        state.paddle.moveRight(deltaTime);
+    }
+}
+
+void Simulation::tick(GameState& state, double tickStart, double tickEnd) {
+    PROFILE_SCOPE("simulate");
+    arena.reset();
+    double time = tickStart;
+
+    for (const InputEvent* event = input.events.front(); event && event->time < tickEnd; event = input.events.front()) {
+        double eventTime = std::max(event->time, time);
+        movePaddle(state, static_cast<float>(eventTime - time));
+        time = eventTime;
+
+        if (event->key == GLFW_KEY_LEFT) {
+            keys.left = event->pressed;
+        } else if (event->key == GLFW_KEY_RIGHT) {
+            keys.right = event->pressed;
+        } else if (event->key == GLFW_KEY_SPACE && event->pressed && !state.gameStarted) {
+            // Espaço foi pressionado
+            state.gameStarted = true; // Inicie o jogo
+        }
+        input.events.pop();
+    }
+    // Eventos descartados com a fila cheia: com ela vazia, o estado do callback é o atual
+    if (!input.events.front() && input.dropped.exchange(false, std::memory_order_acquire)) {
+        keys.left = input.heldLeft.load(std::memory_order_relaxed);
+        keys.right = input.heldRight.load(std::memory_order_relaxed);
+        if (input.startRequested.load(std::memory_order_relaxed)) {
+            state.gameStarted = true;
+        }
+    }
+    movePaddle(state, static_cast<float>(tickEnd - time));
+
+    float deltaTime = static_cast<float>(tickEnd - tickStart);
+
+    // Os chunks começam a ser carregados antes do início; a rolagem só depois
+    if (scrollingBoard) {
+        if (state.gameStarted) {
+            state.scroll += scrollSpeed * deltaTime;
+        }
+        scrollingBoard->update(state.scroll, state.resident, state.disabledBlocks, state.damagedBlocks);
+    }
+
+    if (!state.gameStarted) {
+        return;
+    }
+
+    // Em rolagem a colisão é feita nas coordenadas fixas dos blocos: a bola é levada até elas.
+    // As remontagens saem da arena e são copiadas para o vetor persistente da colisão.
+    float blockOffset = scrollingBoard ? state.scroll : 0.0f;
+    if (!collisionBuilt || (scrollingBoard && collisionChunks != state.resident.chunks)) {
+        collision.assign(scrollingBoard ? scrollingBoard->getActiveBlocks(state.resident, state.disabledBlocks, &arena)
+                                        : board.getActiveBlocks(state.disabledBlocks, &arena));
+        collisionChunks = state.resident.chunks;
+        collisionBuilt = true;
+    } else {
+        collision.beginTick();
+    }
+
+    // Movimento, paredes e paddle de todas as bolas de uma vez; a fase larga contra os blocos
+    // em paralelo; depois os blocos bola a bola, na ordem
+    integrateBalls(state.balls, deltaTime, state.paddle);
+    std::pmr::vector<int> candidates(&arena);
+    findCollisionCandidates(jobs, collision.bounds, state.balls, blockOffset, candidates);
+
+    // Um escopo para a passada inteira, não um por bola: com muitas bolas a 1 kHz eles
+    // encheriam a fila do profiler entre dois quadros
+    {
+        PROFILE_SCOPE("resolveCollisions");
+        int end = state.balls.end();
+        for (int i = 0; i < end; ++i) {
+            if (!state.balls.isAlive(i)) {
+                continue;
+            }
+            if (state.balls.y[i] < -1.0f) {
+                state.balls.despawn(i);
+                continue;
+            }
+            Ball ball = offsetBall(state.balls.get(i), blockOffset);
+            int hit = verifyCollisionBlocks(collision.blocks, collision.bounds, ball, state.disabledBlocks, candidates[i]);
+            ball = offsetBall(ball, -blockOffset);
+            state.balls.set(i, ball);
+            if (hit < 0) {
+                continue;
+            }
+            if (resistsHit(state, state.disabledBlocks.back())) {
+                // A bola já quicou; o bloco volta (na colisão, a partir do próximo tick) e fica marcado
+                state.damagedBlocks.push_back(state.disabledBlocks.back());
+                state.disabledBlocks.pop_back();
+                collision.resist(hit);
+            } else if (++state.brokenBlocks % MULTIBALL_EVERY == 0) {
+                splitBall(state.balls, ball);
+            }
+        }
+    }
+
+    if (state.balls.size() == 0) {
+        state.gameOver = true;
+    }
+    // A fase em rolagem não acaba
+    if (!scrollingBoard && static_cast<int>(state.disabledBlocks.size()) == board.size()) {
+        state.gameOver = true;
+    }
+}
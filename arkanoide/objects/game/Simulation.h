@@ -0,0 +1,116 @@
+#ifndef SIMULATION_H
+#define SIMULATION_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <glm/glm.hpp>
+#include <commons/FrameArena.h>
+#include <commons/JobSystem.h>
+#include <commons/SpscRing.h>
+#include "Ball.h"
+#include "BallPool.h"
+#include "Block.h"
+#include "Board.h"
+#include "Paddle.h"
+#include "ScrollingBoard.h"
+
+const double SIMULATION_TICK = 0.001; // Simulação a 1 kHz, independente da taxa de quadros
+
+// Multibola: a cada MULTIBALL_EVERY blocos destruídos a bola que acertou se divide em
+// três, desviadas de SPLIT_ANGLE radianos. O pool tem capacidade fixa; spawns com ele
+// cheio são ignorados.
+const int MAX_BALLS = 1024;
+const int MULTIBALL_EVERY = 8;
+const float SPLIT_ANGLE = 0.5f;
+
+// Evento de tecla (código do GLFW) com o instante (glfwGetTime) em que o callback o recebeu
+struct InputEvent {
+    double time;
+    int key;
+    bool pressed;
+};
+
+// Estado das teclas visto pela simulação, reconstruído a partir dos eventos
+struct KeyState {
+    bool left = false;
+    bool right = false;
+};
+
+// Produtor: callback de teclado na thread principal. Consumidor: thread de simulação.
+// O estado final das teclas é escrito pelo callback antes de cada push. Se a fila encher, o
+// evento se perde (e com ele o instante exato), mas a simulação reconcilia as teclas com
+// este estado assim que esvaziar a fila: uma tecla solta nunca fica presa.
+struct GameInput {
+    SpscRing<InputEvent, 256> events;
+    std::atomic<bool> heldLeft{ false };
+    std::atomic<bool> heldRight{ false };
+    std::atomic<bool> startRequested{ false };
+    std::atomic<bool> dropped{ false };
+};
+
+// Retrato imutável do jogo publicado pela simulação a cada tick
+struct GameState {
+    Paddle paddle;
+    BallPool balls;
+    std::vector<Block> disabledBlocks;
+    std::vector<Block> damagedBlocks; // uma entrada por golpe que um bloco resistente aguentou
+    bool gameStarted; // Variável para controlar se o jogo começou
+    bool gameOver;
+
+    // Total de blocos quebrados: em rolagem disabledBlocks perde as entradas dos chunks que
+    // saíram, então o tamanho dele não diz quantos blocos quebraram desde o último quadro
+    uint64_t brokenBlocks = 0;
+
+    // Modo em rolagem: a tela mostra os blocos em y - scroll, e só os chunks residentes existem
+    float scroll = 0.0f;
+    ResidentChunks resident;
+};
+
+// Capacidade das listas do GameState para o jogo inteiro, para que nem a simulação nem a
+// publicação no TripleBuffer realoquem conforme os blocos quebram. A cópia de um vetor não
+// leva a capacidade junto, então cada cópia do estado precisa da sua própria reserva.
+void reserveGameState(GameState& state, const Board& board, const ScrollingBoard* scrollingBoard);
+
+glm::vec2 rotate(glm::vec2 vector, float angle);
+
+// A simulação do jogo, um tick por chamada. Guarda de um tick para o outro o que não faz
+// parte do retrato: as teclas, a arena do tick e os blocos da colisão. Só a thread de
+// simulação a usa. Em rolagem (scrollingBoard não nulo) os blocos vêm dos chunks residentes.
+class Simulation {
+public:
+    Simulation(const Board& board, ScrollingBoard* scrollingBoard, float scrollSpeed, GameInput& input, JobSystem& jobs);
+
+    // Avança o jogo no intervalo [tickStart, tickEnd). Os eventos de teclado são aplicados
+    // no instante exato em que aconteceram, então o paddle anda exatamente o tempo que a
+    // tecla ficou pressionada, mesmo que ela tenha sido solta antes do fim do tick.
+    void tick(GameState& state, double tickStart, double tickEnd);
+
+    // O próximo tick monta os blocos da colisão de novo; para quando `state` é trocado por
+    // outro (ex.: o jogo recomeça)
+    void restart();
+
+private:
+    bool resistsHit(const GameState& state, const Block& block) const;
+    void movePaddle(GameState& state, float deltaTime) const;
+
+    const Board& board;
+    ScrollingBoard* scrollingBoard;
+    float scrollSpeed;
+    GameInput& input;
+    JobSystem& jobs;
+    KeyState keys;
+
+    // Os candidatos da fase larga, refeitos a cada tick, e os temporários das remontagens
+    FrameArena arena;
+
+    // Blocos da colisão: só são montados de novo quando os blocos mudam por fora da
+    // colisão: no primeiro tick e, em rolagem, quando um chunk entra ou sai (a poda de
+    // disabledBlocks acontece junto)
+    CollisionBlocks collision;
+    std::vector<std::shared_ptr<const BoardChunk>> collisionChunks; // os residentes na última montagem
+    bool collisionBuilt = false;
+};
+
+#endif
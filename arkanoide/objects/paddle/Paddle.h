@@ -2,17 +2,16 @@
 #define PADDLE_H
 
 #include <glm/glm.hpp>
-#include <glad/glad.h>
+#include <commons/CommandBuffer.h>
 
 class Paddle {
 public:
     Paddle(float width, float height, float initialX);
-    ~Paddle();
 
     void moveLeft(float deltaTime);
     void moveRight(float deltaTime);
 
-    void draw();
+    void record(CommandBuffer& commands) const;
 
     float getX() const;
     float getY() const;
@@ -21,7 +20,6 @@ public:
     glm::vec2 getPosition() const;
 
 private:
-    GLuint VAO, VBO;
     glm::vec2 position;
     float width, height;
     float speed;
@@ -0,0 +1,231 @@
+#include "ParticleSystem.h"
+#include <algorithm>
+#include <commons/Profiler.h>
+
+static const float GRAVITY = 1.5f;
+static const float FLOOR = -1.0f;     // abaixo disso a partícula saiu do campo
+static const int SHARDS_PER_BLOCK = 48;
+static const int SPARKS_PER_BLOCK = 16;
+static const int PARTICLES_PER_PART = 4096; // menos que isso por trecho não paga um job
+
+static uint32_t packColor(glm::vec3 color) {
+    glm::vec3 clamped = glm::clamp(color, glm::vec3(0.0f), glm::vec3(1.0f));
+    uint32_t r = static_cast<uint32_t>(clamped.x * 255.0f + 0.5f);
+    uint32_t g = static_cast<uint32_t>(clamped.y * 255.0f + 0.5f);
+    uint32_t b = static_cast<uint32_t>(clamped.z * 255.0f + 0.5f);
+    return r | (g << 8) | (b << 16) | (0xFFu << 24);
+}
+
+ParticleSystem::ParticleSystem(int capacity) {
+    this->capacity = capacity;
+    size_t padded = static_cast<size_t>(capacity + PADDING - 1) / PADDING * PADDING;
+    x.assign(padded, 0.0f);
+    y.assign(padded, 0.0f);
+    vx.assign(padded, 0.0f);
+    vy.assign(padded, 0.0f);
+    life.assign(padded, 0.0f);
+    color.assign(padded, 0);
+}
+
+void ParticleSystem::emit(glm::vec2 position, glm::vec2 velocity, float life, glm::vec3 color) {
+    x[head] = position.x;
+    y[head] = position.y;
+    vx[head] = velocity.x;
+    vy[head] = velocity.y;
+    this->life[head] = life;
+    this->color[head] = packColor(color);
+    if (++head == capacity) {
+        head = 0;
+        wrapped = true;
+    }
+}
+
+void ParticleSystem::emitBurst(glm::vec2 corner, glm::vec2 size, glm::vec3 color, int count, float speed, float life) {
+    for (int i = 0; i < count; ++i) {
+        glm::vec2 position = corner + size * glm::vec2(random(), random());
+        glm::vec2 velocity = speed * glm::vec2(2.0f * random() - 1.0f, random());
+        emit(position, velocity, life * (0.5f + 0.5f * random()), color);
+    }
+}
+
+void ParticleSystem::emitBlockBreak(const Block& block, glm::vec3 color) {
+    // O bloco é desenhado centrado na sua posição (Mesh::Quad vai de -0.5 a 0.5)
+    glm::vec2 size(block.getWidth(), block.getHeight());
+    emitBurst(block.getPosition() - 0.5f * size, size, color, SHARDS_PER_BLOCK, 0.6f, 1.2f);
+    emitBurst(block.getPosition(), glm::vec2(0.0f), glm::vec3(1.0f, 0.9f, 0.4f), SPARKS_PER_BLOCK, 1.5f, 0.4f);
+}
+
+void ParticleSystem::clear() {
+    std::fill(life.begin(), life.end(), 0.0f);
+    head = 0;
+    wrapped = false;
+}
+
+int ParticleSystem::getCapacity() const {
+    return capacity;
+}
+
+int ParticleSystem::end() const {
+    int used = wrapped ? capacity : head;
+    return (used + PADDING - 1) / PADDING * PADDING;
+}
+
+void ParticleSystem::partRange(int part, int parts, int& first, int& last) const {
+    int groups = end() / PADDING;
+    first = part * groups / parts * PADDING;
+    last = (part + 1) * groups / parts * PADDING;
+}
+
+// xorshift32: barato e sem estado global; a qualidade basta para efeitos visuais
+float ParticleSystem::random() {
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return static_cast<float>(seed >> 8) / 16777216.0f;
+}
+
+// Escreve as partículas vivas de um grupo (bit i = partícula first + i)
+static inline int writeGroup(const ParticleSystem& particles, int first, uint32_t alive, PointVertex* points) {
+    int written = 0;
+    while (alive) {
+        int i = first + __builtin_ctz(alive);
+        alive &= alive - 1;
+        points[written++] = PointVertex{ glm::vec2(particles.x[i], particles.y[i]), particles.color[i] };
+    }
+    return written;
+}
+
+static int updateScalar(ParticleSystem& particles, int first, int last, float deltaTime, float gravityStep, PointVertex* points) {
+    int written = 0;
+    for (int i = first; i < last; ++i) {
+        float life = particles.life[i] - deltaTime;
+        float vy = particles.vy[i] - gravityStep;
+        float x = particles.x[i] + particles.vx[i] * deltaTime;
+        float y = particles.y[i] + vy * deltaTime;
+        particles.life[i] = life;
+        particles.vy[i] = vy;
+        particles.x[i] = x;
+        particles.y[i] = y;
+        if (life > 0.0f && y > FLOOR) {
+            points[written++] = PointVertex{ glm::vec2(x, y), particles.color[i] };
+        }
+    }
+    return written;
+}
+
+#ifdef SIMD_X86
+
+static int updateSse2(ParticleSystem& particles, int first, int last, float deltaTime, float gravityStep, PointVertex* points) {
+    const __m128 dt = _mm_set1_ps(deltaTime);
+    const __m128 gravity = _mm_set1_ps(gravityStep);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 bottom = _mm_set1_ps(FLOOR);
+    int written = 0;
+    for (int i = first; i < last; i += 4) {
+        __m128 life = _mm_sub_ps(_mm_loadu_ps(&particles.life[i]), dt);
+        __m128 vy = _mm_sub_ps(_mm_loadu_ps(&particles.vy[i]), gravity);
+        __m128 x = _mm_add_ps(_mm_loadu_ps(&particles.x[i]), _mm_mul_ps(_mm_loadu_ps(&particles.vx[i]), dt));
+        __m128 y = _mm_add_ps(_mm_loadu_ps(&particles.y[i]), _mm_mul_ps(vy, dt));
+        _mm_storeu_ps(&particles.life[i], life);
+        _mm_storeu_ps(&particles.vy[i], vy);
+        _mm_storeu_ps(&particles.x[i], x);
+        _mm_storeu_ps(&particles.y[i], y);
+        __m128 alive = _mm_and_ps(_mm_cmpgt_ps(life, zero), _mm_cmpgt_ps(y, bottom));
+        written += writeGroup(particles, i, static_cast<uint32_t>(_mm_movemask_ps(alive)), points + written);
+    }
+    return written;
+}
+
+__attribute__((target("avx2")))
+static int updateAvx2(ParticleSystem& particles, int first, int last, float deltaTime, float gravityStep, PointVertex* points) {
+    const __m256 dt = _mm256_set1_ps(deltaTime);
+    const __m256 gravity = _mm256_set1_ps(gravityStep);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 bottom = _mm256_set1_ps(FLOOR);
+    int written = 0;
+    for (int i = first; i < last; i += 8) {
+        __m256 life = _mm256_sub_ps(_mm256_loadu_ps(&particles.life[i]), dt);
+        __m256 vy = _mm256_sub_ps(_mm256_loadu_ps(&particles.vy[i]), gravity);
+        __m256 x = _mm256_add_ps(_mm256_loadu_ps(&particles.x[i]), _mm256_mul_ps(_mm256_loadu_ps(&particles.vx[i]), dt));
+        __m256 y = _mm256_add_ps(_mm256_loadu_ps(&particles.y[i]), _mm256_mul_ps(vy, dt));
+        _mm256_storeu_ps(&particles.life[i], life);
+        _mm256_storeu_ps(&particles.vy[i], vy);
+        _mm256_storeu_ps(&particles.x[i], x);
+        _mm256_storeu_ps(&particles.y[i], y);
+        __m256 alive = _mm256_and_ps(_mm256_cmp_ps(life, zero, _CMP_GT_OQ), _mm256_cmp_ps(y, bottom, _CMP_GT_OQ));
+        written += writeGroup(particles, i, static_cast<uint32_t>(_mm256_movemask_ps(alive)), points + written);
+    }
+    return written;
+}
+
+// Mesmos cuidados de BallPool.cpp: sem contração em FMA no GCC, e o aviso falso do GCC 12
+#ifndef __clang__
+#pragma GCC push_options
+#pragma GCC optimize("fp-contract=off")
+#endif
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+__attribute__((target("avx512f")))
+static int updateAvx512(ParticleSystem& particles, int first, int last, float deltaTime, float gravityStep, PointVertex* points) {
+    const __m512 dt = _mm512_set1_ps(deltaTime);
+    const __m512 gravity = _mm512_set1_ps(gravityStep);
+    const __m512 zero = _mm512_setzero_ps();
+    const __m512 bottom = _mm512_set1_ps(FLOOR);
+    int written = 0;
+    for (int i = first; i < last; i += 16) {
+        __m512 life = _mm512_sub_ps(_mm512_loadu_ps(&particles.life[i]), dt);
+        __m512 vy = _mm512_sub_ps(_mm512_loadu_ps(&particles.vy[i]), gravity);
+        __m512 x = _mm512_add_ps(_mm512_loadu_ps(&particles.x[i]), _mm512_mul_ps(_mm512_loadu_ps(&particles.vx[i]), dt));
+        __m512 y = _mm512_add_ps(_mm512_loadu_ps(&particles.y[i]), _mm512_mul_ps(vy, dt));
+        _mm512_storeu_ps(&particles.life[i], life);
+        _mm512_storeu_ps(&particles.vy[i], vy);
+        _mm512_storeu_ps(&particles.x[i], x);
+        _mm512_storeu_ps(&particles.y[i], y);
+        __mmask16 alive = _mm512_cmp_ps_mask(life, zero, _CMP_GT_OQ) & _mm512_cmp_ps_mask(y, bottom, _CMP_GT_OQ);
+        written += writeGroup(particles, i, static_cast<uint32_t>(alive), points + written);
+    }
+    return written;
+}
+#pragma GCC diagnostic pop
+#ifndef __clang__
+#pragma GCC pop_options
+#endif
+
+#endif
+
+int updateParticlesWith(SimdLevel level, ParticleSystem& particles, int first, int last, float deltaTime, PointVertex* points) {
+    // Mesmo passo de gravidade em todos os níveis, para o resultado ser igual bit a bit
+    float gravityStep = GRAVITY * deltaTime;
+    switch (level) {
+#ifdef SIMD_X86
+    case SimdLevel::Avx512:
+        return updateAvx512(particles, first, last, deltaTime, gravityStep, points);
+    case SimdLevel::Avx2:
+        return updateAvx2(particles, first, last, deltaTime, gravityStep, points);
+    case SimdLevel::Sse2:
+        return updateSse2(particles, first, last, deltaTime, gravityStep, points);
+#endif
+    case SimdLevel::Scalar:
+    default:
+        return updateScalar(particles, first, last, deltaTime, gravityStep, points);
+    }
+}
+
+int updateParticles(ParticleSystem& particles, int first, int last, float deltaTime, PointVertex* points) {
+    PROFILE_SCOPE("updateParticles");
+    return updateParticlesWith(activeSimdLevel(), particles, first, last, deltaTime, points);
+}
+
+void updateParticles(JobSystem& jobs, ParticleSystem& particles, float deltaTime, Frame& frame) {
+    int parts = std::max(1, std::min(jobs.size() * JobSystem::CHUNKS_PER_THREAD, particles.end() / PARTICLES_PER_PART));
+    frame.points.resize(particles.end());
+    frame.pointRanges.resize(parts);
+    jobs.parallelFor(0, parts, 1, [&](int firstPart, int lastPart) {
+        for (int part = firstPart; part < lastPart; ++part) {
+            int first, last;
+            particles.partRange(part, parts, first, last);
+            int count = updateParticles(particles, first, last, deltaTime, frame.points.data() + first);
+            frame.pointRanges[part] = PointRange{ first, count };
+        }
+    });
+}
@@ -0,0 +1,68 @@
+#ifndef PARTICLE_SYSTEM_H
+#define PARTICLE_SYSTEM_H
+
+#include <cstdint>
+#include <vector>
+#include <glm/glm.hpp>
+#include <commons/CommandBuffer.h>
+#include <commons/JobSystem.h>
+#include <commons/Simd.h>
+#include "Block.h"
+
+// Estilhaços e faíscas dos blocos destruídos, em arrays separados (SoA) usados como
+// anel: emit() escreve na próxima posição e, com o anel cheio, substitui a partícula
+// mais antiga. Nada é alocado depois do construtor. Partículas mortas (vida esgotada ou
+// abaixo do campo) continuam nos arrays e só deixam de ser desenhadas.
+//
+// Emissão e atualização não podem rodar ao mesmo tempo; update() de trechos diferentes
+// pode (é o que a sobrecarga com JobSystem faz, um trecho por job).
+class ParticleSystem {
+public:
+    static const int PADDING = 16;
+
+    explicit ParticleSystem(int capacity);
+
+    void emit(glm::vec2 position, glm::vec2 velocity, float life, glm::vec3 color);
+
+    // `count` partículas em posições aleatórias dentro da caixa, lançadas para cima com
+    // velocidade até `speed`, vivendo entre life/2 e life segundos
+    void emitBurst(glm::vec2 corner, glm::vec2 size, glm::vec3 color, int count, float speed, float life);
+
+    // Estilhaços na cor do bloco e faíscas amarelas, a partir do centro
+    void emitBlockBreak(const Block& block, glm::vec3 color);
+
+    void clear();
+
+    int getCapacity() const;
+
+    // Fim (múltiplo de PADDING) do trecho que já recebeu partículas; percorrer [0, end())
+    int end() const;
+
+    // Trecho `part` de `parts` de [0, end()), com fronteiras múltiplas de PADDING
+    void partRange(int part, int parts, int& first, int& last) const;
+
+    std::vector<float> x, y, vx, vy, life;
+    std::vector<uint32_t> color; // RGBA8, vermelho no byte mais baixo
+
+private:
+    float random();
+
+    int capacity;
+    int head = 0;
+    bool wrapped = false;
+    uint32_t seed = 0x9E3779B9u;
+};
+
+// Avança as partículas de [first, last) em deltaTime (gravidade, movimento, vida) e
+// escreve as vivas, compactadas, em points[0..]; retorna quantas escreveu. `first` e
+// `last` vêm de partRange(); `points` precisa de espaço para last - first.
+int updateParticles(ParticleSystem& particles, int first, int last, float deltaTime, PointVertex* points);
+
+// Avança todas as partículas em trechos paralelos no JobSystem e escreve o quadro como o
+// Renderer desenha: frame.points com o espaço de end() partículas e um PointRange por trecho
+void updateParticles(JobSystem& jobs, ParticleSystem& particles, float deltaTime, Frame& frame);
+
+// Igual, num nível específico (que a CPU precisa suportar); usado pelos microbenchmarks
+int updateParticlesWith(SimdLevel level, ParticleSystem& particles, int first, int last, float deltaTime, PointVertex* points);
+
+#endif
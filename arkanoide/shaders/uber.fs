@@ -0,0 +1,30 @@
+#version 330 core
+#if defined(SCREEN_TEXTURE)
+in vec2 screenPosition;
+uniform sampler2D screenTexture;
+#elif defined(VERTEX_COLOR) || defined(INSTANCED)
+in vec3 fragColor;
+#else
+uniform vec3 shapeColor;
+#endif
+#ifdef SDF_CIRCLE
+in vec2 localPosition;
+#endif
+
+out vec4 FragColor;
+
+void main() {
+#ifdef SDF_CIRCLE
+    // Círculo desenhado num quadrado: descarta o que estiver fora do raio
+    if (dot(localPosition, localPosition) > 1.0) {
+        discard;
+    }
+#endif
+#if defined(SCREEN_TEXTURE)
+    FragColor = texture(screenTexture, screenPosition);
+#elif defined(VERTEX_COLOR) || defined(INSTANCED)
+    FragColor = vec4(fragColor, 1.0);
+#else
+    FragColor = vec4(shapeColor, 1.0);
+#endif
+}
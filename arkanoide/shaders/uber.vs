@@ -0,0 +1,60 @@
+#version 330 core
+// Uber-shader: as variantes são escolhidas com #define (ver commons/ShaderVariants.h)
+layout(location = 0) in vec3 inPosition;
+#ifdef VERTEX_COLOR
+layout(location = 1) in vec3 inColor;
+#endif
+#ifdef INSTANCED
+layout(location = 2) in vec2 instanceOffset;
+layout(location = 3) in vec2 instanceScale;
+layout(location = 4) in vec3 instanceColor;
+#endif
+
+#ifdef PROJECTION
+uniform mat4 projection;
+#endif
+#ifdef MODEL
+uniform mat4 model;
+#endif
+#ifdef SCALE
+uniform float scale;
+#endif
+
+#if defined(VERTEX_COLOR) || defined(INSTANCED)
+out vec3 fragColor;
+#endif
+#ifdef SDF_CIRCLE
+out vec2 localPosition;
+#endif
+#ifdef SCREEN_TEXTURE
+out vec2 screenPosition;
+#endif
+
+void main() {
+    vec4 position = vec4(inPosition, 1.0);
+#ifdef SCALE
+    position.xy *= scale;
+#endif
+#ifdef SDF_CIRCLE
+    // Quadrado unitário (-0.5..0.5) vira o disco de raio 1 no fragment shader
+    localPosition = inPosition.xy * 2.0;
+#endif
+#ifdef INSTANCED
+    position.xy = position.xy * instanceScale + instanceOffset;
+    fragColor = instanceColor;
+#endif
+#ifdef MODEL
+    position = model * position;
+#endif
+#ifdef PROJECTION
+    position = projection * position;
+#endif
+#ifdef VERTEX_COLOR
+    fragColor = inColor;
+#endif
+#ifdef SCREEN_TEXTURE
+    // Coordenada de textura = posição na tela (clip -1..1 -> 0..1)
+    screenPosition = position.xy / position.w * 0.5 + 0.5;
+#endif
+    gl_Position = position;
+}
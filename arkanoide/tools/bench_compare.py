@@ -0,0 +1,94 @@
+#!/usr/bin/env python3
+# Compara dois resultados do bench ou do micro (A = referência, B = mudança):
+#     python3 tools/bench_compare.py antes.json depois.json [--threshold 0.03] [--alpha 0.01]
+# Para cada cena (p50 do tempo de quadro) ou microbenchmark (mediana de ns/op) presente
+# nos dois, mostra A, B e a variação. Uma diferença só conta se passar do limiar relativo
+# E se o teste de Mann-Whitney sobre as amostras brutas disser que não é ruído. Sai com
+# código 1 se algo ficou significativamente mais lento (útil para rodar antes de um merge).
+
+import argparse
+import json
+import math
+import sys
+
+
+def load(path):
+    """(metadados, {nome: (mediana, amostras)}, unidade)"""
+    with open(path) as file:
+        data = json.load(file)
+    if "benchmarks" in data:
+        entries = {entry["name"]: (entry["nsPerOp"], entry["samples"]) for entry in data["benchmarks"]}
+        return data, entries, "ns/op"
+    entries = {scene["name"]: (scene["frameMs"]["p50"], scene["frameSamples"]) for scene in data["scenes"]}
+    return data, entries, "ms"
+
+
+def mann_whitney_p(a, b):
+    """p bicaudal pela aproximação normal, com correção de empates."""
+    n1, n2 = len(a), len(b)
+    if n1 < 2 or n2 < 2:
+        return 1.0
+    values = sorted([(value, 0) for value in a] + [(value, 1) for value in b])
+    ranks = [0.0] * len(values)
+    ties = 0.0
+    i = 0
+    while i < len(values):
+        j = i
+        while j + 1 < len(values) and values[j + 1][0] == values[i][0]:
+            j += 1
+        for k in range(i, j + 1):
+            ranks[k] = (i + j) / 2.0 + 1.0
+        count = j - i + 1
+        ties += count ** 3 - count
+        i = j + 1
+    rank_a = sum(rank for rank, (_, group) in zip(ranks, values) if group == 0)
+    u = rank_a - n1 * (n1 + 1) / 2.0
+    n = n1 + n2
+    variance = n1 * n2 / 12.0 * ((n + 1) - ties / (n * (n - 1)))
+    if variance <= 0.0:
+        return 1.0
+    z = (u - n1 * n2 / 2.0) / math.sqrt(variance)
+    return math.erfc(abs(z) / math.sqrt(2.0))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compara dois JSON do bench")
+    parser.add_argument("a")
+    parser.add_argument("b")
+    parser.add_argument("--threshold", type=float, default=0.03, help="variação relativa mínima do p50")
+    parser.add_argument("--alpha", type=float, default=0.01, help="nível de significância")
+    args = parser.parse_args()
+
+    data_a, scenes_a, unit = load(args.a)
+    data_b, scenes_b, unit_b = load(args.b)
+    if unit != unit_b:
+        print("erro: um arquivo é do bench e o outro do micro")
+        return 2
+    if data_a.get("glRenderer") != data_b.get("glRenderer"):
+        print("aviso: GPUs diferentes (%s / %s)" % (data_a.get("glRenderer"), data_b.get("glRenderer")))
+    if data_a.get("optimized") != data_b.get("optimized"):
+        print("aviso: só um dos builds foi otimizado")
+
+    print("%-36s %12s %12s %8s" % ("nome", "A " + unit, "B " + unit, "variação"))
+    regressions = 0
+    for name, (median_a, samples_a) in scenes_a.items():
+        if name not in scenes_b:
+            continue
+        median_b, samples_b = scenes_b[name]
+        change = (median_b - median_a) / median_a if median_a > 0 else 0.0
+        p = mann_whitney_p(samples_a, samples_b)
+        verdict = ""
+        if abs(change) >= args.threshold and p < args.alpha:
+            verdict = "mais lento" if change > 0 else "mais rápido"
+            regressions += change > 0
+        print("%-36s %12.4g %12.4g %+7.1f%%  %s" % (name, median_a, median_b, 100.0 * change, verdict))
+
+    for name in sorted(scenes_a.keys() - scenes_b.keys()):
+        print("só em A: %s" % name)
+    for name in sorted(scenes_b.keys() - scenes_a.keys()):
+        print("só em B: %s" % name)
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,170 @@
+#!/usr/bin/env python3
+# Compila uma fase do formato texto para o binário que o jogo mapeia (objects/board/LevelFile.h):
+#     python3 tools/compile_level.py levels/classic.txt classic.lvl
+# Fases enormes para testar o streaming podem ser geradas sem texto:
+#     python3 tools/compile_level.py --generate 100000x400 grande.lvl
+#
+# Formato texto (uma diretiva por linha, '#' comenta até o fim da linha):
+#     block 0.15 0.1        largura e altura dos blocos
+#     spacing 0.02 0.02     espaço entre blocos
+#     origin -0.65 0.8      canto inferior esquerdo do bloco da linha 0, coluna 0
+#     chunk 64              linhas por chunk de streaming
+#     color red 1 0.2 0.2   cor da paleta (até 256), usada pelo nome nas células
+#     row red red*2 . red   uma linha de blocos: cor, cor*resistência (1 a 255) ou '.' vazio
+# As linhas descem a partir da origem; linhas mais curtas são completadas com células vazias.
+
+import argparse
+import random
+import struct
+import sys
+
+MAGIC = 0x4C4B5241  # "ARKL"
+VERSION = 1
+ALIGNMENT = 64
+HEADER = struct.Struct("<8I6f5Q")
+CHUNK = struct.Struct("<2I2f")
+
+
+class Level:
+    def __init__(self):
+        self.block = (0.15, 0.1)
+        self.spacing = (0.02, 0.02)
+        self.origin = (-0.65, 0.8)
+        self.chunk_rows = 64
+        self.palette = []
+        self.rows = []  # [(hitPoints, colorIndex) ou None]
+
+
+def fail(path, number, message):
+    sys.exit("%s:%d: %s" % (path, number, message))
+
+
+def parse(path):
+    level = Level()
+    names = {}
+    with open(path, encoding="utf-8") as file:
+        for number, line in enumerate(file, 1):
+            tokens = line.split("#", 1)[0].split()
+            if not tokens:
+                continue
+            directive, arguments = tokens[0], tokens[1:]
+            try:
+                if directive in ("block", "spacing", "origin") and len(arguments) == 2:
+                    setattr(level, directive, (float(arguments[0]), float(arguments[1])))
+                elif directive == "chunk" and len(arguments) == 1:
+                    level.chunk_rows = int(arguments[0])
+                    if level.chunk_rows <= 0:
+                        fail(path, number, "chunk precisa ser positivo")
+                elif directive == "color" and len(arguments) == 4:
+                    if arguments[0] in names:
+                        fail(path, number, "cor '%s' repetida" % arguments[0])
+                    if len(level.palette) == 256:
+                        fail(path, number, "mais de 256 cores")
+                    names[arguments[0]] = len(level.palette)
+                    level.palette.append(tuple(float(value) for value in arguments[1:]))
+                elif directive == "row":
+                    level.rows.append([parse_cell(path, number, cell, names) for cell in arguments])
+                else:
+                    fail(path, number, "diretiva inválida: %s" % line.strip())
+            except ValueError:
+                fail(path, number, "número inválido: %s" % line.strip())
+    if not level.rows:
+        sys.exit("%s: nenhuma linha de blocos" % path)
+    return level
+
+
+def parse_cell(path, number, cell, names):
+    if cell == ".":
+        return None
+    name, _, hit_points = cell.partition("*")
+    if name not in names:
+        fail(path, number, "cor '%s' não declarada" % name)
+    hit_points = int(hit_points) if hit_points else 1
+    if not 1 <= hit_points <= 255:
+        fail(path, number, "resistência fora de 1..255: %s" % cell)
+    return (hit_points, names[name])
+
+
+def generate(size, seed):
+    rows, cols = (int(value) for value in size.lower().split("x"))
+    generator = random.Random(seed)
+    level = Level()
+    # Mesma área do tabuleiro 7x8 na largura; a altura cresce com as linhas (fase em rolagem)
+    scale = 8.0 / cols
+    level.block = (0.15 * scale, 0.1 * scale)
+    level.spacing = (0.02 * scale, 0.02 * scale)
+    level.palette = [(generator.random(), generator.random(), generator.random()) for _ in range(16)]
+    for row in range(rows):
+        color = row % len(level.palette)
+        level.rows.append([None if generator.random() < 0.1 else (generator.choice((1, 1, 1, 2, 3)), color) for _ in range(cols)])
+    return level
+
+
+def align(offset):
+    return (offset + ALIGNMENT - 1) // ALIGNMENT * ALIGNMENT
+
+
+def write(level, path):
+    if not level.palette:
+        level.palette.append((1.0, 1.0, 1.0))
+    rows = len(level.rows)
+    cols = max(len(row) for row in level.rows)
+    hit_points = bytearray(rows * cols)
+    colors = bytearray(rows * cols)
+    bricks = 0
+    for r, row in enumerate(level.rows):
+        for c, cell in enumerate(row):
+            if cell is not None:
+                hit_points[r * cols + c], colors[r * cols + c] = cell
+                bricks += 1
+
+    pitch_y = level.block[1] + level.spacing[1]
+    chunks = []
+    for first in range(0, rows, level.chunk_rows):
+        count = min(level.chunk_rows, rows - first)
+        top = level.origin[1] - first * pitch_y + level.block[1]
+        bottom = level.origin[1] - (first + count - 1) * pitch_y
+        chunks.append(CHUNK.pack(first, count, top, bottom))
+
+    palette_offset = align(HEADER.size)
+    chunk_offset = align(palette_offset + 12 * len(level.palette))
+    hit_points_offset = align(chunk_offset + CHUNK.size * len(chunks))
+    color_offset = align(hit_points_offset + len(hit_points))
+    file_size = color_offset + len(colors)
+
+    header = HEADER.pack(MAGIC, VERSION, rows, cols, bricks, len(level.palette), level.chunk_rows, len(chunks),
+                         level.block[0], level.block[1], level.spacing[0], level.spacing[1], level.origin[0], level.origin[1],
+                         palette_offset, chunk_offset, hit_points_offset, color_offset, file_size)
+    with open(path, "wb") as file:
+        for offset, data in ((0, header),
+                             (palette_offset, b"".join(struct.pack("<3f", *color) for color in level.palette)),
+                             (chunk_offset, b"".join(chunks)),
+                             (hit_points_offset, hit_points),
+                             (color_offset, colors)):
+            file.write(b"\0" * (offset - file.tell()))
+            file.write(data)
+    print("%s: %dx%d, %d blocos, %d chunks, %d bytes" % (path, rows, cols, bricks, len(chunks), file_size))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compila fases do arkanoide")
+    parser.add_argument("input", nargs="?", help="fase em texto")
+    parser.add_argument("output", help="arquivo .lvl")
+    parser.add_argument("--generate", metavar="LINHASxCOLUNAS", help="gera uma fase aleatória em vez de ler texto")
+    parser.add_argument("--chunk", type=int, help="linhas por chunk (sobrepõe a diretiva)")
+    parser.add_argument("--seed", type=int, default=1)
+    arguments = parser.parse_args()
+
+    if arguments.generate:
+        level = generate(arguments.generate, arguments.seed)
+    elif arguments.input:
+        level = parse(arguments.input)
+    else:
+        parser.error("informe a fase em texto ou --generate")
+    if arguments.chunk:
+        level.chunk_rows = arguments.chunk
+    write(level, arguments.output)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,107 @@
+#!/usr/bin/env python3
+# Gera commons/EmbeddedShaders.h com os shaders de shaders/ embutidos no binário.
+# Rodar a partir de arkanoide/ antes de compilar:
+#     python3 tools/embed_shaders.py
+# O hash é o mesmo FNV-1a de 64 bits do ShaderCache; o header confere os hashes e a
+# estrutura básica de cada shader em tempo de compilação (static_assert).
+
+import glob
+import os
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+OUTPUT = os.path.join(ROOT, "commons", "EmbeddedShaders.h")
+PATTERNS = ["shaders/*.vs", "shaders/*.fs"]
+DELIMITER = "glsl"
+
+
+def fnv1a(data):
+    value = 14695981039346656037
+    for byte in data:
+        value ^= byte
+        value = (value * 1099511628211) & 0xFFFFFFFFFFFFFFFF
+    return value
+
+
+def main():
+    paths = sorted(path for pattern in PATTERNS for path in glob.glob(os.path.join(ROOT, pattern)))
+    entries = []
+    for path in paths:
+        relative = os.path.relpath(path, ROOT).replace(os.sep, "/")
+        with open(path, "rb") as file:
+            data = file.read()
+        source = data.decode("utf-8")
+        if ")" + DELIMITER + "\"" in source:
+            sys.exit("embed_shaders: %s contém o delimitador do raw string" % relative)
+        entries.append((relative, source, fnv1a(data)))
+
+    lines = [
+        "// Gerado por tools/embed_shaders.py a partir de shaders/. Não editar à mão.",
+        "",
+        "#pragma once",
+        "",
+        "#include <cstdint>",
+        "#include <string_view>",
+        "",
+        "struct EmbeddedShader {",
+        "    std::string_view path;",
+        "    std::string_view source;",
+        "    uint64_t hash;",
+        "};",
+        "",
+        "inline constexpr EmbeddedShader embeddedShaders[] = {",
+    ]
+    for relative, source, value in entries:
+        lines.append("    { \"%s\", R\"%s(%s)%s\", 0x%016xull }," % (relative, DELIMITER, source, DELIMITER, value))
+    lines += [
+        "};",
+        "",
+        "constexpr uint64_t embeddedShaderHash(std::string_view source) {",
+        "    uint64_t value = 14695981039346656037ull;",
+        "    for (char c : source) {",
+        "        value ^= static_cast<unsigned char>(c);",
+        "        value *= 1099511628211ull;",
+        "    }",
+        "    return value;",
+        "}",
+        "",
+        "// Validação mínima: diretiva de versão, um main() e chaves/parênteses balanceados",
+        "constexpr bool isValidEmbeddedShader(const EmbeddedShader& shader) {",
+        "    if (shader.source.substr(0, 17) != \"#version 330 core\" || shader.source.find(\"void main()\") == std::string_view::npos) {",
+        "        return false;",
+        "    }",
+        "    int braces = 0;",
+        "    int parentheses = 0;",
+        "    for (char c : shader.source) {",
+        "        braces += (c == '{') - (c == '}');",
+        "        parentheses += (c == '(') - (c == ')');",
+        "        if (braces < 0 || parentheses < 0) {",
+        "            return false;",
+        "        }",
+        "    }",
+        "    return braces == 0 && parentheses == 0 && embeddedShaderHash(shader.source) == shader.hash;",
+        "}",
+        "",
+    ]
+    for index, (relative, _, _) in enumerate(entries):
+        lines.append("static_assert(isValidEmbeddedShader(embeddedShaders[%d]), \"%s inválido ou desatualizado: rode tools/embed_shaders.py\");" % (index, relative))
+    lines += [
+        "",
+        "constexpr const EmbeddedShader* findEmbeddedShader(std::string_view path) {",
+        "    for (const auto& shader : embeddedShaders) {",
+        "        if (shader.path == path) {",
+        "            return &shader;",
+        "        }",
+        "    }",
+        "    return nullptr;",
+        "}",
+        "",
+    ]
+
+    content = "\n".join(lines)
+    with open(OUTPUT, "w", encoding="utf-8", newline="\n") as file:
+        file.write(content)
+
+
+if __name__ == "__main__":
+    main()
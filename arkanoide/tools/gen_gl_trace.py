@@ -0,0 +1,347 @@
+#!/usr/bin/env python3
+# Gera commons/GlTraceFunctions.h a partir de glad/glad.h: para cada ponteiro glad_gl*
+# uma função que mede o tempo no driver e grava a chamada (GlTraceRecord), e o caso
+# correspondente do replay (glTraceReplay). Rodar a partir de arkanoide/ depois de
+# regenerar a glad:
+#     python3 tools/gen_gl_trace.py
+#
+# Ponteiros só podem ir para o trace quando se sabe o tamanho do que apontam; as regras
+# estão nas tabelas abaixo. Funções com um ponteiro de entrada sem regra (ou com GLsync,
+# callbacks, mapeamento de buffer) continuam medidas, mas o replay as pula.
+
+import os
+import re
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+GLAD = os.path.join(ROOT, "glad", "glad.h")
+OUTPUT = os.path.join(ROOT, "commons", "GlTraceFunctions.h")
+
+TYPEDEF = re.compile(r"^typedef (.+?) \(APIENTRYP (PFNGL\w+PROC)\)\((.*)\);$")
+GLAPI = re.compile(r"^GLAPI (PFNGL\w+PROC) glad_(gl\w+);$")
+
+# Parâmetros GLuint que são nomes de objetos e precisam ser traduzidos no replay
+NAME_KINDS = {
+    "buffer": "Buffer",
+    "program": "Program",
+    "shader": "Shader",
+    "array": "VertexArray",
+    "texture": "Texture",
+    "framebuffer": "Framebuffer",
+    "renderbuffer": "Renderbuffer",
+    "sampler": "Sampler",
+    "id": "Query",
+}
+
+# glGen*: (parâmetro de saída, tipo de objeto)
+GEN = {
+    "glGenBuffers": ("buffers", "Buffer"),
+    "glGenVertexArrays": ("arrays", "VertexArray"),
+    "glGenTextures": ("textures", "Texture"),
+    "glGenFramebuffers": ("framebuffers", "Framebuffer"),
+    "glGenRenderbuffers": ("renderbuffers", "Renderbuffer"),
+    "glGenQueries": ("ids", "Query"),
+    "glGenSamplers": ("samplers", "Sampler"),
+    "glGenTransformFeedbacks": ("ids", "TransformFeedback"),
+}
+
+DELETE = {
+    "glDeleteBuffers": ("buffers", "Buffer"),
+    "glDeleteVertexArrays": ("arrays", "VertexArray"),
+    "glDeleteTextures": ("textures", "Texture"),
+    "glDeleteFramebuffers": ("framebuffers", "Framebuffer"),
+    "glDeleteRenderbuffers": ("renderbuffers", "Renderbuffer"),
+    "glDeleteQueries": ("ids", "Query"),
+    "glDeleteSamplers": ("samplers", "Sampler"),
+    "glDeleteTransformFeedbacks": ("ids", "TransformFeedback"),
+}
+
+# Funções que devolvem o nome de um objeto novo
+CREATE = {
+    "glCreateProgram": "Program",
+    "glCreateShader": "Shader",
+}
+
+# Ponteiros de entrada com tamanho conhecido: (função, parâmetro) -> expressão em bytes
+PAYLOAD = {
+    ("glBufferData", "data"): "size",
+    ("glBufferSubData", "data"): "size",
+    ("glTexImage2D", "pixels"): "GlIntercept::textureBytes(width, height, format, type)",
+    ("glTexSubImage2D", "pixels"): "GlIntercept::textureBytes(width, height, format, type)",
+    ("glDrawBuffers", "bufs"): "n * sizeof(GLenum)",
+    ("glClearBufferfv", "value"): "4 * sizeof(GLfloat)",
+    ("glClearBufferiv", "value"): "4 * sizeof(GLint)",
+    ("glClearBufferuiv", "value"): "4 * sizeof(GLuint)",
+    ("glTexParameterfv", "params"): "4 * sizeof(GLfloat)",
+    ("glTexParameteriv", "params"): "4 * sizeof(GLint)",
+    ("glSamplerParameterfv", "param"): "4 * sizeof(GLfloat)",
+    ("glSamplerParameteriv", "param"): "4 * sizeof(GLint)",
+}
+for components in range(1, 5):
+    for suffix, ctype in (("f", "GLfloat"), ("i", "GLint"), ("ui", "GLuint"), ("d", "GLdouble")):
+        PAYLOAD[("glUniform%d%sv" % (components, suffix), "value")] = "count * %d * sizeof(%s)" % (components, ctype)
+    for suffix, ctype in (("f", "GLfloat"), ("s", "GLshort"), ("d", "GLdouble")):
+        PAYLOAD[("glVertexAttrib%d%sv" % (components, suffix), "v")] = "%d * sizeof(%s)" % (components, ctype)
+for shape in ("2", "3", "4", "2x3", "3x2", "2x4", "4x2", "3x4", "4x3"):
+    size = int(shape[0]) * int(shape[-1])
+    for suffix, ctype in (("f", "GLfloat"), ("d", "GLdouble")):
+        PAYLOAD[("glUniformMatrix%s%sv" % (shape, suffix), "value")] = "count * %d * sizeof(%s)" % (size, ctype)
+
+# Strings terminadas em zero
+STRINGS = {
+    ("glGetUniformLocation", "name"),
+    ("glGetAttribLocation", "name"),
+    ("glBindAttribLocation", "name"),
+    ("glBindFragDataLocation", "name"),
+    ("glBindFragDataLocationIndexed", "name"),
+    ("glGetFragDataLocation", "name"),
+    ("glGetFragDataIndex", "name"),
+    ("glGetUniformBlockIndex", "uniformBlockName"),
+    ("glGetSubroutineIndex", "name"),
+    ("glGetSubroutineUniformLocation", "name"),
+}
+
+# Ponteiros que são deslocamentos num buffer ligado (VBO/EBO/indireto), gravados como número
+OFFSETS = {
+    ("glVertexAttribPointer", "pointer"),
+    ("glVertexAttribIPointer", "pointer"),
+    ("glDrawElements", "indices"),
+    ("glDrawElementsInstanced", "indices"),
+    ("glDrawRangeElements", "indices"),
+    ("glDrawElementsBaseVertex", "indices"),
+    ("glDrawRangeElementsBaseVertex", "indices"),
+    ("glDrawElementsInstancedBaseVertex", "indices"),
+    ("glDrawArraysIndirect", "indirect"),
+    ("glDrawElementsIndirect", "indirect"),
+}
+
+# Escrevem ou leem memória do cliente de formas que o trace não captura
+SKIP = {
+    "glMapBuffer", "glMapBufferRange", "glUnmapBuffer", "glFlushMappedBufferRange",
+    "glReadPixels", "glGetTexImage", "glGetCompressedTexImage", "glGetBufferSubData",
+}
+
+
+def parse_params(text):
+    text = text.strip()
+    if text in ("", "void"):
+        return []
+    params = []
+    for part in text.split(","):
+        part = part.strip()
+        match = re.match(r"^(.*?)(\w+)$", part)
+        ctype, name = match.group(1).strip(), match.group(2)
+        params.append((ctype, name))
+    return params
+
+
+def short(function):
+    return function[2:]
+
+
+def plan(function, ret, params):
+    """Uma lista de passos (kind, ...) por parâmetro, ou None se o replay não suporta."""
+    if function in SKIP or ret == "GLsync" or "GLsync" in ret:
+        return None
+    steps = []
+    for ctype, name in params:
+        pointer = "*" in ctype
+        if ctype in ("GLsync", "GLDEBUGPROC", "GLDEBUGPROCARB", "GLDEBUGPROCKHR", "GLDEBUGPROCAMD"):
+            return None
+        if not pointer:
+            kind = None
+            if ctype == "GLuint" and name in NAME_KINDS:
+                kind = NAME_KINDS[name]
+                if kind == "Query" and "TransformFeedback" in function:
+                    kind = "TransformFeedback"
+            steps.append(("value", ctype, name, kind))
+        elif function in GEN and GEN[function][0] == name:
+            steps.append(("gen", ctype, name, GEN[function][1]))
+        elif function in DELETE and DELETE[function][0] == name:
+            steps.append(("delete", ctype, name, DELETE[function][1]))
+        elif (function, name) in PAYLOAD:
+            steps.append(("bytes", ctype, name, PAYLOAD[(function, name)]))
+        elif (function, name) in STRINGS:
+            steps.append(("string", ctype, name, None))
+        elif (function, name) in OFFSETS:
+            steps.append(("offset", ctype, name, None))
+        elif function == "glShaderSource" and name in ("string", "length"):
+            steps.append(("source" if name == "string" else "sourceLength", ctype, name, None))
+        elif not ctype.startswith("const"):
+            steps.append(("output", ctype, name, None))
+        else:
+            return None
+    return steps
+
+
+def count_expr(params, function):
+    # glGen*/glDelete* usam n, glGenSamplers usa count
+    return params[0][1]
+
+
+def wrapper(function, ret, params, steps):
+    name = short(function)
+    args = ", ".join("%s %s" % (ctype, pname) for ctype, pname in params) or ""
+    call = ", ".join(pname for _, pname in params)
+    lines = ["inline %s APIENTRY glTrace_%s(%s) {" % (ret, name, args)]
+    lines.append("    GlTraceRecord traceRecord(GlFunction::%s);" % name)
+    if steps is not None:
+        for kind, ctype, pname, extra in steps:
+            if kind == "value":
+                lines.append("    traceRecord.value(%s);" % pname)
+            elif kind == "delete":
+                lines.append("    traceRecord.names(%s, %s);" % (count_expr(params, function), pname))
+            elif kind == "bytes":
+                lines.append("    traceRecord.bytes(%s, %s ? %s : 0);" % (pname, pname, extra))
+            elif kind == "string":
+                lines.append("    traceRecord.string(%s);" % pname)
+            elif kind == "offset":
+                lines.append("    traceRecord.offset(%s);" % pname)
+            elif kind == "source":
+                lines.append("    traceRecord.shaderSource(count, string, length);")
+    else:
+        lines.append("    traceRecord.unsupported();")
+    lines.append("    uint64_t traceStart = GlTraceRecord::now();")
+    if ret == "void":
+        lines.append("    glTraceReal_%s(%s);" % (name, call))
+    else:
+        lines.append("    %s traceResult = glTraceReal_%s(%s);" % (ret, name, call))
+    if steps is not None:
+        for kind, ctype, pname, extra in steps:
+            if kind == "gen":
+                lines.append("    traceRecord.names(%s, %s);" % (count_expr(params, function), pname))
+        if function in CREATE:
+            lines.append("    traceRecord.value(traceResult);")
+    lines.append("    traceRecord.finish(traceStart);")
+    if ret != "void":
+        lines.append("    return traceResult;")
+    lines.append("}")
+    return lines
+
+
+def replay_case(function, ret, params, steps):
+    name = short(function)
+    lines = ["    case GlFunction::%s: {" % name]
+    args = []
+    for kind, ctype, pname, extra in steps:
+        if kind == "value":
+            if extra:
+                lines.append("        %s %s = reader.name(GlObject::%s, reader.value<%s>());" % (ctype, pname, extra, ctype))
+            else:
+                lines.append("        %s %s = reader.value<%s>();" % (ctype, pname, ctype))
+            args.append(pname)
+        elif kind == "gen":
+            lines.append("        %s %s = static_cast<%s>(reader.scratch());" % (ctype, pname, ctype))
+            args.append(pname)
+        elif kind == "delete":
+            lines.append("        %s %s = reader.names(GlObject::%s, %s);" % (ctype, pname, extra, count_expr(params, function)))
+            args.append(pname)
+        elif kind == "bytes":
+            lines.append("        %s %s = static_cast<%s>(reader.bytes());" % (ctype, pname, ctype))
+            args.append(pname)
+        elif kind == "string":
+            lines.append("        %s %s = reader.string();" % (ctype, pname))
+            args.append(pname)
+        elif kind == "offset":
+            lines.append("        %s %s = reader.offset();" % (ctype, pname))
+            args.append(pname)
+        elif kind == "source":
+            lines.append("        %s %s = reader.shaderSource(count);" % (ctype, pname))
+            args.append(pname)
+        elif kind == "sourceLength":
+            lines.append("        %s %s = reader.shaderSourceLengths();" % (ctype, pname))
+            args.append(pname)
+        elif kind == "output":
+            lines.append("        %s %s = static_cast<%s>(reader.scratch());" % (ctype, pname, ctype))
+            args.append(pname)
+    call = "%s(%s)" % (function, ", ".join(args))
+    if function in CREATE:
+        lines.append("        GLuint result = %s;" % call)
+        lines.append("        reader.mapName(GlObject::%s, reader.value<GLuint>(), result);" % CREATE[function])
+    else:
+        lines.append("        %s;" % call)
+    for kind, ctype, pname, extra in steps:
+        if kind == "gen":
+            lines.append("        reader.mapNames(GlObject::%s, %s, %s);" % (extra, count_expr(params, function), pname))
+    lines.append("        return true;")
+    lines.append("    }")
+    return lines
+
+
+def main():
+    typedefs = {}
+    functions = []
+    with open(GLAD, encoding="utf-8") as file:
+        for line in file:
+            line = line.rstrip("\n")
+            match = TYPEDEF.match(line)
+            if match:
+                typedefs[match.group(2)] = (match.group(1).strip(), parse_params(match.group(3)))
+                continue
+            match = GLAPI.match(line)
+            if match and match.group(1) in typedefs:
+                ret, params = typedefs[match.group(1)]
+                functions.append((match.group(2), match.group(1), ret, params))
+
+    lines = [
+        "// Gerado por tools/gen_gl_trace.py a partir de glad/glad.h. Não editar à mão.",
+        "// Incluído por GlTrace.h, que define GlTraceRecord e GlTraceReader.",
+        "",
+        "#pragma once",
+        "",
+        "namespace GlFunction {",
+        "    enum : uint16_t {",
+    ]
+    for function, _, _, _ in functions:
+        lines.append("        %s," % short(function))
+    lines += [
+        "        Count",
+        "    };",
+        "}",
+        "",
+        "inline const char* const glFunctionNames[] = {",
+    ]
+    for function, _, _, _ in functions:
+        lines.append("    \"%s\"," % function)
+    lines += ["};", ""]
+
+    for function, proc, _, _ in functions:
+        lines.append("inline %s glTraceReal_%s = nullptr;" % (proc, short(function)))
+    lines.append("")
+
+    plans = {}
+    for function, proc, ret, params in functions:
+        plans[function] = plan(function, ret, params)
+        lines += wrapper(function, ret, params, plans[function])
+        lines.append("")
+
+    lines += [
+        "// Troca cada ponteiro carregado pela versão medida; os nulos (fora do contexto) ficam",
+        "inline void glTraceInstallFunctions() {",
+    ]
+    for function, _, _, _ in functions:
+        name = short(function)
+        lines.append("    if (glad_%s) { glTraceReal_%s = glad_%s; glad_%s = glTrace_%s; }" % (function, name, function, function, name))
+    lines += [
+        "}",
+        "",
+        "// Executa uma chamada gravada; false se a função não é suportada pelo replay",
+        "inline bool glTraceReplay(uint16_t function, GlTraceReader& reader) {",
+        "    switch (function) {",
+    ]
+    for function, _, ret, params in functions:
+        if plans[function] is not None:
+            lines += replay_case(function, ret, params, plans[function])
+    lines += [
+        "    default:",
+        "        return false;",
+        "    }",
+        "}",
+        "",
+    ]
+
+    with open(OUTPUT, "w", encoding="utf-8", newline="\n") as file:
+        file.write("\n".join(lines))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,88 @@
+// Reproduz offline um trace gravado com ARKANOIDE_GL_TRACE (commons/GlTrace.h), sem a
+// lógica do jogo, para medir só o custo das chamadas GL no driver.
+//
+//     g++ -I . -o gl_replay tools/gl_replay.cpp glad/glad.c -lglfw -lGL -ldl
+//     ./gl_replay arkanoide.trace [--finish]
+//
+// --finish chama glFinish a cada quadro, incluindo o tempo de GPU na medida.
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <commons/GlTrace.h>
+
+int main(int argc, char** argv) {
+    const char* path = nullptr;
+    bool finish = false;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--finish") == 0) {
+            finish = true;
+        } else {
+            path = argv[i];
+        }
+    }
+    if (!path) {
+        std::cerr << "uso: " << argv[0] << " arquivo.trace [--finish]" << std::endl;
+        return 1;
+    }
+
+    if (!glfwInit()) {
+        std::cerr << "Erro ao inicializar o GLFW" << std::endl;
+        return 1;
+    }
+    // Mesmo contexto do jogo, numa janela invisível
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    GLFWwindow* window = glfwCreateWindow(800, 600, "gl_replay", nullptr, nullptr);
+    if (!window) {
+        std::cerr << "Erro ao criar a janela GLFW" << std::endl;
+        glfwTerminate();
+        return 1;
+    }
+    glfwMakeContextCurrent(window);
+    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+        std::cerr << "Erro ao inicializar o GLAD" << std::endl;
+        glfwTerminate();
+        return 1;
+    }
+
+    GlTracePlayer player;
+    if (!player.load(path)) {
+        std::cerr << "Trace inválido ou gerado com outra glad: " << path << std::endl;
+        glfwTerminate();
+        return 1;
+    }
+
+    std::vector<double> frameTimes;
+    uint64_t start = GlTraceRecord::now();
+    while (true) {
+        uint64_t frameStart = GlTraceRecord::now();
+        if (!player.playFrame()) {
+            break;
+        }
+        if (finish) {
+            glFinish();
+        }
+        frameTimes.push_back((GlTraceRecord::now() - frameStart) / 1e6);
+    }
+    double total = (GlTraceRecord::now() - start) / 1e6;
+
+    std::sort(frameTimes.begin(), frameTimes.end());
+    auto percentile = [&frameTimes](double fraction) {
+        return frameTimes.empty() ? 0.0 : frameTimes[static_cast<size_t>(fraction * (frameTimes.size() - 1) + 0.5)];
+    };
+    std::cout << "quadros: " << player.frameCount() << "  total: " << total << " ms" << std::endl;
+    std::cout << "ms/quadro  p50 " << percentile(0.50) << "  p95 " << percentile(0.95) << "  p99 " << percentile(0.99) << std::endl;
+    std::cout << "chamadas puladas (sem suporte no replay): " << player.skippedCalls() << std::endl << std::endl;
+    GlTrace::report(std::cout, player.stats(), 20);
+
+    glfwTerminate();
+    return 0;
+}